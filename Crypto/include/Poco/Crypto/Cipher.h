@@ -116,6 +116,22 @@ public:
 	virtual std::string decryptString(const std::string& str, Encoding encoding = ENC_NONE);
 		/// Directly decrypt a string that is encoded with the given encoding.
 
+	virtual std::size_t encrypt(const void* input, std::size_t inputLength, void* output, std::size_t outputLength);
+		/// One-shot encryption of a contiguous buffer, without the
+		/// per-chunk round trip through a stream buffer, so OpenSSL
+		/// processes the whole payload in one EVP update. The output
+		/// buffer must provide room for at least
+		/// inputLength + 2*blockSize() bytes.
+		///
+		/// Returns the number of bytes written to the output buffer.
+
+	virtual std::size_t decrypt(const void* input, std::size_t inputLength, void* output, std::size_t outputLength);
+		/// One-shot decryption of a contiguous buffer; the output
+		/// buffer must provide room for at least
+		/// inputLength + 2*blockSize() bytes.
+		///
+		/// Returns the number of bytes written to the output buffer.
+
 	virtual void encrypt(std::istream& source, std::ostream& sink, Encoding encoding = ENC_NONE);
 		/// Directly encrypts an input stream and encodes it using the given encoding.
 
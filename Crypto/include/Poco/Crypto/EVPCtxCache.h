@@ -0,0 +1,68 @@
+//
+// EVPCtxCache.h
+//
+// Library: Crypto
+// Package: CryptoCore
+// Module:  EVPCtxCache
+//
+// Definition of the EVPCtxCache class.
+//
+// Copyright (c) 2008, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Crypto_EVPCtxCache_INCLUDED
+#define Crypto_EVPCtxCache_INCLUDED
+
+
+#include "Poco/Crypto/Crypto.h"
+#include <openssl/evp.h>
+
+
+namespace Poco {
+namespace Crypto {
+
+
+class Crypto_API EVPCtxCache
+	/// A thread-local cache of OpenSSL EVP cipher and digest
+	/// contexts.
+	///
+	/// EVP_CIPHER_CTX_new()/EVP_MD_CTX_new() allocate and free on
+	/// every transform; code that signs or encrypts at a high rate
+	/// (JWT issuance, per-message encryption) spends measurable time
+	/// in those allocations. acquire*() hands out a reset context
+	/// from the calling thread's free list (falling back to a fresh
+	/// allocation), release*() resets and returns it. Since the
+	/// lists are thread-local, no locking is involved.
+{
+public:
+	static EVP_CIPHER_CTX* acquireCipherCtx();
+		/// Returns a clean cipher context, reusing a cached one
+		/// when available.
+
+	static void releaseCipherCtx(EVP_CIPHER_CTX* pCtx);
+		/// Resets the context and returns it to the calling
+		/// thread's cache (or frees it when the cache is full).
+
+	static EVP_MD_CTX* acquireMDCtx();
+		/// Returns a clean digest context, reusing a cached one
+		/// when available.
+
+	static void releaseMDCtx(EVP_MD_CTX* pCtx);
+		/// Resets the context and returns it to the calling
+		/// thread's cache (or frees it when the cache is full).
+
+private:
+	EVPCtxCache();
+	EVPCtxCache(const EVPCtxCache&);
+	EVPCtxCache& operator = (const EVPCtxCache&);
+};
+
+
+} } // namespace Poco::Crypto
+
+
+#endif // Crypto_EVPCtxCache_INCLUDED
@@ -24,6 +24,7 @@
 #include "Poco/SharedPtr.h"
 #include <vector>
 #include <set>
+#include <map>
 #include <istream>
 #include <openssl/ssl.h>
 
@@ -167,6 +168,19 @@ public:
 	static void writePEM(const std::string& pemFileName, const List& list);
 		/// Writes the list of certificates to the specified PEM file.
 
+	static X509Certificate loadCached(const std::string& pemFileName);
+		/// Returns the certificate from the given PEM file, parsing
+		/// it only the first time: subsequent calls for the same
+		/// path reuse the cached parsed certificate (duplicated via
+		/// the OpenSSL object, without re-reading or re-parsing the
+		/// file) until the file's modification time changes.
+		///
+		/// Intended for certificates consulted per connection, such
+		/// as trust-store entries.
+
+	static void flushCache();
+		/// Drops all certificates cached by loadCached().
+
 protected:
 	void load(std::istream& stream);
 		/// Loads the certificate from the given stream. The
@@ -177,7 +191,14 @@ protected:
 		/// certificate must be in PEM format.
 
 	void init();
-		/// Extracts issuer and subject name from the certificate.
+		/// Marks the lazily extracted fields as stale.
+
+	void extractFields() const;
+		/// Extracts issuer name, subject name and serial number
+		/// from the certificate. Called lazily by the accessors:
+		/// certificates that are only handed around (trust-store
+		/// entries consulted per connection) never pay for the
+		/// one-line conversions.
 	
 private:
 	enum
@@ -185,9 +206,12 @@ private:
 		NAME_BUFFER_SIZE = 256
 	};
 	
-	std::string _issuerName;
-	std::string _subjectName;
-	std::string _serialNumber;
+	mutable bool _extracted;
+	mutable std::string _issuerName;
+	mutable std::string _subjectName;
+	mutable std::string _serialNumber;
+	mutable std::map<int, std::string> _issuerFields;
+	mutable std::map<int, std::string> _subjectFields;
 	X509*       _pCert;
 	OpenSSLInitializer _openSSLInitializer;
 };
@@ -209,18 +233,21 @@ inline long X509Certificate::version() const
 
 inline const std::string& X509Certificate::serialNumber() const
 {
+	if (!_extracted) extractFields();
 	return _serialNumber;
 }
 
 
 inline const std::string& X509Certificate::issuerName() const
 {
+	if (!_extracted) extractFields();
 	return _issuerName;
 }
 
 
 inline const std::string& X509Certificate::subjectName() const
 {
+	if (!_extracted) extractFields();
 	return _subjectName;
 }
 
@@ -15,6 +15,7 @@
 #include "Poco/Crypto/Cipher.h"
 #include "Poco/Crypto/CryptoStream.h"
 #include "Poco/Crypto/CryptoTransform.h"
+#include "Poco/SharedPtr.h"
 #include "Poco/Base64Encoder.h"
 #include "Poco/Base64Decoder.h"
 #include "Poco/HexBinaryEncoder.h"
@@ -60,6 +61,40 @@ std::string Cipher::decryptString(const std::string& str, Encoding encoding)
 }
 
 
+std::size_t Cipher::encrypt(const void* input, std::size_t inputLength, void* output, std::size_t outputLength)
+{
+	Poco::SharedPtr<CryptoTransform> pTransform = createEncryptor();
+	poco_assert (outputLength >= inputLength + 2*pTransform->blockSize());
+
+	std::streamsize n = pTransform->transform(
+		reinterpret_cast<const unsigned char*>(input),
+		static_cast<std::streamsize>(inputLength),
+		reinterpret_cast<unsigned char*>(output),
+		static_cast<std::streamsize>(outputLength));
+	n += pTransform->finalize(
+		reinterpret_cast<unsigned char*>(output) + n,
+		static_cast<std::streamsize>(outputLength) - n);
+	return static_cast<std::size_t>(n);
+}
+
+
+std::size_t Cipher::decrypt(const void* input, std::size_t inputLength, void* output, std::size_t outputLength)
+{
+	Poco::SharedPtr<CryptoTransform> pTransform = createDecryptor();
+	poco_assert (outputLength >= inputLength + 2*pTransform->blockSize());
+
+	std::streamsize n = pTransform->transform(
+		reinterpret_cast<const unsigned char*>(input),
+		static_cast<std::streamsize>(inputLength),
+		reinterpret_cast<unsigned char*>(output),
+		static_cast<std::streamsize>(outputLength));
+	n += pTransform->finalize(
+		reinterpret_cast<unsigned char*>(output) + n,
+		static_cast<std::streamsize>(outputLength) - n);
+	return static_cast<std::size_t>(n);
+}
+
+
 void Cipher::encrypt(std::istream& source, std::ostream& sink, Encoding encoding)
 {
 	CryptoInputStream encryptor(source, createEncryptor());
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Crypto/CipherImpl.h"
+#include "Poco/Crypto/EVPCtxCache.h"
 #include "Poco/Crypto/CryptoTransform.h"
 #include "Poco/Exception.h"
 #include "Poco/Buffer.h"
@@ -97,7 +98,7 @@ namespace
 		_iv(iv)
 	{
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
-		_pContext = EVP_CIPHER_CTX_new();
+		_pContext = EVPCtxCache::acquireCipherCtx();
 		EVP_CipherInit(
 			_pContext,
 			_pCipher,
@@ -130,8 +131,7 @@ namespace
 	CryptoTransformImpl::~CryptoTransformImpl()
 	{
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
-		EVP_CIPHER_CTX_cleanup(_pContext);
-		EVP_CIPHER_CTX_free(_pContext);
+		EVPCtxCache::releaseCipherCtx(_pContext);
 #else
 		EVP_CIPHER_CTX_cleanup(&_context);
 #endif
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Crypto/DigestEngine.h"
+#include "Poco/Crypto/EVPCtxCache.h"
 #include "Poco/Crypto/CryptoException.h"
 
 
@@ -22,7 +23,7 @@ namespace Crypto {
 
 DigestEngine::DigestEngine(const std::string& name):
 	_name(name),
-	_pContext(EVP_MD_CTX_create())
+	_pContext(EVPCtxCache::acquireMDCtx())
 {
 	const EVP_MD* md = EVP_get_digestbyname(_name.c_str());
 	if (!md) throw OpenSSLException(_name);
@@ -32,7 +33,7 @@ DigestEngine::DigestEngine(const std::string& name):
 	
 DigestEngine::~DigestEngine()
 {
-	EVP_MD_CTX_destroy(_pContext);
+	EVPCtxCache::releaseMDCtx(_pContext);
 }
 
 int DigestEngine::nid() const
@@ -49,8 +50,7 @@ std::size_t DigestEngine::digestLength() const
 void DigestEngine::reset()
 {
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L && !defined(LIBRESSL_VERSION_NUMBER)
-	EVP_MD_CTX_free(_pContext);
-	_pContext = EVP_MD_CTX_create();
+	EVP_MD_CTX_reset(_pContext);
 #else
 	EVP_MD_CTX_cleanup(_pContext);
 #endif
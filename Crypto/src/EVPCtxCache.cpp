@@ -0,0 +1,107 @@
+//
+// EVPCtxCache.cpp
+//
+// Library: Crypto
+// Package: CryptoCore
+// Module:  EVPCtxCache
+//
+// Copyright (c) 2008, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Crypto/EVPCtxCache.h"
+#include <vector>
+
+
+namespace Poco {
+namespace Crypto {
+
+
+namespace
+{
+	const std::size_t MAX_CACHED_CONTEXTS = 8;
+
+
+	template <typename Ctx, void (*freeCtx)(Ctx*)>
+	class CtxFreeList
+		/// Owns the cached contexts of one thread; frees whatever
+		/// is still cached when the thread exits.
+	{
+	public:
+		~CtxFreeList()
+		{
+			for (typename std::vector<Ctx*>::iterator it = _contexts.begin(); it != _contexts.end(); ++it)
+				freeCtx(*it);
+		}
+
+		Ctx* pop()
+		{
+			if (_contexts.empty()) return 0;
+			Ctx* pCtx = _contexts.back();
+			_contexts.pop_back();
+			return pCtx;
+		}
+
+		bool push(Ctx* pCtx)
+		{
+			if (_contexts.size() >= MAX_CACHED_CONTEXTS) return false;
+			_contexts.push_back(pCtx);
+			return true;
+		}
+
+	private:
+		std::vector<Ctx*> _contexts;
+	};
+
+
+	CtxFreeList<EVP_CIPHER_CTX, EVP_CIPHER_CTX_free>& cipherFreeList()
+	{
+		static thread_local CtxFreeList<EVP_CIPHER_CTX, EVP_CIPHER_CTX_free> freeList;
+		return freeList;
+	}
+
+
+	CtxFreeList<EVP_MD_CTX, EVP_MD_CTX_free>& mdFreeList()
+	{
+		static thread_local CtxFreeList<EVP_MD_CTX, EVP_MD_CTX_free> freeList;
+		return freeList;
+	}
+}
+
+
+EVP_CIPHER_CTX* EVPCtxCache::acquireCipherCtx()
+{
+	EVP_CIPHER_CTX* pCtx = cipherFreeList().pop();
+	if (!pCtx) pCtx = EVP_CIPHER_CTX_new();
+	return pCtx;
+}
+
+
+void EVPCtxCache::releaseCipherCtx(EVP_CIPHER_CTX* pCtx)
+{
+	if (!pCtx) return;
+	EVP_CIPHER_CTX_reset(pCtx);
+	if (!cipherFreeList().push(pCtx)) EVP_CIPHER_CTX_free(pCtx);
+}
+
+
+EVP_MD_CTX* EVPCtxCache::acquireMDCtx()
+{
+	EVP_MD_CTX* pCtx = mdFreeList().pop();
+	if (!pCtx) pCtx = EVP_MD_CTX_new();
+	return pCtx;
+}
+
+
+void EVPCtxCache::releaseMDCtx(EVP_MD_CTX* pCtx)
+{
+	if (!pCtx) return;
+	EVP_MD_CTX_reset(pCtx);
+	if (!mdFreeList().push(pCtx)) EVP_MD_CTX_free(pCtx);
+}
+
+
+} } // namespace Poco::Crypto
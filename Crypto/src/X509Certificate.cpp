@@ -13,6 +13,9 @@
 
 
 #include "Poco/Crypto/X509Certificate.h"
+#include "Poco/File.h"
+#include "Poco/Mutex.h"
+#include "Poco/SingletonHolder.h"
 #include "Poco/Crypto/CryptoException.h"
 #include "Poco/StreamCopier.h"
 #include "Poco/String.h"
@@ -34,6 +37,7 @@ namespace Crypto {
 
 
 X509Certificate::X509Certificate(std::istream& istr):
+	_extracted(false),
 	_pCert(0)
 {
 	load(istr);
@@ -41,6 +45,7 @@ X509Certificate::X509Certificate(std::istream& istr):
 
 
 X509Certificate::X509Certificate(const std::string& path):
+	_extracted(false),
 	_pCert(0)
 {
 	load(path);
@@ -48,6 +53,7 @@ X509Certificate::X509Certificate(const std::string& path):
 
 
 X509Certificate::X509Certificate(X509* pCert):
+	_extracted(false),
 	_pCert(pCert)
 {
 	poco_check_ptr(_pCert);
@@ -57,6 +63,7 @@ X509Certificate::X509Certificate(X509* pCert):
 
 
 X509Certificate::X509Certificate(X509* pCert, bool shared):
+	_extracted(false),
 	_pCert(pCert)
 {
 	poco_check_ptr(_pCert);
@@ -75,9 +82,12 @@ X509Certificate::X509Certificate(X509* pCert, bool shared):
 
 
 X509Certificate::X509Certificate(const X509Certificate& cert):
+	_extracted(cert._extracted),
 	_issuerName(cert._issuerName),
 	_subjectName(cert._subjectName),
 	_serialNumber(cert._serialNumber),
+	_issuerFields(cert._issuerFields),
+	_subjectFields(cert._subjectFields),
 	_pCert(cert._pCert)
 {
 	_pCert = X509_dup(_pCert);
@@ -95,9 +105,12 @@ X509Certificate& X509Certificate::operator = (const X509Certificate& cert)
 void X509Certificate::swap(X509Certificate& cert)
 {
 	using std::swap;
+	swap(cert._extracted, _extracted);
 	swap(cert._issuerName, _issuerName);
 	swap(cert._subjectName, _subjectName);
 	swap(cert._serialNumber, _serialNumber);
+	swap(cert._issuerFields, _issuerFields);
+	swap(cert._subjectFields, _subjectFields);
 	swap(cert._pCert, _pCert);
 }
 
@@ -195,6 +208,14 @@ void X509Certificate::save(const std::string& path) const
 
 
 void X509Certificate::init()
+{
+	_extracted = false;
+	_issuerFields.clear();
+	_subjectFields.clear();
+}
+
+
+void X509Certificate::extractFields() const
 {
 	char buffer[NAME_BUFFER_SIZE];
 	X509_NAME_oneline(X509_get_issuer_name(_pCert), buffer, sizeof(buffer));
@@ -212,6 +233,7 @@ void X509Certificate::init()
 		}
 		BN_free(pBN);
 	}
+	_extracted = true;
 }
 
 
@@ -223,25 +245,35 @@ std::string X509Certificate::commonName() const
 
 std::string X509Certificate::issuerName(NID nid) const
 {
+	std::map<int, std::string>::const_iterator it = _issuerFields.find(nid);
+	if (it != _issuerFields.end()) return it->second;
+
+	std::string value;
 	if (X509_NAME* issuer = X509_get_issuer_name(_pCert))
 	{
 		char buffer[NAME_BUFFER_SIZE];
 		if (X509_NAME_get_text_by_NID(issuer, nid, buffer, sizeof(buffer)) >= 0)
-			return std::string(buffer);
+			value = buffer;
 	}
-	return std::string();
+	_issuerFields[nid] = value;
+	return value;
 }
 
 
 std::string X509Certificate::subjectName(NID nid) const
 {
+	std::map<int, std::string>::const_iterator it = _subjectFields.find(nid);
+	if (it != _subjectFields.end()) return it->second;
+
+	std::string value;
 	if (X509_NAME* subj = X509_get_subject_name(_pCert))
 	{
 		char buffer[NAME_BUFFER_SIZE];
 		if (X509_NAME_get_text_by_NID(subj, nid, buffer, sizeof(buffer)) >= 0)
-			return std::string(buffer);
+			value = buffer;
 	}
-	return std::string();
+	_subjectFields[nid] = value;
+	return value;
 }
 
 
@@ -397,4 +429,49 @@ void X509Certificate::printAll(std::ostream& out) const
 }
 
 
+
+namespace
+{
+	struct CachedCertificate
+	{
+		Poco::Timestamp lastModified;
+		Poco::SharedPtr<X509Certificate> pCertificate;
+	};
+
+	struct CertificateCache
+	{
+		Poco::FastMutex mutex;
+		std::map<std::string, CachedCertificate> entries;
+	};
+
+	Poco::SingletonHolder<CertificateCache> certificateCache;
+}
+
+
+X509Certificate X509Certificate::loadCached(const std::string& pemFileName)
+{
+	Poco::Timestamp lastModified = Poco::File(pemFileName).getLastModified();
+	CertificateCache& cache = *certificateCache.get();
+
+	Poco::FastMutex::ScopedLock lock(cache.mutex);
+	std::map<std::string, CachedCertificate>::iterator it = cache.entries.find(pemFileName);
+	if (it == cache.entries.end() || it->second.lastModified != lastModified)
+	{
+		CachedCertificate entry;
+		entry.lastModified = lastModified;
+		entry.pCertificate = new X509Certificate(pemFileName);
+		it = cache.entries.insert(std::make_pair(pemFileName, entry)).first;
+	}
+	return *it->second.pCertificate;
+}
+
+
+void X509Certificate::flushCache()
+{
+	CertificateCache& cache = *certificateCache.get();
+	Poco::FastMutex::ScopedLock lock(cache.mutex);
+	cache.entries.clear();
+}
+
+
 } } // namespace Poco::Crypto
@@ -175,6 +175,7 @@ public:
 		/// Exact behavior is determined by the TStrategy.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
+		_pSnapshot = 0;
 		_strategy.add(aDelegate);
 	}
 
@@ -184,6 +185,7 @@ public:
 		/// If the delegate is not found, this function does nothing.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
+		_pSnapshot = 0;
 		_strategy.remove(aDelegate);
 	}
 
@@ -196,6 +198,7 @@ public:
 		/// remove() to remove the delegate.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
+		_pSnapshot = 0;
 		return _strategy.add(aDelegate);
 	}
 
@@ -206,6 +209,7 @@ public:
 		/// If the delegate is not found, this function does nothing.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
+		_pSnapshot = 0;
 		_strategy.remove(delegateHandle);
 	}
 
@@ -232,15 +236,19 @@ public:
 		/// the notify method is immediately aborted and the exception is propagated
 		/// to the caller.
 	{
-		Poco::ScopedLockWithUnlock<TMutex> lock(_mutex);
-		if (!_enabled) return;
-
 		// thread-safeness:
-		// copy should be faster and safer than blocking until
-		// execution ends
-		TStrategy strategy(_strategy);
-		lock.unlock();
-		strategy.notify(pSender, args);
+		// invoke an immutable snapshot of the delegate list; the
+		// snapshot is only rebuilt after the list has changed, so
+		// steady-state notification does not copy the delegates --
+		// it just takes a reference under the lock
+		SharedPtr<TStrategy> pStrategy;
+		{
+			typename TMutex::ScopedLock lock(_mutex);
+			if (!_enabled) return;
+			if (!_pSnapshot) _pSnapshot = new TStrategy(_strategy);
+			pStrategy = _pSnapshot;
+		}
+		pStrategy->notify(pSender, args);
 	}
 
 	bool hasDelegates() const
@@ -271,7 +279,8 @@ public:
 			// make a copy of the strategy here to guarantee that
 			// between notifyAsync and the execution of the method no changes can occur
 
-			params.ptrStrat = SharedPtr<TStrategy>(new TStrategy(_strategy));
+			if (!_pSnapshot) _pSnapshot = new TStrategy(_strategy);
+			params.ptrStrat = _pSnapshot;
 			params.enabled  = _enabled;
 		}
 		ActiveResult<TArgs> result = _executeAsync(params);
@@ -304,6 +313,7 @@ public:
 		/// Removes all delegates.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
+		_pSnapshot = 0;
 		_strategy.clear();
 	}
 
@@ -344,6 +354,7 @@ protected:
 	}
 
 	TStrategy _strategy; /// The strategy used to notify observers.
+	mutable SharedPtr<TStrategy> _pSnapshot; /// Immutable snapshot of the strategy, invalidated on change.
 	bool      _enabled;  /// Stores if an event is enabled. Notifies on disabled events have no effect
 	                     /// but it is possible to change the observers.
 	mutable TMutex _mutex;
@@ -383,6 +394,7 @@ public:
 		/// Exact behavior is determined by the TStrategy.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
+		_pSnapshot = 0;
 		_strategy.add(aDelegate);
 	}
 
@@ -392,6 +404,7 @@ public:
 		/// If the delegate is not found, this function does nothing.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
+		_pSnapshot = 0;
 		_strategy.remove(aDelegate);
 	}
 
@@ -404,6 +417,7 @@ public:
 		/// remove() to remove the delegate.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
+		_pSnapshot = 0;
 		return _strategy.add(aDelegate);
 	}
 
@@ -414,6 +428,7 @@ public:
 		/// If the delegate is not found, this function does nothing.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
+		_pSnapshot = 0;
 		_strategy.remove(delegateHandle);
 	}
 
@@ -474,7 +489,8 @@ public:
 			// make a copy of the strategy here to guarantee that
 			// between notifyAsync and the execution of the method no changes can occur
 
-			params.ptrStrat = SharedPtr<TStrategy>(new TStrategy(_strategy));
+			if (!_pSnapshot) _pSnapshot = new TStrategy(_strategy);
+			params.ptrStrat = _pSnapshot;
 			params.enabled  = _enabled;
 		}
 		ActiveResult<void> result = _executeAsync(params);
@@ -506,6 +522,7 @@ public:
 		/// Removes all delegates.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
+		_pSnapshot = 0;
 		_strategy.clear();
 	}
 
@@ -544,6 +561,7 @@ protected:
 	}
 
 	TStrategy _strategy; /// The strategy used to notify observers.
+	mutable SharedPtr<TStrategy> _pSnapshot; /// Immutable snapshot of the strategy, invalidated on change.
 	bool      _enabled;  /// Stores if an event is enabled. Notifies on disabled events have no effect
 	                     /// but it is possible to change the observers.
 	mutable TMutex _mutex;
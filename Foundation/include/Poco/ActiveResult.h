@@ -21,6 +21,7 @@
 #include "Poco/Foundation.h"
 #include "Poco/Mutex.h"
 #include "Poco/Event.h"
+#include <atomic>
 #include "Poco/RefCountedObject.h"
 #include "Poco/Exception.h"
 #include <algorithm>
@@ -41,7 +42,8 @@ public:
 	ActiveResultHolder():
 		_pData(0),
 		_pExc(0),
-		_event(Event::EVENT_MANUALRESET)
+		_event(Event::EVENT_MANUALRESET),
+		_done(false)
 		/// Creates an ActiveResultHolder.
 	{
 	}
@@ -62,6 +64,8 @@ public:
 	void wait()
 		/// Pauses the caller until the result becomes available.
 	{
+		// fast path: completed results skip the event system call
+		if (_done.load(std::memory_order_acquire)) return;
 		_event.wait();
 	}
 	
@@ -70,6 +74,7 @@ public:
 		/// become available. Returns true if the result became
 		/// available, false otherwise.
 	{
+		if (_done.load(std::memory_order_acquire)) return true;
 		return _event.tryWait(milliseconds);
 	}
 	
@@ -78,12 +83,14 @@ public:
 		/// become available. Throws a TimeoutException if the
 		/// result did not became available.
 	{
+		if (_done.load(std::memory_order_acquire)) return;
 		_event.wait(milliseconds);
 	}
 	
 	void notify()
 		/// Notifies the invoking thread that the result became available.
 	{
+		_done.store(true, std::memory_order_release);
 		_event.set();
 	}
 	
@@ -137,6 +144,7 @@ private:
 	ResultType* _pData;
 	Exception*  _pExc;
 	Event       _event;
+	std::atomic<bool> _done;
 };
 
 
@@ -147,7 +155,8 @@ class ActiveResultHolder<void>: public RefCountedObject
 public:
 	ActiveResultHolder():
 		_pExc(0),
-		_event(Event::EVENT_MANUALRESET)
+		_event(Event::EVENT_MANUALRESET),
+		_done(false)
 		/// Creates an ActiveResultHolder.
 	{
 	}
@@ -155,6 +164,8 @@ public:
 	void wait()
 		/// Pauses the caller until the result becomes available.
 	{
+		// fast path: completed results skip the event system call
+		if (_done.load(std::memory_order_acquire)) return;
 		_event.wait();
 	}
 	
@@ -163,6 +174,7 @@ public:
 		/// become available. Returns true if the result became
 		/// available, false otherwise.
 	{
+		if (_done.load(std::memory_order_acquire)) return true;
 		return _event.tryWait(milliseconds);
 	}
 	
@@ -171,12 +183,14 @@ public:
 		/// become available. Throws a TimeoutException if the
 		/// result did not became available.
 	{
+		if (_done.load(std::memory_order_acquire)) return;
 		_event.wait(milliseconds);
 	}
 	
 	void notify()
 		/// Notifies the invoking thread that the result became available.
 	{
+		_done.store(true, std::memory_order_release);
 		_event.set();
 	}
 	
@@ -228,6 +242,7 @@ protected:
 private:
 	Exception*  _pExc;
 	Event       _event;
+	std::atomic<bool> _done;
 };
 
 
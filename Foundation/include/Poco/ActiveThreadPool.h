@@ -0,0 +1,151 @@
+//
+// ActiveThreadPool.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  ActiveThreadPool
+//
+// Definition of the ActiveThreadPool class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ActiveThreadPool_INCLUDED
+#define Foundation_ActiveThreadPool_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Thread.h"
+#include "Poco/Mutex.h"
+#include "Poco/Event.h"
+#include "Poco/AtomicCounter.h"
+#include <vector>
+
+
+namespace Poco {
+
+
+class Runnable;
+class ActiveThreadPoolWorker;
+
+
+class Foundation_API ActiveThreadPool
+	/// A thread pool that dispatches queued Runnable targets to a
+	/// fixed set of worker threads, using one task queue per worker
+	/// and work stealing between workers.
+	///
+	/// Unlike ThreadPool, which dedicates a pooled thread to every
+	/// started target until the target returns, an ActiveThreadPool
+	/// queues targets and executes them as workers become free.
+	/// start() therefore never throws NoThreadAvailableException.
+	/// Submission only touches the queue of one worker, chosen
+	/// round-robin, so task dispatch from many producer threads
+	/// scales with the number of workers instead of contending
+	/// on a single pool-wide mutex.
+	///
+	/// Every worker takes targets from its own queue in submission
+	/// order. A worker that runs out of work steals the most
+	/// recently queued target from another worker's queue, keeping
+	/// all workers busy under uneven producer load.
+	///
+	/// Since targets share the fixed set of worker threads, they
+	/// should not block indefinitely, or the pool may starve.
+	/// Long-running or blocking targets belong in a ThreadPool.
+{
+public:
+	ActiveThreadPool(int capacity = 0, int stackSize = POCO_THREAD_STACK_SIZE);
+		/// Creates an ActiveThreadPool with the given number of
+		/// worker threads. If capacity is 0 (the default), one
+		/// worker per processor core is created.
+
+	ActiveThreadPool(const std::string& name, int capacity = 0, int stackSize = POCO_THREAD_STACK_SIZE);
+		/// Creates an ActiveThreadPool with the given name and
+		/// number of worker threads. If capacity is 0 (the
+		/// default), one worker per processor core is created.
+
+	~ActiveThreadPool();
+		/// Stops all worker threads. Queued targets that have not
+		/// been started are discarded.
+
+	int capacity() const;
+		/// Returns the number of worker threads.
+
+	int pending() const;
+		/// Returns the number of targets queued or running.
+
+	void start(Runnable& target);
+		/// Queues the target for execution on one of the worker
+		/// threads.
+		///
+		/// The target must remain valid until its run() method
+		/// has completed.
+
+	void joinAll();
+		/// Waits until all queued and running targets have
+		/// completed. New targets may be started afterwards.
+
+	void stopAll();
+		/// Stops all worker threads and waits for their completion.
+		/// Queued targets that have not been started are discarded.
+		///
+		/// Once stopAll() has been called, no new targets may
+		/// be started.
+
+	const std::string& name() const;
+		/// Returns the name of the thread pool,
+		/// or an empty string if no name has been
+		/// specified in the constructor.
+
+	static ActiveThreadPool& defaultPool();
+		/// Returns a reference to the default
+		/// ActiveThreadPool.
+
+protected:
+	Runnable* stealWork(ActiveThreadPoolWorker* pThief);
+		/// Called by an idle worker to take a target from
+		/// another worker's queue. Returns a null pointer
+		/// if no work can be stolen.
+
+	void taskCompleted();
+
+private:
+	ActiveThreadPool(const ActiveThreadPool& pool);
+	ActiveThreadPool& operator = (const ActiveThreadPool& pool);
+
+	void init(int capacity, int stackSize);
+
+	typedef std::vector<ActiveThreadPoolWorker*> WorkerVec;
+
+	std::string _name;
+	WorkerVec _workers;
+	AtomicCounter _nextWorker;
+	AtomicCounter _pendingCount;
+	Event _idleEvent;
+
+	friend class ActiveThreadPoolWorker;
+};
+
+
+//
+// inlines
+//
+inline const std::string& ActiveThreadPool::name() const
+{
+	return _name;
+}
+
+
+inline int ActiveThreadPool::pending() const
+{
+	return _pendingCount.value();
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ActiveThreadPool_INCLUDED
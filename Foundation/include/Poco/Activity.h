@@ -21,6 +21,7 @@
 #include "Poco/Foundation.h"
 #include "Poco/RunnableAdapter.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/CancellationToken.h"
 #include "Poco/Event.h"
 #include "Poco/Mutex.h"
 
@@ -117,6 +118,7 @@ public:
 		{
 			_done.reset();
 			_stopped = false;
+			_cancelSource.reset();
 			_running = true;
 			try
 			{
@@ -131,10 +133,22 @@ public:
 	}
 	
 	void stop()
-		/// Requests to stop the activity.
+		/// Requests to stop the activity. In addition to setting
+		/// the isStopped() flag, the activity's cancellation token
+		/// is cancelled, so blocking operations observing it are
+		/// interrupted instead of running into their timeouts.
 	{
 		FastMutex::ScopedLock lock(_mutex);
 		_stopped = true;
+		_cancelSource.cancel();
+	}
+
+	CancellationToken cancellationToken() const
+		/// Returns a token that is cancelled when the activity is
+		/// requested to stop; pass it into blocking operations run
+		/// by the activity so stop() interrupts them promptly.
+	{
+		return _cancelSource.token();
 	}
 	
 	void wait()
@@ -193,6 +207,7 @@ private:
 
 	C*                  _pOwner;
 	RunnableAdapterType _runnable;
+	CancellationTokenSource _cancelSource;
 	std::atomic<bool>   _stopped;
 	std::atomic<bool>   _running;
 	Event               _done;
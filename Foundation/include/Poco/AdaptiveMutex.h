@@ -0,0 +1,163 @@
+//
+// AdaptiveMutex.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  AdaptiveMutex
+//
+// Definition of the AdaptiveMutex class.
+//
+// Copyright (c) 2004-2008, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_AdaptiveMutex_INCLUDED
+#define Foundation_AdaptiveMutex_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Mutex.h"
+#include "Poco/ScopedLock.h"
+#if defined(POCO_ENABLE_MUTEX_STATS)
+#include "Poco/Clock.h"
+#include <atomic>
+#endif
+
+
+namespace Poco {
+
+
+class AdaptiveMutex
+	/// A mutex that spins briefly before parking.
+	///
+	/// FastMutex maps straight to the platform mutex; when a
+	/// critical section lasts microseconds, going to sleep in the
+	/// kernel on contention costs more than the wait itself. An
+	/// AdaptiveMutex retries tryLock() in a bounded exponential
+	/// backoff loop first and only falls back to the blocking
+	/// (parking) lock when the spin budget is exhausted. The
+	/// ScopedLock API is the same as FastMutex's:
+	///
+	///     AdaptiveMutex::ScopedLock lock(_mutex);
+	///
+	/// With POCO_ENABLE_MUTEX_STATS defined, every AdaptiveMutex
+	/// additionally counts acquisitions, contended acquisitions and
+	/// total wait time, so the hottest locks can be found
+	/// empirically; without the flag, the counters (and their
+	/// overhead) do not exist.
+{
+public:
+	typedef Poco::ScopedLock<AdaptiveMutex> ScopedLock;
+
+	enum
+	{
+		MAX_SPINS = 4096 /// total spin budget before parking
+	};
+
+	AdaptiveMutex()
+	{
+	}
+
+	~AdaptiveMutex()
+	{
+	}
+
+	void lock()
+		/// Locks the mutex, spinning briefly before blocking.
+	{
+#if defined(POCO_ENABLE_MUTEX_STATS)
+		_acquisitions.fetch_add(1, std::memory_order_relaxed);
+#endif
+		if (_mutex.tryLock()) return;
+#if defined(POCO_ENABLE_MUTEX_STATS)
+		_contended.fetch_add(1, std::memory_order_relaxed);
+		Poco::Clock started;
+#endif
+		int spins = 1;
+		while (spins < MAX_SPINS)
+		{
+			for (int i = 0; i < spins; i++)
+				yieldProcessor();
+			if (_mutex.tryLock())
+			{
+#if defined(POCO_ENABLE_MUTEX_STATS)
+				_waitMicroseconds.fetch_add(started.elapsed(), std::memory_order_relaxed);
+#endif
+				return;
+			}
+			spins *= 2;
+		}
+		_mutex.lock();
+#if defined(POCO_ENABLE_MUTEX_STATS)
+		_waitMicroseconds.fetch_add(started.elapsed(), std::memory_order_relaxed);
+#endif
+	}
+
+	bool tryLock()
+		/// Tries to lock the mutex; returns immediately.
+	{
+#if defined(POCO_ENABLE_MUTEX_STATS)
+		_acquisitions.fetch_add(1, std::memory_order_relaxed);
+#endif
+		return _mutex.tryLock();
+	}
+
+	void unlock()
+		/// Unlocks the mutex.
+	{
+		_mutex.unlock();
+	}
+
+#if defined(POCO_ENABLE_MUTEX_STATS)
+	Poco::UInt64 acquisitions() const
+		/// Returns the number of lock()/tryLock() calls.
+	{
+		return _acquisitions.load(std::memory_order_relaxed);
+	}
+
+	Poco::UInt64 contendedAcquisitions() const
+		/// Returns the number of lock() calls that found the mutex
+		/// held and had to spin or park.
+	{
+		return _contended.load(std::memory_order_relaxed);
+	}
+
+	Poco::Int64 totalWaitMicroseconds() const
+		/// Returns the accumulated time lock() callers spent
+		/// waiting (spinning or parked).
+	{
+		return _waitMicroseconds.load(std::memory_order_relaxed);
+	}
+#endif
+
+private:
+	AdaptiveMutex(const AdaptiveMutex&);
+	AdaptiveMutex& operator = (const AdaptiveMutex&);
+
+	static void yieldProcessor()
+	{
+#if defined(_MSC_VER)
+		YieldProcessor();
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		__builtin_ia32_pause();
+#elif defined(__GNUC__) && (defined(__aarch64__) || defined(__arm__))
+		__asm__ __volatile__("yield");
+#endif
+	}
+
+	FastMutex _mutex;
+#if defined(POCO_ENABLE_MUTEX_STATS)
+	std::atomic<Poco::UInt64> _acquisitions{0};
+	std::atomic<Poco::UInt64> _contended{0};
+	std::atomic<Poco::Int64> _waitMicroseconds{0};
+#endif
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_AdaptiveMutex_INCLUDED
@@ -180,6 +180,15 @@ public:
 			construct(other);
 	}
 
+	Any(Any&& other)
+		/// Move constructor. Heap-held content is taken over without
+		/// copying; locally held content is copied (its dynamic type
+		/// is unknown here, so it cannot be moved). The moved-from
+		/// Any is empty afterwards.
+	{
+		moveFrom(other);
+	}
+
 	~Any()
 		/// Destructor. If Any is locally held, calls ValueHolder destructor;
 		/// otherwise, deletes the placeholder from the heap.
@@ -247,6 +256,24 @@ public:
 
 		return *this;
 	}
+
+	Any& operator = (Any&& rhs)
+		/// Move assignment operator; see the move constructor.
+	{
+		if (this != &rhs)
+		{
+			if (!empty())
+			{
+				if (_valueHolder.isLocal())
+					destruct();
+				else
+					delete content();
+				_valueHolder.erase();
+			}
+			moveFrom(rhs);
+		}
+		return *this;
+	}
 	
 	bool empty() const
 		/// Returns true if the Any is empty.
@@ -331,6 +358,25 @@ private:
 		}
 	}
 
+	void moveFrom(Any& other)
+		/// Takes over the other Any's content; the caller must have
+		/// emptied *this beforehand.
+	{
+		if (other.empty()) return;
+		if (other._valueHolder.isLocal())
+		{
+			construct(other);
+			other.destruct();
+			other._valueHolder.erase();
+		}
+		else
+		{
+			_valueHolder.pHolder = other._valueHolder.pHolder;
+			_valueHolder.setLocal(false);
+			other._valueHolder.erase();
+		}
+	}
+
 	void construct(const Any& other)
 	{
 		if (!other.empty())
@@ -372,6 +418,14 @@ private:
 	{
 	}
 
+	Any(Any&& other):
+		_pHolder(other._pHolder)
+		/// Move constructor; takes over the other Any's content.
+		/// The moved-from Any is empty afterwards.
+	{
+		other._pHolder = 0;
+	}
+
 	~Any()
 	{
 		delete _pHolder;
@@ -403,6 +457,19 @@ private:
 		return *this;
 	}
 
+	Any& operator = (Any&& rhs)
+		/// Move assignment operator; takes over the other Any's
+		/// content.
+	{
+		if (this != &rhs)
+		{
+			delete _pHolder;
+			_pHolder = rhs._pHolder;
+			rhs._pHolder = 0;
+		}
+		return *this;
+	}
+
 	bool empty() const
 		/// Returns true if the Any is empty.
 	{
@@ -527,10 +594,10 @@ ValueType AnyCast(Any& operand)
 	if (!result)
 	{
 		std::string s = "RefAnyCast: Failed to convert between Any types ";
-		if (operand._pHolder)
+		if (!operand.empty())
 		{
 			s.append(1, '(');
-			s.append(operand._pHolder->type().name());
+			s.append(operand.type().name());
 			s.append(" => ");
 			s.append(typeid(ValueType).name());
 			s.append(1, ')');
@@ -566,14 +633,18 @@ const ValueType& RefAnyCast(const Any & operand)
 	/// const MyType& tmp = RefAnyCast<MyType>(anAny);
 {
 	ValueType* result = AnyCast<ValueType>(const_cast<Any*>(&operand));
-	std::string s = "RefAnyCast: Failed to convert between Any types ";
-	if (operand._pHolder)
+	if (!result)
 	{
-		s.append(1, '(');
-		s.append(operand._pHolder->type().name());
-		s.append(" => ");
-		s.append(typeid(ValueType).name());
-		s.append(1, ')');
+		std::string s = "RefAnyCast: Failed to convert between Any types ";
+		if (!operand.empty())
+		{
+			s.append(1, '(');
+			s.append(operand.type().name());
+			s.append(" => ");
+			s.append(typeid(ValueType).name());
+			s.append(1, ')');
+		}
+		throw BadCastException(s);
 	}
 	return *result;
 }
@@ -590,10 +661,10 @@ ValueType& RefAnyCast(Any& operand)
 	if (!result)
 	{
 		std::string s = "RefAnyCast: Failed to convert between Any types ";
-		if (operand._pHolder)
+		if (!operand.empty())
 		{
 			s.append(1, '(');
-			s.append(operand._pHolder->type().name());
+			s.append(operand.type().name());
 			s.append(" => ");
 			s.append(typeid(ValueType).name());
 			s.append(1, ')');
@@ -0,0 +1,141 @@
+//
+// Arena.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  Arena
+//
+// Definition of the Arena class and the ArenaAllocator adapter.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Arena_INCLUDED
+#define Foundation_Arena_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <vector>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API Arena
+	/// A monotonic memory arena.
+	///
+	/// Allocations bump a pointer within large pre-allocated blocks
+	/// and are never freed individually: all memory is reclaimed at
+	/// once by reset() or when the arena is destroyed. This makes
+	/// allocation nearly free and gives consecutive allocations
+	/// cache-friendly locality, at the cost of holding all memory
+	/// until the reset.
+	///
+	/// The intended use is transient, phase-structured work -- e.g.
+	/// parsing one request or document -- where the arena is reset
+	/// between phases. ArenaAllocator adapts an Arena to the
+	/// standard allocator interface, so standard containers can
+	/// place their nodes in it.
+	///
+	/// An Arena is not thread-safe; use one arena per thread or
+	/// guard it externally.
+{
+public:
+	explicit Arena(std::size_t blockSize = 4096);
+		/// Creates the Arena; memory is obtained from the heap in
+		/// blocks of the given size (allocations larger than the
+		/// block size get a dedicated block).
+
+	~Arena();
+		/// Destroys the Arena and frees all blocks.
+
+	void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+		/// Returns size bytes of memory with the given alignment,
+		/// valid until reset() is called or the arena is destroyed.
+
+	void reset();
+		/// Reclaims all allocations at once. The first block is
+		/// kept so a recycled arena (e.g. per keep-alive request)
+		/// does not return to the heap.
+
+	std::size_t allocated() const;
+		/// Returns the number of bytes handed out since creation
+		/// or the last reset().
+
+	std::size_t capacity() const;
+		/// Returns the total number of bytes obtained from the heap.
+
+private:
+	Arena(const Arena&);
+	Arena& operator = (const Arena&);
+
+	void grow(std::size_t minSize);
+
+	std::vector<char*> _blocks;
+	std::vector<std::size_t> _blockSizes;
+	std::size_t _blockSize;
+	char* _pCurrent;
+	char* _pEnd;
+	std::size_t _allocated;
+};
+
+
+template <class T>
+class ArenaAllocator
+	/// Standard allocator adapter placing all allocations in an
+	/// Arena. Deallocation is a no-op; memory is reclaimed when the
+	/// arena is reset or destroyed.
+{
+public:
+	typedef T value_type;
+
+	explicit ArenaAllocator(Arena& arena):
+		_pArena(&arena)
+	{
+	}
+
+	template <class U>
+	ArenaAllocator(const ArenaAllocator<U>& other):
+		_pArena(other.arena())
+	{
+	}
+
+	T* allocate(std::size_t n)
+	{
+		return static_cast<T*>(_pArena->allocate(n*sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, std::size_t)
+	{
+		// monotonic: reclaimed wholesale by Arena::reset()
+	}
+
+	Arena* arena() const
+	{
+		return _pArena;
+	}
+
+	bool operator == (const ArenaAllocator& other) const
+	{
+		return _pArena == other._pArena;
+	}
+
+	bool operator != (const ArenaAllocator& other) const
+	{
+		return _pArena != other._pArena;
+	}
+
+private:
+	Arena* _pArena;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Arena_INCLUDED
@@ -0,0 +1,68 @@
+//
+// Base32Codec.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base32Codec
+//
+// Definition of the Base32Codec class.
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Base32Codec_INCLUDED
+#define Foundation_Base32Codec_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <string>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API Base32Codec
+	/// Bulk, buffer-oriented Base32 (RFC 4648) encoding and
+	/// decoding; the contiguous-buffer counterpart of
+	/// Base32Encoder/Base32Decoder, following the Base64Codec
+	/// pattern: whole five-byte groups are transformed per
+	/// iteration instead of one character at a time through a
+	/// stream buffer.
+{
+public:
+	static std::size_t encodedLength(std::size_t dataLength, bool padding = true);
+		/// Returns the exact number of characters encode() will
+		/// produce for dataLength input bytes.
+
+	static void encode(const void* data, std::size_t length, std::string& base32, bool padding = true);
+		/// Base32-encodes the given buffer, replacing the contents
+		/// of the base32 string.
+
+	static std::string encode(const void* data, std::size_t length, bool padding = true);
+		/// Base32-encodes the given buffer and returns the
+		/// encoded string.
+
+	static bool decode(const std::string& base32, std::string& data);
+		/// Decodes the given Base32-encoded string, replacing the
+		/// contents of data. ASCII whitespace is skipped; padding
+		/// is accepted but not required; both digit cases are
+		/// accepted.
+		///
+		/// Returns false if the input contains characters outside
+		/// the alphabet; data then contains the bytes decoded up to
+		/// the offending character.
+
+private:
+	Base32Codec();
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Base32Codec_INCLUDED
@@ -0,0 +1,75 @@
+//
+// Base64Codec.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base64
+//
+// Definition of class Base64Codec.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Base64Codec_INCLUDED
+#define Foundation_Base64Codec_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Base64Encoder.h"
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API Base64Codec
+	/// Bulk, buffer-oriented Base64 encoding and decoding.
+	///
+	/// In contrast to Base64Encoder/Base64Decoder, which transform
+	/// one character at a time through an unbuffered stream buffer,
+	/// these routines transform whole contiguous buffers, processing
+	/// full three/four-byte groups per iteration. For multi-megabyte
+	/// payloads this is more than an order of magnitude faster than
+	/// going through the stream classes.
+	///
+	/// The bulk encoder never inserts line breaks (RFC 4648 raw
+	/// form); the bulk decoder skips ASCII whitespace, so input
+	/// produced with line breaks is accepted.
+{
+public:
+	static std::size_t encodedLength(std::size_t dataLength, int options = 0);
+		/// Returns the exact number of characters encode() will
+		/// produce for dataLength input bytes with the given
+		/// options (a combination of Base64EncodingOptions values).
+
+	static void encode(const void* data, std::size_t length, std::string& base64, int options = 0);
+		/// Base64-encodes the given buffer, replacing the contents
+		/// of the base64 string.
+
+	static std::string encode(const void* data, std::size_t length, int options = 0);
+		/// Base64-encodes the given buffer and returns the
+		/// encoded string.
+
+	static bool decode(const std::string& base64, std::string& data, int options = 0);
+		/// Decodes the given Base64-encoded string, replacing the
+		/// contents of data. ASCII whitespace (including CR/LF line
+		/// breaks) in the input is skipped; padding characters are
+		/// accepted but not required.
+		///
+		/// Returns false if the input contains characters outside
+		/// the selected alphabet; data then contains the bytes
+		/// decoded up to the offending character.
+
+private:
+	Base64Codec();
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Base64Codec_INCLUDED
@@ -69,6 +69,10 @@ public:
 
 private:
 	int writeToDevice(char c);
+	std::streamsize xsputn(const char* s, std::streamsize count);
+		/// Bulk-encodes full three-byte groups directly into the
+		/// connected streambuf, bypassing the per-character
+		/// writeToDevice() path.
 
 	int             _options;
 	unsigned char   _group[3];
@@ -82,6 +86,7 @@ private:
 	static const unsigned char OUT_ENCODING_URL[64];
 
 	friend class Base64DecoderBuf;
+	friend class Base64Codec;
 
 	Base64EncoderBuf(const Base64EncoderBuf&);
 	Base64EncoderBuf& operator = (const Base64EncoderBuf&);
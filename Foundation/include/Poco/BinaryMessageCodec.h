@@ -0,0 +1,63 @@
+//
+// BinaryMessageCodec.h
+//
+// Library: Foundation
+// Package: Logging
+// Module:  BinaryMessageCodec
+//
+// Definition of the BinaryMessageCodec class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_BinaryMessageCodec_INCLUDED
+#define Foundation_BinaryMessageCodec_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Message.h"
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API BinaryMessageCodec
+	/// Serializes Message objects, including their parameters, into
+	/// a compact length-prefixed binary record format and
+	/// reconstructs them from it.
+	///
+	/// The format is used by channels that persist or transport log
+	/// records in binary form (see SharedMemoryChannel): records can
+	/// be written and shipped without ever rendering the final text
+	/// line, and a collector reconstructs full Message objects --
+	/// with source, thread and process information as well as all
+	/// structured parameters -- for an ordinary formatting channel
+	/// chain.
+	///
+	/// Records are not self-delimiting; writers are expected to
+	/// frame them (e.g. with a leading record size), as
+	/// SharedMemoryChannel does.
+{
+public:
+	static void write(const Message& msg, std::string& buffer);
+		/// Appends a binary record for the given message
+		/// to the buffer.
+
+	static bool read(Message& msg, const char* buffer, std::size_t size);
+		/// Reconstructs a message from a binary record.
+		/// Returns false if the record is malformed or truncated.
+
+private:
+	BinaryMessageCodec();
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_BinaryMessageCodec_INCLUDED
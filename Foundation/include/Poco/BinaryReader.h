@@ -23,6 +23,7 @@
 #include "Poco/MemoryStream.h"
 #include "Poco/ByteOrder.h"
 #include <vector>
+#include <type_traits>
 #include <istream>
 
 
@@ -89,6 +90,7 @@ public:
 
 		*this >> size;
 		if (!good()) return *this;
+		if (tryBulkRead(value, size)) return *this;
 		value.reserve(size);
 		while (this->good() && size-- > 0)
 		{
@@ -146,6 +148,28 @@ public:
 		/// Returns the number of available bytes in the stream.
 
 private:
+	template <typename T>
+	typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, bool>::type
+	tryBulkRead(std::vector<T>& value, Poco::UInt32 size)
+		/// Reads arithmetic elements in native byte order with one
+		/// bulk read instead of a stream read per element.
+	{
+		if (_flipBytes) return false;
+		std::size_t oldSize = value.size();
+		value.resize(oldSize + size);
+		if (size > 0) readRaw(reinterpret_cast<char*>(&value[oldSize]), size*sizeof(T));
+		if (!good()) value.resize(oldSize);
+		return true;
+	}
+
+	template <typename T>
+	typename std::enable_if<!std::is_arithmetic<T>::value || std::is_same<T, bool>::value, bool>::type
+	tryBulkRead(std::vector<T>&, Poco::UInt32)
+	{
+		return false;
+	}
+
+
 
 #ifdef POCO_OS_FAMILY_WINDOWS
 #pragma warning(push)
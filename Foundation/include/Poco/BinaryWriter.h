@@ -19,10 +19,12 @@
 
 
 #include "Poco/Foundation.h"
+#include "Poco/BufferRef.h"
 #include "Poco/Buffer.h"
 #include "Poco/MemoryStream.h"
 #include "Poco/ByteOrder.h"
 #include <vector>
+#include <type_traits>
 #include <ostream>
 
 
@@ -93,6 +95,7 @@ public:
 		Poco::UInt32 size(static_cast<Poco::UInt32>(value.size()));
 
 		*this << size;
+		if (tryBulkWrite(value, size)) return *this;
 		for (typename std::vector<T>::const_iterator it = value.begin(); it != value.end(); ++it)
 		{
 			*this << *it;
@@ -129,6 +132,10 @@ public:
 	void writeRaw(const char* buffer, std::streamsize length);
 		/// Writes length raw bytes from the given buffer to the stream.
 
+	void writeRaw(const ConstBufferRef& data);
+		/// Writes the bytes referenced by the given span to
+		/// the stream.
+
 	void writeBOM();
 		/// Writes a byte-order mark to the stream. A byte order mark is
 		/// a 16-bit integer with a value of 0xFEFF, written in host byte-order.
@@ -155,6 +162,26 @@ public:
 		/// either BIG_ENDIAN_BYTE_ORDER or LITTLE_ENDIAN_BYTE_ORDER.
 
 private:
+	template <typename T>
+	typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, bool>::type
+	tryBulkWrite(const std::vector<T>& value, Poco::UInt32 size)
+		/// Writes arithmetic elements in native byte order with one
+		/// bulk write instead of a stream write per element.
+	{
+		if (_flipBytes) return false;
+		if (size > 0) writeRaw(reinterpret_cast<const char*>(&value[0]), size*sizeof(T));
+		return true;
+	}
+
+	template <typename T>
+	typename std::enable_if<!std::is_arithmetic<T>::value || std::is_same<T, bool>::value, bool>::type
+	tryBulkWrite(const std::vector<T>&, Poco::UInt32)
+		/// vector<bool> is a packed proxy container and non-arithmetic
+		/// elements have structured encodings; both stay element-wise.
+	{
+		return false;
+	}
+
 
 #ifdef POCO_OS_FAMILY_WINDOWS
 #pragma warning(push)
@@ -0,0 +1,148 @@
+//
+// BoundedNotificationQueue.h
+//
+// Library: Foundation
+// Package: Notifications
+// Module:  BoundedNotificationQueue
+//
+// Definition of the BoundedNotificationQueue class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_BoundedNotificationQueue_INCLUDED
+#define Foundation_BoundedNotificationQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Notification.h"
+#include "Poco/Event.h"
+#include <atomic>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API BoundedNotificationQueue
+	/// A BoundedNotificationQueue object provides a way to implement
+	/// asynchronous notifications, like NotificationQueue, but with a
+	/// fixed capacity and a lock-free multi-producer/multi-consumer
+	/// enqueue/dequeue path.
+	///
+	/// Notifications are passed through a preallocated atomic ring
+	/// buffer, so neither producers nor consumers take a mutex and
+	/// the queue never allocates after construction. Waiting
+	/// consumers are woken in batches: a producer only signals when
+	/// consumers are actually blocked, so at high throughput the
+	/// wakeup cost disappears from the enqueue path.
+	///
+	/// This makes the queue suitable for fixed-topology pipeline
+	/// stages pushing millions of notifications per second. For
+	/// unbounded queues, urgent notifications or dispatch to a
+	/// NotificationCenter, use NotificationQueue and friends.
+{
+public:
+	explicit BoundedNotificationQueue(std::size_t capacity);
+		/// Creates the BoundedNotificationQueue with room for at
+		/// least capacity notifications. The capacity is rounded
+		/// up to the next power of two.
+
+	~BoundedNotificationQueue();
+		/// Destroys the BoundedNotificationQueue. Notifications
+		/// still in the queue are released.
+
+	bool tryEnqueueNotification(Notification::Ptr pNotification);
+		/// Enqueues the given notification by adding it to
+		/// the end of the queue (FIFO), if room is available.
+		/// Returns false if the queue is full; in this case the
+		/// queue does not take ownership of the notification.
+
+	void enqueueNotification(Notification::Ptr pNotification);
+		/// Enqueues the given notification by adding it to
+		/// the end of the queue (FIFO), waiting for room if the
+		/// queue is full.
+		/// The queue takes ownership of the notification.
+
+	Notification* dequeueNotification();
+		/// Dequeues the next pending notification.
+		/// Returns 0 (null) if no notification is available.
+		/// The caller gains ownership of the notification and
+		/// is expected to release it when done with it.
+		///
+		/// It is highly recommended that the result is immediately
+		/// assigned to a Notification::Ptr, to avoid potential
+		/// memory management issues.
+
+	Notification* waitDequeueNotification();
+		/// Dequeues the next pending notification.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued.
+		/// This method returns 0 (null) if wakeUpAll()
+		/// has been called by another thread.
+		///
+		/// It is highly recommended that the result is immediately
+		/// assigned to a Notification::Ptr, to avoid potential
+		/// memory management issues.
+
+	Notification* waitDequeueNotification(long milliseconds);
+		/// Dequeues the next pending notification.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued up to the specified time.
+		/// Returns 0 (null) if no notification is available.
+		///
+		/// It is highly recommended that the result is immediately
+		/// assigned to a Notification::Ptr, to avoid potential
+		/// memory management issues.
+
+	void wakeUpAll();
+		/// Wakes up all threads that wait for a notification.
+		///
+		/// The wakeup state is sticky: once wakeUpAll() has been
+		/// called, waitDequeueNotification() no longer blocks on an
+		/// empty queue, so worker threads can be shut down reliably.
+
+	bool empty() const;
+		/// Returns true iff the queue is empty.
+
+	bool full() const;
+		/// Returns true iff the queue is full.
+
+	std::size_t size() const;
+		/// Returns the number of notifications in the queue.
+
+	std::size_t capacity() const;
+		/// Returns the maximum number of notifications
+		/// the queue can hold.
+
+private:
+	BoundedNotificationQueue();
+	BoundedNotificationQueue(const BoundedNotificationQueue&);
+	BoundedNotificationQueue& operator = (const BoundedNotificationQueue&);
+
+	struct Cell
+	{
+		std::atomic<std::size_t> sequence;
+		Notification* pNotification;
+	};
+
+	Cell* _buffer;
+	std::size_t _bufferMask;
+	std::atomic<std::size_t> _enqueuePos;
+	std::atomic<std::size_t> _dequeuePos;
+	std::atomic<int> _waitingConsumers;
+	std::atomic<int> _waitingProducers;
+	std::atomic<bool> _wakeUpAll;
+	Event _nonEmpty;
+	Event _nonFull;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_BoundedNotificationQueue_INCLUDED
@@ -63,6 +63,21 @@ public:
 	{
 	}
 
+	Buffer(T* pMem, std::size_t length, bool transferOwnership):
+		_capacity(length),
+		_used(length),
+		_ptr(pMem),
+		_ownMem(transferOwnership)
+		/// Creates the Buffer, adopting the supplied memory. If
+		/// transferOwnership is true, the memory must have been
+		/// allocated with new[]; the Buffer takes ownership (it
+		/// will delete [] it) and behaves like one that allocated
+		/// its storage itself, including resizability. With
+		/// transferOwnership false this is the plain wrapping
+		/// constructor.
+	{
+	}
+
 	Buffer(const T* pMem, std::size_t length):
 		_capacity(length),
 		_used(length),
@@ -206,6 +221,14 @@ public:
 		}
 	}
 
+	void reserve(std::size_t newCapacity)
+		/// Grows the buffer capacity to at least newCapacity
+		/// elements without changing the size or touching content.
+		/// Never shrinks.
+	{
+		if (newCapacity > _capacity) setCapacity(newCapacity, true);
+	}
+
 	void assign(const T* buf, std::size_t sz)
 		/// Assigns the argument buffer to this buffer.
 		/// If necessary, resizes the buffer.
@@ -217,18 +240,24 @@ public:
 	}
 
 	void append(const T* buf, std::size_t sz)
-		/// Resizes this buffer and appends the argument buffer.
+		/// Appends the argument buffer, growing capacity
+		/// geometrically as needed, so repeated appends cost
+		/// amortized constant time per element instead of a
+		/// reallocation and full copy each.
 	{
 		if (0 == sz) return;
-		resize(_used + sz, true);
-		std::memcpy(_ptr + _used - sz, buf, sz * sizeof(T));
+		if (_used + sz > _capacity) grow(_used + sz);
+		std::memcpy(_ptr + _used, buf, sz * sizeof(T));
+		_used += sz;
 	}
 
 	void append(T val)
-		/// Resizes this buffer by one element and appends the argument value.
+		/// Appends the argument value, growing capacity
+		/// geometrically as needed.
 	{
-		resize(_used + 1, true);
-		_ptr[_used - 1] = val;
+		if (_used + 1 > _capacity) grow(_used + 1);
+		_ptr[_used] = val;
+		++_used;
 	}
 
 	void append(const Buffer& buf)
@@ -349,6 +378,15 @@ public:
 private:
 	Buffer();
 
+	void grow(std::size_t minCapacity)
+		/// Reallocates to at least minCapacity, at least doubling
+		/// the current capacity, preserving content.
+	{
+		std::size_t newCapacity = _capacity ? 2*_capacity : 16;
+		if (newCapacity < minCapacity) newCapacity = minCapacity;
+		setCapacity(newCapacity, true);
+	}
+
 	std::size_t _capacity;
 	std::size_t _used;
 	T*          _ptr;
@@ -0,0 +1,176 @@
+//
+// BufferRef.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  BufferRef
+//
+// Definition of the BufferRef and ConstBufferRef classes.
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_BufferRef_INCLUDED
+#define Foundation_BufferRef_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Buffer.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class ConstBufferRef
+	/// A non-owning reference to a contiguous read-only byte range
+	/// (a span), used as a vocabulary type by byte-consuming APIs
+	/// (sockets, digests, checksums, binary writers).
+	///
+	/// A ConstBufferRef constructs implicitly from std::string,
+	/// Poco::Buffer<char> and std::vector<char>, so call sites can
+	/// pass whatever container they hold without the defensive
+	/// copies (or manual data()/size() unpacking) that crossing a
+	/// (const char*, length) API seam otherwise invites.
+	///
+	/// Like any span, it does not keep the referenced memory alive;
+	/// the data must outlive the reference.
+{
+public:
+	ConstBufferRef():
+		_data(0),
+		_size(0)
+	{
+	}
+
+	ConstBufferRef(const void* data, std::size_t size):
+		_data(reinterpret_cast<const char*>(data)),
+		_size(size)
+	{
+	}
+
+	ConstBufferRef(const std::string& data):
+		_data(data.data()),
+		_size(data.size())
+	{
+	}
+
+	ConstBufferRef(const Poco::Buffer<char>& data):
+		_data(data.begin()),
+		_size(data.size())
+	{
+	}
+
+	ConstBufferRef(const std::vector<char>& data):
+		_data(data.empty() ? 0 : &data[0]),
+		_size(data.size())
+	{
+	}
+
+	const char* data() const
+	{
+		return _data;
+	}
+
+	std::size_t size() const
+	{
+		return _size;
+	}
+
+	bool empty() const
+	{
+		return _size == 0;
+	}
+
+	const char* begin() const
+	{
+		return _data;
+	}
+
+	const char* end() const
+	{
+		return _data + _size;
+	}
+
+private:
+	const char* _data;
+	std::size_t _size;
+};
+
+
+class BufferRef
+	/// A non-owning reference to a contiguous writable byte range;
+	/// the mutable counterpart of ConstBufferRef, for APIs that
+	/// fill caller-provided storage (socket receives and the like).
+{
+public:
+	BufferRef():
+		_data(0),
+		_size(0)
+	{
+	}
+
+	BufferRef(void* data, std::size_t size):
+		_data(reinterpret_cast<char*>(data)),
+		_size(size)
+	{
+	}
+
+	BufferRef(Poco::Buffer<char>& data):
+		_data(data.begin()),
+		_size(data.size())
+	{
+	}
+
+	BufferRef(std::vector<char>& data):
+		_data(data.empty() ? 0 : &data[0]),
+		_size(data.size())
+	{
+	}
+
+	operator ConstBufferRef() const
+	{
+		return ConstBufferRef(_data, _size);
+	}
+
+	char* data() const
+	{
+		return _data;
+	}
+
+	std::size_t size() const
+	{
+		return _size;
+	}
+
+	bool empty() const
+	{
+		return _size == 0;
+	}
+
+	char* begin() const
+	{
+		return _data;
+	}
+
+	char* end() const
+	{
+		return _data + _size;
+	}
+
+private:
+	char* _data;
+	std::size_t _size;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_BufferRef_INCLUDED
@@ -0,0 +1,148 @@
+//
+// CachePersistence.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  CachePersistence
+//
+// Definition of the CachePersistence class template.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_CachePersistence_INCLUDED
+#define Foundation_CachePersistence_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/BinaryWriter.h"
+#include "Poco/BinaryReader.h"
+#include "Poco/Checksum.h"
+#include "Poco/FileStream.h"
+#include "Poco/File.h"
+#include "Poco/Exception.h"
+#include "Poco/StreamCopier.h"
+#include <sstream>
+#include <set>
+
+
+namespace Poco {
+
+
+template <class TCache, class TKey, class TValue>
+class CachePersistence
+	/// Checkpoints the contents of an AbstractCache-based cache to a
+	/// checksummed file and restores them, so long-lived lookup
+	/// caches come back warm after a restart instead of being
+	/// rebuilt cold from the backing store.
+	///
+	/// Keys and values are serialized with BinaryWriter; TKey and
+	/// TValue must therefore be types BinaryWriter/BinaryReader can
+	/// handle (or for which the operators have been provided). The
+	/// file carries a magic tag, an entry count and a CRC-32C
+	/// checksum over the payload; load() refuses corrupt or
+	/// truncated files and leaves the cache unchanged.
+	///
+	/// Entries are restored through the cache's ordinary add()
+	/// path, so the cache's replacement strategy applies (e.g. a
+	/// size-limited cache keeps only as many entries as it would
+	/// normally hold). Expiration-based strategies see restored
+	/// entries as freshly added.
+	///
+	/// Usage:
+	///     LRUCache<std::string, std::string> cache(10000);
+	///     CachePersistence<LRUCache<std::string, std::string>,
+	///         std::string, std::string> persistence;
+	///     persistence.load(cache, "lookup.cache");
+	///     ...
+	///     persistence.save(cache, "lookup.cache");
+{
+public:
+	std::size_t save(TCache& cache, const std::string& path)
+		/// Writes all cache entries to the given file, replacing
+		/// its contents. Returns the number of entries written.
+	{
+		std::ostringstream payload;
+		BinaryWriter writer(payload, BinaryWriter::LITTLE_ENDIAN_BYTE_ORDER);
+
+		std::set<TKey> keys = cache.getAllKeys();
+		UInt32 count = 0;
+		for (typename std::set<TKey>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+		{
+			SharedPtr<TValue> pValue = cache.get(*it);
+			if (pValue)
+			{
+				writer << *it << *pValue;
+				++count;
+			}
+		}
+
+		std::string data = payload.str();
+		Checksum crc(Checksum::TYPE_CRC32C);
+		crc.update(data);
+
+		FileOutputStream ostr(path);
+		BinaryWriter header(ostr, BinaryWriter::LITTLE_ENDIAN_BYTE_ORDER);
+		header << MAGIC << count << static_cast<UInt32>(crc.checksum());
+		header.writeRaw(data);
+		ostr.close();
+		return count;
+	}
+
+	std::size_t load(TCache& cache, const std::string& path)
+		/// Restores entries from the given file into the cache
+		/// (through its ordinary add() path). Returns the number of
+		/// restored entries; returns 0 if the file does not exist.
+		///
+		/// Throws a DataFormatException if the file is corrupt; the
+		/// cache is left unchanged in that case.
+	{
+		File file(path);
+		if (!file.exists()) return 0;
+
+		FileInputStream istr(path);
+		BinaryReader header(istr, BinaryReader::LITTLE_ENDIAN_BYTE_ORDER);
+		UInt32 magic, count, checksum;
+		header >> magic >> count >> checksum;
+		if (!istr.good() || magic != MAGIC)
+			throw DataFormatException("Not a cache checkpoint file", path);
+
+		std::stringstream payload;
+		StreamCopier::copyStream(istr, payload);
+		std::string data = payload.str();
+		Checksum crc(Checksum::TYPE_CRC32C);
+		crc.update(data);
+		if (static_cast<UInt32>(crc.checksum()) != checksum)
+			throw DataFormatException("Cache checkpoint file checksum mismatch", path);
+
+		BinaryReader reader(payload, BinaryReader::LITTLE_ENDIAN_BYTE_ORDER);
+		std::size_t restored = 0;
+		for (UInt32 i = 0; i < count; i++)
+		{
+			TKey key;
+			TValue value;
+			reader >> key >> value;
+			if (!payload.good() && i + 1 < count)
+				throw DataFormatException("Cache checkpoint file truncated", path);
+			cache.add(key, value);
+			++restored;
+		}
+		return restored;
+	}
+
+private:
+	enum
+	{
+		MAGIC = 0x434B5043 // "CPKC"
+	};
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_CachePersistence_INCLUDED
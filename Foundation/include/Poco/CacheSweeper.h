@@ -0,0 +1,88 @@
+//
+// CacheSweeper.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  CacheSweeper
+//
+// Definition of the CacheSweeper class template.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_CacheSweeper_INCLUDED
+#define Foundation_CacheSweeper_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Timer.h"
+
+
+namespace Poco {
+
+
+template <class TCache>
+class CacheSweeper
+	/// Periodically evicts stale entries from a cache by invoking
+	/// its forceReplace() method from a background timer thread.
+	///
+	/// Expiration-based caches (ExpireCache and friends) validate
+	/// expiry lazily: entries that are never touched again linger,
+	/// pinning their memory until some access happens to sweep them.
+	/// Attaching a CacheSweeper bounds that staleness:
+	///
+	///     ExpireCache<int, Payload> cache(60000);
+	///     CacheSweeper<ExpireCache<int, Payload> > sweeper(cache, 5000);
+	///
+	/// The sweep runs the cache's normal strategy eviction, so all
+	/// strategies (and their Remove events) behave exactly as on an
+	/// access-triggered eviction.
+{
+public:
+	CacheSweeper(TCache& cache, long intervalMilliseconds = 1000):
+		_cache(cache),
+		_timer(intervalMilliseconds, intervalMilliseconds),
+		_callback(*this, &CacheSweeper<TCache>::onTimer)
+		/// Creates the CacheSweeper and starts sweeping the given
+		/// cache at the given interval. The cache must outlive
+		/// the sweeper.
+	{
+		_timer.start(_callback);
+	}
+
+	~CacheSweeper()
+		/// Stops the sweeper.
+	{
+		try
+		{
+			_timer.stop();
+		}
+		catch (...)
+		{
+			poco_unexpected();
+		}
+	}
+
+private:
+	CacheSweeper(const CacheSweeper&);
+	CacheSweeper& operator = (const CacheSweeper&);
+
+	void onTimer(Poco::Timer&)
+	{
+		_cache.forceReplace();
+	}
+
+	TCache& _cache;
+	Poco::Timer _timer;
+	Poco::TimerCallback<CacheSweeper<TCache> > _callback;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_CacheSweeper_INCLUDED
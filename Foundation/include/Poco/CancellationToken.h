@@ -0,0 +1,123 @@
+//
+// CancellationToken.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  CancellationToken
+//
+// Definition of the CancellationToken and CancellationTokenSource classes.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_CancellationToken_INCLUDED
+#define Foundation_CancellationToken_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Event.h"
+#include "Poco/Mutex.h"
+#include "Poco/SharedPtr.h"
+#include <functional>
+#include <map>
+#include <atomic>
+
+
+namespace Poco {
+
+
+class Foundation_API CancellationToken
+	/// A cooperative cancellation handle.
+	///
+	/// Long-running operations poll isCancelled() (or call
+	/// throwIfCancelled()) at checkpoints; blocking operations
+	/// register an onCancel() callback that interrupts their wait
+	/// (e.g. by waking a poll), so cancelling a 30-second-timeout
+	/// operation takes effect immediately instead of after the
+	/// timeout. Tokens are cheap, copyable handles to state shared
+	/// with the CancellationTokenSource that created them.
+{
+public:
+	typedef std::function<void ()> Callback;
+
+	CancellationToken();
+		/// Creates a token that can never be cancelled.
+
+	~CancellationToken();
+		/// Destroys the CancellationToken.
+
+	bool isCancelled() const;
+		/// Returns true if cancellation has been requested.
+
+	void throwIfCancelled() const;
+		/// Throws an InterruptedException if cancellation has
+		/// been requested.
+
+	bool wait(long milliseconds) const;
+		/// Waits up to the given time for cancellation; returns
+		/// true if cancellation was requested.
+
+	int onCancel(const Callback& callback) const;
+		/// Registers a callback invoked when cancellation is
+		/// requested (immediately, if it already has been) and
+		/// returns an id for removeCallback(). Callbacks run on the
+		/// cancelling thread and must be fast and non-throwing.
+
+	void removeCallback(int id) const;
+		/// Removes the callback with the given id. No-op while a
+		/// concurrent cancel() is already delivering callbacks.
+
+private:
+	struct State;
+	CancellationToken(const Poco::SharedPtr<State>& pState);
+
+	mutable Poco::SharedPtr<State> _pState;
+
+	friend class CancellationTokenSource;
+};
+
+
+class Foundation_API CancellationTokenSource
+	/// Creates and cancels CancellationTokens; owned by the party
+	/// that may request cancellation, while the operations observe
+	/// tokens only.
+{
+public:
+	CancellationTokenSource();
+		/// Creates the CancellationTokenSource.
+
+	~CancellationTokenSource();
+		/// Destroys the CancellationTokenSource.
+
+	CancellationToken token() const;
+		/// Returns a token observing this source.
+
+	void cancel();
+		/// Requests cancellation: marks the token cancelled, wakes
+		/// waiters and runs registered callbacks. Idempotent.
+
+	bool isCancelled() const;
+		/// Returns true if cancel() has been called.
+
+	void reset();
+		/// Re-arms the source for reuse (e.g. a restartable
+		/// Activity): previously handed-out tokens observe the
+		/// fresh, uncancelled state again. Must not race with
+		/// cancel() or with operations still observing the token.
+
+private:
+	CancellationTokenSource(const CancellationTokenSource&);
+	CancellationTokenSource& operator = (const CancellationTokenSource&);
+
+	Poco::SharedPtr<CancellationToken::State> _pState;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_CancellationToken_INCLUDED
@@ -19,6 +19,7 @@
 
 
 #include "Poco/Foundation.h"
+#include "Poco/BufferRef.h"
 #include "Poco/ChecksumImpl.h"
 
 
@@ -33,7 +34,11 @@ public:
 	{
 		TYPE_ADLER32 = ChecksumImpl::TYPE_ADLER32_IMPL,
 		TYPE_CRC32 = ChecksumImpl::TYPE_CRC32_IMPL,
-		TYPE_CRC64 = ChecksumImpl::TYPE_CRC64_IMPL
+		TYPE_CRC64 = ChecksumImpl::TYPE_CRC64_IMPL,
+		TYPE_CRC32C = ChecksumImpl::TYPE_CRC32C_IMPL
+			/// CRC-32C (Castagnoli polynomial, as used by iSCSI,
+			/// ext4 and others); computed with the SSE4.2 CRC32
+			/// instruction where the processor supports it.
 	};
 
 	Checksum();
@@ -52,6 +57,10 @@ public:
 		/// Updates the checksum with the given data.
 
 	void update(char data);
+
+	void update(const ConstBufferRef& data);
+		/// Updates the checksum with the bytes referenced by the
+		/// given span.
 		/// Updates the checksum with the given data.
 
 	Poco::UInt64 checksum() const;
@@ -75,6 +84,12 @@ inline void Checksum::update(const std::string& data)
 }
 
 
+inline void Checksum::update(const ConstBufferRef& data)
+{
+	update(data.data(), static_cast<unsigned>(data.size()));
+}
+
+
 inline void Checksum::update(char c)
 {
 	_pImpl->update(&c, 1);
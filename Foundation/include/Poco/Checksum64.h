@@ -61,6 +61,20 @@ public:
 	Poco::UInt64 checksum() const;
 		/// Returns the calculated checksum.
 
+	static Poco::UInt64 combine(Poco::UInt64 crcA, Poco::UInt64 crcB, Poco::UInt64 lengthB);
+		/// Combines two checksums: given the CRC-64 of a block A,
+		/// the CRC-64 of a block B, and the length of B, returns
+		/// the CRC-64 of the concatenation A||B without touching
+		/// the data again. Runs in O(log lengthB).
+
+	static Poco::UInt64 checksumParallel(const char* data, std::size_t length, int maxThreads = 0);
+		/// Computes the CRC-64 of the given buffer by checksumming
+		/// it in chunks on a ThreadPool and merging the partial
+		/// results with combine(), so multi-gigabyte buffers use
+		/// all cores. maxThreads <= 0 uses one thread per
+		/// processor. The result is identical to a serial
+		/// update()/checksum() pass.
+
 	ChecksumImpl::Type type() const;
 		/// Which type of checksum are we calculating.
 
@@ -31,7 +31,8 @@ public:
 	{
 		TYPE_ADLER32_IMPL = 0,
 		TYPE_CRC32_IMPL,
-		TYPE_CRC64_IMPL
+		TYPE_CRC64_IMPL,
+		TYPE_CRC32C_IMPL
 	};
 
 	virtual ~ChecksumImpl() {}
@@ -71,6 +71,17 @@ public:
 		/// Swaps the Clock with another one.
 	
 	void update();
+		/// Updates the Clock with the current system clock value.
+
+	void updateCoarse();
+		/// Updates the Clock from a coarse, low-overhead monotonic
+		/// source (CLOCK_MONOTONIC_COARSE on Linux; elsewhere the
+		/// regular source). Resolution is the kernel tick,
+		/// typically one to four milliseconds.
+
+	static Clock coarse();
+		/// Returns the current monotonic time from the coarse
+		/// clock source (see updateCoarse()).
 		/// Updates the Clock with the current system clock.
 
 	bool operator == (const Clock& ts) const;
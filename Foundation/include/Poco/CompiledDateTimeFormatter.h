@@ -0,0 +1,78 @@
+//
+// CompiledDateTimeFormatter.h
+//
+// Library: Foundation
+// Package: DateTime
+// Module:  CompiledDateTimeFormatter
+//
+// Definition of the CompiledDateTimeFormatter class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_CompiledDateTimeFormatter_INCLUDED
+#define Foundation_CompiledDateTimeFormatter_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/DateTime.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/Timestamp.h"
+#include <vector>
+#include <string>
+
+
+namespace Poco {
+
+
+class Foundation_API CompiledDateTimeFormatter
+	/// Formats DateTime values with a format pattern that is parsed
+	/// once at construction instead of being re-walked per call
+	/// (see DateTimeFormatter for the pattern syntax).
+	///
+	/// When the pattern contains no sub-second specifiers, the
+	/// formatter additionally caches the last formatted second:
+	/// formatting many timestamps within the same second -- the
+	/// common case in access logging -- returns the cached string
+	/// without any formatting work.
+	///
+	/// A CompiledDateTimeFormatter is not thread-safe (because of
+	/// the cache); use one per thread.
+{
+public:
+	explicit CompiledDateTimeFormatter(const std::string& pattern);
+		/// Creates the CompiledDateTimeFormatter, parsing the
+		/// pattern into an operation list.
+
+	const std::string& format(const Timestamp& timestamp, int timeZoneDifferential = DateTimeFormatter::UTC);
+		/// Formats the given timestamp. The returned reference is
+		/// valid until the next format() call.
+
+	const std::string& format(const DateTime& dateTime, int timeZoneDifferential = DateTimeFormatter::UTC);
+		/// Formats the given DateTime. The returned reference is
+		/// valid until the next format() call.
+
+private:
+	struct Op
+	{
+		bool        literal;
+		std::string text; // literal text, or a "%X" fragment
+	};
+
+	std::vector<Op> _ops;
+	bool _cacheable;                 // no sub-second specifiers in the pattern
+	bool _cacheValid;
+	Timestamp::TimeVal _cachedSecond;
+	int _cachedTzd;
+	std::string _result;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_CompiledDateTimeFormatter_INCLUDED
@@ -86,15 +86,14 @@
 // cases when value holder fits into POCO_SMALL_OBJECT_SIZE
 // (see below).
 //
-// !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-// !!! NOTE: Any/Dynamic::Var SOO will NOT work reliably   !!!
-// !!! without C++11 (std::aligned_storage in particular). !!!
-// !!! Only comment this out if your compiler has support  !!!
-// !!! for std::aligned_storage.                           !!!
-// !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+// Any/Dynamic::Var small-object optimization (SOO): values whose
+// holder fits the inline buffer are placement new-ed into the
+// Any/Var object instead of being heap-allocated. Enabled by
+// default (requires std::aligned_storage, i.e. C++11 or later);
+// define POCO_NO_SOO to restore heap-only storage.
 //
 #ifndef POCO_NO_SOO
-#ifndef POCO_ENABLE_SOO
+#ifdef POCO_DISABLE_SOO
 #define POCO_NO_SOO
 #endif
 #endif
@@ -104,9 +103,12 @@
 // Small object size in bytes. When assigned to Any or Var,
 // objects larger than this value will be alocated on the heap,
 // while those smaller will be placement new-ed into an
-// internal buffer.
+// internal buffer. The default of 48 covers the holder for a
+// std::string (vtable pointer plus the string object), so string
+// values - the dominant case in configuration and JSON layers -
+// stay inline.
 #if !defined(POCO_SMALL_OBJECT_SIZE) && !defined(POCO_NO_SOO)
-	#define POCO_SMALL_OBJECT_SIZE 32
+	#define POCO_SMALL_OBJECT_SIZE 48
 #endif
 
 
@@ -77,6 +77,21 @@ public:
 		///
 		/// Must be called when deflating to an output stream.
 
+	void reset(std::ostream& ostr);
+		/// Reuses the stream buffer, including zlib's internal
+		/// deflate state (via deflateReset()), for compressing to
+		/// another output stream. This avoids tearing down and
+		/// re-initializing the several hundred KB deflate context
+		/// for every compressed payload.
+		///
+		/// Must only be called on an output stream buffer, after
+		/// close() has finished the previous payload.
+
+	void setParams(int level, int strategy);
+		/// Changes the compression level and strategy (see the zlib
+		/// documentation of deflateParams()) for subsequently
+		/// written data. Best called directly after reset().
+
 protected:
 	int readFromDevice(char* buffer, std::streamsize length);
 	int writeToDevice(const char* buffer, std::streamsize length);
@@ -169,6 +184,17 @@ public:
 		///
 		/// Must be called when deflating to an output stream.
 
+	void reset(std::ostream& ostr);
+		/// Reuses the stream, including its deflate context, for
+		/// compressing to another output stream (see
+		/// DeflatingStreamBuf::reset()). Must be called after
+		/// close(); also clears the stream state.
+
+	void setParams(int level, int strategy);
+		/// Changes the compression level and strategy for
+		/// subsequently written data (see
+		/// DeflatingStreamBuf::setParams()).
+
 protected:
 	virtual int sync();
 };
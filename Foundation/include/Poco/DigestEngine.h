@@ -19,6 +19,7 @@
 
 
 #include "Poco/Foundation.h"
+#include "Poco/BufferRef.h"
 #include <vector>
 
 
@@ -44,6 +45,9 @@ public:
 	void update(const void* data, std::size_t length);
 	void update(char data);
 	void update(const std::string& data);
+	void update(const ConstBufferRef& data);
+		/// Updates the digest with the bytes referenced by the
+		/// given span.
 		/// Updates the digest with the given data.
 
 	virtual std::size_t digestLength() const = 0;
@@ -105,6 +109,12 @@ inline void DigestEngine::update(const std::string& data)
 }
 
 
+inline void DigestEngine::update(const ConstBufferRef& data)
+{
+	updateImpl(data.data(), data.size());
+}
+
+
 } // namespace Poco
 
 
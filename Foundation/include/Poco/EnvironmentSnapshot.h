@@ -0,0 +1,84 @@
+//
+// EnvironmentSnapshot.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  EnvironmentSnapshot
+//
+// Definition of the EnvironmentSnapshot class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_EnvironmentSnapshot_INCLUDED
+#define Foundation_EnvironmentSnapshot_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <map>
+#include <string>
+
+
+namespace Poco {
+
+
+class Foundation_API EnvironmentSnapshot
+	/// An immutable snapshot of the process environment.
+	///
+	/// Environment::get() takes a global mutex and copies the
+	/// variable's value on every call -- reasonable for occasional
+	/// lookups, wasteful when configuration layers consult the
+	/// environment on a request path. An EnvironmentSnapshot
+	/// captures the entire environment once at construction;
+	/// lookups afterwards touch only the snapshot's own map, with
+	/// no locking and no interaction with the live (mutable)
+	/// environment. Call refresh() to re-capture on demand.
+	///
+	/// A snapshot is safe for concurrent reads; refresh() must not
+	/// race with readers (refresh at startup or during quiescence,
+	/// or use one snapshot per thread).
+{
+public:
+	EnvironmentSnapshot();
+		/// Captures the current process environment.
+
+	~EnvironmentSnapshot();
+		/// Destroys the EnvironmentSnapshot.
+
+	bool has(const std::string& name) const;
+		/// Returns true if the captured environment contains the
+		/// given variable.
+
+	std::string get(const std::string& name) const;
+		/// Returns the captured value of the given variable.
+		/// Throws a NotFoundException if the variable did not
+		/// exist at capture time.
+
+	std::string get(const std::string& name, const std::string& defaultValue) const;
+		/// Returns the captured value of the given variable, or
+		/// defaultValue if it did not exist at capture time.
+
+	void refresh();
+		/// Re-captures the current process environment.
+
+	std::size_t size() const;
+		/// Returns the number of captured variables.
+
+private:
+	EnvironmentSnapshot(const EnvironmentSnapshot&);
+	EnvironmentSnapshot& operator = (const EnvironmentSnapshot&);
+
+	void capture();
+
+	std::map<std::string, std::string> _env;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_EnvironmentSnapshot_INCLUDED
@@ -21,6 +21,7 @@
 #include "Poco/Foundation.h"
 #include "Poco/Exception.h"
 #include "Poco/Buffer.h"
+#include <atomic>
 #include "Poco/BasicEvent.h"
 #include "Poco/Mutex.h"
 #include "Poco/Format.h"
@@ -541,7 +542,90 @@ private:
 //
 // We provide an instantiation for char
 //
+template <class T>
+class BasicSpscFIFOBuffer
+	/// A fixed-capacity, lock-free FIFO ring buffer for exactly one
+	/// producer thread and one consumer thread.
+	///
+	/// Unlike BasicFIFOBuffer, which guards every operation with a
+	/// (recursive) mutex and compacts data with memmove, this ring
+	/// never moves data and never locks: the producer owns the head
+	/// index, the consumer owns the tail index, and the two
+	/// communicate through acquire/release atomics. Intended for
+	/// high-rate pipeline stages; there are no transition events.
+{
+public:
+	explicit BasicSpscFIFOBuffer(std::size_t capacity):
+		_buffer(capacity + 1),
+		_head(0),
+		_tail(0)
+		/// Creates the ring with room for capacity elements.
+	{
+		poco_assert (capacity > 0);
+	}
+
+	std::size_t write(const T* pBuffer, std::size_t length)
+		/// Writes up to length elements (producer side only).
+		/// Returns the number of elements written; zero when full.
+	{
+		std::size_t head = _head.load(std::memory_order_relaxed);
+		std::size_t tail = _tail.load(std::memory_order_acquire);
+		std::size_t free = (tail + _buffer.size() - head - 1) % _buffer.size();
+		if (length > free) length = free;
+		for (std::size_t i = 0; i < length; i++)
+			_buffer[(head + i) % _buffer.size()] = pBuffer[i];
+		_head.store((head + length) % _buffer.size(), std::memory_order_release);
+		return length;
+	}
+
+	std::size_t read(T* pBuffer, std::size_t length)
+		/// Reads up to length elements (consumer side only).
+		/// Returns the number of elements read; zero when empty.
+	{
+		std::size_t tail = _tail.load(std::memory_order_relaxed);
+		std::size_t head = _head.load(std::memory_order_acquire);
+		std::size_t avail = (head + _buffer.size() - tail) % _buffer.size();
+		if (length > avail) length = avail;
+		for (std::size_t i = 0; i < length; i++)
+			pBuffer[i] = _buffer[(tail + i) % _buffer.size()];
+		_tail.store((tail + length) % _buffer.size(), std::memory_order_release);
+		return length;
+	}
+
+	std::size_t used() const
+		/// Returns the number of elements in the ring (approximate
+		/// under concurrent access).
+	{
+		std::size_t head = _head.load(std::memory_order_acquire);
+		std::size_t tail = _tail.load(std::memory_order_acquire);
+		return (head + _buffer.size() - tail) % _buffer.size();
+	}
+
+	std::size_t available() const
+		/// Returns the remaining capacity (approximate under
+		/// concurrent access).
+	{
+		return _buffer.size() - 1 - used();
+	}
+
+	bool isEmpty() const
+	{
+		return used() == 0;
+	}
+
+private:
+	BasicSpscFIFOBuffer(const BasicSpscFIFOBuffer&);
+	BasicSpscFIFOBuffer& operator = (const BasicSpscFIFOBuffer&);
+
+	Buffer<T> _buffer;
+	std::atomic<std::size_t> _head; /// written by the producer
+	char _padding[64];              /// keep head and tail on separate cache lines
+	std::atomic<std::size_t> _tail; /// written by the consumer
+};
+
+
 typedef BasicFIFOBuffer<char> FIFOBuffer;
+typedef BasicSpscFIFOBuffer<char> SpscFIFOBuffer;
 
 
 } // namespace Poco
@@ -23,11 +23,16 @@
 #include "Poco/Timestamp.h"
 #include "Poco/Timespan.h"
 #include "Poco/Mutex.h"
+#include "Poco/Event.h"
+#include "Poco/RunnableAdapter.h"
+#include <atomic>
+#include <vector>
 
 
 namespace Poco {
 
 
+class Thread;
 class LogFile;
 class RotateStrategy;
 class ArchiveStrategy;
@@ -162,6 +167,29 @@ class Foundation_API FileChannel: public Channel
 	///            if it exists (unless other conditions for a rotation are met).
 	///            This is the default.
 	///
+	/// The async property moves the actual file I/O off the logging
+	/// thread: messages are appended to an in-memory buffer and written
+	/// to the log file in batches by a background thread. This takes
+	/// the write() system call and the rotation checks out of the
+	/// calling thread's latency path. Valid values are:
+	///
+	///   * true:  Messages are buffered and written by a background thread.
+	///   * false: Messages are written synchronously (default).
+	///
+	/// In async mode, the following additional properties apply:
+	///
+	///   * flushInterval:  Interval in milliseconds at which the
+	///                     background thread writes out the buffer
+	///                     (default 100). The buffer is also written
+	///                     early when it fills up.
+	///   * bufferSize:     Maximum number of buffered messages
+	///                     (default 8192).
+	///   * overflowPolicy: What to do when the buffer is full:
+	///                     "block" (default) makes the logging thread
+	///                     wait for room; "drop" discards the message
+	///                     and logs how many messages were lost with
+	///                     the next batch.
+	///
 	/// For a more lightweight file channel class, see SimpleFileChannel.
 {
 public:
@@ -231,6 +259,10 @@ public:
 	static const std::string PROP_PURGECOUNT;
 	static const std::string PROP_FLUSH;
 	static const std::string PROP_ROTATEONOPEN;
+	static const std::string PROP_ASYNC;
+	static const std::string PROP_FLUSHINTERVAL;
+	static const std::string PROP_BUFFERSIZE;
+	static const std::string PROP_OVERFLOWPOLICY;
 
 protected:
 	~FileChannel();
@@ -241,6 +273,8 @@ protected:
 	void setPurgeCount(const std::string& count);
 	void setFlush(const std::string& flush);
 	void setRotateOnOpen(const std::string& rotateOnOpen);
+	void setAsync(const std::string& async);
+	void setOverflowPolicy(const std::string& policy);
 	void purge();
 
 private:
@@ -248,6 +282,12 @@ private:
 	int extractDigit(const std::string& value, std::string::const_iterator* nextToDigit = NULL) const;
 	void setPurgeStrategy(PurgeStrategy* strategy);
 	Timespan::TimeDiff extractFactor(const std::string& value, std::string::const_iterator start) const;
+	void rotateIfNeeded();
+	void logAsync(const std::string& text);
+	void runFlusher();
+	void flushBuffer(std::vector<std::string>& back);
+	void startFlusher();
+	void stopFlusher();
 
 	std::string      _path;
 	std::string      _times;
@@ -258,10 +298,22 @@ private:
 	std::string      _purgeCount;
 	bool             _flush;
 	bool             _rotateOnOpen;
+	bool             _async;
+	long             _flushInterval;
+	std::size_t      _bufferSize;
+	bool             _dropOnOverflow;
 	LogFile*         _pFile;
 	RotateStrategy*  _pRotateStrategy;
 	ArchiveStrategy* _pArchiveStrategy;
 	PurgeStrategy*   _pPurgeStrategy;
+	std::vector<std::string> _buffer;
+	std::size_t      _dropped;
+	RunnableAdapter<FileChannel> _flusherAdapter;
+	Thread*          _pFlusherThread;
+	std::atomic<bool> _flusherStopped;
+	Event            _flushEvent;
+	Event            _notFull;
+	FastMutex        _bufferMutex;
 	FastMutex        _mutex;
 };
 
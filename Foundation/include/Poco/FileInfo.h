@@ -0,0 +1,170 @@
+//
+// FileInfo.h
+//
+// Library: Foundation
+// Package: Filesystem
+// Module:  FileInfo
+//
+// Definition of the FileInfo class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_FileInfo_INCLUDED
+#define Foundation_FileInfo_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/File.h"
+#include "Poco/Timestamp.h"
+
+
+namespace Poco {
+
+
+class Foundation_API FileInfo
+	/// A snapshot of a file's metadata, obtained with a single
+	/// stat() call.
+	///
+	/// Poco::File issues one system call per query, so the common
+	/// sequence exists()/getSize()/getLastModified() on the same
+	/// path triples the syscalls -- per request, in a static file
+	/// server. A FileInfo captures everything in one call:
+	///
+	///     FileInfo info(path);
+	///     if (info.exists() && info.isFile())
+	///         serve(path, info.size(), info.lastModified());
+	///
+	/// The snapshot does not follow later changes to the file;
+	/// call update() to refresh it.
+{
+public:
+	explicit FileInfo(const std::string& path);
+		/// Creates the FileInfo for the given path, capturing the
+		/// file's metadata. A non-existent file yields a FileInfo
+		/// with exists() == false (no exception is thrown).
+
+	void update();
+		/// Refreshes the snapshot with a new stat() call.
+
+	const std::string& path() const;
+		/// Returns the path the snapshot was taken of.
+
+	bool exists() const;
+		/// Returns true if the file existed when the snapshot
+		/// was taken.
+
+	bool isFile() const;
+		/// Returns true if the entry is a regular file.
+
+	bool isDirectory() const;
+		/// Returns true if the entry is a directory.
+
+	bool isLink() const;
+		/// Returns true if the entry is a symbolic link.
+
+	File::FileSize size() const;
+		/// Returns the file's size in bytes (0 if it does
+		/// not exist).
+
+	Timestamp lastModified() const;
+		/// Returns the file's last modification time (0 if it
+		/// does not exist).
+
+	bool canRead() const;
+		/// Returns true if the file is readable by the
+		/// current user.
+
+	bool canWrite() const;
+		/// Returns true if the file is writeable by the
+		/// current user.
+
+	bool canExecute() const;
+		/// Returns true if the file is executable by the
+		/// current user.
+
+private:
+	std::string    _path;
+	bool           _exists;
+	bool           _isFile;
+	bool           _isDirectory;
+	bool           _isLink;
+	bool           _canRead;
+	bool           _canWrite;
+	bool           _canExecute;
+	File::FileSize _size;
+	Timestamp      _lastModified;
+};
+
+
+//
+// inlines
+//
+inline const std::string& FileInfo::path() const
+{
+	return _path;
+}
+
+
+inline bool FileInfo::exists() const
+{
+	return _exists;
+}
+
+
+inline bool FileInfo::isFile() const
+{
+	return _isFile;
+}
+
+
+inline bool FileInfo::isDirectory() const
+{
+	return _isDirectory;
+}
+
+
+inline bool FileInfo::isLink() const
+{
+	return _isLink;
+}
+
+
+inline File::FileSize FileInfo::size() const
+{
+	return _size;
+}
+
+
+inline Timestamp FileInfo::lastModified() const
+{
+	return _lastModified;
+}
+
+
+inline bool FileInfo::canRead() const
+{
+	return _canRead;
+}
+
+
+inline bool FileInfo::canWrite() const
+{
+	return _canWrite;
+}
+
+
+inline bool FileInfo::canExecute() const
+{
+	return _canExecute;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_FileInfo_INCLUDED
@@ -50,6 +50,10 @@ public:
 	std::streampos seekpos(std::streampos pos, std::ios::openmode mode = std::ios::in | std::ios::out);
 		/// Change to specified position, according to mode.
 
+	int nativeHandle() const;
+		/// Returns the underlying file descriptor, or -1 if
+		/// the stream buffer is not open.
+
 protected:
 	enum
 	{
@@ -20,8 +20,15 @@
 
 #include "Poco/Foundation.h"
 #include "Poco/Any.h"
+#include "Poco/Ascii.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
 #include <vector>
 #include <type_traits>
+#include <sstream>
+#if !defined(POCO_NO_LOCALE)
+#include <locale>
+#endif
 
 
 namespace Poco {
@@ -139,6 +146,292 @@ std::string format(FMT &fmt, T arg1, Args... args)
 }
 
 
+//
+// formatv: variadic formatting without Any boxing
+//
+
+
+namespace Impl {
+
+
+struct FormatSpec
+	/// Parsed representation of a single %-format specification,
+	/// used by the non-boxing formatv() path.
+{
+	char flags[4];
+	int  nFlags;
+	int  width;
+	int  prec;
+	char mod;
+	char type;
+};
+
+
+inline bool parseFormatSpec(std::string::const_iterator& itFmt, const std::string::const_iterator& endFmt, FormatSpec& spec)
+	/// Parses a format specification following a percent sign.
+	/// Returns false for constructs formatv() does not support
+	/// (positional %[<index>] addressing and '*' width/precision).
+{
+	spec.nFlags = 0;
+	spec.width  = 0;
+	spec.prec   = -1;
+	spec.mod    = 0;
+	spec.type   = 0;
+	if (itFmt != endFmt && *itFmt == '[') return false;
+	bool isFlag = true;
+	while (isFlag && itFmt != endFmt)
+	{
+		switch (*itFmt)
+		{
+		case '-':
+		case '+':
+		case '0':
+		case '#':
+			if (spec.nFlags < 4) spec.flags[spec.nFlags++] = *itFmt;
+			++itFmt;
+			break;
+		default:
+			isFlag = false;
+			break;
+		}
+	}
+	if (itFmt != endFmt && *itFmt == '*') return false;
+	while (itFmt != endFmt && Ascii::isDigit(*itFmt))
+	{
+		spec.width = 10*spec.width + *itFmt - '0';
+		++itFmt;
+	}
+	if (itFmt != endFmt && *itFmt == '.')
+	{
+		++itFmt;
+		if (itFmt != endFmt && *itFmt == '*') return false;
+		spec.prec = 0;
+		while (itFmt != endFmt && Ascii::isDigit(*itFmt))
+		{
+			spec.prec = 10*spec.prec + *itFmt - '0';
+			++itFmt;
+		}
+	}
+	if (itFmt != endFmt)
+	{
+		switch (*itFmt)
+		{
+		case 'l':
+		case 'h':
+		case 'L':
+		case '?':
+			spec.mod = *itFmt++;
+			break;
+		}
+	}
+	if (itFmt == endFmt) return false;
+	spec.type = *itFmt++;
+	return true;
+}
+
+
+inline bool isConsumingFormatType(char type)
+	/// Returns true iff the given type specifier consumes an argument.
+{
+	switch (type)
+	{
+	case 'b': case 'c': case 'd': case 'i': case 'o': case 'u':
+	case 'x': case 'X': case 'e': case 'E': case 'f': case 's': case 'z':
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+template <typename T>
+void formatValueSlow(std::string& result, const FormatSpec& spec, const T& value)
+	/// Formats a single value with the full flags/width/precision
+	/// machinery through an output string stream. Only used when the
+	/// specification carries formatting options the direct path
+	/// cannot handle.
+{
+	std::ostringstream str;
+#if !defined(POCO_NO_LOCALE)
+	str.imbue(std::locale::classic());
+#endif
+	for (int i = 0; i < spec.nFlags; i++)
+	{
+		switch (spec.flags[i])
+		{
+		case '-': str.setf(std::ios::left); break;
+		case '+': str.setf(std::ios::showpos); break;
+		case '0': str.fill('0'); str.setf(std::ios::internal); break;
+		case '#': str.setf(std::ios::showpoint | std::ios::showbase); break;
+		}
+	}
+	if (spec.width > 0) str.width(spec.width);
+	if (spec.prec >= 0) str.precision(spec.prec);
+	switch (spec.type)
+	{
+	case 'o': str << std::oct; break;
+	case 'x': str << std::hex; break;
+	case 'X': str << std::hex << std::uppercase; break;
+	case 'e': str << std::scientific; break;
+	case 'E': str << std::scientific << std::uppercase; break;
+	case 'f': str << std::fixed; break;
+	}
+	str << value;
+	result.append(str.str());
+}
+
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, void>::type
+appendFormatValue(std::string& result, const FormatSpec& spec, T value)
+{
+	if (spec.nFlags == 0 && spec.width == 0 && spec.prec < 0)
+	{
+		switch (spec.type)
+		{
+		case 'b': result += (value ? '1' : '0'); return;
+		case 'c': result += static_cast<char>(value); return;
+		case 'd':
+		case 'i': NumberFormatter::append(result, static_cast<Int64>(value)); return;
+		case 'u':
+		case 'z': NumberFormatter::append(result, static_cast<UInt64>(value)); return;
+		case 'X': NumberFormatter::appendHex(result, static_cast<UInt64>(value)); return;
+		}
+	}
+	switch (spec.type)
+	{
+	case 'b': formatValueSlow(result, spec, static_cast<int>(value ? 1 : 0)); break;
+	case 'c': formatValueSlow(result, spec, static_cast<char>(value)); break;
+	case 'o':
+	case 'u':
+	case 'x':
+	case 'X':
+	case 'z': formatValueSlow(result, spec, static_cast<UInt64>(value)); break;
+	default:  formatValueSlow(result, spec, static_cast<Int64>(value)); break;
+	}
+}
+
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, void>::type
+appendFormatValue(std::string& result, const FormatSpec& spec, T value)
+{
+	if (spec.nFlags == 0 && spec.width == 0 && spec.type == 'f')
+	{
+		NumberFormatter::append(result, static_cast<double>(value), spec.prec >= 0 ? spec.prec : 6);
+		return;
+	}
+	formatValueSlow(result, spec, static_cast<double>(value));
+}
+
+
+template <typename T>
+typename std::enable_if<!std::is_integral<T>::value && !std::is_floating_point<T>::value, void>::type
+appendFormatValue(std::string& result, const FormatSpec& spec, const T& value)
+{
+	formatValueSlow(result, spec, value);
+}
+
+
+inline void appendFormatValue(std::string& result, const FormatSpec& spec, const std::string& value)
+{
+	if (spec.nFlags == 0 && spec.width == 0 && spec.prec < 0)
+		result.append(value);
+	else
+		formatValueSlow(result, spec, value);
+}
+
+
+inline void appendFormatValue(std::string& result, const FormatSpec& spec, const char* value)
+{
+	if (spec.nFlags == 0 && spec.width == 0 && spec.prec < 0)
+		result.append(value);
+	else
+		formatValueSlow(result, spec, value);
+}
+
+
+inline void formatvImpl(std::string& result, std::string::const_iterator& itFmt, const std::string::const_iterator& endFmt)
+	/// Recursion base case: no values left; remaining format
+	/// specifiers are copied verbatim, like format() does.
+{
+	while (itFmt != endFmt)
+	{
+		if (*itFmt == '%')
+		{
+			++itFmt;
+			if (itFmt != endFmt) result += *itFmt++;
+		}
+		else result += *itFmt++;
+	}
+}
+
+
+template <typename T, typename... Args>
+void formatvImpl(std::string& result, std::string::const_iterator& itFmt, const std::string::const_iterator& endFmt, const T& value, const Args&... args)
+{
+	while (itFmt != endFmt)
+	{
+		if (*itFmt == '%')
+		{
+			++itFmt;
+			if (itFmt == endFmt) return;
+			FormatSpec spec;
+			if (!parseFormatSpec(itFmt, endFmt, spec))
+				throw InvalidArgumentException("formatv: unsupported format specification");
+			if (isConsumingFormatType(spec.type))
+			{
+				appendFormatValue(result, spec, value);
+				formatvImpl(result, itFmt, endFmt, args...);
+				return;
+			}
+			result += spec.type;
+		}
+		else
+		{
+			result += *itFmt;
+			++itFmt;
+		}
+	}
+}
+
+
+} // namespace Impl
+
+
+template <typename... Args>
+void formatv(std::string& result, const std::string& fmt, const Args&... args)
+	/// Appends the formatted string to result, like format(), but
+	/// formats each argument directly from its static type instead
+	/// of boxing it into an Any. Common specifications without
+	/// flags, width and precision are formatted via NumberFormatter
+	/// without any stream or heap allocation, making this the
+	/// preferred path for hot formatting code such as logging.
+	///
+	/// The %-specification syntax is the same as for format(), with
+	/// two differences: positional %[<index>] addressing and '*'
+	/// width/precision are not supported and cause an
+	/// InvalidArgumentException to be thrown; and since arguments
+	/// are formatted from their actual type, the <modifier>
+	/// characters and mismatched type specifiers never produce
+	/// [ERRFMT] -- the argument's value is formatted as-is.
+{
+	std::string::const_iterator itFmt  = fmt.begin();
+	std::string::const_iterator endFmt = fmt.end();
+	Impl::formatvImpl(result, itFmt, endFmt, args...);
+}
+
+
+template <typename... Args>
+std::string formatv(const std::string& fmt, const Args&... args)
+	/// Returns the formatted string. See formatv() above.
+{
+	std::string result;
+	formatv(result, fmt, args...);
+	return result;
+}
+
+
 } // namespace Poco
 
 
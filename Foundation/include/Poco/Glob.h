@@ -138,6 +138,7 @@ protected:
 
 private:
 	std::string _pattern;
+	std::string _literalPrefix; /// pattern bytes before the first metacharacter
 	int         _options;
 
 	Glob();
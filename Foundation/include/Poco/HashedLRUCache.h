@@ -0,0 +1,61 @@
+//
+// HashedLRUCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  HashedLRUCache
+//
+// Definition of the HashedLRUCache class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_HashedLRUCache_INCLUDED
+#define Foundation_HashedLRUCache_INCLUDED
+
+
+#include "Poco/AbstractCache.h"
+#include "Poco/HashedLRUStrategy.h"
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue,
+	class THash = Hash<TKey>,
+	class TMutex = FastMutex,
+	class TEventMutex = FastMutex
+>
+class HashedLRUCache: public AbstractCache<TKey, TValue, HashedLRUStrategy<TKey, TValue, THash>, TMutex, TEventMutex>
+	/// An HashedLRUCache implements Least Recently Used caching like
+	/// LRUCache, but with a hash-indexed access list, so get/add/remove
+	/// run in O(1) instead of O(log n). TKey must be hashable (by
+	/// default through Poco::Hash). The default size for a cache is
+	/// 1024 entries.
+{
+public:
+	HashedLRUCache(std::size_t size = 1024):
+		AbstractCache<TKey, TValue, HashedLRUStrategy<TKey, TValue, THash>, TMutex, TEventMutex>(HashedLRUStrategy<TKey, TValue, THash>(size))
+	{
+	}
+
+	~HashedLRUCache()
+	{
+	}
+
+private:
+	HashedLRUCache(const HashedLRUCache& aCache);
+	HashedLRUCache& operator = (const HashedLRUCache& aCache);
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_HashedLRUCache_INCLUDED
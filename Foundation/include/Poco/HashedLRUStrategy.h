@@ -0,0 +1,148 @@
+//
+// HashedLRUStrategy.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  HashedLRUStrategy
+//
+// Definition of the HashedLRUStrategy class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_HashedLRUStrategy_INCLUDED
+#define Foundation_HashedLRUStrategy_INCLUDED
+
+
+#include "Poco/KeyValueArgs.h"
+#include "Poco/ValidArgs.h"
+#include "Poco/AbstractStrategy.h"
+#include "Poco/HashMap.h"
+#include "Poco/EventArgs.h"
+#include "Poco/Exception.h"
+#include <list>
+#include <set>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+template <class TKey, class TValue, class THash = Hash<TKey> >
+class HashedLRUStrategy: public AbstractStrategy<TKey, TValue>
+	/// An HashedLRUStrategy implements least recently used cache
+	/// replacement, like LRUStrategy, but indexes the access list
+	/// with a HashMap instead of a std::map, so that cache hits,
+	/// inserts and removals run in O(1) instead of O(log n) --
+	/// a measurable difference for caches with very many entries.
+	///
+	/// TKey must be hashable through the given hash function
+	/// (by default Poco::Hash).
+{
+public:
+	typedef std::list<TKey>                   Keys;
+	typedef typename Keys::iterator           Iterator;
+	typedef typename Keys::const_iterator     ConstIterator;
+	typedef HashMap<TKey, Iterator, THash>    KeyIndex;
+	typedef typename KeyIndex::Iterator       IndexIterator;
+	typedef typename KeyIndex::ConstIterator  ConstIndexIterator;
+
+public:
+	HashedLRUStrategy(std::size_t size):
+		_size(size)
+	{
+		if (_size < 1) throw InvalidArgumentException("size must be > 0");
+	}
+
+	~HashedLRUStrategy()
+	{
+	}
+
+	void onAdd(const void*, const KeyValueArgs <TKey, TValue>& args)
+	{
+		_keys.push_front(args.key());
+		std::pair<IndexIterator, bool> stat = _keyIndex.insert(std::make_pair(args.key(), _keys.begin()));
+		if (!stat.second)
+		{
+			stat.first->second = _keys.begin();
+		}
+	}
+
+	void onRemove(const void*, const TKey& key)
+	{
+		IndexIterator it = _keyIndex.find(key);
+
+		if (it != _keyIndex.end())
+		{
+			_keys.erase(it->second);
+			_keyIndex.erase(it);
+		}
+	}
+
+	void onGet(const void*, const TKey& key)
+	{
+		// LRU: in case of an hit, move to begin
+		IndexIterator it = _keyIndex.find(key);
+
+		if (it != _keyIndex.end())
+		{
+			_keys.splice(_keys.begin(), _keys, it->second);
+			it->second = _keys.begin();
+		}
+	}
+
+	void onClear(const void*, const EventArgs& args)
+	{
+		_keys.clear();
+		_keyIndex.clear();
+	}
+
+	void onIsValid(const void*, ValidArgs<TKey>& args)
+	{
+		if (_keyIndex.find(args.key()) == _keyIndex.end())
+		{
+			args.invalidate();
+		}
+	}
+
+	void onReplace(const void*, std::set<TKey>& elemsToRemove)
+	{
+		// Note: replace only informs the cache which elements
+		// it would like to remove!
+		// it does not remove them on its own!
+		std::size_t curSize = _keyIndex.size();
+
+		if (curSize < _size)
+		{
+			return;
+		}
+
+		std::size_t diff = curSize - _size;
+		Iterator it = --_keys.end(); //--keys can never be invoked on an empty list due to the minSize==1 requirement of LRU
+		std::size_t i = 0;
+
+		while (i++ < diff)
+		{
+			elemsToRemove.insert(*it);
+			if (it != _keys.begin())
+			{
+				--it;
+			}
+		}
+	}
+
+protected:
+	Keys      _keys;
+	KeyIndex  _keyIndex;
+	std::size_t _size;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_HashedLRUStrategy_INCLUDED
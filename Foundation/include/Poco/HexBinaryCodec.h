@@ -0,0 +1,75 @@
+//
+// HexBinaryCodec.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  HexBinaryCodec
+//
+// Definition of the HexBinaryCodec class.
+//
+// Copyright (c) 2009, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_HexBinaryCodec_INCLUDED
+#define Foundation_HexBinaryCodec_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <string>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API HexBinaryCodec
+	/// Bulk, buffer-oriented hexBinary encoding and decoding; the
+	/// contiguous-buffer counterpart of HexBinaryEncoder/Decoder,
+	/// following the Base64Codec pattern.
+	///
+	/// Encoding emits two characters per input byte from a
+	/// 512-entry byte-pair table (one 16-bit store per byte instead
+	/// of two nibble lookups through a streambuf), which is where
+	/// digest-hex-encoding CPU time goes. No line breaks are
+	/// inserted; uppercase output is available via an option.
+{
+public:
+	enum Options
+	{
+		OPT_UPPERCASE = 1 /// encode to upper-case hex digits
+	};
+
+	static std::size_t encodedLength(std::size_t dataLength);
+		/// Returns the number of characters encode() produces for
+		/// dataLength input bytes (2*dataLength).
+
+	static void encode(const void* data, std::size_t length, std::string& hex, int options = 0);
+		/// Hex-encodes the given buffer, replacing the contents
+		/// of hex.
+
+	static std::string encode(const void* data, std::size_t length, int options = 0);
+		/// Hex-encodes the given buffer and returns the
+		/// encoded string.
+
+	static bool decode(const std::string& hex, std::string& data);
+		/// Decodes the given hex string, replacing the contents of
+		/// data. Both digit cases are accepted; ASCII whitespace is
+		/// skipped.
+		///
+		/// Returns false if the input contains a non-hex,
+		/// non-whitespace character or ends on an odd digit; data
+		/// then contains the bytes decoded up to that point.
+
+private:
+	HexBinaryCodec();
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_HexBinaryCodec_INCLUDED
@@ -60,7 +60,12 @@ public:
 		
 	void setUppercase(bool flag = true);
 		/// Specify whether hex digits a-f are written in upper or lower case.
-	
+
+protected:
+	std::streamsize xsputn(const char* s, std::streamsize count);
+		/// Bulk path: encodes whole buffers through
+		/// HexBinaryCodec's pair table instead of per character.
+
 private:
 	int writeToDevice(char c);
 
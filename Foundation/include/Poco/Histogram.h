@@ -0,0 +1,102 @@
+//
+// Histogram.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  Histogram
+//
+// Definition of the Histogram class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Histogram_INCLUDED
+#define Foundation_Histogram_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <atomic>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API Histogram
+	/// A lock-free, fixed-memory latency/value histogram for
+	/// hot-path instrumentation.
+	///
+	/// Values are recorded into logarithmically spaced buckets
+	/// (powers of two with four linear sub-buckets each, giving a
+	/// worst-case quantile error of ~12.5%) using one atomic
+	/// increment -- safe to call concurrently from any number of
+	/// threads with no locking. Quantiles, count, and sum are
+	/// derived on demand by the (typically rare) reader.
+	///
+	/// The intended use is recording microsecond durations measured
+	/// with Stopwatch or Clock, but any non-negative 64-bit values
+	/// work:
+	///
+	///     Histogram requestLatency;
+	///     ...
+	///     Stopwatch sw; sw.start();
+	///     handleRequest();
+	///     requestLatency.record(sw.elapsed());
+	///     ...
+	///     Int64 p99 = requestLatency.quantile(0.99);
+{
+public:
+	Histogram();
+		/// Creates an empty Histogram.
+
+	void record(Int64 value);
+		/// Records a value (negative values count as zero).
+		/// One relaxed atomic increment; wait-free.
+
+	UInt64 count() const;
+		/// Returns the number of recorded values.
+
+	Int64 sum() const;
+		/// Returns the (approximate) sum of all recorded values.
+
+	Int64 quantile(double q) const;
+		/// Returns an approximation of the q-quantile (0 <= q <= 1)
+		/// of the recorded values, e.g. quantile(0.5) for the
+		/// median or quantile(0.99) for the 99th percentile.
+
+	Int64 max() const;
+		/// Returns an upper bound of the largest recorded value.
+
+	void reset();
+		/// Resets all buckets. Not atomic with respect to
+		/// concurrent record() calls; values recorded during the
+		/// reset may or may not be counted.
+
+	enum
+	{
+		SUB_BUCKET_BITS = 2,
+		SUB_BUCKETS     = 1 << SUB_BUCKET_BITS,
+		BUCKETS         = 64*SUB_BUCKETS
+	};
+
+private:
+	Histogram(const Histogram&);
+	Histogram& operator = (const Histogram&);
+
+	static std::size_t bucketFor(Int64 value);
+	static Int64 bucketUpperBound(std::size_t index);
+
+	std::atomic<UInt64> _buckets[BUCKETS];
+	std::atomic<UInt64> _count;
+	std::atomic<Int64>  _sum;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Histogram_INCLUDED
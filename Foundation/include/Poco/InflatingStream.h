@@ -79,6 +79,11 @@ public:
 		
 	void reset();
 		/// Resets the stream buffer.
+
+	void reset(std::istream& istr);
+		/// Resets the zlib machinery (reusing the allocated inflate
+		/// state) and attaches the stream buffer to the given new
+		/// input stream. Only valid for input stream buffers.
 		
 protected:
 	int readFromDevice(char* buffer, std::streamsize length);
@@ -202,6 +207,10 @@ public:
 	void reset();
 		/// Resets the zlib machinery so that another zlib stream can be read from
 		/// the same underlying input stream.
+
+	void reset(std::istream& istr);
+		/// Resets the zlib machinery (reusing its allocated state)
+		/// and attaches the stream to the given new input stream.
 };
 
 
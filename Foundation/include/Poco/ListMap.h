@@ -141,7 +141,18 @@ public:
 		while (it != _list.end() && isEqual(it->first, val.first)) ++it;
 		return _list.insert(it, val);
 	}
-	
+
+	Iterator insert(ValueType&& val)
+		/// Inserts the value into the map by moving it, avoiding
+		/// a copy of the mapped value. Ordering semantics are the
+		/// same as for the copying insert().
+		/// Returns iterator pointing to the newly inserted value
+	{
+		Iterator it = find(val.first);
+		while (it != _list.end() && isEqual(it->first, val.first)) ++it;
+		return _list.insert(it, std::move(val));
+	}
+
 	void erase(Iterator it)
 	{
 		_list.erase(it);
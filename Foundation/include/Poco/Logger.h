@@ -23,6 +23,7 @@
 #include "Poco/Message.h"
 #include "Poco/Format.h"
 #include "Poco/AutoPtr.h"
+#include "Poco/RWLock.h"
 #include <map>
 #include <vector>
 #include <cstddef>
@@ -474,133 +475,147 @@ private:
 
 	// definitions in Foundation.cpp
 	static LoggerMapPtr _pLoggerMap;
-	static Mutex        _mapMtx;
+	static RWLock       _mapMtx;
 };
 
 
 //
 // convenience macros
 //
+//
+// Logging macros
+//
+// POCO_MIN_LOG_LEVEL sets a compile-time level floor for all
+// logging macros: calls logging below it (numerically above, in
+// Message::Priority terms) compile to nothing, so the arguments are
+// dead-stripped entirely. The default admits every level; a release
+// build of debug-heavy code might set it to 6 (PRIO_INFORMATION).
+//
+#if !defined(POCO_MIN_LOG_LEVEL)
+#define POCO_MIN_LOG_LEVEL 8
+#endif
+
+
 #define poco_fatal(logger, msg) \
-	if ((logger).fatal()) (logger).fatal(msg, __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 1 && (logger).fatal()) (logger).fatal(msg, __FILE__, __LINE__); else (void) 0
 
 #define poco_fatal_f1(logger, fmt, arg1) \
-	if ((logger).fatal()) (logger).fatal(Poco::format((fmt), arg1), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 1 && (logger).fatal()) (logger).fatal(Poco::format((fmt), arg1), __FILE__, __LINE__); else (void) 0
 
 #define poco_fatal_f2(logger, fmt, arg1, arg2) \
-	if ((logger).fatal()) (logger).fatal(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 1 && (logger).fatal()) (logger).fatal(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
 
 #define poco_fatal_f3(logger, fmt, arg1, arg2, arg3) \
-	if ((logger).fatal()) (logger).fatal(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 1 && (logger).fatal()) (logger).fatal(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
 
 #define poco_fatal_f4(logger, fmt, arg1, arg2, arg3, arg4) \
-	if ((logger).fatal()) (logger).fatal(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 1 && (logger).fatal()) (logger).fatal(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
 
 #define poco_critical(logger, msg) \
-	if ((logger).critical()) (logger).critical(msg, __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 2 && (logger).critical()) (logger).critical(msg, __FILE__, __LINE__); else (void) 0
 
 #define poco_critical_f1(logger, fmt, arg1) \
-	if ((logger).critical()) (logger).critical(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 2 && (logger).critical()) (logger).critical(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
 
 #define poco_critical_f2(logger, fmt, arg1, arg2) \
-	if ((logger).critical()) (logger).critical(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 2 && (logger).critical()) (logger).critical(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
 
 #define poco_critical_f3(logger, fmt, arg1, arg2, arg3) \
-	if ((logger).critical()) (logger).critical(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 2 && (logger).critical()) (logger).critical(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
 
 #define poco_critical_f4(logger, fmt, arg1, arg2, arg3, arg4) \
-	if ((logger).critical()) (logger).critical(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 2 && (logger).critical()) (logger).critical(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
 
 #define poco_error(logger, msg) \
-	if ((logger).error()) (logger).error(msg, __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 3 && (logger).error()) (logger).error(msg, __FILE__, __LINE__); else (void) 0
 
 #define poco_error_f1(logger, fmt, arg1) \
-	if ((logger).error()) (logger).error(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 3 && (logger).error()) (logger).error(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
 
 #define poco_error_f2(logger, fmt, arg1, arg2) \
-	if ((logger).error()) (logger).error(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 3 && (logger).error()) (logger).error(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
 
 #define poco_error_f3(logger, fmt, arg1, arg2, arg3) \
-	if ((logger).error()) (logger).error(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 3 && (logger).error()) (logger).error(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
 
 #define poco_error_f4(logger, fmt, arg1, arg2, arg3, arg4) \
-	if ((logger).error()) (logger).error(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 3 && (logger).error()) (logger).error(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
 
 #define poco_warning(logger, msg) \
-	if ((logger).warning()) (logger).warning(msg, __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 4 && (logger).warning()) (logger).warning(msg, __FILE__, __LINE__); else (void) 0
 
 #define poco_warning_f1(logger, fmt, arg1) \
-	if ((logger).warning()) (logger).warning(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 4 && (logger).warning()) (logger).warning(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
 
 #define poco_warning_f2(logger, fmt, arg1, arg2) \
-	if ((logger).warning()) (logger).warning(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 4 && (logger).warning()) (logger).warning(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
 
 #define poco_warning_f3(logger, fmt, arg1, arg2, arg3) \
-	if ((logger).warning()) (logger).warning(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 4 && (logger).warning()) (logger).warning(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
 
 #define poco_warning_f4(logger, fmt, arg1, arg2, arg3, arg4) \
-	if ((logger).warning()) (logger).warning(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 4 && (logger).warning()) (logger).warning(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
 	
 #define poco_notice(logger, msg) \
-	if ((logger).notice()) (logger).notice(msg, __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 5 && (logger).notice()) (logger).notice(msg, __FILE__, __LINE__); else (void) 0
 
 #define poco_notice_f1(logger, fmt, arg1) \
-	if ((logger).notice()) (logger).notice(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 5 && (logger).notice()) (logger).notice(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
 
 #define poco_notice_f2(logger, fmt, arg1, arg2) \
-	if ((logger).notice()) (logger).notice(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 5 && (logger).notice()) (logger).notice(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
 
 #define poco_notice_f3(logger, fmt, arg1, arg2, arg3) \
-	if ((logger).notice()) (logger).notice(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 5 && (logger).notice()) (logger).notice(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
 
 #define poco_notice_f4(logger, fmt, arg1, arg2, arg3, arg4) \
-	if ((logger).notice()) (logger).notice(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 5 && (logger).notice()) (logger).notice(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
 
 #define poco_information(logger, msg) \
-	if ((logger).information()) (logger).information(msg, __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 6 && (logger).information()) (logger).information(msg, __FILE__, __LINE__); else (void) 0
 
 #define poco_information_f1(logger, fmt, arg1) \
-	if ((logger).information()) (logger).information(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 6 && (logger).information()) (logger).information(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
 
 #define poco_information_f2(logger, fmt, arg1, arg2) \
-	if ((logger).information()) (logger).information(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 6 && (logger).information()) (logger).information(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
 
 #define poco_information_f3(logger, fmt, arg1, arg2, arg3) \
-	if ((logger).information()) (logger).information(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 6 && (logger).information()) (logger).information(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
 
 #define poco_information_f4(logger, fmt, arg1, arg2, arg3, arg4) \
-	if ((logger).information()) (logger).information(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
+	if (POCO_MIN_LOG_LEVEL >= 6 && (logger).information()) (logger).information(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
 
 #if defined(_DEBUG) || defined(POCO_LOG_DEBUG)
 	#define poco_debug(logger, msg) \
-		if ((logger).debug()) (logger).debug(msg, __FILE__, __LINE__); else (void) 0
+		if (POCO_MIN_LOG_LEVEL >= 7 && (logger).debug()) (logger).debug(msg, __FILE__, __LINE__); else (void) 0
 
 	#define poco_debug_f1(logger, fmt, arg1) \
-		if ((logger).debug()) (logger).debug(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
+		if (POCO_MIN_LOG_LEVEL >= 7 && (logger).debug()) (logger).debug(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
 
 	#define poco_debug_f2(logger, fmt, arg1, arg2) \
-		if ((logger).debug()) (logger).debug(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
+		if (POCO_MIN_LOG_LEVEL >= 7 && (logger).debug()) (logger).debug(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
 
 	#define poco_debug_f3(logger, fmt, arg1, arg2, arg3) \
-		if ((logger).debug()) (logger).debug(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
+		if (POCO_MIN_LOG_LEVEL >= 7 && (logger).debug()) (logger).debug(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
 
 	#define poco_debug_f4(logger, fmt, arg1, arg2, arg3, arg4) \
-		if ((logger).debug()) (logger).debug(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
+		if (POCO_MIN_LOG_LEVEL >= 7 && (logger).debug()) (logger).debug(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
 
 	#define poco_trace(logger, msg) \
-		if ((logger).trace()) (logger).trace(msg, __FILE__, __LINE__); else (void) 0
+		if (POCO_MIN_LOG_LEVEL >= 8 && (logger).trace()) (logger).trace(msg, __FILE__, __LINE__); else (void) 0
 
 	#define poco_trace_f1(logger, fmt, arg1) \
-		if ((logger).trace()) (logger).trace(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
+		if (POCO_MIN_LOG_LEVEL >= 8 && (logger).trace()) (logger).trace(Poco::format((fmt), (arg1)), __FILE__, __LINE__); else (void) 0
 
 	#define poco_trace_f2(logger, fmt, arg1, arg2) \
-		if ((logger).trace()) (logger).trace(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
+		if (POCO_MIN_LOG_LEVEL >= 8 && (logger).trace()) (logger).trace(Poco::format((fmt), (arg1), (arg2)), __FILE__, __LINE__); else (void) 0
 
 	#define poco_trace_f3(logger, fmt, arg1, arg2, arg3) \
-		if ((logger).trace()) (logger).trace(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
+		if (POCO_MIN_LOG_LEVEL >= 8 && (logger).trace()) (logger).trace(Poco::format((fmt), (arg1), (arg2), (arg3)), __FILE__, __LINE__); else (void) 0
 
 	#define poco_trace_f4(logger, fmt, arg1, arg2, arg3, arg4) \
-		if ((logger).trace()) (logger).trace(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
+		if (POCO_MIN_LOG_LEVEL >= 8 && (logger).trace()) (logger).trace(Poco::format((fmt), (arg1), (arg2), (arg3), (arg4)), __FILE__, __LINE__); else (void) 0
 #else
 	#define poco_debug(logger, msg)
 	#define poco_debug_f1(logger, fmt, arg1)
@@ -614,6 +629,53 @@ private:
 	#define poco_trace_f4(logger, fmt, arg1, arg2, arg3, arg4)
 #endif
 
+
+#define poco_log_lazy(logger, priority, callable) \
+	if (POCO_MIN_LOG_LEVEL >= static_cast<int>(priority) && (logger).is(priority)) \
+		(logger).log(Poco::Message((logger).name(), (callable)(), (priority), __FILE__, __LINE__)); \
+	else (void) 0
+	/// Logs the string returned by the given callable (typically a
+	/// lambda) at the given Message::Priority. The callable is only
+	/// invoked when the level is enabled, so arbitrarily expensive
+	/// message construction costs nothing on disabled levels:
+	///
+	///     poco_log_lazy(logger, Poco::Message::PRIO_DEBUG,
+	///         [&]() { return "state: " + expensiveDump(); });
+
+
+#define poco_fatal_v(logger, fmt, ...) \
+	if (POCO_MIN_LOG_LEVEL >= 1 && (logger).fatal()) (logger).fatal(Poco::formatv((fmt), __VA_ARGS__), __FILE__, __LINE__); else (void) 0
+
+#define poco_critical_v(logger, fmt, ...) \
+	if (POCO_MIN_LOG_LEVEL >= 2 && (logger).critical()) (logger).critical(Poco::formatv((fmt), __VA_ARGS__), __FILE__, __LINE__); else (void) 0
+
+#define poco_error_v(logger, fmt, ...) \
+	if (POCO_MIN_LOG_LEVEL >= 3 && (logger).error()) (logger).error(Poco::formatv((fmt), __VA_ARGS__), __FILE__, __LINE__); else (void) 0
+
+#define poco_warning_v(logger, fmt, ...) \
+	if (POCO_MIN_LOG_LEVEL >= 4 && (logger).warning()) (logger).warning(Poco::formatv((fmt), __VA_ARGS__), __FILE__, __LINE__); else (void) 0
+
+#define poco_notice_v(logger, fmt, ...) \
+	if (POCO_MIN_LOG_LEVEL >= 5 && (logger).notice()) (logger).notice(Poco::formatv((fmt), __VA_ARGS__), __FILE__, __LINE__); else (void) 0
+
+#define poco_information_v(logger, fmt, ...) \
+	if (POCO_MIN_LOG_LEVEL >= 6 && (logger).information()) (logger).information(Poco::formatv((fmt), __VA_ARGS__), __FILE__, __LINE__); else (void) 0
+	/// Like poco_information_fN, but variadic and built on the
+	/// non-boxing Poco::formatv: arguments are forwarded untouched
+	/// (no Poco::Any boxing) and only when the level passes.
+
+#if defined(_DEBUG) || defined(POCO_LOG_DEBUG)
+	#define poco_debug_v(logger, fmt, ...) \
+		if (POCO_MIN_LOG_LEVEL >= 7 && (logger).debug()) (logger).debug(Poco::formatv((fmt), __VA_ARGS__), __FILE__, __LINE__); else (void) 0
+
+	#define poco_trace_v(logger, fmt, ...) \
+		if (POCO_MIN_LOG_LEVEL >= 8 && (logger).trace()) (logger).trace(Poco::formatv((fmt), __VA_ARGS__), __FILE__, __LINE__); else (void) 0
+#else
+	#define poco_debug_v(logger, fmt, ...)
+	#define poco_trace_v(logger, fmt, ...)
+#endif
+
+
 //
 // inlines
 //
@@ -0,0 +1,151 @@
+//
+// MappedFileInputStream.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  MappedFileInputStream
+//
+// Definition of the MappedFileInputStream class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_MappedFileInputStream_INCLUDED
+#define Foundation_MappedFileInputStream_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/SharedMemory.h"
+#include <istream>
+
+
+namespace Poco {
+
+
+class Foundation_API MappedFileStreamBuf: public std::streambuf
+	/// The streambuf class used by MappedFileInputStream.
+	///
+	/// The whole file is mapped into memory and the stream's get
+	/// area is the mapping itself, so reads never copy through an
+	/// intermediate buffer and never issue per-block read() system
+	/// calls. The kernel is advised of sequential access so
+	/// read-ahead covers large scans.
+{
+public:
+	MappedFileStreamBuf(const std::string& path);
+		/// Creates the MappedFileStreamBuf and maps the given file.
+		///
+		/// Throws a FileException if the file cannot be opened
+		/// or mapped.
+
+	~MappedFileStreamBuf();
+		/// Destroys the MappedFileStreamBuf and unmaps the file.
+
+	const char* data() const;
+		/// Returns a pointer to the start of the mapping, or a null
+		/// pointer for an empty file.
+
+	std::size_t size() const;
+		/// Returns the size of the mapped file.
+
+protected:
+	pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which);
+	pos_type seekpos(pos_type pos, std::ios_base::openmode which);
+
+private:
+	MappedFileStreamBuf(const MappedFileStreamBuf&);
+	MappedFileStreamBuf& operator = (const MappedFileStreamBuf&);
+
+	SharedMemory _memory;
+	std::size_t  _size;
+};
+
+
+class Foundation_API MappedFileIOS: public virtual std::ios
+	/// The base class for MappedFileInputStream.
+	///
+	/// This class is needed to ensure the correct initialization
+	/// order of the stream buffer and base classes.
+{
+public:
+	MappedFileIOS(const std::string& path);
+	~MappedFileIOS();
+	MappedFileStreamBuf* rdbuf();
+
+protected:
+	MappedFileStreamBuf _buf;
+};
+
+
+class Foundation_API MappedFileInputStream: public MappedFileIOS, public std::istream
+	/// An input stream for reading from a memory-mapped file.
+	///
+	/// Unlike FileInputStream, which reads through a small fixed
+	/// buffer (one read() system call every few kilobytes), the
+	/// entire file is mapped and bytes are served directly from the
+	/// mapping. This is the preferred way to scan large files
+	/// sequentially; for small files or streaming appends,
+	/// FileInputStream remains the better choice.
+{
+public:
+	MappedFileInputStream(const std::string& path);
+		/// Creates the MappedFileInputStream and maps the file with
+		/// the given path.
+		///
+		/// Throws a FileException if the file cannot be opened
+		/// or mapped.
+
+	~MappedFileInputStream();
+		/// Destroys the MappedFileInputStream.
+
+	const char* data() const;
+		/// Returns a pointer to the start of the mapping, or a null
+		/// pointer for an empty file. Allows zero-copy access to
+		/// the whole file contents.
+
+	std::size_t size() const;
+		/// Returns the size of the mapped file.
+};
+
+
+//
+// inlines
+//
+inline const char* MappedFileStreamBuf::data() const
+{
+	return _size > 0 ? _memory.begin() : 0;
+}
+
+
+inline std::size_t MappedFileStreamBuf::size() const
+{
+	return _size;
+}
+
+
+inline MappedFileStreamBuf* MappedFileIOS::rdbuf()
+{
+	return &_buf;
+}
+
+
+inline const char* MappedFileInputStream::data() const
+{
+	return _buf.data();
+}
+
+
+inline std::size_t MappedFileInputStream::size() const
+{
+	return _buf.size();
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_MappedFileInputStream_INCLUDED
@@ -193,9 +193,16 @@ public:
 		/// If the parameter does not exist, it is created with an
 		/// empty string value.
 
+	typedef std::map<std::string, std::string> StringMap;
+
+	const StringMap* parameters() const;
+		/// Returns a pointer to the message's parameter map, or a
+		/// null pointer if no parameters have been set. Allows
+		/// channels to enumerate structured attributes (e.g. for
+		/// binary persistence) without knowing their names.
+
 protected:
 	void init();
-	typedef std::map<std::string, std::string> StringMap;
 
 private:
 	std::string _source;
@@ -257,6 +264,12 @@ inline IntPtr Message::getOsTid() const
 }
 
 
+inline const Message::StringMap* Message::parameters() const
+{
+	return _pMap;
+}
+
+
 inline long Message::getPid() const
 {
 	return _pid;
@@ -129,6 +129,7 @@ private:
 	typedef std::vector<AbstractObserverPtr> ObserverList;
 
 	ObserverList  _observers;
+	SharedPtr<ObserverList> _pSnapshot; /// immutable snapshot, invalidated on change
 	mutable Mutex _mutex;
 };
 
@@ -21,6 +21,7 @@
 #include "Poco/Poco.h"
 #include "Poco/Mutex.h"
 #include "Poco/Condition.h"
+#include "Poco/Timestamp.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/SharedPtr.h"
 #include <vector>
@@ -230,14 +231,27 @@ public:
 			{
 				return 0;
 			}
-			while (_size >= _peakCapacity)
+			++_waitCount;
+			Poco::Timestamp waitStart;
+			while (_pool.empty() && _size >= _peakCapacity)
 			{
 				if ( !_availableCondition.tryWait(_mutex, timeoutMilliseconds))
 				{
 					// timeout
+					_totalWaitTime += waitStart.elapsed();
+					++_timeoutCount;
 					return 0;
 				}
 			}
+			_totalWaitTime += waitStart.elapsed();
+			// a returned object may have become available while
+			// waiting; prefer it over creating a new one
+			if (!_pool.empty())
+			{
+				P pObject = _pool.back();
+				_pool.pop_back();
+				return activateObject(pObject);
+			}
 		}
 
 		// _size < _peakCapacity
@@ -260,6 +274,8 @@ public:
 				try
 				{
 					_pool.push_back(pObject);
+					// wake a borrower blocked on an exhausted pool
+					_availableCondition.signal();
 					return;
 				}
 				catch (...)
@@ -288,6 +304,33 @@ public:
 		
 		return _size;
 	}
+
+	std::size_t waitCount() const
+		/// Returns the number of borrowObject() calls that had to
+		/// wait for an object.
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		return _waitCount;
+	}
+
+	std::size_t timeoutCount() const
+		/// Returns the number of borrowObject() calls that timed
+		/// out waiting.
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		return _timeoutCount;
+	}
+
+	Poco::Timestamp::TimeDiff totalWaitTime() const
+		/// Returns the cumulative time, in microseconds, borrowers
+		/// have spent waiting for objects.
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		return _totalWaitTime;
+	}
 	
 	std::size_t available() const
 	{
@@ -320,6 +363,9 @@ private:
 	std::size_t _capacity;
 	std::size_t _peakCapacity;
 	std::size_t _size;
+	std::size_t _waitCount = 0;
+	std::size_t _timeoutCount = 0;
+	Poco::Timestamp::TimeDiff _totalWaitTime = 0;
 	std::vector<P> _pool;
 	mutable Poco::FastMutex _mutex;
 	Poco::Condition _availableCondition;
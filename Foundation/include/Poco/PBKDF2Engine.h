@@ -119,13 +119,15 @@ protected:
 		{
 			prf.reset();
 			prf.update(&up[0], up.size());
-			Poco::DigestEngine::Digest u = prf.digest();
+			// borrow the engine's digest and recycle up's storage:
+			// no vector allocation per iteration
+			const Poco::DigestEngine::Digest& u = prf.digest();
 			poco_assert_dbg(u.size() == PRF_DIGEST_SIZE);
 			for (int ui = 0; ui < PRF_DIGEST_SIZE; ui++)
 			{
 				ux[ui] ^= u[ui];
 			}
-			std::swap(up, u);
+			up.assign(u.begin(), u.end());
 		}
 		_result.insert(_result.end(), ux.begin(), ux.end());
 	}
@@ -0,0 +1,132 @@
+//
+// PaddedAtomicCounter.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  PaddedAtomicCounter
+//
+// Definition of the PaddedAtomicCounter class and CounterArray.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_PaddedAtomicCounter_INCLUDED
+#define Foundation_PaddedAtomicCounter_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class PaddedAtomicCounter
+	/// A 64-bit atomic counter occupying its own cache line.
+	///
+	/// Plain AtomicCounter instances packed into arrays (one per
+	/// endpoint, per CPU, ...) false-share cache lines: every
+	/// increment invalidates its neighbours' lines across cores.
+	/// PaddedAtomicCounter pads each counter to a cache line and
+	/// uses relaxed increments, the appropriate ordering for
+	/// statistics counters.
+{
+public:
+	PaddedAtomicCounter(): _value(0)
+	{
+	}
+
+	void increment(Int64 delta = 1)
+		/// Adds delta to the counter (relaxed ordering).
+	{
+		_value.fetch_add(delta, std::memory_order_relaxed);
+	}
+
+	void decrement(Int64 delta = 1)
+		/// Subtracts delta from the counter (relaxed ordering).
+	{
+		_value.fetch_sub(delta, std::memory_order_relaxed);
+	}
+
+	Int64 value() const
+		/// Returns the counter's value.
+	{
+		return _value.load(std::memory_order_relaxed);
+	}
+
+	void reset()
+		/// Resets the counter to zero.
+	{
+		_value.store(0, std::memory_order_relaxed);
+	}
+
+private:
+	PaddedAtomicCounter(const PaddedAtomicCounter&);
+	PaddedAtomicCounter& operator = (const PaddedAtomicCounter&);
+
+	std::atomic<Int64> _value;
+	char _padding[64 - sizeof(std::atomic<Int64>)];
+};
+
+
+class CounterArray
+	/// A fixed-size array of PaddedAtomicCounter, for per-endpoint
+	/// or per-core statistics without false sharing.
+{
+public:
+	explicit CounterArray(std::size_t size):
+		_counters(new PaddedAtomicCounter[size]),
+		_size(size)
+	{
+	}
+
+	~CounterArray()
+	{
+		delete [] _counters;
+	}
+
+	PaddedAtomicCounter& operator [] (std::size_t index)
+	{
+		poco_assert_dbg (index < _size);
+		return _counters[index];
+	}
+
+	const PaddedAtomicCounter& operator [] (std::size_t index) const
+	{
+		poco_assert_dbg (index < _size);
+		return _counters[index];
+	}
+
+	std::size_t size() const
+	{
+		return _size;
+	}
+
+	Int64 total() const
+		/// Returns the sum over all counters.
+	{
+		Int64 sum = 0;
+		for (std::size_t i = 0; i < _size; i++)
+			sum += _counters[i].value();
+		return sum;
+	}
+
+private:
+	CounterArray(const CounterArray&);
+	CounterArray& operator = (const CounterArray&);
+
+	PaddedAtomicCounter* _counters;
+	std::size_t _size;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_PaddedAtomicCounter_INCLUDED
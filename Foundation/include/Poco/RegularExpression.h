@@ -154,6 +154,15 @@ public:
 		/// Throws a RegularExpressionException in case of an error.
 		/// Returns the number of matches.
 
+	std::size_t matchAll(const std::string& subject, MatchVec& matches, int options = 0) const;
+		/// Finds all non-overlapping occurrences of the pattern in
+		/// the subject, appending one Match (offset and length of
+		/// the whole matched substring) per occurrence, so scanning
+		/// a large input costs one call instead of a caller-side
+		/// offset-advancing loop.
+		///
+		/// Returns the number of occurrences found.
+
 	int split(const std::string& subject, std::vector<std::string>& strings, int options = 0) const;
 		/// Matches the given subject string against the pattern.
 		/// The first entry in captured is the captured substring.
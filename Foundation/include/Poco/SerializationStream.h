@@ -0,0 +1,219 @@
+//
+// SerializationStream.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  SerializationStream
+//
+// Definition of SerializationStreamBuf and SerializationOutputStream.
+//
+// Copyright (c) 2009, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_SerializationStream_INCLUDED
+#define Foundation_SerializationStream_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Buffer.h"
+#include "Poco/StreamUtil.h"
+#include <streambuf>
+#include <ios>
+#include <ostream>
+#include <cstring>
+
+
+namespace Poco {
+
+
+class Foundation_API SerializationStreamBuf: public std::streambuf
+	/// A growable in-memory stream buffer for building serialized
+	/// messages, with O(1) checkpoints and length patching.
+	///
+	/// Unlike MemoryStreamBuf, which wraps a fixed caller buffer,
+	/// this buffer owns growable contiguous storage (geometric
+	/// growth via Poco::Buffer), so serializers need not know
+	/// message sizes up front. On top of that it supports the two
+	/// patterns that otherwise force copies:
+	///
+	///   - speculative serialization: checkpoint() before writing,
+	///     rollback() to the checkpoint when a policy says abort --
+	///     both constant time;
+	///   - length prefixes: reservePatch(n) leaves an n-byte hole
+	///     and returns its offset; patch() fills it in after the
+	///     content (and thus its length) is known, without moving
+	///     any bytes.
+	///
+	/// The serialized message stays contiguous; data()/size() hand
+	/// it to a socket send or writev-style gather without a
+	/// coalescing copy.
+{
+public:
+	typedef std::size_t Checkpoint;
+
+	SerializationStreamBuf(std::size_t initialCapacity = 1024);
+		/// Creates the SerializationStreamBuf with the given
+		/// initial storage capacity.
+
+	~SerializationStreamBuf();
+		/// Destroys the SerializationStreamBuf.
+
+	Checkpoint checkpoint() const;
+		/// Returns the current write position.
+
+	void rollback(Checkpoint checkpoint);
+		/// Discards everything written after the given checkpoint.
+
+	std::size_t reservePatch(std::size_t length);
+		/// Writes length zero bytes and returns their offset,
+		/// to be filled in later with patch().
+
+	void patch(std::size_t offset, const void* data, std::size_t length);
+		/// Overwrites length bytes at the given offset (which must
+		/// have been written or reserved already) with data. The
+		/// write position is unaffected.
+
+	const char* data() const;
+		/// Returns the serialized content.
+
+	std::size_t size() const;
+		/// Returns the number of bytes written.
+
+	void clear();
+		/// Discards the content for reuse; capacity is retained.
+
+protected:
+	int_type overflow(int_type c);
+	std::streamsize xsputn(const char* s, std::streamsize count);
+
+private:
+	SerializationStreamBuf(const SerializationStreamBuf&);
+	SerializationStreamBuf& operator = (const SerializationStreamBuf&);
+
+	std::size_t written() const;
+	void grow(std::size_t minCapacity);
+
+	Poco::Buffer<char> _buffer;
+};
+
+
+class Foundation_API SerializationIOS: public virtual std::ios
+	/// The base class for SerializationOutputStream.
+	///
+	/// This class is needed to ensure the correct initialization
+	/// order of the stream buffer and base classes.
+{
+public:
+	SerializationIOS(std::size_t initialCapacity);
+		/// Creates the basic stream.
+
+	~SerializationIOS();
+		/// Destroys the stream.
+
+	SerializationStreamBuf* rdbuf();
+		/// Returns a pointer to the underlying streambuf.
+
+protected:
+	SerializationStreamBuf _buf;
+};
+
+
+class Foundation_API SerializationOutputStream: public SerializationIOS, public std::ostream
+	/// An output stream for building serialized messages in memory;
+	/// see SerializationStreamBuf for the supported patterns.
+	///
+	///     SerializationOutputStream ostr;
+	///     BinaryWriter writer(ostr);
+	///     std::size_t lengthOffset = ostr.reservePatch(sizeof(Poco::UInt32));
+	///     ...serialize content...
+	///     Poco::UInt32 length = static_cast<Poco::UInt32>(ostr.size() - sizeof(Poco::UInt32));
+	///     ostr.patch(lengthOffset, &length, sizeof(length));
+	///     socket.sendBytes(ostr.data(), static_cast<int>(ostr.size()));
+{
+public:
+	typedef SerializationStreamBuf::Checkpoint Checkpoint;
+
+	SerializationOutputStream(std::size_t initialCapacity = 1024);
+		/// Creates the SerializationOutputStream.
+
+	~SerializationOutputStream();
+		/// Destroys the SerializationOutputStream.
+
+	Checkpoint checkpoint() const;
+		/// Returns the current write position.
+
+	void rollback(Checkpoint checkpoint);
+		/// Discards everything written after the given checkpoint.
+
+	std::size_t reservePatch(std::size_t length);
+		/// Writes length zero bytes and returns their offset.
+
+	void patch(std::size_t offset, const void* data, std::size_t length);
+		/// Overwrites previously written/reserved bytes.
+
+	const char* data() const;
+		/// Returns the serialized content.
+
+	std::size_t size() const;
+		/// Returns the number of bytes written.
+
+	void reset();
+		/// Discards the content and clears the stream state
+		/// for reuse.
+
+};
+
+
+//
+// inlines
+//
+inline SerializationStreamBuf* SerializationIOS::rdbuf()
+{
+	return &_buf;
+}
+
+
+inline SerializationStreamBuf::Checkpoint SerializationOutputStream::checkpoint() const
+{
+	return _buf.checkpoint();
+}
+
+
+inline void SerializationOutputStream::rollback(Checkpoint checkpoint)
+{
+	_buf.rollback(checkpoint);
+}
+
+
+inline std::size_t SerializationOutputStream::reservePatch(std::size_t length)
+{
+	return _buf.reservePatch(length);
+}
+
+
+inline void SerializationOutputStream::patch(std::size_t offset, const void* data, std::size_t length)
+{
+	_buf.patch(offset, data, length);
+}
+
+
+inline const char* SerializationOutputStream::data() const
+{
+	return _buf.data();
+}
+
+
+inline std::size_t SerializationOutputStream::size() const
+{
+	return _buf.size();
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_SerializationStream_INCLUDED
@@ -0,0 +1,142 @@
+//
+// ShardedRWLock.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  ShardedRWLock
+//
+// Definition of the ShardedRWLock class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ShardedRWLock_INCLUDED
+#define Foundation_ShardedRWLock_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Mutex.h"
+#include <atomic>
+
+
+#ifndef POCO_CACHE_LINE_SIZE
+#define POCO_CACHE_LINE_SIZE 64
+#endif
+
+
+namespace Poco {
+
+
+class Foundation_API ShardedRWLock
+	/// A reader/writer lock optimized for read-mostly data on
+	/// many-core hosts.
+	///
+	/// Readers increment one of several cache-line-padded per-shard
+	/// counters (each thread sticks to one shard), so concurrent
+	/// read acquisition does not bounce a single counter cache line
+	/// across cores the way pthread_rwlock does. Writers raise a
+	/// flag, then wait for all shards to drain; they are serialized
+	/// among themselves and starve readers only while waiting.
+	///
+	/// Use readLock()/readUnlock() and writeLock()/writeUnlock()
+	/// in matched pairs (the ScopedReadLock/ScopedWriteLock helpers
+	/// do this); read locks may be acquired recursively, write
+	/// locks may not. Writes are expected to be rare: a write
+	/// acquisition busy-waits (with yields) for readers to drain.
+{
+public:
+	ShardedRWLock();
+		/// Creates the ShardedRWLock.
+
+	~ShardedRWLock();
+		/// Destroys the ShardedRWLock.
+
+	void readLock();
+		/// Acquires a read lock; blocks while a writer holds or is
+		/// acquiring the lock.
+
+	bool tryReadLock();
+		/// Tries to acquire a read lock without blocking; returns
+		/// true on success.
+
+	void readUnlock();
+		/// Releases a read lock.
+
+	void writeLock();
+		/// Acquires the write lock, waiting for all readers to
+		/// drain. Writers are serialized among themselves.
+
+	void writeUnlock();
+		/// Releases the write lock.
+
+	class ScopedReadLock
+	{
+	public:
+		explicit ScopedReadLock(ShardedRWLock& lock): _lock(lock)
+		{
+			_lock.readLock();
+		}
+
+		~ScopedReadLock()
+		{
+			_lock.readUnlock();
+		}
+
+	private:
+		ScopedReadLock(const ScopedReadLock&);
+		ScopedReadLock& operator = (const ScopedReadLock&);
+
+		ShardedRWLock& _lock;
+	};
+
+	class ScopedWriteLock
+	{
+	public:
+		explicit ScopedWriteLock(ShardedRWLock& lock): _lock(lock)
+		{
+			_lock.writeLock();
+		}
+
+		~ScopedWriteLock()
+		{
+			_lock.writeUnlock();
+		}
+
+	private:
+		ScopedWriteLock(const ScopedWriteLock&);
+		ScopedWriteLock& operator = (const ScopedWriteLock&);
+
+		ShardedRWLock& _lock;
+	};
+
+private:
+	ShardedRWLock(const ShardedRWLock&);
+	ShardedRWLock& operator = (const ShardedRWLock&);
+
+	enum
+	{
+		SHARDS = 16
+	};
+
+	struct Shard
+	{
+		std::atomic<int> readers;
+		char padding[POCO_CACHE_LINE_SIZE > sizeof(std::atomic<int>) ? POCO_CACHE_LINE_SIZE - sizeof(std::atomic<int>) : 1];
+	};
+
+	Shard& shardForThread();
+
+	Shard _shards[SHARDS];
+	std::atomic<bool> _writerPending;
+	FastMutex _writerMutex;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ShardedRWLock_INCLUDED
@@ -0,0 +1,143 @@
+//
+// SharedMemoryChannel.h
+//
+// Library: Foundation
+// Package: Logging
+// Module:  SharedMemoryChannel
+//
+// Definition of the SharedMemoryChannel class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_SharedMemoryChannel_INCLUDED
+#define Foundation_SharedMemoryChannel_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Channel.h"
+#include "Poco/SharedMemory.h"
+#include "Poco/SharedPtr.h"
+#include <atomic>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API SharedMemoryChannel: public Channel
+	/// A Channel that appends binary log records to a ring buffer in
+	/// a named shared memory segment, to be consumed by a collector
+	/// process using SharedMemoryLogReader.
+	///
+	/// This allows many worker processes on a host to log through
+	/// one file (and one rotation policy) without interleaving or
+	/// write amplification: producers only reserve space in the ring
+	/// with an atomic compare-and-exchange and copy their record --
+	/// no locks, no system calls -- while a single collector process
+	/// drains the ring into an ordinary Channel chain (e.g. a
+	/// FileChannel behind a PatternFormatter).
+	///
+	/// The collector must create the segment (by instantiating a
+	/// SharedMemoryLogReader) before producers open the channel.
+	/// When the ring is full, records are dropped and counted; the
+	/// drop count is available to the reader.
+	///
+	/// The following properties are supported:
+	///   * name: the name of the shared memory segment
+	///           (default "poco.log").
+	///   * size: the size of the shared memory segment in bytes
+	///           (default 1 MB). Must match the reader's size.
+{
+public:
+	typedef AutoPtr<SharedMemoryChannel> Ptr;
+
+	SharedMemoryChannel();
+		/// Creates the SharedMemoryChannel with default name
+		/// and size.
+
+	SharedMemoryChannel(const std::string& name, std::size_t size = DEFAULT_SIZE);
+		/// Creates the SharedMemoryChannel for the given segment
+		/// name and size.
+
+	void open();
+		/// Attaches to the shared memory segment, which must
+		/// already have been created by the reader.
+
+	void close();
+		/// Detaches from the shared memory segment.
+
+	void log(const Message& msg);
+		/// Appends a binary record for the given message to the
+		/// shared ring. If the ring is full, the record is dropped
+		/// and the drop counter is incremented.
+
+	void setProperty(const std::string& name, const std::string& value);
+		/// Sets the property with the given name (see the class
+		/// documentation for supported properties).
+
+	std::string getProperty(const std::string& name) const;
+		/// Returns the value of the property with the given name.
+
+	static const std::string PROP_NAME;
+	static const std::string PROP_SIZE;
+
+	enum
+	{
+		DEFAULT_SIZE = 1024*1024
+	};
+
+protected:
+	~SharedMemoryChannel();
+
+private:
+	std::string _name;
+	std::size_t _size;
+	SharedPtr<SharedMemory> _pMemory;
+
+	friend class SharedMemoryLogReader;
+};
+
+
+class Foundation_API SharedMemoryLogReader
+	/// Consumes binary log records written by SharedMemoryChannel
+	/// producers and feeds them, as reconstructed Message objects,
+	/// to an ordinary Channel chain.
+	///
+	/// There must be exactly one reader per segment; the reader
+	/// creates (and on destruction unlinks) the shared memory
+	/// segment, so it must be set up before the producers start.
+{
+public:
+	SharedMemoryLogReader(Channel::Ptr pChannel, const std::string& name = "poco.log", std::size_t size = SharedMemoryChannel::DEFAULT_SIZE);
+		/// Creates the shared memory segment and the ring header.
+		/// Drained records are logged to the given channel.
+
+	~SharedMemoryLogReader();
+		/// Destroys the reader and unlinks the segment.
+
+	int drain();
+		/// Reads all complete records currently in the ring,
+		/// logs them to the channel and returns their number.
+
+	UInt64 dropped() const;
+		/// Returns the number of records dropped by producers
+		/// because the ring was full.
+
+private:
+	SharedMemoryLogReader(const SharedMemoryLogReader&);
+	SharedMemoryLogReader& operator = (const SharedMemoryLogReader&);
+
+	Channel::Ptr _pChannel;
+	SharedMemory _memory;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_SharedMemoryChannel_INCLUDED
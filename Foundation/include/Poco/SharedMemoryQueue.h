@@ -0,0 +1,86 @@
+//
+// SharedMemoryQueue.h
+//
+// Library: Foundation
+// Package: Processes
+// Module:  SharedMemoryQueue
+//
+// Definition of the SharedMemoryQueue class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_SharedMemoryQueue_INCLUDED
+#define Foundation_SharedMemoryQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/SharedMemory.h"
+#include "Poco/Buffer.h"
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API SharedMemoryQueue
+	/// A bounded message queue between co-located processes, built
+	/// on a named SharedMemory ring buffer.
+	///
+	/// Multiple producer processes (or threads) enqueue opaque byte
+	/// messages with an atomic reservation and a memcpy -- no locks
+	/// and no system calls -- and a single consumer process drains
+	/// them in order. For small messages this replaces a localhost
+	/// TCP round trip (microseconds) with a shared-memory handoff
+	/// (tens of nanoseconds plus polling latency).
+	///
+	/// The consumer creates the queue (OWNER role, which also
+	/// unlinks the segment on destruction) before any producer
+	/// attaches. receive() polls; block using a NamedEvent or a
+	/// short sleep loop as appropriate for the application's
+	/// latency needs. When the ring is full, send() fails and the
+	/// producer decides whether to retry, drop or back off.
+{
+public:
+	enum Role
+	{
+		QUEUE_OWNER,    /// creates (and finally unlinks) the segment; the consumer side
+		QUEUE_PRODUCER  /// attaches to an existing segment
+	};
+
+	SharedMemoryQueue(const std::string& name, std::size_t size, Role role);
+		/// Creates or attaches to the queue with the given segment
+		/// name and total segment size.
+
+	~SharedMemoryQueue();
+		/// Destroys the SharedMemoryQueue; the owner unlinks
+		/// the segment.
+
+	bool send(const void* message, std::size_t size);
+		/// Enqueues a message; returns false (without blocking)
+		/// when the ring does not currently have room.
+
+	bool receive(Poco::Buffer<char>& message);
+		/// Dequeues the oldest message into the given buffer
+		/// (resizing it to the message size). Returns false if the
+		/// queue is empty. Only one process may consume.
+
+	std::size_t capacity() const;
+		/// Returns the usable ring capacity in bytes.
+
+private:
+	SharedMemoryQueue(const SharedMemoryQueue&);
+	SharedMemoryQueue& operator = (const SharedMemoryQueue&);
+
+	SharedMemory _memory;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_SharedMemoryQueue_INCLUDED
@@ -35,6 +35,12 @@ public:
 	static std::streamsize copyStream(std::istream& istr, std::ostream& ostr, std::size_t bufferSize = 8192);
 		/// Writes all bytes readable from istr to ostr, using an internal buffer.
 		///
+		/// When both streams are backed by FileStream, the data is
+		/// moved in-kernel with copy_file_range() where available,
+		/// without surfacing into the buffer at all. Otherwise, for
+		/// long copies, the buffer is grown adaptively (up to 256K)
+		/// to reduce per-chunk overhead.
+		///
 		/// Returns the number of bytes copied.
 
 #if defined(POCO_HAVE_INT64)
@@ -197,6 +197,38 @@ int icompare(
 }
 
 
+template <class S>
+typename S::size_type ifind(const S& str, const S& pattern, typename S::size_type pos = 0)
+	/// Case-insensitive (ASCII) substring search; returns the
+	/// position of the first occurrence of pattern in str at or
+	/// after pos, or S::npos if not found. Complements icompare()
+	/// for header and token scanning without lower-casing copies.
+{
+	if (pattern.empty()) return pos <= str.size() ? pos : S::npos;
+	if (pattern.size() > str.size()) return S::npos;
+	const int first = Ascii::toLower(pattern[0]);
+	typename S::size_type last = str.size() - pattern.size();
+	for (typename S::size_type i = pos; i <= last; ++i)
+	{
+		if (Ascii::toLower(str[i]) == first)
+		{
+			typename S::size_type j = 1;
+			while (j < pattern.size() && Ascii::toLower(str[i + j]) == Ascii::toLower(pattern[j])) ++j;
+			if (j == pattern.size()) return i;
+		}
+	}
+	return S::npos;
+}
+
+
+template <class S>
+typename S::size_type ifind(const S& str, const typename S::value_type* pattern, typename S::size_type pos = 0)
+	/// Case-insensitive (ASCII) substring search.
+{
+	return ifind(str, S(pattern), pos);
+}
+
+
 template <class S>
 int icompare(const S& str1, const S& str2)
 	// A special optimization for an often used case.
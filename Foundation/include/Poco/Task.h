@@ -23,6 +23,7 @@
 #include "Poco/RefCountedObject.h"
 #include "Poco/Mutex.h"
 #include "Poco/Event.h"
+#include "Poco/CancellationToken.h"
 
 
 namespace Poco {
@@ -70,6 +71,12 @@ public:
 		/// but the base class implementation of cancel() should
 		/// be called to ensure proper behavior.
 
+	CancellationToken cancellationToken() const;
+		/// Returns a token that is cancelled when the task is
+		/// cancelled; pass it into blocking operations performed by
+		/// runTask() so cancel() interrupts them promptly.
+
+
 	bool isCancelled() const;
 		/// Returns true if cancellation of the task has been
 		/// requested.
@@ -150,6 +157,7 @@ private:
 	float             _progress;
 	TaskState         _state;
 	Event             _cancelEvent;
+	CancellationTokenSource _cancelSource;
 	mutable FastMutex _mutex;
 	
 	friend class TaskManager;
@@ -0,0 +1,130 @@
+//
+// TaskGraph.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  TaskGraph
+//
+// Definition of the TaskGraph class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_TaskGraph_INCLUDED
+#define Foundation_TaskGraph_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Event.h"
+#include "Poco/Mutex.h"
+#include "Poco/Exception.h"
+#include <functional>
+#include <vector>
+#include <atomic>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API TaskGraph
+	/// A scheduler for directed acyclic graphs of dependent work
+	/// items, running on a ThreadPool.
+	///
+	/// Tasks are added as callables together with the tasks they
+	/// depend on; the scheduler starts every task whose dependencies
+	/// have all completed. When a finishing task makes exactly one
+	/// dependent ready, that dependent runs immediately on the same
+	/// pool thread (a continuation), avoiding the queue round trip
+	/// and thread handoff that chaining work through separate
+	/// ThreadPool::start() calls and Events would cost; when several
+	/// become ready at once, one continues in-thread and the rest
+	/// fan out to the pool.
+	///
+	///     TaskGraph graph;
+	///     TaskGraph::TaskId parse = graph.add([&]() { ... });
+	///     TaskGraph::TaskId xform = graph.add([&]() { ... }, parse);
+	///     graph.add([&]() { ... }, xform);
+	///     graph.run();
+	///     graph.wait();
+	///
+	/// A TaskGraph is single-use: build, run, wait. The first
+	/// exception thrown by any task is captured and rethrown from
+	/// wait(); remaining ready tasks still run.
+{
+public:
+	typedef std::size_t TaskId;
+	typedef std::function<void ()> Callable;
+
+	TaskGraph(ThreadPool& pool = ThreadPool::defaultPool());
+		/// Creates the TaskGraph, scheduling onto the given pool.
+
+	~TaskGraph();
+		/// Destroys the TaskGraph. Blocks until all started
+		/// tasks have finished.
+
+	TaskId add(const Callable& task);
+		/// Adds a task with no dependencies and returns its id.
+
+	TaskId add(const Callable& task, TaskId dependency);
+		/// Adds a task that runs after the given task has
+		/// completed and returns its id.
+
+	TaskId add(const Callable& task, const std::vector<TaskId>& dependencies);
+		/// Adds a task that runs after all given tasks have
+		/// completed and returns its id.
+
+	void run();
+		/// Starts executing the graph. No tasks may be added
+		/// after run().
+
+	void wait();
+		/// Waits for all tasks to complete, then rethrows the
+		/// first exception a task threw, if any.
+
+	bool tryWait(long milliseconds);
+		/// Waits for all tasks to complete, with a timeout.
+		/// Returns false on timeout; on completion, rethrows the
+		/// first exception a task threw, if any, and returns true.
+
+private:
+	struct Node
+	{
+		Callable work;
+		std::atomic<int> pendingDeps;
+		std::vector<TaskId> dependents;
+	};
+
+	class NodeRunner;
+	friend class NodeRunner;
+
+	TaskGraph(const TaskGraph&);
+	TaskGraph& operator = (const TaskGraph&);
+
+	void execute(TaskId id);
+		/// Runs the node, then continues into at most one newly
+		/// ready dependent in-thread, handing additional ready
+		/// dependents to the pool.
+
+	void start(TaskId id);
+
+	ThreadPool& _pool;
+	std::vector<Node*> _nodes;
+	std::atomic<std::size_t> _remaining;
+	std::atomic<bool> _started;
+	Event _done;
+	FastMutex _errMutex;
+	std::exception_ptr _firstError;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_TaskGraph_INCLUDED
@@ -103,6 +103,17 @@ public:
 
 	static const int MIN_PROGRESS_NOTIFICATION_INTERVAL;
 
+	void setProgressNotificationInterval(Timestamp::TimeDiff microseconds);
+		/// Sets the minimum interval between TaskProgressNotification
+		/// postings. Progress updates arriving faster than this are
+		/// coalesced (the default is 100 milliseconds). Schedulers
+		/// with very many concurrent tasks can raise the interval to
+		/// bound notification dispatch cost.
+
+	Timestamp::TimeDiff getProgressNotificationInterval() const;
+		/// Returns the minimum interval, in microseconds, between
+		/// progress notifications.
+
 protected:
 	void postNotification(const Notification::Ptr& pNf);
 		/// Posts a notification to the task manager's
@@ -118,6 +129,7 @@ private:
 	ThreadPool&        _threadPool;
 	TaskList           _taskList;
 	Timestamp          _lastProgressNotification;
+	Timestamp::TimeDiff _progressNotificationInterval;
 	NotificationCenter _nc;
 	mutable FastMutex  _mutex;
 
@@ -81,8 +81,13 @@ private:
 	TextConverter(const TextConverter&);
 	TextConverter& operator = (const TextConverter&);
 
+	bool isIdentityForASCII() const;
+		/// Returns true if both encodings pass ASCII bytes through
+		/// unchanged, enabling the bulk conversion fast path.
+
 	const TextEncoding& _inEncoding;
 	const TextEncoding& _outEncoding;
+	bool                _asciiPassthrough;
 	int                 _defaultChar;
 };
 
@@ -223,6 +223,7 @@ private:
 	typedef std::map<std::string, TextEncoding::Ptr, CILess> EncodingMap;
 
 	EncodingMap    _encodings;
+	mutable EncodingMap _aliasCache; /// lazily resolved alias lookups, cleared on change
 	mutable RWLock _lock;
 };
 
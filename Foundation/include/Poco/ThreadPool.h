@@ -23,6 +23,7 @@
 #include "Poco/Mutex.h"
 #include "Poco/AtomicCounter.h"
 #include <vector>
+#include <ctime>
 
 
 namespace Poco {
@@ -102,9 +103,55 @@ public:
 	void setAffinityPolicy(ThreadAffinityPolicy affinityPolicy);
 		/// Sets the thread affinity policy for newly created threads.
 
+	void setAffinityCpuSet(const std::vector<int>& cpus);
+		/// Restricts the cores used by the TAP_UNIFORM_DISTRIBUTION
+		/// affinity policy to the given set: worker threads are
+		/// pinned round-robin over the listed cores instead of all
+		/// processors. Useful to keep a pool (and its cache lines)
+		/// on one socket of a multi-socket host.
+		///
+		/// Passing an empty vector restores distribution over all
+		/// processors.
+
+	const std::vector<int>& getAffinityCpuSet() const;
+		/// Returns the core set used by the TAP_UNIFORM_DISTRIBUTION
+		/// affinity policy; empty if all processors are used.
+
 	ThreadAffinityPolicy getAffinityPolicy();
 		/// Returns the thread affinity policy used to create new threads.
 
+	void setGrowthIncrement(int increment);
+		/// Sets the number of threads the pool grows by when demand
+		/// exceeds the currently allocated threads (default 1).
+		/// Growing by more than one anticipates bursts: the first
+		/// request of a burst pays one growth event instead of each
+		/// request paying its own thread-creation latency.
+
+	int getGrowthIncrement() const;
+		/// Returns the growth increment.
+
+	void setCreationRateLimit(int threadsPerSecond);
+		/// Limits speculative pool growth to the given number of
+		/// thread creations per second (0 = unlimited, the
+		/// default). The thread required to serve the current
+		/// request is always created; only the anticipatory extras
+		/// from setGrowthIncrement() are subject to the limit.
+
+	void setIdleSpin(int iterations);
+		/// Sets the number of yield iterations an idle pooled
+		/// thread spins waiting for new work before parking on its
+		/// event (default 0 = park immediately). A brief spin
+		/// absorbs schedule-wake latency when work arrives in
+		/// bursts, at the cost of some idle CPU.
+
+	int growthEvents() const;
+		/// Returns the number of times the pool created threads on
+		/// demand (after startup pre-warming via minCapacity).
+
+	int saturationEvents() const;
+		/// Returns the number of times the pool was saturated
+		/// (a start() failed with NoThreadAvailableException).
+
 	int used() const;
 		/// Returns the number of currently used threads.
 
@@ -178,6 +225,7 @@ public:
 protected:
 	PooledThread* getThread();
 	PooledThread* createThread();
+	bool takeCreationToken();
 
 	void housekeep();
 	int affinity(int cpu);
@@ -190,12 +238,20 @@ private:
 
 	std::string _name;
 	int _minCapacity;
+	int _growthIncrement;
+	int _creationRateLimit;
+	int _idleSpin;
+	int _growthEvents;
+	int _saturationEvents;
+	int _creationTokens;
+	std::time_t _lastTokenRefill;
 	int _maxCapacity;
 	int _idleTime;
 	int _serial;
 	int _age;
 	int _stackSize;
 	ThreadVec _threads;
+	std::vector<int> _affinityCpus;
 	mutable FastMutex _mutex;
 	ThreadAffinityPolicy _affinityPolicy;
 	AtomicCounter _lastCpu;
@@ -229,6 +285,12 @@ inline ThreadPool::ThreadAffinityPolicy ThreadPool::getAffinityPolicy()
 }
 
 
+inline const std::vector<int>& ThreadPool::getAffinityCpuSet() const
+{
+	return _affinityCpus;
+}
+
+
 inline const std::string& ThreadPool::name() const
 {
 	return _name;
@@ -24,6 +24,7 @@
 #include "Poco/Event.h"
 #include "Poco/Timestamp.h"
 #include "Poco/Clock.h"
+#include <vector>
 #include <map>
 
 
@@ -89,7 +90,19 @@ public:
 		/// assigned to a Notification::Ptr, to avoid potential
 		/// memory management issues.
 		
+	std::size_t dequeueDueNotifications(std::vector<Notification::Ptr>& batch);
+		/// Dequeues all pending notifications with timestamps less
+		/// than or equal to the current time, appending them to the
+		/// given vector in timestamp order, under a single lock
+		/// acquisition. Returns the number of notifications
+		/// dequeued.
+		///
+		/// When many timers share one expiry instant, draining them
+		/// in one call avoids a wakeup (and a lock round trip) per
+		/// notification.
+
 	Notification* waitDequeueNotification();
+
 		/// Dequeues the next pending notification.
 		/// If no notification is available, waits for a notification
 		/// to be enqueued.
@@ -83,6 +83,19 @@ public:
 	void update();
 		/// Updates the Timestamp with the current time.
 
+	void updateCoarse();
+		/// Updates the Timestamp from a coarse, low-overhead clock
+		/// source (CLOCK_REALTIME_COARSE on Linux; elsewhere the
+		/// regular source). Resolution is the kernel tick,
+		/// typically one to four milliseconds -- appropriate for
+		/// high-rate message timestamping where update()'s
+		/// microsecond precision is not needed.
+
+	static Timestamp coarse();
+		/// Returns the current time from the coarse clock source
+		/// (see updateCoarse()).
+		/// Updates the Timestamp with the current time.
+
 	bool operator == (const Timestamp& ts) const;
 	bool operator != (const Timestamp& ts) const;
 	bool operator >  (const Timestamp& ts) const;
@@ -0,0 +1,247 @@
+//
+// ActiveThreadPool.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  ActiveThreadPool
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/ActiveThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Thread.h"
+#include "Poco/Event.h"
+#include "Poco/Environment.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/SingletonHolder.h"
+#include <deque>
+#include <atomic>
+#include <sstream>
+
+
+namespace Poco {
+
+
+class ActiveThreadPoolWorker: public Runnable
+{
+public:
+	ActiveThreadPoolWorker(ActiveThreadPool& pool, const std::string& name, int stackSize):
+		_pool(pool),
+		_stopped(false),
+		_thread(name)
+	{
+		_thread.setStackSize(stackSize);
+	}
+
+	void start()
+	{
+		_thread.start(*this);
+	}
+
+	void enqueue(Runnable* pTarget)
+	{
+		{
+			FastMutex::ScopedLock lock(_mutex);
+			_queue.push_back(pTarget);
+		}
+		_wakeup.set();
+	}
+
+	Runnable* next()
+		/// Takes the oldest queued target from the worker's own queue.
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		if (_queue.empty()) return 0;
+		Runnable* pTarget = _queue.front();
+		_queue.pop_front();
+		return pTarget;
+	}
+
+	Runnable* steal()
+		/// Takes the most recently queued target, called by
+		/// other workers that have run out of work.
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		if (_queue.empty()) return 0;
+		Runnable* pTarget = _queue.back();
+		_queue.pop_back();
+		return pTarget;
+	}
+
+	int discard()
+		/// Drops all queued targets and returns how many
+		/// were dropped.
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		int n = static_cast<int>(_queue.size());
+		_queue.clear();
+		return n;
+	}
+
+	void stop()
+	{
+		if (_stopped.exchange(true)) return;
+		_wakeup.set();
+		_thread.join();
+	}
+
+	void run()
+	{
+		for (;;)
+		{
+			Runnable* pTarget = next();
+			if (!pTarget) pTarget = _pool.stealWork(this);
+			if (pTarget)
+			{
+				try
+				{
+					pTarget->run();
+				}
+				catch (Exception& exc)
+				{
+					ErrorHandler::handle(exc);
+				}
+				catch (std::exception& exc)
+				{
+					ErrorHandler::handle(exc);
+				}
+				catch (...)
+				{
+					ErrorHandler::handle();
+				}
+				_pool.taskCompleted();
+			}
+			else
+			{
+				if (_stopped) break;
+				_wakeup.tryWait(100);
+			}
+		}
+	}
+
+private:
+	ActiveThreadPool& _pool;
+	std::deque<Runnable*> _queue;
+	FastMutex _mutex;
+	Event _wakeup;
+	std::atomic<bool> _stopped;
+	Thread _thread;
+};
+
+
+ActiveThreadPool::ActiveThreadPool(int capacity, int stackSize)
+{
+	init(capacity, stackSize);
+}
+
+
+ActiveThreadPool::ActiveThreadPool(const std::string& name, int capacity, int stackSize):
+	_name(name)
+{
+	init(capacity, stackSize);
+}
+
+
+ActiveThreadPool::~ActiveThreadPool()
+{
+	try
+	{
+		stopAll();
+		for (WorkerVec::iterator it = _workers.begin(); it != _workers.end(); ++it)
+			delete *it;
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void ActiveThreadPool::init(int capacity, int stackSize)
+{
+	poco_assert (capacity >= 0);
+
+	if (capacity == 0) capacity = static_cast<int>(Environment::processorCount());
+	_workers.reserve(capacity);
+	for (int i = 0; i < capacity; i++)
+	{
+		std::ostringstream name;
+		name << _name << "[#active-worker-" << i << "]";
+		_workers.push_back(new ActiveThreadPoolWorker(*this, name.str(), stackSize));
+	}
+	for (WorkerVec::iterator it = _workers.begin(); it != _workers.end(); ++it)
+		(*it)->start();
+}
+
+
+int ActiveThreadPool::capacity() const
+{
+	return static_cast<int>(_workers.size());
+}
+
+
+void ActiveThreadPool::start(Runnable& target)
+{
+	++_pendingCount;
+	int idx = ++_nextWorker;
+	if (idx < 0) idx = -idx;
+	_workers[idx % _workers.size()]->enqueue(&target);
+}
+
+
+Runnable* ActiveThreadPool::stealWork(ActiveThreadPoolWorker* pThief)
+{
+	for (WorkerVec::iterator it = _workers.begin(); it != _workers.end(); ++it)
+	{
+		if (*it == pThief) continue;
+		Runnable* pTarget = (*it)->steal();
+		if (pTarget) return pTarget;
+	}
+	return 0;
+}
+
+
+void ActiveThreadPool::taskCompleted()
+{
+	if (--_pendingCount == 0)
+		_idleEvent.set();
+}
+
+
+void ActiveThreadPool::joinAll()
+{
+	while (_pendingCount.value() > 0)
+		_idleEvent.tryWait(100);
+}
+
+
+void ActiveThreadPool::stopAll()
+{
+	for (WorkerVec::iterator it = _workers.begin(); it != _workers.end(); ++it)
+	{
+		int discarded = (*it)->discard();
+		while (discarded-- > 0) taskCompleted();
+	}
+	for (WorkerVec::iterator it = _workers.begin(); it != _workers.end(); ++it)
+		(*it)->stop();
+}
+
+
+namespace
+{
+	static SingletonHolder<ActiveThreadPool> sh;
+}
+
+
+ActiveThreadPool& ActiveThreadPool::defaultPool()
+{
+	return *sh.get();
+}
+
+
+} // namespace Poco
@@ -52,23 +52,37 @@ protected:
 	{
 		std::string gzPath(path);
 		gzPath.append(".gz");
+		// compress into a temporary name and rename on success, so a
+		// crash mid-compression never leaves a truncated .gz that
+		// could be mistaken for a complete archive
+		std::string tmpPath(gzPath);
+		tmpPath.append(".tmp");
 		FileInputStream istr(path);
-		FileOutputStream ostr(gzPath);
+		FileOutputStream ostr(tmpPath);
 		try
 		{
 			DeflatingOutputStream deflater(ostr, DeflatingStreamBuf::STREAM_GZIP);
 			StreamCopier::copyStream(istr, deflater);
-			if (!deflater.good() || !ostr.good()) throw WriteFileException(gzPath);
+			if (!deflater.good() || !ostr.good()) throw WriteFileException(tmpPath);
 			deflater.close();
 			ostr.close();
 			istr.close();
+			Poco::File tmpf(tmpPath);
+			tmpf.renameTo(gzPath);
 		}
 		catch (Poco::Exception&)
 		{
-			// deflating failed - remove gz file and leave uncompressed log file
+			// deflating failed - remove the temporary and leave the
+			// uncompressed log file
 			ostr.close();
-			Poco::File gzf(gzPath);
-			gzf.remove();
+			try
+			{
+				Poco::File tmpf(tmpPath);
+				tmpf.remove();
+			}
+			catch (...)
+			{
+			}
 			return;
 		}
 		File f(path);
@@ -0,0 +1,106 @@
+//
+// Arena.cpp
+//
+// Library: Foundation
+// Package: Core
+// Module:  Arena
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Arena.h"
+
+
+namespace Poco {
+
+
+Arena::Arena(std::size_t blockSize):
+	_blockSize(blockSize),
+	_pCurrent(0),
+	_pEnd(0),
+	_allocated(0)
+{
+	poco_assert (blockSize > 0);
+}
+
+
+Arena::~Arena()
+{
+	for (std::vector<char*>::iterator it = _blocks.begin(); it != _blocks.end(); ++it)
+		delete [] *it;
+}
+
+
+void Arena::grow(std::size_t minSize)
+{
+	std::size_t size = minSize > _blockSize ? minSize : _blockSize;
+	char* pBlock = new char[size];
+	_blocks.push_back(pBlock);
+	_blockSizes.push_back(size);
+	_pCurrent = pBlock;
+	_pEnd = pBlock + size;
+}
+
+
+void* Arena::allocate(std::size_t size, std::size_t alignment)
+{
+	poco_assert_dbg (alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	std::size_t space = static_cast<std::size_t>(_pEnd - _pCurrent);
+	std::size_t padding = reinterpret_cast<std::uintptr_t>(_pCurrent) & (alignment - 1);
+	if (padding > 0) padding = alignment - padding;
+	if (size + padding > space)
+	{
+		grow(size + alignment);
+		padding = reinterpret_cast<std::uintptr_t>(_pCurrent) & (alignment - 1);
+		if (padding > 0) padding = alignment - padding;
+	}
+	char* p = _pCurrent + padding;
+	_pCurrent = p + size;
+	_allocated += size + padding;
+	return p;
+}
+
+
+void Arena::reset()
+{
+	// keep the first block for reuse, return the rest
+	while (_blocks.size() > 1)
+	{
+		delete [] _blocks.back();
+		_blocks.pop_back();
+		_blockSizes.pop_back();
+	}
+	if (!_blocks.empty())
+	{
+		_pCurrent = _blocks.front();
+		_pEnd = _pCurrent + _blockSizes.front();
+	}
+	else
+	{
+		_pCurrent = _pEnd = 0;
+	}
+	_allocated = 0;
+}
+
+
+std::size_t Arena::allocated() const
+{
+	return _allocated;
+}
+
+
+std::size_t Arena::capacity() const
+{
+	std::size_t total = 0;
+	for (std::vector<std::size_t>::const_iterator it = _blockSizes.begin(); it != _blockSizes.end(); ++it)
+		total += *it;
+	return total;
+}
+
+
+} // namespace Poco
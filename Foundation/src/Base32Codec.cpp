@@ -0,0 +1,122 @@
+//
+// Base32Codec.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base32Codec
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Base32Codec.h"
+#include "Poco/Ascii.h"
+
+
+namespace Poco {
+
+
+namespace
+{
+	const char BASE32_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+
+
+	int base32Value(char c)
+	{
+		if (c >= 'A' && c <= 'Z') return c - 'A';
+		if (c >= 'a' && c <= 'z') return c - 'a';
+		if (c >= '2' && c <= '7') return c - '2' + 26;
+		return -1;
+	}
+}
+
+
+std::size_t Base32Codec::encodedLength(std::size_t dataLength, bool padding)
+{
+	if (padding)
+		return ((dataLength + 4)/5)*8;
+	if (dataLength == 0) return 0;
+	// 8 characters per full 5-byte group, plus ceil(8*rem/5) for the tail
+	static const std::size_t tailChars[] = { 0, 2, 4, 5, 7 };
+	return (dataLength/5)*8 + tailChars[dataLength % 5];
+}
+
+
+void Base32Codec::encode(const void* data, std::size_t length, std::string& base32, bool padding)
+{
+	base32.clear();
+	base32.reserve(encodedLength(length, padding));
+
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+	std::size_t fullGroups = length/5;
+	for (std::size_t i = 0; i < fullGroups; i++)
+	{
+		// 40 bits per group, emitted as eight 5-bit indices
+		Poco::UInt64 group =
+			(static_cast<Poco::UInt64>(p[0]) << 32) |
+			(static_cast<Poco::UInt64>(p[1]) << 24) |
+			(static_cast<Poco::UInt64>(p[2]) << 16) |
+			(static_cast<Poco::UInt64>(p[3]) << 8) |
+			 static_cast<Poco::UInt64>(p[4]);
+		for (int shift = 35; shift >= 0; shift -= 5)
+			base32 += BASE32_CHARS[(group >> shift) & 0x1F];
+		p += 5;
+	}
+
+	std::size_t remaining = length - fullGroups*5;
+	if (remaining > 0)
+	{
+		Poco::UInt64 group = 0;
+		for (std::size_t i = 0; i < remaining; i++)
+			group |= static_cast<Poco::UInt64>(p[i]) << (32 - 8*i);
+		static const int tailChars[] = { 0, 2, 4, 5, 7 };
+		int chars = tailChars[remaining];
+		for (int i = 0; i < chars; i++)
+			base32 += BASE32_CHARS[(group >> (35 - 5*i)) & 0x1F];
+		if (padding)
+		{
+			for (int i = chars; i < 8; i++)
+				base32 += '=';
+		}
+	}
+}
+
+
+std::string Base32Codec::encode(const void* data, std::size_t length, bool padding)
+{
+	std::string base32;
+	encode(data, length, base32, padding);
+	return base32;
+}
+
+
+bool Base32Codec::decode(const std::string& base32, std::string& data)
+{
+	data.clear();
+	data.reserve((base32.size()/8 + 1)*5);
+
+	Poco::UInt64 group = 0;
+	int bits = 0;
+	for (std::string::const_iterator it = base32.begin(); it != base32.end(); ++it)
+	{
+		char c = *it;
+		if (Ascii::isSpace(c)) continue;
+		if (c == '=') break; // padding: only trailing filler may follow
+		int value = base32Value(c);
+		if (value < 0) return false;
+		group = (group << 5) | static_cast<Poco::UInt64>(value);
+		bits += 5;
+		if (bits >= 8)
+		{
+			bits -= 8;
+			data += static_cast<char>((group >> bits) & 0xFF);
+		}
+	}
+	return true;
+}
+
+
+} // namespace Poco
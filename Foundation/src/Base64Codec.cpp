@@ -0,0 +1,151 @@
+//
+// Base64Codec.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base64
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Base64Codec.h"
+#include "Poco/Ascii.h"
+
+
+namespace Poco {
+
+
+namespace
+{
+	struct DecodingTable
+		/// Inverse alphabet table; 0xFF marks invalid characters.
+	{
+		DecodingTable(const unsigned char* pEncoding)
+		{
+			for (int i = 0; i < 256; i++) table[i] = 0xFF;
+			for (unsigned char i = 0; i < 64; i++) table[pEncoding[i]] = i;
+		}
+
+		unsigned char table[256];
+	};
+}
+
+
+std::size_t Base64Codec::encodedLength(std::size_t dataLength, int options)
+{
+	if (dataLength == 0) return 0;
+	if (options & BASE64_NO_PADDING)
+	{
+		// four characters per full group, plus two or three
+		// characters for a trailing partial group
+		return (dataLength/3)*4 + (dataLength % 3 > 0 ? dataLength % 3 + 1 : 0);
+	}
+	else
+	{
+		return ((dataLength + 2)/3)*4;
+	}
+}
+
+
+void Base64Codec::encode(const void* data, std::size_t length, std::string& base64, int options)
+{
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* pEncoding = (options & BASE64_URL_ENCODING) ?
+		Base64EncoderBuf::OUT_ENCODING_URL : Base64EncoderBuf::OUT_ENCODING;
+
+	base64.resize(encodedLength(length, options));
+	std::string::iterator out = base64.begin();
+	while (length >= 3)
+	{
+		unsigned group = (static_cast<unsigned>(p[0]) << 16) | (static_cast<unsigned>(p[1]) << 8) | p[2];
+		*out++ = pEncoding[(group >> 18) & 0x3F];
+		*out++ = pEncoding[(group >> 12) & 0x3F];
+		*out++ = pEncoding[(group >> 6) & 0x3F];
+		*out++ = pEncoding[group & 0x3F];
+		p += 3;
+		length -= 3;
+	}
+	if (length == 1)
+	{
+		*out++ = pEncoding[p[0] >> 2];
+		*out++ = pEncoding[(p[0] & 0x03) << 4];
+		if (!(options & BASE64_NO_PADDING))
+		{
+			*out++ = '=';
+			*out++ = '=';
+		}
+	}
+	else if (length == 2)
+	{
+		*out++ = pEncoding[p[0] >> 2];
+		*out++ = pEncoding[((p[0] & 0x03) << 4) | (p[1] >> 4)];
+		*out++ = pEncoding[(p[1] & 0x0F) << 2];
+		if (!(options & BASE64_NO_PADDING))
+		{
+			*out++ = '=';
+		}
+	}
+	poco_assert_dbg (out == base64.end());
+}
+
+
+std::string Base64Codec::encode(const void* data, std::size_t length, int options)
+{
+	std::string base64;
+	encode(data, length, base64, options);
+	return base64;
+}
+
+
+bool Base64Codec::decode(const std::string& base64, std::string& data, int options)
+{
+	static const DecodingTable stdTable(Base64EncoderBuf::OUT_ENCODING);
+	static const DecodingTable urlTable(Base64EncoderBuf::OUT_ENCODING_URL);
+	const unsigned char* pDecoding = (options & BASE64_URL_ENCODING) ? urlTable.table : stdTable.table;
+
+	data.clear();
+	data.reserve((base64.size()/4)*3 + 2);
+	unsigned group = 0;
+	int groupLength = 0;
+	for (std::string::const_iterator it = base64.begin(); it != base64.end(); ++it)
+	{
+		unsigned char c = static_cast<unsigned char>(*it);
+		if (c == '=') break;
+		unsigned char b = pDecoding[c];
+		if (b == 0xFF)
+		{
+			if (Ascii::isSpace(c)) continue;
+			return false;
+		}
+		group = (group << 6) | b;
+		if (++groupLength == 4)
+		{
+			data += static_cast<char>((group >> 16) & 0xFF);
+			data += static_cast<char>((group >> 8) & 0xFF);
+			data += static_cast<char>(group & 0xFF);
+			group = 0;
+			groupLength = 0;
+		}
+	}
+	if (groupLength == 2)
+	{
+		data += static_cast<char>((group >> 4) & 0xFF);
+	}
+	else if (groupLength == 3)
+	{
+		data += static_cast<char>((group >> 10) & 0xFF);
+		data += static_cast<char>((group >> 2) & 0xFF);
+	}
+	else if (groupLength == 1)
+	{
+		return false; // a single trailing character cannot encode a byte
+	}
+	return true;
+}
+
+
+} // namespace Poco
@@ -108,6 +108,62 @@ int Base64EncoderBuf::writeToDevice(char c)
 }
 
 
+std::streamsize Base64EncoderBuf::xsputn(const char* s, std::streamsize count)
+{
+	static const int eof = std::char_traits<char>::eof();
+
+	std::streamsize written = 0;
+	// complete a pending partial group one character at a time
+	while (written < count && _groupLength != 0)
+	{
+		if (writeToDevice(s[written]) == eof) return written;
+		++written;
+	}
+	// bulk-encode full groups
+	char chunk[1024];
+	while (count - written >= 3)
+	{
+		std::streamsize groups = (count - written)/3;
+		if (groups > static_cast<std::streamsize>(sizeof(chunk)/4))
+			groups = static_cast<std::streamsize>(sizeof(chunk)/4);
+		if (_lineLength > 0)
+		{
+			std::streamsize lineGroups = (_lineLength - _pos + 3)/4;
+			if (lineGroups < 1) lineGroups = 1;
+			if (groups > lineGroups) groups = lineGroups;
+		}
+		const unsigned char* p = reinterpret_cast<const unsigned char*>(s) + written;
+		char* out = chunk;
+		for (std::streamsize i = 0; i < groups; i++)
+		{
+			unsigned group = (static_cast<unsigned>(p[0]) << 16) | (static_cast<unsigned>(p[1]) << 8) | p[2];
+			*out++ = _pOutEncoding[(group >> 18) & 0x3F];
+			*out++ = _pOutEncoding[(group >> 12) & 0x3F];
+			*out++ = _pOutEncoding[(group >> 6) & 0x3F];
+			*out++ = _pOutEncoding[group & 0x3F];
+			p += 3;
+		}
+		std::streamsize n = out - chunk;
+		if (_buf.sputn(chunk, n) != n) return written;
+		written += groups*3;
+		_pos += static_cast<int>(n);
+		if (_lineLength > 0 && _pos >= _lineLength)
+		{
+			if (_buf.sputc('\r') == eof) return written;
+			if (_buf.sputc('\n') == eof) return written;
+			_pos = 0;
+		}
+	}
+	// buffer a trailing partial group
+	while (written < count)
+	{
+		if (writeToDevice(s[written]) == eof) return written;
+		++written;
+	}
+	return written;
+}
+
+
 int Base64EncoderBuf::close()
 {
 	static const int eof = std::char_traits<char>::eof();
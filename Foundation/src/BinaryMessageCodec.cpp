@@ -0,0 +1,125 @@
+//
+// BinaryMessageCodec.cpp
+//
+// Library: Foundation
+// Package: Logging
+// Module:  BinaryMessageCodec
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/BinaryMessageCodec.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+namespace
+{
+	void appendUInt32(std::string& buffer, UInt32 value)
+	{
+		buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+	void appendInt64(std::string& buffer, Int64 value)
+	{
+		buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+	void appendString(std::string& buffer, const std::string& value)
+	{
+		appendUInt32(buffer, static_cast<UInt32>(value.size()));
+		buffer.append(value);
+	}
+
+	bool readUInt32(const char*& p, const char* end, UInt32& value)
+	{
+		if (end - p < static_cast<std::ptrdiff_t>(sizeof(value))) return false;
+		std::memcpy(&value, p, sizeof(value));
+		p += sizeof(value);
+		return true;
+	}
+
+	bool readInt64(const char*& p, const char* end, Int64& value)
+	{
+		if (end - p < static_cast<std::ptrdiff_t>(sizeof(value))) return false;
+		std::memcpy(&value, p, sizeof(value));
+		p += sizeof(value);
+		return true;
+	}
+
+	bool readString(const char*& p, const char* end, std::string& value)
+	{
+		UInt32 length;
+		if (!readUInt32(p, end, length)) return false;
+		if (end - p < static_cast<std::ptrdiff_t>(length)) return false;
+		value.assign(p, length);
+		p += length;
+		return true;
+	}
+}
+
+
+void BinaryMessageCodec::write(const Message& msg, std::string& buffer)
+{
+	buffer.reserve(buffer.size() + 64 + msg.getSource().size() + msg.getText().size() + msg.getThread().size());
+	buffer += static_cast<char>(msg.getPriority());
+	appendInt64(buffer, msg.getTime().epochMicroseconds());
+	appendInt64(buffer, msg.getPid());
+	appendInt64(buffer, msg.getTid());
+	appendString(buffer, msg.getSource());
+	appendString(buffer, msg.getThread());
+	appendString(buffer, msg.getText());
+	const Message::StringMap* pParams = msg.parameters();
+	appendUInt32(buffer, pParams ? static_cast<UInt32>(pParams->size()) : 0);
+	if (pParams)
+	{
+		for (Message::StringMap::const_iterator it = pParams->begin(); it != pParams->end(); ++it)
+		{
+			appendString(buffer, it->first);
+			appendString(buffer, it->second);
+		}
+	}
+}
+
+
+bool BinaryMessageCodec::read(Message& msg, const char* buffer, std::size_t size)
+{
+	const char* p = buffer;
+	const char* end = buffer + size;
+	if (p == end) return false;
+
+	msg.setPriority(static_cast<Message::Priority>(*p++));
+	Int64 time, pid, tid;
+	if (!readInt64(p, end, time)) return false;
+	if (!readInt64(p, end, pid)) return false;
+	if (!readInt64(p, end, tid)) return false;
+	msg.setTime(Timestamp(time));
+	msg.setPid(static_cast<long>(pid));
+	msg.setTid(static_cast<long>(tid));
+	std::string str;
+	if (!readString(p, end, str)) return false;
+	msg.setSource(str);
+	if (!readString(p, end, str)) return false;
+	msg.setThread(str);
+	if (!readString(p, end, str)) return false;
+	msg.setText(str);
+	UInt32 params;
+	if (!readUInt32(p, end, params)) return false;
+	for (UInt32 i = 0; i < params; i++)
+	{
+		std::string name, value;
+		if (!readString(p, end, name)) return false;
+		if (!readString(p, end, value)) return false;
+		msg.set(name, value);
+	}
+	return true;
+}
+
+
+} // namespace Poco
@@ -192,6 +192,12 @@ void BinaryWriter::writeRaw(const char* buffer, std::streamsize length)
 }
 
 
+void BinaryWriter::writeRaw(const ConstBufferRef& data)
+{
+	_ostr.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+
 void BinaryWriter::writeBOM()
 {
 	UInt16 value = 0xFEFF;
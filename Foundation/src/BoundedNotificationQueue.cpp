@@ -0,0 +1,220 @@
+//
+// BoundedNotificationQueue.cpp
+//
+// Library: Foundation
+// Package: Notifications
+// Module:  BoundedNotificationQueue
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/BoundedNotificationQueue.h"
+#include "Poco/Timestamp.h"
+
+
+namespace Poco {
+
+
+BoundedNotificationQueue::BoundedNotificationQueue(std::size_t capacity):
+	_enqueuePos(0),
+	_dequeuePos(0),
+	_waitingConsumers(0),
+	_waitingProducers(0),
+	_wakeUpAll(false)
+{
+	poco_assert (capacity >= 2);
+
+	std::size_t size = 2;
+	while (size < capacity) size <<= 1;
+	_buffer = new Cell[size];
+	_bufferMask = size - 1;
+	for (std::size_t i = 0; i < size; i++)
+	{
+		_buffer[i].sequence.store(i, std::memory_order_relaxed);
+		_buffer[i].pNotification = 0;
+	}
+}
+
+
+BoundedNotificationQueue::~BoundedNotificationQueue()
+{
+	try
+	{
+		Notification* pNf = dequeueNotification();
+		while (pNf)
+		{
+			pNf->release();
+			pNf = dequeueNotification();
+		}
+		delete [] _buffer;
+	}
+	catch (...)
+	{
+		delete [] _buffer;
+		poco_unexpected();
+	}
+}
+
+
+bool BoundedNotificationQueue::tryEnqueueNotification(Notification::Ptr pNotification)
+{
+	poco_check_ptr (pNotification);
+
+	Cell* pCell;
+	std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		pCell = &_buffer[pos & _bufferMask];
+		std::size_t seq = pCell->sequence.load(std::memory_order_acquire);
+		std::ptrdiff_t dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+		if (dif == 0)
+		{
+			if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (dif < 0)
+		{
+			return false; // full
+		}
+		else
+		{
+			pos = _enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+	pCell->pNotification = pNotification.duplicate();
+	pCell->sequence.store(pos + 1, std::memory_order_release);
+	if (_waitingConsumers.load(std::memory_order_acquire) > 0)
+		_nonEmpty.set();
+	return true;
+}
+
+
+void BoundedNotificationQueue::enqueueNotification(Notification::Ptr pNotification)
+{
+	while (!tryEnqueueNotification(pNotification))
+	{
+		++_waitingProducers;
+		if (!full()) // re-check to avoid a lost wakeup
+		{
+			--_waitingProducers;
+			continue;
+		}
+		_nonFull.tryWait(100);
+		--_waitingProducers;
+	}
+}
+
+
+Notification* BoundedNotificationQueue::dequeueNotification()
+{
+	Cell* pCell;
+	std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		pCell = &_buffer[pos & _bufferMask];
+		std::size_t seq = pCell->sequence.load(std::memory_order_acquire);
+		std::ptrdiff_t dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+		if (dif == 0)
+		{
+			if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (dif < 0)
+		{
+			return 0; // empty
+		}
+		else
+		{
+			pos = _dequeuePos.load(std::memory_order_relaxed);
+		}
+	}
+	Notification* pNf = pCell->pNotification;
+	pCell->pNotification = 0;
+	pCell->sequence.store(pos + _bufferMask + 1, std::memory_order_release);
+	if (_waitingProducers.load(std::memory_order_acquire) > 0)
+		_nonFull.set();
+	return pNf;
+}
+
+
+Notification* BoundedNotificationQueue::waitDequeueNotification()
+{
+	for (;;)
+	{
+		Notification* pNf = dequeueNotification();
+		if (pNf) return pNf;
+		if (_wakeUpAll.load(std::memory_order_acquire)) return 0;
+		++_waitingConsumers;
+		if (!empty()) // re-check to avoid a lost wakeup
+		{
+			--_waitingConsumers;
+			continue;
+		}
+		_nonEmpty.tryWait(100);
+		--_waitingConsumers;
+	}
+}
+
+
+Notification* BoundedNotificationQueue::waitDequeueNotification(long milliseconds)
+{
+	Notification* pNf = dequeueNotification();
+	if (pNf) return pNf;
+	Poco::Timestamp now;
+	Poco::Timestamp::TimeDiff diff(Poco::Timestamp::TimeDiff(milliseconds)*1000);
+	while (now.elapsed() < diff)
+	{
+		if (_wakeUpAll.load(std::memory_order_acquire)) return 0;
+		++_waitingConsumers;
+		if (empty())
+		{
+			long remaining = static_cast<long>((diff - now.elapsed())/1000);
+			if (remaining > 100) remaining = 100;
+			if (remaining > 0) _nonEmpty.tryWait(remaining);
+		}
+		--_waitingConsumers;
+		pNf = dequeueNotification();
+		if (pNf) return pNf;
+	}
+	return 0;
+}
+
+
+void BoundedNotificationQueue::wakeUpAll()
+{
+	_wakeUpAll.store(true, std::memory_order_release);
+	_nonEmpty.set();
+}
+
+
+bool BoundedNotificationQueue::empty() const
+{
+	return size() == 0;
+}
+
+
+bool BoundedNotificationQueue::full() const
+{
+	return size() > _bufferMask;
+}
+
+
+std::size_t BoundedNotificationQueue::size() const
+{
+	std::size_t enq = _enqueuePos.load(std::memory_order_acquire);
+	std::size_t deq = _dequeuePos.load(std::memory_order_acquire);
+	return enq > deq ? enq - deq : 0;
+}
+
+
+std::size_t BoundedNotificationQueue::capacity() const
+{
+	return _bufferMask + 1;
+}
+
+
+} // namespace Poco
@@ -0,0 +1,157 @@
+//
+// CancellationToken.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  CancellationToken
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/CancellationToken.h"
+#include "Poco/Exception.h"
+
+
+namespace Poco {
+
+
+struct CancellationToken::State
+{
+	State():
+		cancelled(false),
+		event(Event::EVENT_MANUALRESET),
+		nextId(0)
+	{
+	}
+
+	std::atomic<bool> cancelled;
+	Event event;
+	FastMutex mutex;
+	int nextId;
+	std::map<int, Callback> callbacks;
+};
+
+
+CancellationToken::CancellationToken():
+	_pState(new State)
+{
+}
+
+
+CancellationToken::CancellationToken(const Poco::SharedPtr<State>& pState):
+	_pState(pState)
+{
+}
+
+
+CancellationToken::~CancellationToken()
+{
+}
+
+
+bool CancellationToken::isCancelled() const
+{
+	return _pState->cancelled.load(std::memory_order_acquire);
+}
+
+
+void CancellationToken::throwIfCancelled() const
+{
+	if (isCancelled()) throw InterruptedException("operation cancelled");
+}
+
+
+bool CancellationToken::wait(long milliseconds) const
+{
+	if (isCancelled()) return true;
+	return _pState->event.tryWait(milliseconds);
+}
+
+
+int CancellationToken::onCancel(const Callback& callback) const
+{
+	bool runNow = false;
+	int id = -1;
+	{
+		FastMutex::ScopedLock lock(_pState->mutex);
+		if (_pState->cancelled)
+		{
+			runNow = true;
+		}
+		else
+		{
+			id = _pState->nextId++;
+			_pState->callbacks[id] = callback;
+		}
+	}
+	if (runNow) callback();
+	return id;
+}
+
+
+void CancellationToken::removeCallback(int id) const
+{
+	FastMutex::ScopedLock lock(_pState->mutex);
+	_pState->callbacks.erase(id);
+}
+
+
+CancellationTokenSource::CancellationTokenSource():
+	_pState(new CancellationToken::State)
+{
+}
+
+
+CancellationTokenSource::~CancellationTokenSource()
+{
+}
+
+
+CancellationToken CancellationTokenSource::token() const
+{
+	return CancellationToken(_pState);
+}
+
+
+void CancellationTokenSource::cancel()
+{
+	std::map<int, CancellationToken::Callback> callbacks;
+	{
+		FastMutex::ScopedLock lock(_pState->mutex);
+		if (_pState->cancelled.exchange(true)) return;
+		callbacks.swap(_pState->callbacks);
+	}
+	_pState->event.set();
+	for (std::map<int, CancellationToken::Callback>::iterator it = callbacks.begin(); it != callbacks.end(); ++it)
+	{
+		try
+		{
+			it->second();
+		}
+		catch (...)
+		{
+		}
+	}
+}
+
+
+bool CancellationTokenSource::isCancelled() const
+{
+	return _pState->cancelled.load(std::memory_order_acquire);
+}
+
+
+void CancellationTokenSource::reset()
+{
+	FastMutex::ScopedLock lock(_pState->mutex);
+	_pState->cancelled = false;
+	_pState->event.reset();
+	_pState->callbacks.clear();
+}
+
+
+} // namespace Poco
@@ -13,16 +13,110 @@
 
 
 #include "Poco/Checksum32.h"
+#include <cstring>
 #if defined(POCO_UNBUNDLED)
 #include <zlib.h>
 #else
 #include "Poco/zlib.h"
 #endif
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define POCO_HAVE_HW_CRC32C 1
+#include <nmmintrin.h>
+#endif
 
 
 namespace Poco {
 
 
+namespace
+{
+	//
+	// CRC-32C (Castagnoli polynomial 0x1EDC6F41, reflected 0x82F63B78),
+	// software fallback table
+	//
+	class CRC32CTable
+	{
+	public:
+		CRC32CTable()
+		{
+			for (Poco::UInt32 i = 0; i < 256; i++)
+			{
+				Poco::UInt32 crc = i;
+				for (int j = 0; j < 8; j++)
+					crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1)));
+				_table[i] = crc;
+			}
+		}
+
+		Poco::UInt32 operator [] (unsigned index) const
+		{
+			return _table[index];
+		}
+
+	private:
+		Poco::UInt32 _table[256];
+	};
+
+
+	Poco::UInt32 crc32cSoftware(Poco::UInt32 crc, const unsigned char* data, unsigned length)
+	{
+		static CRC32CTable table;
+
+		crc = ~crc;
+		while (length-- > 0)
+			crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+		return ~crc;
+	}
+
+
+#if defined(POCO_HAVE_HW_CRC32C)
+	__attribute__((target("sse4.2")))
+	Poco::UInt32 crc32cHardware(Poco::UInt32 crc, const unsigned char* data, unsigned length)
+	{
+		crc = ~crc;
+#if defined(__x86_64__)
+		while (length >= 8)
+		{
+			Poco::UInt64 chunk;
+			std::memcpy(&chunk, data, 8);
+			crc = static_cast<Poco::UInt32>(_mm_crc32_u64(crc, chunk));
+			data += 8;
+			length -= 8;
+		}
+#endif
+		while (length >= 4)
+		{
+			Poco::UInt32 chunk;
+			std::memcpy(&chunk, data, 4);
+			crc = _mm_crc32_u32(crc, chunk);
+			data += 4;
+			length -= 4;
+		}
+		while (length-- > 0)
+			crc = _mm_crc32_u8(crc, *data++);
+		return ~crc;
+	}
+
+
+	bool haveHardwareCRC32C()
+	{
+		static const bool available = __builtin_cpu_supports("sse4.2");
+		return available;
+	}
+#endif
+
+
+	Poco::UInt32 crc32c(Poco::UInt32 crc, const unsigned char* data, unsigned length)
+	{
+#if defined(POCO_HAVE_HW_CRC32C)
+		if (haveHardwareCRC32C())
+			return crc32cHardware(crc, data, length);
+#endif
+		return crc32cSoftware(crc, data, length);
+	}
+}
+
+
 Checksum32::Checksum32():
 	_type(TYPE_CRC32_IMPL),
 	_value(crc32(0L, Z_NULL, 0))
@@ -36,6 +130,8 @@ Checksum32::Checksum32(ChecksumImpl::Type t):
 {
 	if (t == TYPE_CRC32_IMPL)
 		_value = crc32(0L, Z_NULL, 0);
+	else if (t == TYPE_CRC32C_IMPL)
+		_value = 0;
 	else
 		_value = adler32(0L, Z_NULL, 0);
 }
@@ -50,6 +146,8 @@ void Checksum32::update(const char* data, unsigned length)
 {
 	if (_type == TYPE_ADLER32_IMPL)
 		_value = adler32(_value, reinterpret_cast<const Bytef*>(data), length);
+	else if (_type == TYPE_CRC32C_IMPL)
+		_value = crc32c(_value, reinterpret_cast<const unsigned char*>(data), length);
 	else
 		_value = crc32(_value, reinterpret_cast<const Bytef*>(data), length);
 }
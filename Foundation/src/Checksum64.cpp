@@ -13,6 +13,11 @@
 
 
 #include "Poco/Checksum64.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Environment.h"
+#include "Poco/SharedPtr.h"
+#include <vector>
 
 
 namespace Poco {
@@ -113,4 +118,148 @@ void Checksum64::update(const char* data, unsigned length)
 }
 
 
+namespace
+{
+	const Poco::UInt64 CRC64_POLY = 0x42F0E1EBA9EA3693ULL;
+
+
+	Poco::UInt64 gf2MatrixTimes(const Poco::UInt64* pMat, Poco::UInt64 vec)
+	{
+		Poco::UInt64 sum = 0;
+		int i = 0;
+		while (vec)
+		{
+			if (vec & 1) sum ^= pMat[i];
+			vec >>= 1;
+			i++;
+		}
+		return sum;
+	}
+
+
+	void gf2MatrixSquare(Poco::UInt64* pSquare, const Poco::UInt64* pMat)
+	{
+		for (int i = 0; i < 64; i++)
+			pSquare[i] = gf2MatrixTimes(pMat, pMat[i]);
+	}
+}
+
+
+Poco::UInt64 Checksum64::combine(Poco::UInt64 crcA, Poco::UInt64 crcB, Poco::UInt64 lengthB)
+{
+	if (lengthB == 0) return crcA;
+
+	// with this CRC's parameters (init == final XOR), the register
+	// algebra collapses to crcB ^ (crcA * x^(8*lengthB) mod P);
+	// the multiplication is done with GF(2) matrix squaring, as in
+	// zlib's crc32_combine, but MSB-first
+	Poco::UInt64 even[64];
+	Poco::UInt64 odd[64];
+
+	// operator for one zero bit fed into the register
+	for (int i = 0; i < 64; i++)
+	{
+		Poco::UInt64 reg = Poco::UInt64(1) << i;
+		odd[i] = (reg << 1) ^ ((reg >> 63) ? CRC64_POLY : 0);
+	}
+	gf2MatrixSquare(even, odd);  // two zero bits
+	gf2MatrixSquare(odd, even);  // four zero bits
+
+	Poco::UInt64 crc = crcA;
+	Poco::UInt64 len = lengthB; // in bytes; the first squaring below yields the 8-zero-bit operator
+	const Poco::UInt64* pMat = odd;
+	Poco::UInt64* pNext = even;
+	do
+	{
+		gf2MatrixSquare(pNext, pMat);
+		if (len & 1) crc = gf2MatrixTimes(pNext, crc);
+		len >>= 1;
+		const Poco::UInt64* pTmp = pNext;
+		pNext = const_cast<Poco::UInt64*>(pMat);
+		pMat = pTmp;
+	}
+	while (len);
+
+	return crc ^ crcB;
+}
+
+
+namespace
+{
+	class ChecksumJob: public Poco::Runnable
+	{
+	public:
+		ChecksumJob(const char* data, std::size_t length):
+			_data(data),
+			_length(length),
+			_crc(0)
+		{
+		}
+
+		void run()
+		{
+			// update() checksums each call's data independently,
+			// so pieces larger than the update() length type are
+			// merged with combine()
+			Checksum64 checksum;
+			std::size_t offset = 0;
+			while (offset < _length)
+			{
+				unsigned chunk = _length - offset > 0x40000000 ? 0x40000000 : static_cast<unsigned>(_length - offset);
+				checksum.update(_data + offset, chunk);
+				_crc = offset == 0 ? checksum.checksum() : Checksum64::combine(_crc, checksum.checksum(), chunk);
+				offset += chunk;
+			}
+		}
+
+		Poco::UInt64 crc() const
+		{
+			return _crc;
+		}
+
+		std::size_t length() const
+		{
+			return _length;
+		}
+
+	private:
+		const char* _data;
+		std::size_t _length;
+		Poco::UInt64 _crc;
+	};
+}
+
+
+Poco::UInt64 Checksum64::checksumParallel(const char* data, std::size_t length, int maxThreads)
+{
+	if (maxThreads <= 0) maxThreads = static_cast<int>(Environment::processorCount());
+	std::size_t chunkSize = maxThreads > 0 ? length/maxThreads : length;
+	if (chunkSize < 65536 || maxThreads < 2)
+	{
+		// too small to amortize the fan-out; the job also handles
+		// lengths beyond update()'s unsigned range
+		ChecksumJob job(data, length);
+		job.run();
+		return job.crc();
+	}
+
+	std::vector<Poco::SharedPtr<ChecksumJob> > jobs;
+	ThreadPool pool(1, maxThreads);
+	std::size_t offset = 0;
+	for (int i = 0; i < maxThreads; i++)
+	{
+		std::size_t size = (i == maxThreads - 1) ? length - offset : chunkSize;
+		jobs.push_back(new ChecksumJob(data + offset, size));
+		pool.start(*jobs.back());
+		offset += size;
+	}
+	pool.joinAll();
+
+	Poco::UInt64 crc = jobs[0]->crc();
+	for (std::size_t i = 1; i < jobs.size(); i++)
+		crc = combine(crc, jobs[i]->crc(), jobs[i]->length());
+	return crc;
+}
+
+
 } // namespace Poco
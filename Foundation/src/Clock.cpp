@@ -13,6 +13,7 @@
 
 
 #include "Poco/Clock.h"
+#include <ctime>
 #include "Poco/Exception.h"
 #include "Poco/Timestamp.h"
 #include <chrono>
@@ -87,6 +88,30 @@ void Clock::update()
 }
 
 
+void Clock::updateCoarse()
+{
+#if POCO_OS == POCO_OS_LINUX && defined(CLOCK_MONOTONIC_COARSE)
+	// shares the CLOCK_MONOTONIC epoch, so values remain comparable
+	// with those from update()
+	struct timespec ts;
+	if (::clock_gettime(CLOCK_MONOTONIC_COARSE, &ts) == 0)
+	{
+		_clock = ClockVal(ts.tv_sec)*resolution() + ts.tv_nsec/1000;
+		return;
+	}
+#endif
+	update();
+}
+
+
+Clock Clock::coarse()
+{
+	Clock result(0);
+	result.updateCoarse();
+	return result;
+}
+
+
 Clock::ClockDiff Clock::accuracy()
 {
 	ClockVal acc = static_cast<ClockVal>(std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(std::chrono::steady_clock::duration(1)).count());
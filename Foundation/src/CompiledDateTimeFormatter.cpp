@@ -0,0 +1,91 @@
+//
+// CompiledDateTimeFormatter.cpp
+//
+// Library: Foundation
+// Package: DateTime
+// Module:  CompiledDateTimeFormatter
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/CompiledDateTimeFormatter.h"
+#include "Poco/DateTimeFormatter.h"
+
+
+namespace Poco {
+
+
+CompiledDateTimeFormatter::CompiledDateTimeFormatter(const std::string& pattern):
+	_cacheable(true),
+	_cacheValid(false),
+	_cachedSecond(0),
+	_cachedTzd(0)
+{
+	std::string::const_iterator it = pattern.begin();
+	std::string::const_iterator end = pattern.end();
+	Op op;
+	op.literal = true;
+	while (it != end)
+	{
+		if (*it == '%' && it + 1 != end)
+		{
+			if (!op.text.empty())
+			{
+				_ops.push_back(op);
+				op.text.clear();
+			}
+			char spec = *(it + 1);
+			if (spec == 'i' || spec == 'c' || spec == 'F')
+				_cacheable = false; // sub-second precision
+			Op field;
+			field.literal = false;
+			field.text.assign(it, it + 2);
+			_ops.push_back(field);
+			it += 2;
+		}
+		else
+		{
+			op.text += *it++;
+		}
+	}
+	if (!op.text.empty()) _ops.push_back(op);
+	_result.reserve(pattern.size() + 16);
+}
+
+
+const std::string& CompiledDateTimeFormatter::format(const Timestamp& timestamp, int timeZoneDifferential)
+{
+	if (_cacheable)
+	{
+		Timestamp::TimeVal second = timestamp.epochMicroseconds()/Timestamp::resolution();
+		if (_cacheValid && second == _cachedSecond && timeZoneDifferential == _cachedTzd)
+			return _result;
+		const std::string& result = format(DateTime(timestamp), timeZoneDifferential);
+		_cachedSecond = second;
+		_cachedTzd = timeZoneDifferential;
+		_cacheValid = true;
+		return result;
+	}
+	return format(DateTime(timestamp), timeZoneDifferential);
+}
+
+
+const std::string& CompiledDateTimeFormatter::format(const DateTime& dateTime, int timeZoneDifferential)
+{
+	_result.clear();
+	for (std::vector<Op>::const_iterator it = _ops.begin(); it != _ops.end(); ++it)
+	{
+		if (it->literal)
+			_result += it->text;
+		else
+			DateTimeFormatter::append(_result, dateTime, it->text, timeZoneDifferential);
+	}
+	return _result;
+}
+
+
+} // namespace Poco
@@ -66,11 +66,48 @@ DateTime::DateTime(const tm& tmStruct):
 }
 
 
+namespace
+{
+	// per-thread cache of the last civil-time computation; most
+	// per-request DateTime constructions fall within one second of
+	// each other, which skips the Julian-day double arithmetic
+	struct CivilTimeCache
+	{
+		Timestamp::UtcTimeVal second = -1;
+		short year = 0, month = 0, day = 0, hour = 0, minute = 0, sec = 0;
+	};
+	thread_local CivilTimeCache civilTimeCache;
+}
+
+
 DateTime::DateTime(const Timestamp& timestamp):
 	_utcTime(timestamp.utcTime())
 {
+	// 100-nanosecond resolution: 10^7 units per second
+	Timestamp::UtcTimeVal second = _utcTime/10000000;
+	CivilTimeCache& cache = civilTimeCache;
+	if (second == cache.second && _utcTime >= 0)
+	{
+		_year        = cache.year;
+		_month       = cache.month;
+		_day         = cache.day;
+		_hour        = cache.hour;
+		_minute      = cache.minute;
+		_second      = cache.sec;
+		Timestamp::UtcTimeVal fraction = _utcTime - second*10000000;
+		_millisecond = static_cast<short>(fraction/10000);
+		_microsecond = static_cast<short>((fraction/10) % 1000);
+		return;
+	}
 	computeGregorian(julianDay());
 	computeDaytime();
+	cache.second = second;
+	cache.year   = _year;
+	cache.month  = _month;
+	cache.day    = _day;
+	cache.hour   = _hour;
+	cache.minute = _minute;
+	cache.sec    = _second;
 }
 
 
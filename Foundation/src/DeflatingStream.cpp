@@ -171,6 +171,39 @@ int DeflatingStreamBuf::close()
 }
 
 
+void DeflatingStreamBuf::reset(std::ostream& ostr)
+{
+	poco_assert (!_pIstr);
+
+	int rc = deflateReset(&_zstr);
+	if (rc != Z_OK) throw IOException(zError(rc));
+	_zstr.next_in   = 0;
+	_zstr.avail_in  = 0;
+	_zstr.next_out  = 0;
+	_zstr.avail_out = 0;
+	_pOstr = &ostr;
+	_eof = false;
+}
+
+
+void DeflatingStreamBuf::setParams(int level, int strategy)
+{
+	// a parameter change may flush buffered compressed data,
+	// so zlib needs a valid output buffer
+	_zstr.next_out  = (unsigned char*) _buffer;
+	_zstr.avail_out = DEFLATE_BUFFER_SIZE;
+	int rc = deflateParams(&_zstr, level, strategy);
+	if (rc != Z_OK) throw IOException(zError(rc));
+	if (_pOstr && _zstr.avail_out != DEFLATE_BUFFER_SIZE)
+	{
+		_pOstr->write(_buffer, DEFLATE_BUFFER_SIZE - _zstr.avail_out);
+		if (!_pOstr->good()) throw IOException("Failed writing deflated data");
+	}
+	_zstr.next_out  = (unsigned char*) _buffer;
+	_zstr.avail_out = DEFLATE_BUFFER_SIZE;
+}
+
+
 int DeflatingStreamBuf::sync()
 {
 	if (BufferedStreamBuf::sync())
@@ -362,6 +395,19 @@ int DeflatingOutputStream::close()
 }
 
 
+void DeflatingOutputStream::reset(std::ostream& ostr)
+{
+	_buf.reset(ostr);
+	clear();
+}
+
+
+void DeflatingOutputStream::setParams(int level, int strategy)
+{
+	_buf.setParams(level, strategy);
+}
+
+
 int DeflatingOutputStream::sync()
 {
 	return _buf.pubsync();
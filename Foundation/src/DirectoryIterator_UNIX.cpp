@@ -48,15 +48,19 @@ DirectoryIteratorImpl::~DirectoryIteratorImpl()
 
 const std::string& DirectoryIteratorImpl::next()
 {
+	// skip the dot entries before touching the string, so regular
+	// entries cost exactly one buffer-reusing assignment
+	struct dirent* pEntry;
 	do
 	{
-		struct dirent* pEntry = readdir(_pDir);
-		if (pEntry)
-			_current = pEntry->d_name;
-		else
-			_current.clear();
+		pEntry = readdir(_pDir);
 	}
-	while (_current == "." || _current == "..");
+	while (pEntry && pEntry->d_name[0] == '.' &&
+		(pEntry->d_name[1] == '\0' || (pEntry->d_name[1] == '.' && pEntry->d_name[2] == '\0')));
+	if (pEntry)
+		_current = pEntry->d_name;
+	else
+		_current.clear();
 	return _current;
 }
 
@@ -308,7 +308,7 @@ public:
 			}
 		}
 		
-		Poco::Buffer<char> buffer(4096);
+		Poco::Buffer<char> buffer(64*1024);
 		while (!_stopped)
 		{
 			fd_set fds;
@@ -321,6 +321,10 @@ public:
 
 			if (select(_fd + 1, &fds, NULL, NULL, &tv) == 1)
 			{
+				// let a burst of changes settle so it lands in one
+				// read and one pass of notifications instead of one
+				// wakeup per change
+				Poco::Thread::sleep(5);
 				int n = read(_fd, buffer.begin(), buffer.size());
 				int i = 0;
 				if (n > 0)
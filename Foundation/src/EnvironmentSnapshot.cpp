@@ -0,0 +1,105 @@
+//
+// EnvironmentSnapshot.cpp
+//
+// Library: Foundation
+// Package: Core
+// Module:  EnvironmentSnapshot
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/EnvironmentSnapshot.h"
+#include "Poco/Exception.h"
+#include <cstring>
+#if defined(POCO_OS_FAMILY_WINDOWS)
+#include "Poco/UnicodeConverter.h"
+#include "Poco/UnWindows.h"
+#else
+extern char** environ;
+#endif
+
+
+namespace Poco {
+
+
+EnvironmentSnapshot::EnvironmentSnapshot()
+{
+	capture();
+}
+
+
+EnvironmentSnapshot::~EnvironmentSnapshot()
+{
+}
+
+
+void EnvironmentSnapshot::capture()
+{
+	_env.clear();
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	wchar_t* pStrings = GetEnvironmentStringsW();
+	if (pStrings)
+	{
+		const wchar_t* p = pStrings;
+		while (*p)
+		{
+			std::string entry;
+			UnicodeConverter::toUTF8(p, entry);
+			std::string::size_type sep = entry.find('=');
+			if (sep != std::string::npos && sep > 0)
+				_env[entry.substr(0, sep)] = entry.substr(sep + 1);
+			p += wcslen(p) + 1;
+		}
+		FreeEnvironmentStringsW(pStrings);
+	}
+#else
+	for (char** p = environ; p && *p; ++p)
+	{
+		const char* entry = *p;
+		const char* sep = std::strchr(entry, '=');
+		if (sep && sep != entry)
+			_env[std::string(entry, sep)] = std::string(sep + 1);
+	}
+#endif
+}
+
+
+bool EnvironmentSnapshot::has(const std::string& name) const
+{
+	return _env.find(name) != _env.end();
+}
+
+
+std::string EnvironmentSnapshot::get(const std::string& name) const
+{
+	std::map<std::string, std::string>::const_iterator it = _env.find(name);
+	if (it == _env.end()) throw NotFoundException(name);
+	return it->second;
+}
+
+
+std::string EnvironmentSnapshot::get(const std::string& name, const std::string& defaultValue) const
+{
+	std::map<std::string, std::string>::const_iterator it = _env.find(name);
+	if (it == _env.end()) return defaultValue;
+	return it->second;
+}
+
+
+void EnvironmentSnapshot::refresh()
+{
+	capture();
+}
+
+
+std::size_t EnvironmentSnapshot::size() const
+{
+	return _env.size();
+}
+
+
+} // namespace Poco
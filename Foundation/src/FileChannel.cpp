@@ -18,6 +18,9 @@
 #include "Poco/PurgeStrategy.h"
 #include "Poco/Message.h"
 #include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Thread.h"
+#include "Poco/RunnableAdapter.h"
 #include "Poco/DateTimeFormatter.h"
 #include "Poco/DateTime.h"
 #include "Poco/LocalDateTime.h"
@@ -36,18 +39,30 @@ const std::string FileChannel::PROP_TIMES        = "times";
 const std::string FileChannel::PROP_COMPRESS     = "compress";
 const std::string FileChannel::PROP_PURGEAGE     = "purgeAge";
 const std::string FileChannel::PROP_PURGECOUNT   = "purgeCount";
-const std::string FileChannel::PROP_FLUSH        = "flush";
-const std::string FileChannel::PROP_ROTATEONOPEN = "rotateOnOpen";
+const std::string FileChannel::PROP_FLUSH          = "flush";
+const std::string FileChannel::PROP_ROTATEONOPEN   = "rotateOnOpen";
+const std::string FileChannel::PROP_ASYNC          = "async";
+const std::string FileChannel::PROP_FLUSHINTERVAL  = "flushInterval";
+const std::string FileChannel::PROP_BUFFERSIZE     = "bufferSize";
+const std::string FileChannel::PROP_OVERFLOWPOLICY = "overflowPolicy";
 
 FileChannel::FileChannel():
 	_times("utc"),
 	_compress(false),
 	_flush(true),
 	_rotateOnOpen(false),
+	_async(false),
+	_flushInterval(100),
+	_bufferSize(8192),
+	_dropOnOverflow(false),
 	_pFile(0),
 	_pRotateStrategy(0),
 	_pArchiveStrategy(new ArchiveByNumberStrategy),
-	_pPurgeStrategy(0)
+	_pPurgeStrategy(0),
+	_dropped(0),
+	_flusherAdapter(*this, &FileChannel::runFlusher),
+	_pFlusherThread(0),
+	_flusherStopped(false)
 {
 }
 
@@ -58,10 +73,18 @@ FileChannel::FileChannel(const std::string& rPath):
 	_compress(false),
 	_flush(true),
 	_rotateOnOpen(false),
+	_async(false),
+	_flushInterval(100),
+	_bufferSize(8192),
+	_dropOnOverflow(false),
 	_pFile(0),
 	_pRotateStrategy(0),
 	_pArchiveStrategy(new ArchiveByNumberStrategy),
-	_pPurgeStrategy(0)
+	_pPurgeStrategy(0),
+	_dropped(0),
+	_flusherAdapter(*this, &FileChannel::runFlusher),
+	_pFlusherThread(0),
+	_flusherStopped(false)
 {
 }
 
@@ -70,6 +93,7 @@ FileChannel::~FileChannel()
 {
 	try
 	{
+		stopFlusher();
 		close();
 		delete _pRotateStrategy;
 		delete _pArchiveStrategy;
@@ -107,6 +131,8 @@ void FileChannel::open()
 
 void FileChannel::close()
 {
+	stopFlusher();
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	delete _pFile;
@@ -118,8 +144,24 @@ void FileChannel::log(const Message& msg)
 {
 	open();
 
+	if (_async)
+	{
+		// close() joins the flusher; logging again after a close()
+		// must bring it back, or the buffer would never drain
+		if (!_pFlusherThread) startFlusher();
+		logAsync(msg.getText());
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
 
+	rotateIfNeeded();
+	_pFile->write(msg.getText(), _flush);
+}
+
+
+void FileChannel::rotateIfNeeded()
+{
 	if (_pRotateStrategy && _pArchiveStrategy && _pRotateStrategy->mustRotate(_pFile))
 	{
 		try
@@ -136,12 +178,121 @@ void FileChannel::log(const Message& msg)
 		// to the new file.
 		_pRotateStrategy->mustRotate(_pFile);
 	}
-	_pFile->write(msg.getText(), _flush);
+}
+
+
+void FileChannel::logAsync(const std::string& text)
+{
+	for (;;)
+	{
+		{
+			FastMutex::ScopedLock lock(_bufferMutex);
+			if (_buffer.size() < _bufferSize)
+			{
+				_buffer.push_back(text);
+				// wake the flusher early once the buffer is half full,
+				// otherwise let it drain on its flushInterval schedule
+				if (_buffer.size() >= _bufferSize/2) _flushEvent.set();
+				return;
+			}
+			if (_dropOnOverflow)
+			{
+				++_dropped;
+				return;
+			}
+		}
+		_flushEvent.set();
+		_notFull.tryWait(10);
+	}
+}
+
+
+void FileChannel::runFlusher()
+{
+	std::vector<std::string> back;
+	while (!_flusherStopped)
+	{
+		_flushEvent.tryWait(_flushInterval);
+		flushBuffer(back);
+	}
+	flushBuffer(back); // final drain
+}
+
+
+void FileChannel::flushBuffer(std::vector<std::string>& back)
+{
+	std::size_t dropped = 0;
+	{
+		FastMutex::ScopedLock lock(_bufferMutex);
+		_buffer.swap(back);
+		dropped = _dropped;
+		_dropped = 0;
+	}
+	_notFull.set();
+	if (back.empty() && dropped == 0) return;
+
+	std::string text;
+	std::size_t length = 0;
+	for (std::vector<std::string>::const_iterator it = back.begin(); it != back.end(); ++it)
+		length += it->size() + 1;
+	text.reserve(length);
+	for (std::vector<std::string>::const_iterator it = back.begin(); it != back.end(); ++it)
+	{
+		if (!text.empty()) text += '\n';
+		text += *it;
+	}
+	if (dropped > 0)
+	{
+		if (!text.empty()) text += '\n';
+		text += "Lost ";
+		text += NumberFormatter::format(dropped);
+		text += " log messages due to buffer overflow";
+	}
+	back.clear();
+
+	FastMutex::ScopedLock lock(_mutex);
+	rotateIfNeeded();
+	_pFile->write(text, _flush);
+}
+
+
+void FileChannel::startFlusher()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (!_pFlusherThread)
+	{
+		_flusherStopped = false;
+		_pFlusherThread = new Thread("FileChannel::flusher");
+		_pFlusherThread->start(_flusherAdapter);
+	}
+}
+
+
+void FileChannel::stopFlusher()
+{
+	if (_pFlusherThread)
+	{
+		_flusherStopped = true;
+		_flushEvent.set();
+		_pFlusherThread->join();
+		delete _pFlusherThread;
+		_pFlusherThread = 0;
+		_flusherStopped = false;
+	}
 }
 
 	
 void FileChannel::setProperty(const std::string& name, const std::string& value)
 {
+	if (name == PROP_ASYNC)
+	{
+		// must not hold _mutex here: disabling async mode joins the
+		// flusher thread, which takes _mutex to write its last batch
+		setAsync(value);
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	if (name == PROP_TIMES)
@@ -170,6 +321,12 @@ void FileChannel::setProperty(const std::string& name, const std::string& value)
 		setFlush(value);
 	else if (name == PROP_ROTATEONOPEN)
 		setRotateOnOpen(value);
+	else if (name == PROP_FLUSHINTERVAL)
+		_flushInterval = NumberParser::parse(value);
+	else if (name == PROP_BUFFERSIZE)
+		_bufferSize = static_cast<std::size_t>(NumberParser::parseUnsigned(value));
+	else if (name == PROP_OVERFLOWPOLICY)
+		setOverflowPolicy(value);
 	else
 		Channel::setProperty(name, value);
 }
@@ -195,6 +352,14 @@ std::string FileChannel::getProperty(const std::string& name) const
 		return std::string(_flush ? "true" : "false");
 	else if (name == PROP_ROTATEONOPEN)
 		return std::string(_rotateOnOpen ? "true" : "false");
+	else if (name == PROP_ASYNC)
+		return std::string(_async ? "true" : "false");
+	else if (name == PROP_FLUSHINTERVAL)
+		return NumberFormatter::format(_flushInterval);
+	else if (name == PROP_BUFFERSIZE)
+		return NumberFormatter::format(static_cast<Poco::UInt64>(_bufferSize));
+	else if (name == PROP_OVERFLOWPOLICY)
+		return std::string(_dropOnOverflow ? "drop" : "block");
 	else
 		return Channel::getProperty(name);
 }
@@ -343,6 +508,33 @@ void FileChannel::setRotateOnOpen(const std::string& rotateOnOpen)
 }
 
 
+void FileChannel::setAsync(const std::string& async)
+{
+	bool enable = icompare(async, "true") == 0;
+	if (enable && !_pFlusherThread)
+	{
+		_async = true;
+		startFlusher();
+	}
+	else if (!enable && _pFlusherThread)
+	{
+		_async = false;
+		stopFlusher();
+	}
+}
+
+
+void FileChannel::setOverflowPolicy(const std::string& policy)
+{
+	if (icompare(policy, "block") == 0)
+		_dropOnOverflow = false;
+	else if (icompare(policy, "drop") == 0)
+		_dropOnOverflow = true;
+	else
+		throw InvalidArgumentException("overflowPolicy", policy);
+}
+
+
 void FileChannel::purge()
 {
 	if (_pPurgeStrategy)
@@ -0,0 +1,94 @@
+//
+// FileInfo.cpp
+//
+// Library: Foundation
+// Package: Filesystem
+// Module:  FileInfo
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/FileInfo.h"
+#if defined(POCO_OS_FAMILY_UNIX)
+#include <sys/stat.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+
+namespace Poco {
+
+
+FileInfo::FileInfo(const std::string& path):
+	_path(path)
+{
+	update();
+}
+
+
+void FileInfo::update()
+{
+	_exists = _isFile = _isDirectory = _isLink = false;
+	_canRead = _canWrite = _canExecute = false;
+	_size = 0;
+	_lastModified = 0;
+
+#if defined(POCO_OS_FAMILY_UNIX)
+	struct stat st;
+	if (::lstat(_path.c_str(), &st) == 0)
+	{
+		_isLink = S_ISLNK(st.st_mode);
+		if (_isLink && ::stat(_path.c_str(), &st) != 0)
+		{
+			// dangling link: the link itself exists
+			_exists = true;
+			return;
+		}
+		_exists = true;
+		_isFile = S_ISREG(st.st_mode);
+		_isDirectory = S_ISDIR(st.st_mode);
+		_size = static_cast<File::FileSize>(st.st_size);
+		_lastModified = Timestamp::fromEpochTime(st.st_mtime);
+		if (st.st_uid == ::geteuid())
+		{
+			_canRead = (st.st_mode & S_IRUSR) != 0;
+			_canWrite = (st.st_mode & S_IWUSR) != 0;
+			_canExecute = (st.st_mode & S_IXUSR) != 0;
+		}
+		else if (st.st_gid == ::getegid())
+		{
+			_canRead = (st.st_mode & S_IRGRP) != 0;
+			_canWrite = (st.st_mode & S_IWGRP) != 0;
+			_canExecute = (st.st_mode & S_IXGRP) != 0;
+		}
+		else
+		{
+			_canRead = (st.st_mode & S_IROTH) != 0;
+			_canWrite = (st.st_mode & S_IWOTH) != 0;
+			_canExecute = (st.st_mode & S_IXOTH) != 0;
+		}
+	}
+#else
+	// portable fallback: one File per query set
+	File file(_path);
+	_exists = file.exists();
+	if (_exists)
+	{
+		_isFile = file.isFile();
+		_isDirectory = file.isDirectory();
+		_isLink = file.isLink();
+		_size = file.getSize();
+		_lastModified = file.getLastModified();
+		_canRead = file.canRead();
+		_canWrite = file.canWrite();
+		_canExecute = file.canExecute();
+	}
+#endif
+}
+
+
+} // namespace Poco
@@ -121,6 +121,12 @@ bool FileStreamBuf::close()
 }
 
 
+int FileStreamBuf::nativeHandle() const
+{
+	return _fd;
+}
+
+
 std::streampos FileStreamBuf::seekoff(std::streamoff off, std::ios::seekdir dir, std::ios::openmode mode)
 {
 	if (_fd == -1 || !(getMode() & mode))
@@ -90,7 +90,7 @@ RefCountDiagnosticContext& RefCountDiagnosticContext::get()
 
 // static Logger members
 Logger::LoggerMapPtr Logger::_pLoggerMap;
-Mutex                Logger::_mapMtx;
+RWLock               Logger::_mapMtx;
 const std::string    Logger::ROOT;
 
 
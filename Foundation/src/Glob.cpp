@@ -27,6 +27,12 @@ namespace Poco {
 Glob::Glob(const std::string& pattern, int options)
 	: _pattern(pattern), _options(options)
 {
+	// the pattern bytes before the first metacharacter must match
+	// the subject literally; remembering them allows rejecting most
+	// non-matching candidates with a plain byte comparison before
+	// the code-point-wise interpretation runs
+	std::string::size_type n = _pattern.find_first_of("*?[\\");
+	_literalPrefix = (n == std::string::npos) ? _pattern : _pattern.substr(0, n);
 }
 
 
@@ -37,6 +43,13 @@ Glob::~Glob()
 
 bool Glob::match(const std::string& subject)
 {
+	if (!(_options & GLOB_CASELESS) && !_literalPrefix.empty())
+	{
+		if (subject.size() < _literalPrefix.size() ||
+			subject.compare(0, _literalPrefix.size(), _literalPrefix) != 0)
+			return false;
+	}
+
 	UTF8Encoding utf8;
 	TextIterator itp(_pattern, utf8);
 	TextIterator endp(_pattern);
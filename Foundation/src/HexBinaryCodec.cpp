@@ -0,0 +1,113 @@
+//
+// HexBinaryCodec.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  HexBinaryCodec
+//
+// Copyright (c) 2009, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/HexBinaryCodec.h"
+#include "Poco/Ascii.h"
+
+
+namespace Poco {
+
+
+namespace
+{
+	struct PairTables
+	{
+		PairTables()
+		{
+			static const char lower[] = "0123456789abcdef";
+			static const char upper[] = "0123456789ABCDEF";
+			for (int i = 0; i < 256; i++)
+			{
+				lowerPairs[2*i]     = lower[i >> 4];
+				lowerPairs[2*i + 1] = lower[i & 0x0F];
+				upperPairs[2*i]     = upper[i >> 4];
+				upperPairs[2*i + 1] = upper[i & 0x0F];
+			}
+		}
+
+		char lowerPairs[512];
+		char upperPairs[512];
+	};
+
+	const PairTables& pairTables()
+	{
+		static PairTables tables;
+		return tables;
+	}
+
+
+	int nibble(char c)
+	{
+		if (c >= '0' && c <= '9') return c - '0';
+		if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+		return -1;
+	}
+}
+
+
+std::size_t HexBinaryCodec::encodedLength(std::size_t dataLength)
+{
+	return 2*dataLength;
+}
+
+
+void HexBinaryCodec::encode(const void* data, std::size_t length, std::string& hex, int options)
+{
+	const char* pairs = (options & OPT_UPPERCASE) ? pairTables().upperPairs : pairTables().lowerPairs;
+	hex.resize(2*length);
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+	char* out = &hex[0];
+	for (std::size_t i = 0; i < length; i++)
+	{
+		const char* pair = pairs + 2*p[i];
+		*out++ = pair[0];
+		*out++ = pair[1];
+	}
+}
+
+
+std::string HexBinaryCodec::encode(const void* data, std::size_t length, int options)
+{
+	std::string hex;
+	encode(data, length, hex, options);
+	return hex;
+}
+
+
+bool HexBinaryCodec::decode(const std::string& hex, std::string& data)
+{
+	data.clear();
+	data.reserve(hex.size()/2);
+	int high = -1;
+	for (std::string::const_iterator it = hex.begin(); it != hex.end(); ++it)
+	{
+		if (Ascii::isSpace(*it)) continue;
+		int n = nibble(*it);
+		if (n < 0) return false;
+		if (high < 0)
+		{
+			high = n;
+		}
+		else
+		{
+			data += static_cast<char>((high << 4) | n);
+			high = -1;
+		}
+	}
+	return high < 0;
+}
+
+
+} // namespace Poco
@@ -13,6 +13,7 @@
 
 
 #include "Poco/HexBinaryEncoder.h"
+#include "Poco/HexBinaryCodec.h"
 
 
 namespace Poco {
@@ -74,6 +75,29 @@ int HexBinaryEncoderBuf::writeToDevice(char c)
 }
 
 
+std::streamsize HexBinaryEncoderBuf::xsputn(const char* s, std::streamsize count)
+{
+	if (_lineLength > 0)
+	{
+		// line breaks interleave with the hex pairs; keep the
+		// per-character path, which tracks the line position
+		std::streamsize written = 0;
+		while (written < count)
+		{
+			if (writeToDevice(s[written]) == std::char_traits<char>::eof()) return written;
+			++written;
+		}
+		return written;
+	}
+
+	std::string hex;
+	HexBinaryCodec::encode(s, static_cast<std::size_t>(count), hex, _uppercase ? HexBinaryCodec::OPT_UPPERCASE : 0);
+	if (_buf.sputn(hex.data(), static_cast<std::streamsize>(hex.size())) != static_cast<std::streamsize>(hex.size()))
+		return 0;
+	return count;
+}
+
+
 int HexBinaryEncoderBuf::close()
 {
 	sync();
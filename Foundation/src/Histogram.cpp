@@ -0,0 +1,115 @@
+//
+// Histogram.cpp
+//
+// Library: Foundation
+// Package: Core
+// Module:  Histogram
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Histogram.h"
+
+
+namespace Poco {
+
+
+Histogram::Histogram():
+	_count(0),
+	_sum(0)
+{
+	for (std::size_t i = 0; i < BUCKETS; i++)
+		_buckets[i].store(0, std::memory_order_relaxed);
+}
+
+
+std::size_t Histogram::bucketFor(Int64 value)
+{
+	if (value < SUB_BUCKETS) return static_cast<std::size_t>(value < 0 ? 0 : value);
+	// highest set bit selects the power-of-two bucket; the next
+	// SUB_BUCKET_BITS bits select the linear sub-bucket
+	int msb = 63;
+	UInt64 uv = static_cast<UInt64>(value);
+	while (!(uv & (UInt64(1) << msb))) --msb;
+	std::size_t base = static_cast<std::size_t>(msb - SUB_BUCKET_BITS + 1)*SUB_BUCKETS;
+	std::size_t sub = static_cast<std::size_t>((uv >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+	std::size_t index = base + sub;
+	return index < BUCKETS ? index : BUCKETS - 1;
+}
+
+
+Int64 Histogram::bucketUpperBound(std::size_t index)
+{
+	if (index < SUB_BUCKETS) return static_cast<Int64>(index);
+	std::size_t base = index/SUB_BUCKETS;
+	std::size_t sub = index % SUB_BUCKETS;
+	int msb = static_cast<int>(base) + SUB_BUCKET_BITS - 1;
+	UInt64 value = (UInt64(1) << msb) | (UInt64(sub) << (msb - SUB_BUCKET_BITS));
+	value |= (UInt64(1) << (msb - SUB_BUCKET_BITS)) - 1; // fill the linear remainder
+	return static_cast<Int64>(value);
+}
+
+
+void Histogram::record(Int64 value)
+{
+	_buckets[bucketFor(value)].fetch_add(1, std::memory_order_relaxed);
+	_count.fetch_add(1, std::memory_order_relaxed);
+	_sum.fetch_add(value > 0 ? value : 0, std::memory_order_relaxed);
+}
+
+
+UInt64 Histogram::count() const
+{
+	return _count.load(std::memory_order_relaxed);
+}
+
+
+Int64 Histogram::sum() const
+{
+	return _sum.load(std::memory_order_relaxed);
+}
+
+
+Int64 Histogram::quantile(double q) const
+{
+	if (q < 0) q = 0;
+	if (q > 1) q = 1;
+	UInt64 total = count();
+	if (total == 0) return 0;
+	UInt64 target = static_cast<UInt64>(q*total);
+	if (target >= total) target = total - 1;
+	UInt64 seen = 0;
+	for (std::size_t i = 0; i < BUCKETS; i++)
+	{
+		seen += _buckets[i].load(std::memory_order_relaxed);
+		if (seen > target) return bucketUpperBound(i);
+	}
+	return bucketUpperBound(BUCKETS - 1);
+}
+
+
+Int64 Histogram::max() const
+{
+	for (std::size_t i = BUCKETS; i > 0; i--)
+	{
+		if (_buckets[i - 1].load(std::memory_order_relaxed) > 0)
+			return bucketUpperBound(i - 1);
+	}
+	return 0;
+}
+
+
+void Histogram::reset()
+{
+	for (std::size_t i = 0; i < BUCKETS; i++)
+		_buckets[i].store(0, std::memory_order_relaxed);
+	_count.store(0, std::memory_order_relaxed);
+	_sum.store(0, std::memory_order_relaxed);
+}
+
+
+} // namespace Poco
@@ -164,6 +164,17 @@ void InflatingStreamBuf::reset()
 }
 
 
+void InflatingStreamBuf::reset(std::istream& istr)
+{
+	poco_assert (_pIstr);
+
+	reset();
+	_zstr.next_in  = 0;
+	_zstr.avail_in = 0;
+	_pIstr = &istr;
+}
+
+
 int InflatingStreamBuf::readFromDevice(char* buffer, std::streamsize length)
 {
 	if (_eof || !_pIstr) return 0;
@@ -357,4 +368,11 @@ void InflatingInputStream::reset()
 }
 
 
+void InflatingInputStream::reset(std::istream& istr)
+{
+	_buf.reset(istr);
+	clear();
+}
+
+
 } // namespace Poco
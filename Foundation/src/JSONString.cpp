@@ -47,15 +47,22 @@ void writeString(const std::string &value, T& obj, typename WriteFunc<T, S>::Typ
 	}
 	else
 	{
-		for(std::string::const_iterator it = value.begin(), end = value.end(); it != end; ++it)
+		// write unescaped runs in bulk; only characters that actually
+		// need escaping go through UTF8::escape()
+		std::string::const_iterator it = value.begin(), end = value.end();
+		std::string::const_iterator runBegin = it;
+		for(; it != end; ++it)
 		{
 			// Forward slash isn't strictly required by JSON spec, but some parsers expect it
 			if((*it >= 0 && *it <= 31) || (*it == '"') || (*it == '\\') || (*it == '/'))
 			{
+				if(it != runBegin) (obj.*write)(&(*runBegin), static_cast<S>(it - runBegin));
 				std::string str = Poco::UTF8::escape(it, it + 1, true);
 				(obj.*write)(str.c_str(), str.size());
-			}else (obj.*write)(&(*it), 1);
+				runBegin = it + 1;
+			}
 		}
+		if(runBegin != end) (obj.*write)(&(*runBegin), static_cast<S>(end - runBegin));
 	}
 	if(wrap) (obj.*write)("\"", 1);
 };
@@ -103,7 +103,7 @@ void Logger::dump(const std::string& msg, const void* buffer, std::size_t length
 
 void Logger::setLevel(const std::string& name, int level)
 {
-	Mutex::ScopedLock lock(_mapMtx);
+	RWLock::ScopedReadLock lock(_mapMtx);
 
 	if (_pLoggerMap)
 	{
@@ -122,7 +122,7 @@ void Logger::setLevel(const std::string& name, int level)
 
 void Logger::setChannel(const std::string& name, Channel::Ptr pChannel)
 {
-	Mutex::ScopedLock lock(_mapMtx);
+	RWLock::ScopedReadLock lock(_mapMtx);
 
 	if (_pLoggerMap)
 	{
@@ -141,7 +141,7 @@ void Logger::setChannel(const std::string& name, Channel::Ptr pChannel)
 
 void Logger::setProperty(const std::string& loggerName, const std::string& propertyName, const std::string& value)
 {
-	Mutex::ScopedLock lock(_mapMtx);
+	RWLock::ScopedReadLock lock(_mapMtx);
 
 	if (_pLoggerMap)
 	{
@@ -273,7 +273,15 @@ void Logger::formatDump(std::string& message, const void* buffer, std::size_t le
 
 Logger& Logger::get(const std::string& name)
 {
-	Mutex::ScopedLock lock(_mapMtx);
+	{
+		// fast path: concurrent lookups of existing loggers only
+		// share the read lock
+		RWLock::ScopedReadLock lock(_mapMtx);
+
+		Ptr pLogger = find(name);
+		if (pLogger) return *pLogger;
+	}
+	RWLock::ScopedWriteLock lock(_mapMtx);
 
 	return unsafeGet(name);
 }
@@ -301,7 +309,7 @@ Logger& Logger::unsafeGet(const std::string& name)
 
 Logger& Logger::create(const std::string& name, Channel::Ptr pChannel, int level)
 {
-	Mutex::ScopedLock lock(_mapMtx);
+	RWLock::ScopedWriteLock lock(_mapMtx);
 
 	if (find(name)) throw ExistsException();
 	Ptr pLogger = new Logger(name, pChannel, level);
@@ -312,7 +320,7 @@ Logger& Logger::create(const std::string& name, Channel::Ptr pChannel, int level
 
 Logger& Logger::root()
 {
-	Mutex::ScopedLock lock(_mapMtx);
+	RWLock::ScopedWriteLock lock(_mapMtx);
 
 	return unsafeGet(ROOT);
 }
@@ -320,7 +328,7 @@ Logger& Logger::root()
 
 Logger::Ptr Logger::has(const std::string& name)
 {
-	Mutex::ScopedLock lock(_mapMtx);
+	RWLock::ScopedReadLock lock(_mapMtx);
 
 	return find(name);
 }
@@ -328,7 +336,7 @@ Logger::Ptr Logger::has(const std::string& name)
 
 void Logger::shutdown()
 {
-	Mutex::ScopedLock lock(_mapMtx);
+	RWLock::ScopedWriteLock lock(_mapMtx);
 
 	_pLoggerMap.reset();
 }
@@ -347,7 +355,7 @@ Logger::Ptr Logger::find(const std::string& name)
 
 void Logger::destroy(const std::string& name)
 {
-	Mutex::ScopedLock lock(_mapMtx);
+	RWLock::ScopedWriteLock lock(_mapMtx);
 
 	if (_pLoggerMap)
 	{
@@ -359,7 +367,7 @@ void Logger::destroy(const std::string& name)
 
 void Logger::names(std::vector<std::string>& names)
 {
-	Mutex::ScopedLock lock(_mapMtx);
+	RWLock::ScopedReadLock lock(_mapMtx);
 
 	names.clear();
 	if (_pLoggerMap)
@@ -0,0 +1,97 @@
+//
+// MappedFileInputStream.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  MappedFileInputStream
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/MappedFileInputStream.h"
+#include "Poco/File.h"
+#include "Poco/StreamUtil.h"
+#include "Poco/Exception.h"
+#if defined(POCO_OS_FAMILY_UNIX)
+#include <sys/mman.h>
+#endif
+
+
+namespace Poco {
+
+
+MappedFileStreamBuf::MappedFileStreamBuf(const std::string& path):
+	_size(0)
+{
+	File f(path);
+	File::FileSize fileSize = f.getSize();
+	_size = static_cast<std::size_t>(fileSize);
+	if (_size > 0)
+	{
+		_memory = SharedMemory(f, SharedMemory::AM_READ);
+		char* begin = _memory.begin();
+		setg(begin, begin, begin + _size);
+#if defined(POCO_OS_FAMILY_UNIX)
+		// large scans benefit from aggressive kernel read-ahead
+		madvise(begin, _size, MADV_SEQUENTIAL);
+#endif
+	}
+}
+
+
+MappedFileStreamBuf::~MappedFileStreamBuf()
+{
+}
+
+
+std::streambuf::pos_type MappedFileStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+	if (!(which & std::ios_base::in) || !eback()) return pos_type(off_type(-1));
+
+	off_type base = 0;
+	if (dir == std::ios_base::cur) base = gptr() - eback();
+	else if (dir == std::ios_base::end) base = egptr() - eback();
+
+	off_type target = base + off;
+	if (target < 0 || target > egptr() - eback()) return pos_type(off_type(-1));
+
+	setg(eback(), eback() + target, egptr());
+	return pos_type(target);
+}
+
+
+std::streambuf::pos_type MappedFileStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+	return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+
+MappedFileIOS::MappedFileIOS(const std::string& path):
+	_buf(path)
+{
+	poco_ios_init(&_buf);
+}
+
+
+MappedFileIOS::~MappedFileIOS()
+{
+}
+
+
+MappedFileInputStream::MappedFileInputStream(const std::string& path):
+	MappedFileIOS(path),
+	std::istream(&_buf)
+{
+}
+
+
+MappedFileInputStream::~MappedFileInputStream()
+{
+}
+
+
+} // namespace Poco
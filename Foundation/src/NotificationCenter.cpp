@@ -35,6 +35,7 @@ NotificationCenter::~NotificationCenter()
 void NotificationCenter::addObserver(const AbstractObserver& observer)
 {
 	Mutex::ScopedLock lock(_mutex);
+	_pSnapshot = 0;
 	_observers.push_back(observer.clone());
 }
 
@@ -42,6 +43,7 @@ void NotificationCenter::addObserver(const AbstractObserver& observer)
 void NotificationCenter::removeObserver(const AbstractObserver& observer)
 {
 	Mutex::ScopedLock lock(_mutex);
+	_pSnapshot = 0;
 	for (ObserverList::iterator it = _observers.begin(); it != _observers.end(); ++it)
 	{
 		if (observer.equals(**it))
@@ -68,10 +70,16 @@ void NotificationCenter::postNotification(Notification::Ptr pNotification)
 {
 	poco_check_ptr (pNotification);
 
-	ScopedLockWithUnlock<Mutex> lock(_mutex);
-	ObserverList observersToNotify(_observers);
-	lock.unlock();
-	for (ObserverList::iterator it = observersToNotify.begin(); it != observersToNotify.end(); ++it)
+	// invoke an immutable snapshot of the observer list; the
+	// snapshot is only rebuilt after the list has changed, so
+	// steady-state posting does not copy the observers
+	SharedPtr<ObserverList> pObservers;
+	{
+		Mutex::ScopedLock lock(_mutex);
+		if (!_pSnapshot) _pSnapshot = new ObserverList(_observers);
+		pObservers = _pSnapshot;
+	}
+	for (ObserverList::iterator it = pObservers->begin(); it != pObservers->end(); ++it)
 	{
 		(*it)->notify(pNotification);
 	}
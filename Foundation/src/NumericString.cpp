@@ -392,6 +392,16 @@ bool strToFloat(const std::string& str, float& result, char decSep, char thSep,
 
 	using namespace double_conversion;
 
+	// common case: plain decimal-point number without separators;
+	// parse in place instead of copying and rewriting the string
+	// (leading/trailing spaces are handled by the converter)
+	if (decSep == '.' && str.find(thSep) == std::string::npos && str.find('f') == std::string::npos)
+	{
+		result = strToFloat(str.c_str(), inf, nan);
+		return !FPEnvironment::isInfinite(result) &&
+			!FPEnvironment::isNaN(result);
+	}
+
 	std::string tmp(str);
 	trimInPlace(tmp);
 	removeInPlace(tmp, thSep);
@@ -409,6 +419,16 @@ bool strToDouble(const std::string& str, double& result, char decSep, char thSep
 
 	using namespace double_conversion;
 
+	// common case: plain decimal-point number without separators;
+	// parse in place instead of copying and rewriting the string
+	// (leading/trailing spaces are handled by the converter)
+	if (decSep == '.' && str.find(thSep) == std::string::npos && str.find('f') == std::string::npos)
+	{
+		result = strToDouble(str.c_str(), inf, nan);
+		return !FPEnvironment::isInfinite(result) &&
+			!FPEnvironment::isNaN(result);
+	}
+
 	std::string tmp(str);
 	trimInPlace(tmp);
 	removeInPlace(tmp, thSep);
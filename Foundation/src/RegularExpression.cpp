@@ -186,6 +186,24 @@ int RegularExpression::extract(const std::string& subject, std::string::size_typ
 }
 
 
+std::size_t RegularExpression::matchAll(const std::string& subject, MatchVec& matches, int options) const
+{
+	std::size_t found = 0;
+	std::string::size_type offset = 0;
+	Match mtch;
+	while (offset <= subject.length())
+	{
+		if (match(subject, offset, mtch, options) == 0) break;
+		matches.push_back(mtch);
+		++found;
+		// advance past the match; empty matches advance by one
+		// character to guarantee progress
+		offset = mtch.offset + (mtch.length > 0 ? mtch.length : 1);
+	}
+	return found;
+}
+
+
 int RegularExpression::split(const std::string& subject, std::string::size_type offset, std::vector<std::string>& strings, int options) const
 {
 	MatchVec matches;
@@ -0,0 +1,156 @@
+//
+// SerializationStream.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  SerializationStream
+//
+// Copyright (c) 2009, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/SerializationStream.h"
+#include "Poco/StreamUtil.h"
+#include "Poco/Bugcheck.h"
+
+
+namespace Poco {
+
+
+SerializationStreamBuf::SerializationStreamBuf(std::size_t initialCapacity):
+	_buffer(initialCapacity ? initialCapacity : 1)
+{
+	setp(_buffer.begin(), _buffer.begin() + _buffer.size());
+}
+
+
+SerializationStreamBuf::~SerializationStreamBuf()
+{
+}
+
+
+std::size_t SerializationStreamBuf::written() const
+{
+	return static_cast<std::size_t>(pptr() - pbase());
+}
+
+
+SerializationStreamBuf::Checkpoint SerializationStreamBuf::checkpoint() const
+{
+	return written();
+}
+
+
+void SerializationStreamBuf::rollback(Checkpoint checkpoint)
+{
+	poco_assert (checkpoint <= written());
+
+	setp(_buffer.begin(), _buffer.begin() + _buffer.size());
+	pbump(static_cast<int>(checkpoint));
+}
+
+
+std::size_t SerializationStreamBuf::reservePatch(std::size_t length)
+{
+	std::size_t offset = written();
+	for (std::size_t i = 0; i < length; i++)
+		sputc(0);
+	return offset;
+}
+
+
+void SerializationStreamBuf::patch(std::size_t offset, const void* data, std::size_t length)
+{
+	poco_assert (offset + length <= written());
+
+	std::memcpy(_buffer.begin() + offset, data, length);
+}
+
+
+const char* SerializationStreamBuf::data() const
+{
+	return _buffer.begin();
+}
+
+
+std::size_t SerializationStreamBuf::size() const
+{
+	return written();
+}
+
+
+void SerializationStreamBuf::clear()
+{
+	setp(_buffer.begin(), _buffer.begin() + _buffer.size());
+}
+
+
+void SerializationStreamBuf::grow(std::size_t minCapacity)
+{
+	std::size_t used = written();
+	std::size_t newCapacity = 2*_buffer.size();
+	if (newCapacity < minCapacity) newCapacity = minCapacity;
+	_buffer.resize(newCapacity, true);
+	setp(_buffer.begin(), _buffer.begin() + _buffer.size());
+	pbump(static_cast<int>(used));
+}
+
+
+SerializationStreamBuf::int_type SerializationStreamBuf::overflow(int_type c)
+{
+	if (c != traits_type::eof())
+	{
+		grow(written() + 1);
+		*pptr() = traits_type::to_char_type(c);
+		pbump(1);
+	}
+	return c;
+}
+
+
+std::streamsize SerializationStreamBuf::xsputn(const char* s, std::streamsize count)
+{
+	std::size_t n = static_cast<std::size_t>(count);
+	if (written() + n > _buffer.size())
+		grow(written() + n);
+	std::memcpy(pptr(), s, n);
+	pbump(static_cast<int>(n));
+	return count;
+}
+
+
+SerializationIOS::SerializationIOS(std::size_t initialCapacity):
+	_buf(initialCapacity)
+{
+	poco_ios_init(&_buf);
+}
+
+
+SerializationIOS::~SerializationIOS()
+{
+}
+
+
+SerializationOutputStream::SerializationOutputStream(std::size_t initialCapacity):
+	SerializationIOS(initialCapacity),
+	std::ostream(&_buf)
+{
+}
+
+
+SerializationOutputStream::~SerializationOutputStream()
+{
+}
+
+
+void SerializationOutputStream::reset()
+{
+	_buf.clear();
+	clear();
+}
+
+
+} // namespace Poco
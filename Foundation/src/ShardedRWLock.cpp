@@ -0,0 +1,104 @@
+//
+// ShardedRWLock.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  ShardedRWLock
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/ShardedRWLock.h"
+#include "Poco/Thread.h"
+
+
+namespace Poco {
+
+
+namespace
+{
+	std::atomic<unsigned> nextShard(0);
+}
+
+
+ShardedRWLock::ShardedRWLock():
+	_writerPending(false)
+{
+	for (int i = 0; i < SHARDS; i++)
+		_shards[i].readers.store(0, std::memory_order_relaxed);
+}
+
+
+ShardedRWLock::~ShardedRWLock()
+{
+}
+
+
+ShardedRWLock::Shard& ShardedRWLock::shardForThread()
+{
+	// each thread sticks to one shard, so its read counter stays
+	// in that core's cache
+	static thread_local unsigned shardIndex = nextShard++ % SHARDS;
+	return _shards[shardIndex];
+}
+
+
+void ShardedRWLock::readLock()
+{
+	Shard& shard = shardForThread();
+	for (;;)
+	{
+		while (_writerPending.load(std::memory_order_acquire))
+			Thread::yield();
+		shard.readers.fetch_add(1, std::memory_order_acquire);
+		if (!_writerPending.load(std::memory_order_acquire))
+			return;
+		// a writer raced in; back off and wait for it
+		shard.readers.fetch_sub(1, std::memory_order_release);
+	}
+}
+
+
+bool ShardedRWLock::tryReadLock()
+{
+	if (_writerPending.load(std::memory_order_acquire)) return false;
+	Shard& shard = shardForThread();
+	shard.readers.fetch_add(1, std::memory_order_acquire);
+	if (!_writerPending.load(std::memory_order_acquire))
+		return true;
+	shard.readers.fetch_sub(1, std::memory_order_release);
+	return false;
+}
+
+
+void ShardedRWLock::readUnlock()
+{
+	shardForThread().readers.fetch_sub(1, std::memory_order_release);
+}
+
+
+void ShardedRWLock::writeLock()
+{
+	_writerMutex.lock();
+	_writerPending.store(true, std::memory_order_release);
+	// wait for all shards to drain
+	for (int i = 0; i < SHARDS; i++)
+	{
+		while (_shards[i].readers.load(std::memory_order_acquire) > 0)
+			Thread::yield();
+	}
+}
+
+
+void ShardedRWLock::writeUnlock()
+{
+	_writerPending.store(false, std::memory_order_release);
+	_writerMutex.unlock();
+}
+
+
+} // namespace Poco
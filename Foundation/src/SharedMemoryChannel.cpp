@@ -0,0 +1,244 @@
+//
+// SharedMemoryChannel.cpp
+//
+// Library: Foundation
+// Package: Logging
+// Module:  SharedMemoryChannel
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/SharedMemoryChannel.h"
+#include "Poco/BinaryMessageCodec.h"
+#include "Poco/Message.h"
+#include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+namespace
+{
+	//
+	// Ring layout: a RingHeader followed by the data area. Producers
+	// reserve space with a compare-and-exchange on head, copy their
+	// record, and finally publish the record's size field with release
+	// semantics; the consumer only reads records whose size has been
+	// published and zeroes the size field behind itself, so stale
+	// sizes from a previous lap are never misread. Records never wrap:
+	// a WRAP_MARKER size tells the consumer to skip to the start of
+	// the data area.
+	//
+	struct RingHeader
+	{
+		std::atomic<UInt64> head;
+		std::atomic<UInt64> tail;
+		std::atomic<UInt64> dropped;
+		UInt64 capacity;
+	};
+
+	const UInt32 WRAP_MARKER = 0xFFFFFFFF;
+
+	RingHeader* ringHeader(SharedMemory& memory)
+	{
+		return reinterpret_cast<RingHeader*>(memory.begin());
+	}
+
+	char* ringData(SharedMemory& memory)
+	{
+		return memory.begin() + sizeof(RingHeader);
+	}
+
+}
+
+
+const std::string SharedMemoryChannel::PROP_NAME = "name";
+const std::string SharedMemoryChannel::PROP_SIZE = "size";
+
+
+SharedMemoryChannel::SharedMemoryChannel():
+	_name("poco.log"),
+	_size(DEFAULT_SIZE)
+{
+}
+
+
+SharedMemoryChannel::SharedMemoryChannel(const std::string& name, std::size_t size):
+	_name(name),
+	_size(size)
+{
+}
+
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+}
+
+
+void SharedMemoryChannel::open()
+{
+	if (!_pMemory)
+	{
+		_pMemory = new SharedMemory(_name, _size, SharedMemory::AM_WRITE, 0, false);
+	}
+}
+
+
+void SharedMemoryChannel::close()
+{
+	_pMemory = 0;
+}
+
+
+void SharedMemoryChannel::log(const Message& msg)
+{
+	open();
+
+	std::string record;
+	BinaryMessageCodec::write(msg, record);
+
+	RingHeader* pHeader = ringHeader(*_pMemory);
+	char* pData = ringData(*_pMemory);
+	const UInt64 capacity = pHeader->capacity;
+	const UInt64 total = sizeof(UInt32) + record.size();
+	if (total + sizeof(UInt32) > capacity)
+	{
+		++pHeader->dropped;
+		return;
+	}
+
+	UInt64 offset;
+	UInt64 padding;
+	for (;;)
+	{
+		UInt64 head = pHeader->head.load(std::memory_order_relaxed);
+		UInt64 tail = pHeader->tail.load(std::memory_order_acquire);
+		offset  = head % capacity;
+		padding = 0;
+		UInt64 need = total;
+		if (offset + total > capacity)
+		{
+			// the record does not fit before the end of the data
+			// area; skip to the start with a wrap marker
+			padding = capacity - offset;
+			need = total + padding;
+		}
+		if (head - tail + need > capacity)
+		{
+			++pHeader->dropped;
+			return;
+		}
+		if (pHeader->head.compare_exchange_weak(head, head + need, std::memory_order_relaxed))
+			break;
+	}
+
+	if (padding > 0)
+	{
+		if (padding >= sizeof(UInt32))
+		{
+			UInt32 marker = WRAP_MARKER;
+			std::memcpy(pData + offset, &marker, sizeof(marker));
+			std::atomic_thread_fence(std::memory_order_release);
+		}
+		offset = 0;
+	}
+	std::memcpy(pData + offset + sizeof(UInt32), record.data(), record.size());
+	UInt32 size = static_cast<UInt32>(record.size());
+	std::atomic_thread_fence(std::memory_order_release);
+	std::memcpy(pData + offset, &size, sizeof(size));
+}
+
+
+void SharedMemoryChannel::setProperty(const std::string& name, const std::string& value)
+{
+	if (name == PROP_NAME)
+		_name = value;
+	else if (name == PROP_SIZE)
+		_size = static_cast<std::size_t>(NumberParser::parseUnsigned(value));
+	else
+		Channel::setProperty(name, value);
+}
+
+
+std::string SharedMemoryChannel::getProperty(const std::string& name) const
+{
+	if (name == PROP_NAME)
+		return _name;
+	else if (name == PROP_SIZE)
+		return NumberFormatter::format(static_cast<UInt64>(_size));
+	else
+		return Channel::getProperty(name);
+}
+
+
+SharedMemoryLogReader::SharedMemoryLogReader(Channel::Ptr pChannel, const std::string& name, std::size_t size):
+	_pChannel(pChannel),
+	_memory(name, size, SharedMemory::AM_WRITE, 0, true)
+{
+	poco_assert (size > 2*sizeof(RingHeader));
+
+	RingHeader* pHeader = ringHeader(_memory);
+	std::memset(_memory.begin(), 0, size);
+	pHeader->capacity = size - sizeof(RingHeader);
+}
+
+
+SharedMemoryLogReader::~SharedMemoryLogReader()
+{
+}
+
+
+int SharedMemoryLogReader::drain()
+{
+	RingHeader* pHeader = ringHeader(_memory);
+	char* pData = ringData(_memory);
+	const UInt64 capacity = pHeader->capacity;
+
+	int count = 0;
+	for (;;)
+	{
+		UInt64 tail = pHeader->tail.load(std::memory_order_relaxed);
+		UInt64 head = pHeader->head.load(std::memory_order_acquire);
+		if (tail >= head) break;
+		UInt64 offset = tail % capacity;
+		UInt32 size;
+		std::memcpy(&size, pData + offset, sizeof(size));
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (size == 0) break; // reserved but not yet published
+		if (size == WRAP_MARKER || offset + sizeof(UInt32) > capacity)
+		{
+			// skip the unused area at the end of the ring
+			if (offset + sizeof(UInt32) <= capacity)
+				std::memset(pData + offset, 0, sizeof(UInt32));
+			pHeader->tail.store(tail + (capacity - offset), std::memory_order_release);
+			continue;
+		}
+
+		Message msg;
+		BinaryMessageCodec::read(msg, pData + offset + sizeof(UInt32), size);
+
+		std::memset(pData + offset, 0, sizeof(UInt32));
+		pHeader->tail.store(tail + sizeof(UInt32) + size, std::memory_order_release);
+
+		if (_pChannel) _pChannel->log(msg);
+		++count;
+	}
+	return count;
+}
+
+
+UInt64 SharedMemoryLogReader::dropped() const
+{
+	RingHeader* pHeader = ringHeader(const_cast<SharedMemory&>(_memory));
+	return pHeader->dropped.load(std::memory_order_relaxed);
+}
+
+
+} // namespace Poco
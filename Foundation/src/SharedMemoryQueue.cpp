@@ -0,0 +1,157 @@
+//
+// SharedMemoryQueue.cpp
+//
+// Library: Foundation
+// Package: Processes
+// Module:  SharedMemoryQueue
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/SharedMemoryQueue.h"
+#include "Poco/Exception.h"
+#include <atomic>
+#include <cstring>
+
+
+namespace Poco {
+
+
+namespace
+{
+	//
+	// Same ring discipline as the shared-memory log channel:
+	// producers reserve with a CAS on head and publish the record's
+	// size field last; the consumer zeroes consumed size fields so
+	// stale values are never misread, and a WRAP_MARKER size skips
+	// the unusable tail of the data area.
+	//
+	struct QueueHeader
+	{
+		std::atomic<UInt64> head;
+		std::atomic<UInt64> tail;
+		UInt64 capacity;
+	};
+
+	const UInt32 WRAP_MARKER = 0xFFFFFFFF;
+
+	QueueHeader* queueHeader(SharedMemory& memory)
+	{
+		return reinterpret_cast<QueueHeader*>(memory.begin());
+	}
+
+	char* queueData(SharedMemory& memory)
+	{
+		return memory.begin() + sizeof(QueueHeader);
+	}
+}
+
+
+SharedMemoryQueue::SharedMemoryQueue(const std::string& name, std::size_t size, Role role):
+	_memory(name, size, SharedMemory::AM_WRITE, 0, role == QUEUE_OWNER)
+{
+	poco_assert (size > 2*sizeof(QueueHeader));
+
+	if (role == QUEUE_OWNER)
+	{
+		std::memset(_memory.begin(), 0, size);
+		queueHeader(_memory)->capacity = size - sizeof(QueueHeader);
+	}
+}
+
+
+SharedMemoryQueue::~SharedMemoryQueue()
+{
+}
+
+
+std::size_t SharedMemoryQueue::capacity() const
+{
+	return static_cast<std::size_t>(queueHeader(const_cast<SharedMemory&>(_memory))->capacity);
+}
+
+
+bool SharedMemoryQueue::send(const void* message, std::size_t size)
+{
+	poco_check_ptr (message);
+
+	QueueHeader* pHeader = queueHeader(_memory);
+	char* pData = queueData(_memory);
+	const UInt64 capacity = pHeader->capacity;
+	const UInt64 total = sizeof(UInt32) + size;
+	if (total + sizeof(UInt32) > capacity) return false;
+
+	UInt64 offset;
+	UInt64 padding;
+	for (;;)
+	{
+		UInt64 head = pHeader->head.load(std::memory_order_relaxed);
+		UInt64 tail = pHeader->tail.load(std::memory_order_acquire);
+		offset  = head % capacity;
+		padding = 0;
+		UInt64 need = total;
+		if (offset + total > capacity)
+		{
+			padding = capacity - offset;
+			need = total + padding;
+		}
+		if (head - tail + need > capacity) return false; // full
+		if (pHeader->head.compare_exchange_weak(head, head + need, std::memory_order_relaxed))
+			break;
+	}
+
+	if (padding > 0)
+	{
+		if (padding >= sizeof(UInt32))
+		{
+			UInt32 marker = WRAP_MARKER;
+			std::memcpy(pData + offset, &marker, sizeof(marker));
+			std::atomic_thread_fence(std::memory_order_release);
+		}
+		offset = 0;
+	}
+	std::memcpy(pData + offset + sizeof(UInt32), message, size);
+	UInt32 recordSize = static_cast<UInt32>(size);
+	std::atomic_thread_fence(std::memory_order_release);
+	std::memcpy(pData + offset, &recordSize, sizeof(recordSize));
+	return true;
+}
+
+
+bool SharedMemoryQueue::receive(Poco::Buffer<char>& message)
+{
+	QueueHeader* pHeader = queueHeader(_memory);
+	char* pData = queueData(_memory);
+	const UInt64 capacity = pHeader->capacity;
+
+	for (;;)
+	{
+		UInt64 tail = pHeader->tail.load(std::memory_order_relaxed);
+		UInt64 head = pHeader->head.load(std::memory_order_acquire);
+		if (tail >= head) return false;
+		UInt64 offset = tail % capacity;
+		UInt32 size;
+		std::memcpy(&size, pData + offset, sizeof(size));
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (size == 0) return false; // reserved but not yet published
+		if (size == WRAP_MARKER || offset + sizeof(UInt32) > capacity)
+		{
+			if (offset + sizeof(UInt32) <= capacity)
+				std::memset(pData + offset, 0, sizeof(UInt32));
+			pHeader->tail.store(tail + (capacity - offset), std::memory_order_release);
+			continue;
+		}
+		message.resize(size, false);
+		if (size > 0) std::memcpy(message.begin(), pData + offset + sizeof(UInt32), size);
+		std::memset(pData + offset, 0, sizeof(UInt32));
+		pHeader->tail.store(tail + sizeof(UInt32) + size, std::memory_order_release);
+		return true;
+	}
+}
+
+
+} // namespace Poco
@@ -14,17 +14,96 @@
 
 #include "Poco/StreamCopier.h"
 #include "Poco/Buffer.h"
+#include "Poco/FileStream.h"
+#if POCO_OS == POCO_OS_LINUX
+#include <unistd.h>
+#if defined(__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2, 27)
+#define POCO_HAVE_COPY_FILE_RANGE 1
+#endif
+#endif
+#endif
 
 
 namespace Poco {
 
 
+namespace
+{
+	enum
+	{
+		MAX_BUFFER_SIZE = 262144
+	};
+
+
+	bool copyFileInKernel(std::istream& istr, std::ostream& ostr, Poco::UInt64& copied)
+		/// When both streams are FileStream-backed, moves the
+		/// remaining data with copy_file_range(), never lifting it
+		/// into user space. Stream positions are synchronized before
+		/// and after, so callers observe the same state as after a
+		/// buffered copy (minus the EOF read, which the caller's
+		/// generic loop performs). Returns false when the fast path
+		/// does not apply or the kernel declines (e.g. special
+		/// files), in which case nothing has been copied.
+	{
+		copied = 0;
+#if defined(POCO_HAVE_COPY_FILE_RANGE)
+		FileStreamBuf* pInBuf  = dynamic_cast<FileStreamBuf*>(istr.rdbuf());
+		FileStreamBuf* pOutBuf = dynamic_cast<FileStreamBuf*>(ostr.rdbuf());
+		if (!pInBuf || !pOutBuf) return false;
+		if (!istr.good() || !ostr.good()) return false;
+		if (pInBuf->nativeHandle() == -1 || pOutBuf->nativeHandle() == -1) return false;
+
+		// route buffered state through the stream: flush pending
+		// output and let seekoff() account for read-ahead
+		ostr.flush();
+		if (!ostr.good()) return false;
+		std::streampos inPos  = istr.rdbuf()->pubseekoff(0, std::ios::cur, std::ios::in);
+		std::streampos outPos = ostr.rdbuf()->pubseekoff(0, std::ios::cur, std::ios::out);
+		if (inPos == std::streampos(-1) || outPos == std::streampos(-1)) return false;
+
+		off_t offIn  = static_cast<off_t>(static_cast<std::streamoff>(inPos));
+		off_t offOut = static_cast<off_t>(static_cast<std::streamoff>(outPos));
+		for (;;)
+		{
+			ssize_t n = ::copy_file_range(pInBuf->nativeHandle(), &offIn, pOutBuf->nativeHandle(), &offOut, MAX_BUFFER_SIZE, 0);
+			if (n > 0)
+			{
+				copied += static_cast<Poco::UInt64>(n);
+			}
+			else if (n == 0)
+			{
+				break;
+			}
+			else
+			{
+				if (copied == 0) return false; // not supported here; buffered copy takes over
+				break; // partial kernel copy; buffered copy finishes the rest
+			}
+		}
+		// re-synchronize the stream views with what the kernel moved
+		istr.rdbuf()->pubseekoff(static_cast<std::streamoff>(offIn), std::ios::beg, std::ios::in);
+		ostr.rdbuf()->pubseekoff(static_cast<std::streamoff>(offOut), std::ios::beg, std::ios::out);
+		return true;
+#else
+		(void) istr;
+		(void) ostr;
+		return false;
+#endif
+	}
+}
+
+
 std::streamsize StreamCopier::copyStream(std::istream& istr, std::ostream& ostr, std::size_t bufferSize)
 {
 	poco_assert (bufferSize > 0);
 
-	Buffer<char> buffer(bufferSize);
+	Poco::UInt64 kernelCopied = 0;
 	std::streamsize len = 0;
+	if (copyFileInKernel(istr, ostr, kernelCopied))
+		len = static_cast<std::streamsize>(kernelCopied);
+
+	Buffer<char> buffer(bufferSize);
 	istr.read(buffer.begin(), bufferSize);
 	std::streamsize n = istr.gcount();
 	while (n > 0)
@@ -33,6 +112,13 @@ std::streamsize StreamCopier::copyStream(std::istream& istr, std::ostream& ostr,
 		ostr.write(buffer.begin(), n);
 		if (istr && ostr)
 		{
+			// long copy through a small buffer: grow it so syscall
+			// count drops with copy length
+			if (static_cast<std::size_t>(n) == bufferSize && bufferSize < MAX_BUFFER_SIZE && len >= static_cast<std::streamsize>(8*bufferSize))
+			{
+				bufferSize *= 2;
+				buffer.resize(bufferSize, false);
+			}
 			istr.read(buffer.begin(), bufferSize);
 			n = istr.gcount();
 		}
@@ -47,8 +133,10 @@ Poco::UInt64 StreamCopier::copyStream64(std::istream& istr, std::ostream& ostr,
 {
 	poco_assert (bufferSize > 0);
 
-	Buffer<char> buffer(bufferSize);
 	Poco::UInt64 len = 0;
+	copyFileInKernel(istr, ostr, len);
+
+	Buffer<char> buffer(bufferSize);
 	istr.read(buffer.begin(), bufferSize);
 	std::streamsize n = istr.gcount();
 	while (n > 0)
@@ -57,6 +145,13 @@ Poco::UInt64 StreamCopier::copyStream64(std::istream& istr, std::ostream& ostr,
 		ostr.write(buffer.begin(), n);
 		if (istr && ostr)
 		{
+			// long copy through a small buffer: grow it so syscall
+			// count drops with copy length
+			if (static_cast<std::size_t>(n) == bufferSize && bufferSize < MAX_BUFFER_SIZE && len >= 8*bufferSize)
+			{
+				bufferSize *= 2;
+				buffer.resize(bufferSize, false);
+			}
 			istr.read(buffer.begin(), bufferSize);
 			n = istr.gcount();
 		}
@@ -39,16 +39,24 @@ void Task::cancel()
 {
 	_state = TASK_CANCELLING;
 	_cancelEvent.set();
+	_cancelSource.cancel();
 	if (_pOwner)
 		_pOwner->taskCancelled(this);
 }
 
 
+CancellationToken Task::cancellationToken() const
+{
+	return _cancelSource.token();
+}
+
+
 void Task::reset()
 {
 	_progress = 0.0;
 	_state    = TASK_IDLE;
 	_cancelEvent.reset();
+	_cancelSource.reset();
 }
 
 
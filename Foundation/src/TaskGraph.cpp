@@ -0,0 +1,193 @@
+//
+// TaskGraph.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  TaskGraph
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/TaskGraph.h"
+
+
+namespace Poco {
+
+
+class TaskGraph::NodeRunner: public Runnable
+{
+public:
+	NodeRunner(TaskGraph& graph, TaskId id):
+		_graph(graph),
+		_id(id)
+	{
+	}
+
+	void run()
+	{
+		_graph.execute(_id);
+		delete this;
+	}
+
+private:
+	TaskGraph& _graph;
+	TaskId _id;
+};
+
+
+TaskGraph::TaskGraph(ThreadPool& pool):
+	_pool(pool),
+	_remaining(0),
+	_started(false),
+	_done(Event::EVENT_MANUALRESET)
+{
+}
+
+
+TaskGraph::~TaskGraph()
+{
+	try
+	{
+		if (_started && _remaining > 0)
+			_done.wait();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+	for (std::vector<Node*>::iterator it = _nodes.begin(); it != _nodes.end(); ++it)
+		delete *it;
+}
+
+
+TaskGraph::TaskId TaskGraph::add(const Callable& task)
+{
+	return add(task, std::vector<TaskId>());
+}
+
+
+TaskGraph::TaskId TaskGraph::add(const Callable& task, TaskId dependency)
+{
+	return add(task, std::vector<TaskId>(1, dependency));
+}
+
+
+TaskGraph::TaskId TaskGraph::add(const Callable& task, const std::vector<TaskId>& dependencies)
+{
+	poco_assert (!_started);
+
+	TaskId id = _nodes.size();
+	Node* pNode = new Node;
+	pNode->work = task;
+	pNode->pendingDeps = static_cast<int>(dependencies.size());
+	_nodes.push_back(pNode);
+	for (std::vector<TaskId>::const_iterator it = dependencies.begin(); it != dependencies.end(); ++it)
+	{
+		poco_assert (*it < id); // dependencies must already exist; also rules out cycles
+		_nodes[*it]->dependents.push_back(id);
+	}
+	++_remaining;
+	return id;
+}
+
+
+void TaskGraph::run()
+{
+	poco_assert (!_started.exchange(true));
+
+	if (_nodes.empty())
+	{
+		_done.set();
+		return;
+	}
+	// collect the roots first: starting while iterating would race
+	// with pool threads completing and reading _nodes
+	std::vector<TaskId> roots;
+	for (TaskId id = 0; id < _nodes.size(); ++id)
+	{
+		if (_nodes[id]->pendingDeps == 0)
+			roots.push_back(id);
+	}
+	poco_assert (!roots.empty()); // an all-dependent graph cannot make progress
+	for (std::vector<TaskId>::const_iterator it = roots.begin(); it != roots.end(); ++it)
+		start(*it);
+}
+
+
+void TaskGraph::wait()
+{
+	_done.wait();
+	if (_firstError) std::rethrow_exception(_firstError);
+}
+
+
+bool TaskGraph::tryWait(long milliseconds)
+{
+	if (!_done.tryWait(milliseconds)) return false;
+	if (_firstError) std::rethrow_exception(_firstError);
+	return true;
+}
+
+
+void TaskGraph::start(TaskId id)
+{
+	NodeRunner* pRunner = new NodeRunner(*this, id);
+	try
+	{
+		_pool.start(*pRunner);
+	}
+	catch (NoThreadAvailableException&)
+	{
+		// pool saturated: run on the calling thread; the graph
+		// still makes progress and continuations still apply
+		pRunner->run();
+	}
+}
+
+
+void TaskGraph::execute(TaskId id)
+{
+	// continuation loop: after finishing a node, keep running one
+	// newly ready dependent on this thread instead of re-queueing it
+	bool haveNext = true;
+	while (haveNext)
+	{
+		Node* pNode = _nodes[id];
+		try
+		{
+			pNode->work();
+		}
+		catch (...)
+		{
+			FastMutex::ScopedLock lock(_errMutex);
+			if (!_firstError) _firstError = std::current_exception();
+		}
+
+		haveNext = false;
+		for (std::vector<TaskId>::const_iterator it = pNode->dependents.begin(); it != pNode->dependents.end(); ++it)
+		{
+			if (--_nodes[*it]->pendingDeps == 0)
+			{
+				if (!haveNext)
+				{
+					id = *it; // first ready dependent continues in-thread
+					haveNext = true;
+				}
+				else
+				{
+					start(*it);
+				}
+			}
+		}
+
+		if (--_remaining == 0)
+			_done.set();
+	}
+}
+
+
+} // namespace Poco
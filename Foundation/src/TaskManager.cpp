@@ -23,13 +23,15 @@ const int TaskManager::MIN_PROGRESS_NOTIFICATION_INTERVAL = 100000; // 100 milli
 
 
 TaskManager::TaskManager(ThreadPool::ThreadAffinityPolicy affinityPolicy):
-	_threadPool(ThreadPool::defaultPool(affinityPolicy))
+	_threadPool(ThreadPool::defaultPool(affinityPolicy)),
+	_progressNotificationInterval(MIN_PROGRESS_NOTIFICATION_INTERVAL)
 {
 }
 
 
 TaskManager::TaskManager(ThreadPool& pool):
-	_threadPool(pool)
+	_threadPool(pool),
+	_progressNotificationInterval(MIN_PROGRESS_NOTIFICATION_INTERVAL)
 {
 }
 
@@ -125,6 +127,22 @@ void TaskManager::removeObserver(const AbstractObserver& observer)
 }
 
 
+void TaskManager::setProgressNotificationInterval(Timestamp::TimeDiff microseconds)
+{
+	poco_assert (microseconds >= 0);
+
+	FastMutex::ScopedLock lock(_mutex);
+	_progressNotificationInterval = microseconds;
+}
+
+
+Timestamp::TimeDiff TaskManager::getProgressNotificationInterval() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+	return _progressNotificationInterval;
+}
+
+
 void TaskManager::postNotification(const Notification::Ptr& pNf)
 {
 	_nc.postNotification(pNf);
@@ -141,7 +159,7 @@ void TaskManager::taskProgress(Task* pTask, float progress)
 {
 	ScopedLockWithUnlock<FastMutex> lock(_mutex);
 
-	if (_lastProgressNotification.isElapsed(MIN_PROGRESS_NOTIFICATION_INTERVAL))
+	if (_lastProgressNotification.isElapsed(_progressNotificationInterval))
 	{
 		_lastProgressNotification.update();
 		lock.unlock();
@@ -31,11 +31,29 @@ namespace Poco {
 TextConverter::TextConverter(const TextEncoding& inEncoding, const TextEncoding& outEncoding, int defaultChar):
 	_inEncoding(inEncoding),
 	_outEncoding(outEncoding),
-	_defaultChar(defaultChar)
+	_defaultChar(defaultChar),
+	_asciiPassthrough(isIdentityForASCII())
 {
 }
 
 
+bool TextConverter::isIdentityForASCII() const
+{
+	const TextEncoding::CharacterMap& inMap = _inEncoding.characterMap();
+	for (int c = 0; c < 128; c++)
+	{
+		if (inMap[c] != c) return false;
+	}
+	unsigned char buffer[TextEncoding::MAX_SEQUENCE_LENGTH];
+	for (int c = 0; c < 128; c++)
+	{
+		if (_outEncoding.convert(c, buffer, sizeof(buffer)) != 1 || buffer[0] != c)
+			return false;
+	}
+	return true;
+}
+
+
 TextConverter::~TextConverter()
 {
 }
@@ -121,6 +139,56 @@ int TextConverter::convert(const std::string& source, std::string& destination)
 
 int TextConverter::convert(const void* source, int length, std::string& destination)
 {
+	if (_asciiPassthrough)
+	{
+		// both encodings pass ASCII through unchanged: copy ASCII
+		// runs in bulk and only drop into the per-code-point
+		// machinery for non-ASCII sequences
+		poco_check_ptr (source);
+
+		int errors = 0;
+		const unsigned char* it  = (const unsigned char*) source;
+		const unsigned char* end = (const unsigned char*) source + length;
+		unsigned char buffer[TextEncoding::MAX_SEQUENCE_LENGTH];
+
+		while (it < end)
+		{
+			const unsigned char* runBegin = it;
+			while (it < end && *it < 0x80) ++it;
+			if (it != runBegin)
+				destination.append((const char*) runBegin, it - runBegin);
+			if (it < end)
+			{
+				int n = _inEncoding.queryConvert(it, 1);
+				int uc;
+				int read = 1;
+				while (-1 > n && (end - it) >= -n)
+				{
+					read = -n;
+					n = _inEncoding.queryConvert(it, read);
+				}
+				if (-1 > n)
+					it = end;
+				else
+					it += read;
+				if (-1 >= n)
+				{
+					uc = _defaultChar;
+					++errors;
+				}
+				else
+				{
+					uc = n;
+				}
+				n = _outEncoding.convert(uc, buffer, sizeof(buffer));
+				if (n == 0) n = _outEncoding.convert(_defaultChar, buffer, sizeof(buffer));
+				poco_assert (n <= sizeof(buffer));
+				destination.append((const char*) buffer, n);
+			}
+		}
+		return errors;
+	}
+
 	return convert(source, length, destination, nullTransform);
 }
 
@@ -81,6 +81,7 @@ void TextEncodingRegistry::add(TextEncoding::Ptr pEncoding, const std::string& n
 	RWLock::ScopedLock lock(_lock, true);
 
 	_encodings[name] = pEncoding;
+	_aliasCache.clear();
 }
 
 
@@ -89,21 +90,37 @@ void TextEncodingRegistry::remove(const std::string& name)
 	RWLock::ScopedLock lock(_lock, true);
 
 	_encodings.erase(name);
+	_aliasCache.clear();
 }
 
 
 TextEncoding::Ptr TextEncodingRegistry::find(const std::string& name) const
 {
-	RWLock::ScopedLock lock(_lock);
-	
-	EncodingMap::const_iterator it = _encodings.find(name);
-	if (it != _encodings.end())
-		return it->second;
-	
-	for (it = _encodings.begin(); it != _encodings.end(); ++it)
+	{
+		RWLock::ScopedLock lock(_lock);
+
+		EncodingMap::const_iterator it = _encodings.find(name);
+		if (it != _encodings.end())
+			return it->second;
+
+		// alias names (e.g. "utf8" for "UTF-8") previously paid a
+		// full scan with a virtual isA() per registered encoding on
+		// every lookup; resolved aliases are remembered until the
+		// registry changes
+		it = _aliasCache.find(name);
+		if (it != _aliasCache.end())
+			return it->second;
+	}
+
+	RWLock::ScopedLock lock(_lock, true);
+
+	for (EncodingMap::const_iterator it = _encodings.begin(); it != _encodings.end(); ++it)
 	{
 		if (it->second->isA(name))
+		{
+			_aliasCache[name] = it->second;
 			return it->second;
+		}
 	}
 	return TextEncoding::Ptr();
 }
@@ -35,6 +35,7 @@ public:
 	~PooledThread();
 
 	void start(int cpu = -1);
+	void setSpinCount(int spinCount);
 	void start(Thread::Priority priority, Runnable& target, int cpu = -1);
 	void start(Thread::Priority priority, Runnable& target, const std::string& name, int cpu = -1);
 	bool idle();
@@ -46,6 +47,7 @@ public:
 
 private:
 	bool _idle;
+	int _spinCount;
 	std::time_t _idleTime;
 	Runnable* _pTarget;
 	std::string _name;
@@ -59,6 +61,7 @@ private:
 
 PooledThread::PooledThread(const std::string& name, int stackSize):
 	_idle(true),
+	_spinCount(0),
 	_idleTime(0),
 	_pTarget(0),
 	_name(name),
@@ -198,12 +201,26 @@ void PooledThread::release()
 }
 
 
+void PooledThread::setSpinCount(int spinCount)
+{
+	_spinCount = spinCount;
+}
+
+
 void PooledThread::run()
 {
 	_started.set();
 	for (;;)
 	{
-		_targetReady.wait();
+		// spin-then-park: a brief yield loop soaks up the wakeup
+		// latency when the next piece of work arrives immediately
+		bool ready = false;
+		for (int spin = _spinCount; spin > 0 && !ready; spin--)
+		{
+			ready = _targetReady.tryWait(0);
+			if (!ready) Thread::yield();
+		}
+		if (!ready) _targetReady.wait();
 		_mutex.lock();
 		if (_pTarget) // a NULL target means kill yourself
 		{
@@ -257,6 +274,13 @@ ThreadPool::ThreadPool(int minCapacity,
 	_idleTime(idleTime),
 	_serial(0),
 	_age(0),
+	_growthIncrement(1),
+	_creationRateLimit(0),
+	_idleSpin(0),
+	_growthEvents(0),
+	_saturationEvents(0),
+	_creationTokens(0),
+	_lastTokenRefill(0),
 	_stackSize(stackSize),
 	_affinityPolicy(affinityPolicy),
 	_lastCpu(0)
@@ -292,6 +316,13 @@ ThreadPool::ThreadPool(const std::string& rName,
 	_idleTime(idleTime),
 	_serial(0),
 	_age(0),
+	_growthIncrement(1),
+	_creationRateLimit(0),
+	_idleSpin(0),
+	_growthEvents(0),
+	_saturationEvents(0),
+	_creationTokens(0),
+	_lastTokenRefill(0),
 	_stackSize(stackSize),
 	_affinityPolicy(affinityPolicy),
 	_lastCpu(0)
@@ -378,13 +409,28 @@ int ThreadPool::allocated() const
 }
 
 
+void ThreadPool::setAffinityCpuSet(const std::vector<int>& cpus)
+{
+	for (std::vector<int>::const_iterator it = cpus.begin(); it != cpus.end(); ++it)
+	{
+		if (*it < 0 || *it >= static_cast<int>(Environment::processorCount()))
+			throw InvalidArgumentException("cpu set entry is invalid");
+	}
+	FastMutex::ScopedLock lock(_mutex);
+	_affinityCpus = cpus;
+}
+
+
 int ThreadPool::affinity(int cpu)
 {
 	switch (static_cast<int>(_affinityPolicy))
 	{
 		case TAP_UNIFORM_DISTRIBUTION:
 		{
-			cpu = _lastCpu.value() % Environment::processorCount();
+			if (!_affinityCpus.empty())
+				cpu = _affinityCpus[_lastCpu.value() % _affinityCpus.size()];
+			else
+				cpu = _lastCpu.value() % Environment::processorCount();
 			_lastCpu++;
 		}
 		break;
@@ -519,10 +565,12 @@ PooledThread* ThreadPool::getThread()
 	{
 		if (_threads.size() < _maxCapacity)
 		{
+			++_growthEvents;
 			pThread = createThread();
 			try
 			{
 				pThread->start();
+				pThread->setSpinCount(_idleSpin);
 				_threads.push_back(pThread);
 			}
 			catch (...)
@@ -530,14 +578,98 @@ PooledThread* ThreadPool::getThread()
 				delete pThread;
 				throw;
 			}
+			// burst anticipation: grow by the configured increment
+			// (rate limited), so the rest of a burst finds warm
+			// threads instead of each paying creation latency
+			for (int i = 1; i < _growthIncrement && _threads.size() < _maxCapacity; i++)
+			{
+				if (!takeCreationToken()) break;
+				PooledThread* pExtra = createThread();
+				try
+				{
+					pExtra->start();
+					pExtra->setSpinCount(_idleSpin);
+					_threads.push_back(pExtra);
+				}
+				catch (...)
+				{
+					delete pExtra;
+					break;
+				}
+			}
+		}
+		else
+		{
+			++_saturationEvents;
+			throw NoThreadAvailableException();
 		}
-		else throw NoThreadAvailableException();
 	}
 	pThread->activate();
 	return pThread;
 }
 
 
+bool ThreadPool::takeCreationToken()
+{
+	if (_creationRateLimit <= 0) return true;
+	std::time_t now = std::time(0);
+	if (now != _lastTokenRefill)
+	{
+		_creationTokens = _creationRateLimit;
+		_lastTokenRefill = now;
+	}
+	if (_creationTokens <= 0) return false;
+	--_creationTokens;
+	return true;
+}
+
+
+void ThreadPool::setGrowthIncrement(int increment)
+{
+	poco_assert (increment >= 1);
+
+	FastMutex::ScopedLock lock(_mutex);
+	_growthIncrement = increment;
+}
+
+
+int ThreadPool::getGrowthIncrement() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+	return _growthIncrement;
+}
+
+
+void ThreadPool::setCreationRateLimit(int threadsPerSecond)
+{
+	FastMutex::ScopedLock lock(_mutex);
+	_creationRateLimit = threadsPerSecond;
+}
+
+
+void ThreadPool::setIdleSpin(int iterations)
+{
+	FastMutex::ScopedLock lock(_mutex);
+	_idleSpin = iterations;
+	for (ThreadVec::iterator it = _threads.begin(); it != _threads.end(); ++it)
+		(*it)->setSpinCount(iterations);
+}
+
+
+int ThreadPool::growthEvents() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+	return _growthEvents;
+}
+
+
+int ThreadPool::saturationEvents() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+	return _saturationEvents;
+}
+
+
 PooledThread* ThreadPool::createThread()
 {
 	std::ostringstream threadName;
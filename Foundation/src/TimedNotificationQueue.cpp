@@ -48,7 +48,9 @@ void TimedNotificationQueue::enqueueNotification(Notification::Ptr pNotification
 	clock += diff;
 
 	FastMutex::ScopedLock lock(_mutex);
-	_nfQueue.insert(NfQueue::value_type(clock, pNotification));
+	// timers are mostly enqueued in expiry order (equal timeouts being
+	// rescheduled); hinting at the end makes those inserts amortized O(1)
+	_nfQueue.insert(_nfQueue.end(), NfQueue::value_type(clock, pNotification));
 	_nfAvailable.set();
 }
 
@@ -58,7 +60,7 @@ void TimedNotificationQueue::enqueueNotification(Notification::Ptr pNotification
 	poco_check_ptr (pNotification);
 
 	FastMutex::ScopedLock lock(_mutex);
-	_nfQueue.insert(NfQueue::value_type(clock, pNotification));
+	_nfQueue.insert(_nfQueue.end(), NfQueue::value_type(clock, pNotification));
 	_nfAvailable.set();
 }
 
@@ -82,6 +84,24 @@ Notification* TimedNotificationQueue::dequeueNotification()
 }
 
 
+std::size_t TimedNotificationQueue::dequeueDueNotifications(std::vector<Notification::Ptr>& batch)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	std::size_t count = 0;
+	NfQueue::iterator it = _nfQueue.begin();
+	while (it != _nfQueue.end() && it->first.elapsed() >= 0)
+	{
+		batch.push_back(it->second);
+		NfQueue::iterator itDel = it;
+		++it;
+		_nfQueue.erase(itDel);
+		++count;
+	}
+	return count;
+}
+
+
 Notification* TimedNotificationQueue::waitDequeueNotification()
 {
 	for (;;)
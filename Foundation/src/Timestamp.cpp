@@ -13,6 +13,7 @@
 
 
 #include "Poco/Timestamp.h"
+#include <ctime>
 #include "Poco/Timespan.h"
 #include "Poco/Exception.h"
 #if defined(POCO_OS_FAMILY_WINDOWS)
@@ -211,6 +212,28 @@ void Timestamp::update()
 }
 
 
+void Timestamp::updateCoarse()
+{
+#if POCO_OS == POCO_OS_LINUX && defined(CLOCK_REALTIME_COARSE)
+	struct timespec ts;
+	if (::clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0)
+	{
+		_ts = TimeVal(ts.tv_sec)*resolution() + ts.tv_nsec/1000;
+		return;
+	}
+#endif
+	update();
+}
+
+
+Timestamp Timestamp::coarse()
+{
+	Timestamp result(0);
+	result.updateCoarse();
+	return result;
+}
+
+
 Timestamp  Timestamp::operator +  (const Timespan& span) const
 {
 	return *this + span.totalMicroseconds();
@@ -649,8 +649,15 @@ void URI::decode(const std::string& str, std::string& decodedStr, bool plusAsSpa
 	bool inQuery = false;
 	std::string::const_iterator it  = str.begin();
 	std::string::const_iterator end = str.end();
+	decodedStr.reserve(decodedStr.size() + str.size());
 	while (it != end)
 	{
+		// copy the run up to the next character needing treatment
+		// in one append instead of one character at a time
+		std::string::const_iterator runBegin = it;
+		while (it != end && *it != '%' && *it != '?' && !(inQuery && plusAsSpace && *it == '+')) ++it;
+		if (it != runBegin) decodedStr.append(runBegin, it);
+		if (it == end) break;
 		char c = *it++;
 		if (c == '?') inQuery = true;
 		// spaces may be encoded as plus signs in the query
@@ -19,6 +19,7 @@
 #include "Poco/MD5Engine.h"
 #include "Poco/SHA1Engine.h"
 #include "Poco/SingletonHolder.h"
+#include "Poco/Process.h"
 #include <cstring>
 
 
@@ -91,11 +92,52 @@ UUID UUIDGenerator::createFromName(const UUID& nsid, const std::string& name, Di
 }
 
 	
+namespace
+{
+	//
+	// per-thread entropy pool: one RandomInputStream refill serves
+	// a batch of UUIDs, instead of a stream construction and
+	// entropy read per identifier
+	//
+	class RandomPool
+	{
+	public:
+		enum
+		{
+			BATCH = 64
+		};
+
+		void next(char* buffer)
+		{
+			// the PID check discards the pool across a fork():
+			// a child inheriting buffered entropy would replay
+			// the parent's "random" UUIDs
+			Process::PID pid = Process::id();
+			if (_pos + 16 > sizeof(_pool) || pid != _pid)
+			{
+				RandomInputStream ris;
+				ris.read(_pool, sizeof(_pool));
+				_pos = 0;
+				_pid = pid;
+			}
+			std::memcpy(buffer, _pool + _pos, 16);
+			_pos += 16;
+		}
+
+	private:
+		char _pool[16*BATCH];
+		std::size_t _pos = sizeof(_pool);
+		Process::PID _pid = 0;
+	};
+
+	thread_local RandomPool randomPool;
+}
+
+
 UUID UUIDGenerator::createRandom()
 {
 	char buffer[16];
-	RandomInputStream ris;
-	ris.read(buffer, sizeof(buffer));
+	randomPool.next(buffer);
 	return UUID(buffer, UUID::UUID_RANDOM);
 }
 
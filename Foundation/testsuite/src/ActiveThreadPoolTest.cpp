@@ -0,0 +1,140 @@
+//
+// ActiveThreadPoolTest.cpp
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ActiveThreadPoolTest.h"
+#include "Poco/CppUnit/TestCaller.h"
+#include "Poco/CppUnit/TestSuite.h"
+#include "Poco/ActiveThreadPool.h"
+#include "Poco/RunnableAdapter.h"
+#include "Poco/Thread.h"
+
+
+using Poco::ActiveThreadPool;
+using Poco::RunnableAdapter;
+using Poco::Thread;
+
+
+ActiveThreadPoolTest::ActiveThreadPoolTest(const std::string& rName): CppUnit::TestCase(rName)
+{
+}
+
+
+ActiveThreadPoolTest::~ActiveThreadPoolTest()
+{
+}
+
+
+void ActiveThreadPoolTest::testActiveThreadPool()
+{
+	ActiveThreadPool pool(2);
+
+	assertTrue (pool.capacity() == 2);
+	assertTrue (pool.pending() == 0);
+
+	RunnableAdapter<ActiveThreadPoolTest> ra(*this, &ActiveThreadPoolTest::count);
+	// unlike ThreadPool, starting more targets than workers queues
+	// them instead of throwing NoThreadAvailableException
+	for (int i = 0; i < 8; ++i)
+		pool.start(ra);
+	pool.joinAll();
+
+	assertTrue (_count == 8);
+	assertTrue (pool.pending() == 0);
+
+	// the pool is reusable after joinAll()
+	pool.start(ra);
+	pool.joinAll();
+	assertTrue (_count == 9);
+}
+
+
+void ActiveThreadPoolTest::testManyTasks()
+{
+	ActiveThreadPool pool(4);
+	RunnableAdapter<ActiveThreadPoolTest> ra(*this, &ActiveThreadPoolTest::count);
+	for (int i = 0; i < 1000; ++i)
+		pool.start(ra);
+	pool.joinAll();
+	assertTrue (_count == 1000);
+}
+
+
+namespace
+{
+	class Submitter: public Poco::Runnable
+	{
+	public:
+		Submitter(ActiveThreadPool& pool, Poco::Runnable& target, int n):
+			_pool(pool),
+			_target(target),
+			_n(n)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < _n; ++i)
+				_pool.start(_target);
+		}
+
+	private:
+		ActiveThreadPool& _pool;
+		Poco::Runnable& _target;
+		int _n;
+	};
+}
+
+
+void ActiveThreadPoolTest::testUnevenProducers()
+{
+	// several producer threads submitting concurrently; work
+	// stealing must still run every queued target exactly once
+	ActiveThreadPool pool(2);
+	RunnableAdapter<ActiveThreadPoolTest> ra(*this, &ActiveThreadPoolTest::count);
+	Submitter s1(pool, ra, 100);
+	Submitter s2(pool, ra, 300);
+	Thread t1;
+	Thread t2;
+	t1.start(s1);
+	t2.start(s2);
+	t1.join();
+	t2.join();
+	pool.joinAll();
+	assertTrue (_count == 400);
+}
+
+
+void ActiveThreadPoolTest::count()
+{
+	++_count;
+}
+
+
+void ActiveThreadPoolTest::setUp()
+{
+	_count = 0;
+}
+
+
+void ActiveThreadPoolTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ActiveThreadPoolTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ActiveThreadPoolTest");
+
+	CppUnit_addTest(pSuite, ActiveThreadPoolTest, testActiveThreadPool);
+	CppUnit_addTest(pSuite, ActiveThreadPoolTest, testManyTasks);
+	CppUnit_addTest(pSuite, ActiveThreadPoolTest, testUnevenProducers);
+
+	return pSuite;
+}
@@ -13,12 +13,14 @@
 #include "Poco/CppUnit/TestSuite.h"
 #include "Poco/Base32Encoder.h"
 #include "Poco/Base32Decoder.h"
+#include "Poco/Base32Codec.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
 using Poco::Base32Encoder;
 using Poco::Base32Decoder;
+using Poco::Base32Codec;
 using Poco::DataFormatException;
 
 
@@ -160,6 +162,44 @@ void Base32Test::testEncodeDecode()
 }
 
 
+void Base32Test::testCodec()
+{
+	// RFC 4648 test vectors
+	assertTrue (Base32Codec::encode("", 0) == "");
+	assertTrue (Base32Codec::encode("f", 1) == "MY======");
+	assertTrue (Base32Codec::encode("fo", 2) == "MZXQ====");
+	assertTrue (Base32Codec::encode("foo", 3) == "MZXW6===");
+	assertTrue (Base32Codec::encode("foob", 4) == "MZXW6YQ=");
+	assertTrue (Base32Codec::encode("fooba", 5) == "MZXW6YTB");
+	assertTrue (Base32Codec::encode("foobar", 6) == "MZXW6YTBOI======");
+	assertTrue (Base32Codec::encode("foobar", 6, false) == "MZXW6YTBOI");
+
+	assertTrue (Base32Codec::encodedLength(5) == 8);
+	assertTrue (Base32Codec::encodedLength(6) == 16);
+	assertTrue (Base32Codec::encodedLength(6, false) == 10);
+
+	std::string decoded;
+	assertTrue (Base32Codec::decode("MZXW6YTBOI======", decoded));
+	assertTrue (decoded == "foobar");
+	assertTrue (Base32Codec::decode("MZXW6YTBOI", decoded));
+	assertTrue (decoded == "foobar");
+	assertTrue (Base32Codec::decode("mzxw6ytboi", decoded));
+	assertTrue (decoded == "foobar");
+	assertTrue (!Base32Codec::decode("MZXW6YTB1I", decoded));
+
+	// bulk output must match the stream encoder for arbitrary data
+	std::string src;
+	for (int i = 0; i < 2555; ++i) src += char(rand() & 0xFF);
+	std::ostringstream str;
+	Base32Encoder encoder(str);
+	encoder.write(src.data(), (std::streamsize) src.size());
+	encoder.close();
+	assertTrue (Base32Codec::encode(src.data(), src.size()) == str.str());
+	assertTrue (Base32Codec::decode(str.str(), decoded));
+	assertTrue (decoded == src);
+}
+
+
 void Base32Test::setUp()
 {
 }
@@ -177,6 +217,7 @@ CppUnit::Test* Base32Test::suite()
 	CppUnit_addTest(pSuite, Base32Test, testEncoder);
 	CppUnit_addTest(pSuite, Base32Test, testDecoder);
 	CppUnit_addTest(pSuite, Base32Test, testEncodeDecode);
+	CppUnit_addTest(pSuite, Base32Test, testCodec);
 
 	return pSuite;
 }
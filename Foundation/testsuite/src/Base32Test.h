@@ -27,6 +27,7 @@ public:
 	void testEncoder();
 	void testDecoder();
 	void testEncodeDecode();
+	void testCodec();
 
 	void setUp();
 	void tearDown();
@@ -13,12 +13,14 @@
 #include "Poco/CppUnit/TestSuite.h"
 #include "Poco/Base64Encoder.h"
 #include "Poco/Base64Decoder.h"
+#include "Poco/Base64Codec.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
 using Poco::Base64Encoder;
 using Poco::Base64Decoder;
+using Poco::Base64Codec;
 using Poco::DataFormatException;
 
 
@@ -343,6 +345,47 @@ void Base64Test::testEncodeDecode()
 }
 
 
+void Base64Test::testCodec()
+{
+	assertTrue (Base64Codec::encode("\00\01\02\03\04\05", 6) == "AAECAwQF");
+	assertTrue (Base64Codec::encode("\00\01\02\03", 4) == "AAECAw==");
+	assertTrue (Base64Codec::encode("ABCDEF", 6) == "QUJDREVG");
+	assertTrue (Base64Codec::encode("!@#$%^&*()_~<>", 14) == "IUAjJCVeJiooKV9+PD4=");
+	assertTrue (Base64Codec::encode("", 0) == "");
+
+	assertTrue (Base64Codec::encode("!@#$%^&*()_~<>", 14, Poco::BASE64_URL_ENCODING) == "IUAjJCVeJiooKV9-PD4=");
+	assertTrue (Base64Codec::encode("ABCDEF", 4, Poco::BASE64_NO_PADDING) == "QUJDRA");
+
+	assertTrue (Base64Codec::encodedLength(0) == 0);
+	assertTrue (Base64Codec::encodedLength(4) == 8);
+	assertTrue (Base64Codec::encodedLength(6) == 8);
+	assertTrue (Base64Codec::encodedLength(4, Poco::BASE64_NO_PADDING) == 6);
+
+	std::string decoded;
+	assertTrue (Base64Codec::decode("AAECAwQF", decoded));
+	assertTrue (decoded == std::string("\00\01\02\03\04\05", 6));
+	assertTrue (Base64Codec::decode("AAECAw==", decoded));
+	assertTrue (decoded == std::string("\00\01\02\03", 4));
+	assertTrue (Base64Codec::decode("AAEC\r\nAw==", decoded));
+	assertTrue (decoded == std::string("\00\01\02\03", 4));
+	assertTrue (Base64Codec::decode("QUJDRA", decoded));
+	assertTrue (decoded == "ABCD");
+	assertTrue (!Base64Codec::decode("QUJD#REVG", decoded));
+
+	// bulk output must match the stream encoder for arbitrary data
+	std::string src;
+	for (int i = 0; i < 4000; ++i) src += char(rand() & 0xFF);
+	std::ostringstream str;
+	Base64Encoder encoder(str);
+	encoder.rdbuf()->setLineLength(0);
+	encoder.write(src.data(), (std::streamsize) src.size());
+	encoder.close();
+	assertTrue (Base64Codec::encode(src.data(), src.size()) == str.str());
+	assertTrue (Base64Codec::decode(str.str(), decoded));
+	assertTrue (decoded == src);
+}
+
+
 void Base64Test::setUp()
 {
 }
@@ -364,6 +407,7 @@ CppUnit::Test* Base64Test::suite()
 	CppUnit_addTest(pSuite, Base64Test, testDecoderURL);
 	CppUnit_addTest(pSuite, Base64Test, testDecoderNoPadding);
 	CppUnit_addTest(pSuite, Base64Test, testEncodeDecode);
+	CppUnit_addTest(pSuite, Base64Test, testCodec);
 
 	return pSuite;
 }
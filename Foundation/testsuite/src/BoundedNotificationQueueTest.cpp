@@ -0,0 +1,211 @@
+//
+// BoundedNotificationQueueTest.cpp
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "BoundedNotificationQueueTest.h"
+#include "Poco/CppUnit/TestCaller.h"
+#include "Poco/CppUnit/TestSuite.h"
+#include "Poco/Notification.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/RunnableAdapter.h"
+
+
+using Poco::BoundedNotificationQueue;
+using Poco::Notification;
+using Poco::Thread;
+using Poco::RunnableAdapter;
+
+
+namespace
+{
+	class BQTestNotification: public Notification
+	{
+	public:
+		BQTestNotification(const std::string& data): _data(data)
+		{
+		}
+		~BQTestNotification()
+		{
+		}
+		const std::string& data() const
+		{
+			return _data;
+		}
+
+	private:
+		std::string _data;
+	};
+}
+
+
+BoundedNotificationQueueTest::BoundedNotificationQueueTest(const std::string& rName): CppUnit::TestCase(rName)
+{
+}
+
+
+BoundedNotificationQueueTest::~BoundedNotificationQueueTest()
+{
+}
+
+
+void BoundedNotificationQueueTest::testQueueDequeue()
+{
+	BoundedNotificationQueue queue(4);
+	assertTrue (queue.empty());
+	assertTrue (queue.size() == 0);
+	assertTrue (queue.capacity() >= 4);
+	Notification* pNf = queue.dequeueNotification();
+	assertNullPtr(pNf);
+	queue.enqueueNotification(new Notification);
+	assertTrue (!queue.empty());
+	assertTrue (queue.size() == 1);
+	pNf = queue.dequeueNotification();
+	assertNotNullPtr(pNf);
+	assertTrue (queue.empty());
+	assertTrue (queue.size() == 0);
+	pNf->release();
+
+	queue.enqueueNotification(new BQTestNotification("first"));
+	queue.enqueueNotification(new BQTestNotification("second"));
+	assertTrue (!queue.empty());
+	assertTrue (queue.size() == 2);
+	BQTestNotification* pTNf = dynamic_cast<BQTestNotification*>(queue.dequeueNotification());
+	assertNotNullPtr(pTNf);
+	assertTrue (pTNf->data() == "first");
+	pTNf->release();
+	pTNf = dynamic_cast<BQTestNotification*>(queue.dequeueNotification());
+	assertNotNullPtr(pTNf);
+	assertTrue (pTNf->data() == "second");
+	pTNf->release();
+	assertTrue (queue.empty());
+	assertTrue (queue.size() == 0);
+}
+
+
+void BoundedNotificationQueueTest::testQueueFull()
+{
+	BoundedNotificationQueue queue(4);
+	std::size_t capacity = queue.capacity();
+	for (std::size_t i = 0; i < capacity; ++i)
+	{
+		assertTrue (queue.tryEnqueueNotification(new Notification));
+	}
+	assertTrue (queue.full());
+	assertTrue (queue.size() == capacity);
+
+	// a full queue must refuse the notification without leaking it
+	Notification::Ptr pNf = new Notification;
+	assertTrue (!queue.tryEnqueueNotification(pNf));
+	assertTrue (pNf->referenceCount() == 1);
+
+	Notification* pFirst = queue.dequeueNotification();
+	assertNotNullPtr(pFirst);
+	pFirst->release();
+	assertTrue (!queue.full());
+	assertTrue (queue.tryEnqueueNotification(pNf));
+	assertTrue (queue.full());
+
+	while (!queue.empty())
+	{
+		Notification* p = queue.dequeueNotification();
+		assertNotNullPtr(p);
+		p->release();
+	}
+}
+
+
+void BoundedNotificationQueueTest::testWaitDequeue()
+{
+	BoundedNotificationQueue queue(4);
+	queue.enqueueNotification(new BQTestNotification("third"));
+	queue.enqueueNotification(new BQTestNotification("fourth"));
+	BQTestNotification* pTNf = dynamic_cast<BQTestNotification*>(queue.waitDequeueNotification(10));
+	assertNotNullPtr(pTNf);
+	assertTrue (pTNf->data() == "third");
+	pTNf->release();
+	pTNf = dynamic_cast<BQTestNotification*>(queue.waitDequeueNotification(10));
+	assertNotNullPtr(pTNf);
+	assertTrue (pTNf->data() == "fourth");
+	pTNf->release();
+	assertTrue (queue.empty());
+
+	Notification* pNf = queue.waitDequeueNotification(10);
+	assertNullPtr(pNf);
+}
+
+
+void BoundedNotificationQueueTest::testThreads()
+{
+	const int NOTIFICATION_COUNT = 5000;
+
+	Thread t1("thread1");
+	Thread t2("thread2");
+	Thread t3("thread3");
+
+	RunnableAdapter<BoundedNotificationQueueTest> ra(*this, &BoundedNotificationQueueTest::work);
+	t1.start(ra);
+	t2.start(ra);
+	t3.start(ra);
+	for (int i = 0; i < NOTIFICATION_COUNT; ++i)
+	{
+		_queue.enqueueNotification(new Notification);
+	}
+	while (!_queue.empty()) Thread::sleep(50);
+	Thread::sleep(20);
+	_queue.wakeUpAll();
+	t1.join();
+	t2.join();
+	t3.join();
+	assertTrue (_handled.size() == NOTIFICATION_COUNT);
+	assertTrue (_handled.count("thread1") > 0);
+	assertTrue (_handled.count("thread2") > 0);
+	assertTrue (_handled.count("thread3") > 0);
+}
+
+
+void BoundedNotificationQueueTest::work()
+{
+	Thread::sleep(50);
+	Notification* pNf = _queue.waitDequeueNotification();
+	while (pNf)
+	{
+		pNf->release();
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			_handled.insert(Thread::current()->name());
+		}
+		Thread::sleep(1);
+		pNf = _queue.waitDequeueNotification();
+	}
+}
+
+
+void BoundedNotificationQueueTest::setUp()
+{
+	_handled.clear();
+}
+
+
+void BoundedNotificationQueueTest::tearDown()
+{
+}
+
+
+CppUnit::Test* BoundedNotificationQueueTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("BoundedNotificationQueueTest");
+
+	CppUnit_addTest(pSuite, BoundedNotificationQueueTest, testQueueDequeue);
+	CppUnit_addTest(pSuite, BoundedNotificationQueueTest, testQueueFull);
+	CppUnit_addTest(pSuite, BoundedNotificationQueueTest, testWaitDequeue);
+	CppUnit_addTest(pSuite, BoundedNotificationQueueTest, testThreads);
+
+	return pSuite;
+}
@@ -0,0 +1,197 @@
+//
+// CancellationTokenTest.cpp
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "CancellationTokenTest.h"
+#include "Poco/CppUnit/TestCaller.h"
+#include "Poco/CppUnit/TestSuite.h"
+#include "Poco/CancellationToken.h"
+#include "Poco/Activity.h"
+#include "Poco/Thread.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Exception.h"
+
+
+using Poco::CancellationToken;
+using Poco::CancellationTokenSource;
+using Poco::Thread;
+using Poco::Timestamp;
+
+
+CancellationTokenTest::CancellationTokenTest(const std::string& rName): CppUnit::TestCase(rName)
+{
+}
+
+
+CancellationTokenTest::~CancellationTokenTest()
+{
+}
+
+
+void CancellationTokenTest::testDefaultToken()
+{
+	// a default-constructed token can never be cancelled
+	CancellationToken token;
+	assertTrue (!token.isCancelled());
+	token.throwIfCancelled();
+	assertTrue (!token.wait(10));
+}
+
+
+void CancellationTokenTest::testCancel()
+{
+	CancellationTokenSource source;
+	CancellationToken token = source.token();
+	assertTrue (!source.isCancelled());
+	assertTrue (!token.isCancelled());
+
+	source.cancel();
+	assertTrue (source.isCancelled());
+	assertTrue (token.isCancelled());
+	try
+	{
+		token.throwIfCancelled();
+		fail("token cancelled - must throw");
+	}
+	catch (Poco::InterruptedException&)
+	{
+	}
+
+	// cancel() is idempotent; reset() re-arms existing tokens
+	source.cancel();
+	source.reset();
+	assertTrue (!source.isCancelled());
+	assertTrue (!token.isCancelled());
+}
+
+
+void CancellationTokenTest::testCallbacks()
+{
+	CancellationTokenSource source;
+	CancellationToken token = source.token();
+
+	int calls = 0;
+	int id1 = token.onCancel([&calls]() { ++calls; });
+	int id2 = token.onCancel([&calls]() { ++calls; });
+	token.removeCallback(id2);
+	source.cancel();
+	assertTrue (calls == 1);
+	token.removeCallback(id1);
+
+	// registering on an already cancelled token runs immediately
+	int lateCalls = 0;
+	token.onCancel([&lateCalls]() { ++lateCalls; });
+	assertTrue (lateCalls == 1);
+}
+
+
+namespace
+{
+	class Canceller: public Poco::Runnable
+	{
+	public:
+		Canceller(CancellationTokenSource& source): _source(source)
+		{
+		}
+
+		void run()
+		{
+			Thread::sleep(100);
+			_source.cancel();
+		}
+
+	private:
+		CancellationTokenSource& _source;
+	};
+}
+
+
+void CancellationTokenTest::testWait()
+{
+	CancellationTokenSource source;
+	CancellationToken token = source.token();
+
+	Timestamp mark;
+	assertTrue (!token.wait(100));
+	assertTrue (mark.elapsed() >= 90000);
+
+	// cancellation from another thread interrupts the wait well
+	// before the timeout
+	Canceller canceller(source);
+	Thread t;
+	t.start(canceller);
+	mark.update();
+	assertTrue (token.wait(10000));
+	assertTrue (mark.elapsed() < 5000000);
+	t.join();
+}
+
+
+namespace
+{
+	class TokenActiveObject
+	{
+	public:
+		TokenActiveObject():
+			_activity(this, &TokenActiveObject::run)
+		{
+		}
+
+		Poco::Activity<TokenActiveObject>& activity()
+		{
+			return _activity;
+		}
+
+		void run()
+		{
+			// blocks until stop() cancels the activity's token
+			_activity.cancellationToken().wait(30000);
+		}
+
+	private:
+		Poco::Activity<TokenActiveObject> _activity;
+	};
+}
+
+
+void CancellationTokenTest::testActivityToken()
+{
+	TokenActiveObject activeObj;
+	activeObj.activity().start();
+	Thread::sleep(100);
+	Timestamp mark;
+	activeObj.activity().stop();
+	activeObj.activity().wait();
+	// stop() must interrupt the token wait, not run into its timeout
+	assertTrue (mark.elapsed() < 5000000);
+}
+
+
+void CancellationTokenTest::setUp()
+{
+}
+
+
+void CancellationTokenTest::tearDown()
+{
+}
+
+
+CppUnit::Test* CancellationTokenTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("CancellationTokenTest");
+
+	CppUnit_addTest(pSuite, CancellationTokenTest, testDefaultToken);
+	CppUnit_addTest(pSuite, CancellationTokenTest, testCancel);
+	CppUnit_addTest(pSuite, CancellationTokenTest, testCallbacks);
+	CppUnit_addTest(pSuite, CancellationTokenTest, testWait);
+	CppUnit_addTest(pSuite, CancellationTokenTest, testActivityToken);
+
+	return pSuite;
+}
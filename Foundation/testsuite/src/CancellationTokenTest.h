@@ -0,0 +1,40 @@
+//
+// CancellationTokenTest.h
+//
+// Definition of the CancellationTokenTest class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef CancellationTokenTest_INCLUDED
+#define CancellationTokenTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/CppUnit/TestCase.h"
+
+
+class CancellationTokenTest: public CppUnit::TestCase
+{
+public:
+	CancellationTokenTest(const std::string& name);
+	~CancellationTokenTest();
+
+	void testDefaultToken();
+	void testCancel();
+	void testCallbacks();
+	void testWait();
+	void testActivityToken();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // CancellationTokenTest_INCLUDED
@@ -25,6 +25,7 @@
 #include "Poco/BasicEvent.h"
 #include "Poco/Delegate.h"
 #include "Poco/Checksum.h"
+#include "Poco/Checksum64.h"
 #include "Poco/MakeUnique.h"
 #include "Poco/Exception.h"
 #include <iostream>
@@ -652,6 +653,36 @@ void CoreTest::testChecksum64()
 }
 
 
+void CoreTest::testChecksum64Combine()
+{
+	std::string strA = "Hello ";
+	std::string strB = "world!!!";
+	std::string strAB = strA + strB;
+
+	Poco::Checksum64 checksumA;
+	Poco::Checksum64 checksumB;
+	Poco::Checksum64 checksumAB;
+	checksumA.update(strA);
+	checksumB.update(strB);
+	checksumAB.update(strAB);
+
+	Poco::UInt64 combined = Poco::Checksum64::combine(checksumA.checksum(), checksumB.checksum(), strB.size());
+	assertTrue (combined == checksumAB.checksum());
+
+	// combining with an empty second block is a no-op
+	assertTrue (Poco::Checksum64::combine(checksumA.checksum(), 0, 0) == checksumA.checksum());
+
+	std::string large;
+	large.reserve(1048576);
+	for (int i = 0; i < 1048576; i++)
+		large += static_cast<char>(i % 251);
+	Poco::Checksum64 checksumLarge;
+	checksumLarge.update(large);
+	assertTrue (Poco::Checksum64::checksumParallel(large.data(), large.size(), 4) == checksumLarge.checksum());
+	assertTrue (Poco::Checksum64::checksumParallel(large.data(), large.size(), 1) == checksumLarge.checksum());
+}
+
+
 void CoreTest::testMakeUnique()
 {
 	assertTrue (*makeUnique<int>() == 0);
@@ -695,6 +726,7 @@ CppUnit::Test* CoreTest::suite()
 	CppUnit_addTest(pSuite, CoreTest, testNullable);
 	CppUnit_addTest(pSuite, CoreTest, testAscii);
 	CppUnit_addTest(pSuite, CoreTest, testChecksum64);
+	CppUnit_addTest(pSuite, CoreTest, testChecksum64Combine);
 	CppUnit_addTest(pSuite, CoreTest, testMakeUnique);
 
 	return pSuite;
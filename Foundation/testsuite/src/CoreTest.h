@@ -35,6 +35,7 @@ public:
 	void testNullable();
 	void testAscii();
 	void testChecksum64();
+	void testChecksum64Combine();
 	void testMakeUnique();
 
 	void setUp();
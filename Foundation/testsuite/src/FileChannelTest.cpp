@@ -17,6 +17,7 @@
 #include "Poco/TemporaryFile.h"
 #include "Poco/Thread.h"
 #include "Poco/File.h"
+#include "Poco/FileStream.h"
 #include "Poco/Path.h"
 #include "Poco/Timestamp.h"
 #include "Poco/DateTime.h"
@@ -544,6 +545,70 @@ void FileChannelTest::testWrongPurgeOption()
 }
 
 
+namespace
+{
+	int countLines(const std::string& name)
+	{
+		Poco::FileInputStream istr(name);
+		int n = 0;
+		std::string line;
+		while (std::getline(istr, line)) ++n;
+		return n;
+	}
+}
+
+
+void FileChannelTest::testAsync()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_ASYNC, "true");
+		pChannel->open();
+		Message msg("source", "This is a log file entry", Message::PRIO_INFORMATION);
+		for (int i = 0; i < 100; ++i)
+			pChannel->log(msg);
+		pChannel->close(); // joins the flusher, draining the buffer
+		assertTrue (countLines(name) == 100);
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
+void FileChannelTest::testAsyncReopen()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_ASYNC, "true");
+		pChannel->open();
+		Message msg("source", "This is a log file entry", Message::PRIO_INFORMATION);
+		for (int i = 0; i < 10; ++i)
+			pChannel->log(msg);
+		pChannel->close();
+		assertTrue (countLines(name) == 10);
+		// logging again reopens the channel and must restart the flusher
+		for (int i = 0; i < 10; ++i)
+			pChannel->log(msg);
+		pChannel->close();
+		assertTrue (countLines(name) == 20);
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
 void FileChannelTest::setUp()
 {
 }
@@ -647,6 +712,8 @@ CppUnit::Test* FileChannelTest::suite()
 	CppUnit_addTest(pSuite, FileChannelTest, testPurgeAge);
 	CppUnit_addTest(pSuite, FileChannelTest, testPurgeCount);
 	CppUnit_addTest(pSuite, FileChannelTest, testWrongPurgeOption);
+	CppUnit_addTest(pSuite, FileChannelTest, testAsync);
+	CppUnit_addTest(pSuite, FileChannelTest, testAsyncReopen);
 
 	return pSuite;
 }
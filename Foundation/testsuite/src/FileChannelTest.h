@@ -44,6 +44,8 @@ public:
 	void testPurgeAge();
 	void testPurgeCount();
 	void testWrongPurgeOption();
+	void testAsync();
+	void testAsyncReopen();
 
 	void setUp();
 	void tearDown();
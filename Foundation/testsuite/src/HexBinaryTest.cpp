@@ -13,12 +13,14 @@
 #include "Poco/CppUnit/TestSuite.h"
 #include "Poco/HexBinaryEncoder.h"
 #include "Poco/HexBinaryDecoder.h"
+#include "Poco/HexBinaryCodec.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
 using Poco::HexBinaryEncoder;
 using Poco::HexBinaryDecoder;
+using Poco::HexBinaryCodec;
 using Poco::DataFormatException;
 
 
@@ -183,6 +185,37 @@ void HexBinaryTest::testEncodeDecode()
 }
 
 
+void HexBinaryTest::testCodec()
+{
+	assertTrue (HexBinaryCodec::encode("", 0) == "");
+	assertTrue (HexBinaryCodec::encode("\x00\x01\xfe\xff", 4) == "0001feff");
+	assertTrue (HexBinaryCodec::encode("\x00\x01\xfe\xff", 4, HexBinaryCodec::OPT_UPPERCASE) == "0001FEFF");
+	assertTrue (HexBinaryCodec::encodedLength(4) == 8);
+
+	std::string decoded;
+	assertTrue (HexBinaryCodec::decode("0001feff", decoded));
+	assertTrue (decoded == std::string("\x00\x01\xfe\xff", 4));
+	assertTrue (HexBinaryCodec::decode("0001FEFF", decoded));
+	assertTrue (decoded == std::string("\x00\x01\xfe\xff", 4));
+	assertTrue (HexBinaryCodec::decode("00 01\r\nfe ff", decoded));
+	assertTrue (decoded == std::string("\x00\x01\xfe\xff", 4));
+	assertTrue (!HexBinaryCodec::decode("000z", decoded));
+	assertTrue (!HexBinaryCodec::decode("000", decoded));
+
+	// bulk output must match the stream encoder for arbitrary data
+	std::string src;
+	for (int i = 0; i < 255; ++i) src += char(i);
+	std::ostringstream str;
+	HexBinaryEncoder encoder(str);
+	encoder.rdbuf()->setLineLength(0);
+	encoder.write(src.data(), (std::streamsize) src.size());
+	encoder.close();
+	assertTrue (HexBinaryCodec::encode(src.data(), src.size()) == str.str());
+	assertTrue (HexBinaryCodec::decode(str.str(), decoded));
+	assertTrue (decoded == src);
+}
+
+
 void HexBinaryTest::setUp()
 {
 }
@@ -200,6 +233,7 @@ CppUnit::Test* HexBinaryTest::suite()
 	CppUnit_addTest(pSuite, HexBinaryTest, testEncoder);
 	CppUnit_addTest(pSuite, HexBinaryTest, testDecoder);
 	CppUnit_addTest(pSuite, HexBinaryTest, testEncodeDecode);
+	CppUnit_addTest(pSuite, HexBinaryTest, testCodec);
 
 	return pSuite;
 }
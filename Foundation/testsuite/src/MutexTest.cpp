@@ -13,6 +13,7 @@
 #include "Poco/CppUnit/TestSuite.h"
 #include "Poco/Exception.h"
 #include "Poco/Mutex.h"
+#include "Poco/AdaptiveMutex.h"
 #include "Poco/Runnable.h"
 #include "Poco/Thread.h"
 #include "Poco/Timestamp.h"
@@ -195,6 +196,63 @@ void MutexTest::testSpinlockMutex()
 }
 
 
+namespace
+{
+	class AdaptiveCountRunnable: public Runnable
+	{
+	public:
+		AdaptiveCountRunnable(Poco::AdaptiveMutex& mtx, long& counter):
+			_mtx(mtx),
+			_counter(counter)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < 10000; ++i)
+			{
+				Poco::AdaptiveMutex::ScopedLock lock(_mtx);
+				++_counter;
+			}
+		}
+
+	private:
+		Poco::AdaptiveMutex& _mtx;
+		long& _counter;
+	};
+}
+
+
+void MutexTest::testAdaptiveMutex()
+{
+	Poco::AdaptiveMutex mtx;
+	mtx.lock();
+
+	bool success = mtx.tryLock();
+	assertTrue (!success);
+
+	mtx.unlock();
+	assertTrue (mtx.tryLock());
+	mtx.unlock();
+
+	// the spin-then-park path must still be mutually exclusive
+	long counter = 0;
+	AdaptiveCountRunnable r1(mtx, counter);
+	AdaptiveCountRunnable r2(mtx, counter);
+	AdaptiveCountRunnable r3(mtx, counter);
+	Thread t1;
+	Thread t2;
+	Thread t3;
+	t1.start(r1);
+	t2.start(r2);
+	t3.start(r3);
+	t1.join();
+	t2.join();
+	t3.join();
+	assertTrue (counter == 30000);
+}
+
+
 void MutexTest::setUp()
 {
 }
@@ -212,6 +270,7 @@ CppUnit::Test* MutexTest::suite()
 	CppUnit_addTest(pSuite, MutexTest, testMutexRecursion);
 	CppUnit_addTest(pSuite, MutexTest, testRecursiveMutexRecursion);
 	CppUnit_addTest(pSuite, MutexTest, testSpinlockMutex);
+	CppUnit_addTest(pSuite, MutexTest, testAdaptiveMutex);
 
 	return pSuite;
 }
@@ -27,6 +27,7 @@ public:
 	void testMutexRecursion();
 	void testRecursiveMutexRecursion();
 	void testSpinlockMutex();
+	void testAdaptiveMutex();
 
 	void setUp();
 	void tearDown();
@@ -14,9 +14,11 @@
 #include "SemaphoreTest.h"
 #include "RWLockTest.h"
 #include "ThreadPoolTest.h"
+#include "ActiveThreadPoolTest.h"
 #include "TimerTest.h"
 #include "ThreadLocalTest.h"
 #include "ActivityTest.h"
+#include "CancellationTokenTest.h"
 #include "ActiveMethodTest.h"
 #include "ActiveDispatcherTest.h"
 #include "ConditionTest.h"
@@ -31,9 +33,11 @@ CppUnit::Test* ThreadingTestSuite::suite()
 	pSuite->addTest(SemaphoreTest::suite());
 	pSuite->addTest(RWLockTest::suite());
 	pSuite->addTest(ThreadPoolTest::suite());
+	pSuite->addTest(ActiveThreadPoolTest::suite());
 	pSuite->addTest(TimerTest::suite());
 	pSuite->addTest(ThreadLocalTest::suite());
 	pSuite->addTest(ActivityTest::suite());
+	pSuite->addTest(CancellationTokenTest::suite());
 	pSuite->addTest(ActiveMethodTest::suite());
 	pSuite->addTest(ActiveDispatcherTest::suite());
 	pSuite->addTest(ConditionTest::suite());
@@ -0,0 +1,94 @@
+//
+// CompiledQuery.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  CompiledQuery
+//
+// Definition of the CompiledQuery class.
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_JSONCompiledQuery_INCLUDED
+#define JSON_JSONCompiledQuery_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/JSON/Object.h"
+#include "Poco/JSON/Array.h"
+#include "Poco/Dynamic/Var.h"
+#include <vector>
+
+
+namespace Poco {
+namespace JSON {
+
+
+class JSON_API CompiledQuery
+	/// A pre-parsed counterpart of Query for paths evaluated
+	/// repeatedly against different documents.
+	///
+	/// Query::find() re-tokenizes the dotted path and re-matches
+	/// the [index] suffixes with a regular expression on every
+	/// call; a CompiledQuery parses the path into segment
+	/// operations once at construction:
+	///
+	///     CompiledQuery query("orders[0].customer.name");
+	///     for (...)
+	///         Dynamic::Var name = query.find(document);
+	///
+	/// The path syntax is that of Query::find(): dot-separated
+	/// member names, each optionally followed by one or more
+	/// [index] selectors.
+{
+public:
+	explicit CompiledQuery(const std::string& path);
+		/// Creates the CompiledQuery, parsing the given path.
+
+	~CompiledQuery();
+		/// Destroys the CompiledQuery.
+
+	Dynamic::Var find(const Dynamic::Var& source) const;
+		/// Evaluates the compiled path against the given document
+		/// (an Object, Array or pointer thereof). Returns an empty
+		/// Var when the path does not resolve.
+
+	const std::string& path() const;
+		/// Returns the original path string.
+
+	static void findAll(const std::vector<CompiledQuery>& queries, const Dynamic::Var& source, std::vector<Dynamic::Var>& results);
+		/// Evaluates all given queries against one document,
+		/// appending one result per query (empty Var for paths
+		/// that do not resolve) -- the rules-engine pattern of
+		/// applying a fixed path set to every incoming document.
+
+private:
+	struct Segment
+	{
+		std::string name;       // empty for a pure [index] segment
+		std::vector<int> indexes;
+	};
+
+	std::string _path;
+	std::vector<Segment> _segments;
+};
+
+
+//
+// inlines
+//
+inline const std::string& CompiledQuery::path() const
+{
+	return _path;
+}
+
+
+} } // namespace Poco::JSON
+
+
+#endif // JSON_JSONCompiledQuery_INCLUDED
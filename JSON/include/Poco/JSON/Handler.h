@@ -62,6 +62,17 @@ public:
 	virtual void key(const std::string& k) = 0;
 		/// A key of an object is read.
 
+	virtual void key(const char* k, std::size_t length);
+		/// A key of an object is read, given as a pointer into the
+		/// parser's token buffer. The pointer is only valid for the
+		/// duration of the call.
+		///
+		/// The default implementation copies the characters into a
+		/// std::string and calls key(const std::string&). Streaming
+		/// handlers that want to avoid a per-token allocation can
+		/// override this method (and the corresponding value()
+		/// overload) and work on the buffer directly.
+
 	virtual void null() = 0;
 		/// A null value is read.
 
@@ -84,6 +95,15 @@ public:
 	virtual void value(const std::string& value) = 0;
 		/// A string value is read.
 
+	virtual void value(const char* v, std::size_t length);
+		/// A string value is read, given as a pointer into the
+		/// parser's token buffer. The pointer is only valid for the
+		/// duration of the call.
+		///
+		/// The default implementation copies the characters into a
+		/// std::string and calls value(const std::string&); see
+		/// key(const char*, std::size_t).
+
 	virtual void value(double d) = 0;
 		/// A double value is read.
 
@@ -23,6 +23,7 @@
 #include "Poco/JSON/Stringifier.h"
 #include "Poco/JSONString.h"
 #include "Poco/SharedPtr.h"
+#include "Poco/Mutex.h"
 #include "Poco/Dynamic/Var.h"
 #include "Poco/Dynamic/Struct.h"
 #include "Poco/Nullable.h"
@@ -214,6 +215,23 @@ public:
 		/// When indent is 0, the object will be printed on a single
 		/// line without indentation.
 
+	const std::string& stringifyCached(unsigned int indent = 0) const;
+		/// Returns the serialized form of the object, caching it so
+		/// stringifying the same unchanged object repeatedly (e.g.
+		/// fanning one object out to thousands of clients) costs
+		/// one serialization and then shared-buffer reads.
+		///
+		/// The cache is invalidated by mutations made through this
+		/// object (set(), remove(), clear()). Mutating a nested
+		/// object or array through a pointer obtained from this one
+		/// does NOT invalidate it; do not use the cached form in
+		/// that pattern.
+		///
+		/// Concurrent stringifyCached() calls on the same object
+		/// are safe (the fanout pattern); mutation requires
+		/// external synchronization, as everywhere on Object.
+
+
 	void remove(const std::string& key);
 		/// Removes the property with the given key.
 
@@ -360,6 +378,9 @@ private:
 	mutable OrdStructPtr _pOrdStruct;
 #endif // POCO_ENABLE_CPP11
 	mutable bool         _modified;
+	mutable Poco::SharedPtr<std::string> _pSerialized;
+	mutable unsigned int _serializedIndent;
+	mutable Poco::FastMutex _serializedMutex; // guards the two above for concurrent readers
 };
 
 
@@ -466,6 +487,7 @@ inline void Object::remove(const std::string& key)
 		}
 	}
 	_modified = true;
+	_pSerialized = 0;
 }
 
 
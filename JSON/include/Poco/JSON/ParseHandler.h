@@ -61,6 +61,11 @@ public:
 	void key(const std::string& k);
 		/// A key is read
 
+	void key(const char* k, std::size_t length);
+		/// A key is read from the parser's token buffer; reuses
+		/// the internal key string's storage instead of creating
+		/// a temporary string.
+
 	Dynamic::Var asVar() const;
 		/// Returns the result of the parser (an object or an array).
 
@@ -113,6 +113,12 @@ public:
 	void render(const Dynamic::Var& data, std::ostream& out) const;
 		/// Renders the template and send the output to the stream.
 
+	void render(const Dynamic::Var& data, std::string& out) const;
+		/// Renders the template into the given string, which is
+		/// cleared first but keeps its capacity -- reusing one
+		/// string across renders avoids per-render stream and
+		/// buffer allocations.
+
 private:
 	std::string readText(std::istream& in);
 	std::string readWord(std::istream& in);
@@ -0,0 +1,91 @@
+//
+// CompiledQuery.cpp
+//
+// Library: JSON
+// Package: JSON
+// Module:  CompiledQuery
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSON/CompiledQuery.h"
+#include "Poco/StringTokenizer.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Exception.h"
+
+
+using Poco::Dynamic::Var;
+
+
+namespace Poco {
+namespace JSON {
+
+
+CompiledQuery::CompiledQuery(const std::string& path):
+	_path(path)
+{
+	Poco::StringTokenizer tokenizer(path, ".");
+	for (Poco::StringTokenizer::Iterator token = tokenizer.begin(); token != tokenizer.end(); ++token)
+	{
+		Segment segment;
+		std::string::size_type bracket = token->find('[');
+		segment.name = token->substr(0, bracket);
+		while (bracket != std::string::npos)
+		{
+			std::string::size_type close = token->find(']', bracket);
+			if (close == std::string::npos)
+				throw Poco::SyntaxException("unterminated index selector", _path);
+			segment.indexes.push_back(Poco::NumberParser::parse(token->substr(bracket + 1, close - bracket - 1)));
+			bracket = token->find('[', close);
+		}
+		_segments.push_back(segment);
+	}
+}
+
+
+CompiledQuery::~CompiledQuery()
+{
+}
+
+
+Var CompiledQuery::find(const Var& source) const
+{
+	Var result = source;
+	for (std::vector<Segment>::const_iterator it = _segments.begin(); it != _segments.end() && !result.isEmpty(); ++it)
+	{
+		if (!it->name.empty())
+		{
+			if (result.type() == typeid(Object::Ptr))
+				result = result.extract<Object::Ptr>()->get(it->name);
+			else if (result.type() == typeid(Object))
+				result = result.extract<Object>().get(it->name);
+			else
+				return Var();
+		}
+		for (std::vector<int>::const_iterator iit = it->indexes.begin(); iit != it->indexes.end() && !result.isEmpty(); ++iit)
+		{
+			if (result.type() == typeid(Array::Ptr))
+				result = result.extract<Array::Ptr>()->get(*iit);
+			else if (result.type() == typeid(Array))
+				result = result.extract<Array>().get(*iit);
+			else
+				return Var();
+		}
+	}
+	return result;
+}
+
+
+void CompiledQuery::findAll(const std::vector<CompiledQuery>& queries, const Var& source, std::vector<Var>& results)
+{
+	results.reserve(results.size() + queries.size());
+	for (std::vector<CompiledQuery>::const_iterator it = queries.begin(); it != queries.end(); ++it)
+		results.push_back(it->find(source));
+}
+
+
+} } // namespace Poco::JSON
@@ -30,6 +30,18 @@ Handler::~Handler()
 }
 
 
+void Handler::key(const char* k, std::size_t length)
+{
+	key(std::string(k, length));
+}
+
+
+void Handler::value(const char* v, std::size_t length)
+{
+	value(std::string(v, length));
+}
+
+
 Dynamic::Var Handler::asVar() const
 {
 	return Dynamic::Var();
@@ -28,7 +28,8 @@ namespace JSON {
 Object::Object(int options):
 	_preserveInsOrder(options & Poco::JSON_PRESERVE_KEY_ORDER),
 	_escapeUnicode(options & Poco::JSON_ESCAPE_UNICODE),
-	_modified(false)
+	_modified(false),
+	_serializedIndent(0)
 {
 }
 
@@ -37,7 +38,8 @@ Object::Object(const Object& other) : _values(other._values),
 	_preserveInsOrder(other._preserveInsOrder),
 	_escapeUnicode(other._escapeUnicode),
 	_pStruct(!other._modified ? other._pStruct : 0),
-	_modified(other._modified)
+	_modified(other._modified),
+	_serializedIndent(0)
 {
 	syncKeys(other._keys);
 }
@@ -49,7 +51,8 @@ Object::Object(Object&& other) :
 	_preserveInsOrder(other._preserveInsOrder),
 	_escapeUnicode(other._escapeUnicode),
 	_pStruct(!other._modified ? other._pStruct : 0),
-	_modified(other._modified)
+	_modified(other._modified),
+	_serializedIndent(0)
 {
 	other.clear();
 }
@@ -70,6 +73,8 @@ Object &Object::operator= (const Object &other)
 		_escapeUnicode = other._escapeUnicode;
 		_pStruct = !other._modified ? other._pStruct : 0;
 		_modified = other._modified;
+		Poco::FastMutex::ScopedLock lock(_serializedMutex);
+		_pSerialized = 0;
 	}
 	return *this;
 }
@@ -86,6 +91,8 @@ Object &Object::operator= (Object &&other)
 		_pStruct = !other._modified ? other._pStruct : 0;
 		_modified = other._modified;
 		other.clear();
+		Poco::FastMutex::ScopedLock lock(_serializedMutex);
+		_pSerialized = 0;
 	}
 	return *this;
 }
@@ -181,6 +188,20 @@ void Object::stringify(std::ostream& out, unsigned int indent, int step) const
 }
 
 
+const std::string& Object::stringifyCached(unsigned int indent) const
+{
+	Poco::FastMutex::ScopedLock lock(_serializedMutex);
+	if (!_pSerialized || _serializedIndent != indent)
+	{
+		std::ostringstream ostr;
+		stringify(ostr, indent);
+		_pSerialized = new std::string(ostr.str());
+		_serializedIndent = indent;
+	}
+	return *_pSerialized;
+}
+
+
 const std::string& Object::getKey(KeyList::const_iterator& iter) const
 {
 	ValueMap::const_iterator it = _values.begin();
@@ -197,18 +218,18 @@ const std::string& Object::getKey(KeyList::const_iterator& iter) const
 Object& Object::set(const std::string& key, const Dynamic::Var& value)
 {
 	std::pair<ValueMap::iterator, bool> ret = _values.insert(ValueMap::value_type(key, value));
-	if (!ret.second) ret.first->second = value;
-	if (_preserveInsOrder)
+	if (!ret.second)
+	{
+		// the key is already present (and, if insertion order is
+		// preserved, already in _keys); only the value changes
+		ret.first->second = value;
+	}
+	else if (_preserveInsOrder)
 	{
-		KeyList::iterator it = _keys.begin();
-		KeyList::iterator end = _keys.end();
-		for (; it != end; ++it)
-		{
-			if (key == (*it)->first) return *this;
-		}
 		_keys.push_back(ret.first);
 	}
 	_modified = true;
+	_pSerialized = 0;
 	return *this;
 }
 
@@ -349,6 +370,7 @@ void Object::clear()
 	_keys.clear();
 	_pStruct = 0;
 	_modified = true;
+	_pSerialized = 0;
 }
 
 
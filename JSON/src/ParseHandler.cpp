@@ -120,6 +120,12 @@ void ParseHandler::key(const std::string& k)
 }
 
 
+void ParseHandler::key(const char* k, std::size_t length)
+{
+	_key.assign(k, length);
+}
+
+
 void ParseHandler::setValue(const Var& value)
 {
 	if (_stack.size())
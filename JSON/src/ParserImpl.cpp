@@ -154,7 +154,13 @@ void ParserImpl::handleObject()
 	while (tok != JSON_OBJECT_END && checkError())
 	{
 		json_next(_pJSON);
-		if (_pHandler) _pHandler->key(std::string(json_get_string(_pJSON, NULL)));
+		if (_pHandler)
+		{
+			std::size_t length = 0;
+			const char* str = json_get_string(_pJSON, &length);
+			// length includes the terminating null character
+			_pHandler->key(str, length > 0 ? length - 1 : 0);
+		}
 		handle();
 		tok = json_peek(_pJSON);
 	}
@@ -201,7 +207,13 @@ void ParserImpl::handle()
 			break;
 		}
 		case JSON_STRING:
-			if (_pHandler) _pHandler->value(std::string(json_get_string(_pJSON, NULL)));
+			if (_pHandler)
+			{
+				std::size_t length = 0;
+				const char* str = json_get_string(_pJSON, &length);
+				// length includes the terminating null character
+				_pHandler->value(str, length > 0 ? length - 1 : 0);
+			}
 			break;
 		case JSON_OBJECT:
 			if (_pHandler) _pHandler->startObject();
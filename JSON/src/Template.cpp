@@ -15,6 +15,7 @@
 #include "Poco/JSON/Template.h"
 #include "Poco/JSON/TemplateCache.h"
 #include "Poco/JSON/Query.h"
+#include "Poco/JSON/CompiledQuery.h"
 #include "Poco/File.h"
 #include "Poco/FileStream.h"
 
@@ -42,6 +43,12 @@ public:
 
 	virtual void render(const Var& data, std::ostream& out) const = 0;
 
+	virtual void optimize()
+		/// Gives parts a chance to flatten themselves after
+		/// parsing; see MultiPart::optimize().
+	{
+	}
+
 	typedef std::vector<SharedPtr<Part> > VectorParts;
 };
 
@@ -71,6 +78,11 @@ public:
 		_content = content;
 	}
 
+	void appendContent(const std::string& content)
+	{
+		_content += content;
+	}
+
 	inline std::string getContent() const
 	{
 		return _content;
@@ -105,6 +117,30 @@ public:
 		}
 	}
 
+	void optimize()
+		/// Fuses runs of adjacent static parts into single strings
+		/// and recurses, so rendering static stretches costs one
+		/// write instead of one per parsed fragment.
+	{
+		VectorParts fused;
+		StringPart* pLast = 0;
+		for (VectorParts::iterator it = _parts.begin(); it != _parts.end(); ++it)
+		{
+			(*it)->optimize();
+			StringPart* pString = dynamic_cast<StringPart*>(it->get());
+			if (pString && pLast)
+			{
+				pLast->appendContent(pString->getContent());
+			}
+			else
+			{
+				fused.push_back(*it);
+				pLast = pString;
+			}
+		}
+		_parts.swap(fused);
+	}
+
 protected:
 	VectorParts _parts;
 };
@@ -114,6 +150,8 @@ class EchoPart: public Part
 {
 public:
 	EchoPart(const std::string& query): Part(), _query(query)
+		/// The query is compiled once here; render() then walks the
+		/// document without re-parsing the path.
 	{
 	}
 
@@ -123,8 +161,7 @@ public:
 
 	void render(const Var& data, std::ostream& out) const
 	{
-		Query query(data);
-		Var value = query.find(_query);
+		Var value = _query.find(data);
 
 		if (!value.isEmpty())
 		{
@@ -133,14 +170,14 @@ public:
 	}
 
 private:
-	std::string _query;
+	CompiledQuery _query;
 };
 
 
 class LogicQuery
 {
 public:
-	LogicQuery(const std::string& query): _queryString(query)
+	LogicQuery(const std::string& query): _query(query)
 	{
 	}
 
@@ -152,8 +189,7 @@ public:
 	{
 		bool logic = false;
 
-		Query query(data);
-		Var value = query.find(_queryString);
+		Var value = _query.find(data);
 
 		if (!value.isEmpty()) // When empty, logic will be false
 		{
@@ -177,7 +213,7 @@ public:
 	}
 
 protected:
-	std::string _queryString;
+	CompiledQuery _query;
 };
 
 
@@ -194,10 +230,7 @@ public:
 
 	virtual bool apply(const Var& data) const
 	{
-		Query query(data);
-		Var value = query.find(_queryString);
-
-		return !value.isEmpty();
+		return !_query.find(data).isEmpty();
 	}
 };
 
@@ -256,6 +289,14 @@ public:
 		}
 	}
 
+	void optimize()
+		/// Branch parts must stay index-aligned with their
+		/// queries, so only the children are optimized here.
+	{
+		for (VectorParts::iterator it = _parts.begin(); it != _parts.end(); ++it)
+			(*it)->optimize();
+	}
+
 private:
 	std::vector<SharedPtr<LogicQuery> > _queries;
 };
@@ -265,6 +306,7 @@ class LoopPart: public MultiPart
 {
 public:
 	LoopPart(const std::string& name, const std::string& query): MultiPart(), _name(name), _query(query)
+		/// The array query is compiled once at parse time.
 	{
 	}
 
@@ -274,12 +316,13 @@ public:
 
 	void render(const Var& data, std::ostream& out) const
 	{
-		Query query(data);
-
 		if (data.type() == typeid(Object::Ptr))
 		{
 			Object::Ptr dataObject = data.extract<Object::Ptr>();
-			Array::Ptr array = query.findArray(_query);
+			Array::Ptr array;
+			Var value = _query.find(data);
+			if (value.type() == typeid(Array::Ptr))
+				array = value.extract<Array::Ptr>();
 			if (!array.isNull())
 			{
 				for (int i = 0; i < array->size(); i++)
@@ -295,7 +338,7 @@ public:
 
 private:
 	std::string _name;
-	std::string _query;
+	CompiledQuery _query;
 };
 
 
@@ -573,6 +616,7 @@ void Template::parse(std::istream& in)
 			throw JSONTemplateException("Missing ?>");
 		}
 	}
+	_parts->optimize();
 }
 
 
@@ -698,4 +742,47 @@ void Template::render(const Var& data, std::ostream& out) const
 }
 
 
+namespace
+{
+	class StringSinkBuf: public std::streambuf
+		/// Appends everything written straight into a caller
+		/// string, bypassing ostringstream's internal buffering and
+		/// copy-out; the caller recycles the string's capacity
+		/// across renders.
+	{
+	public:
+		StringSinkBuf(std::string& target):
+			_target(target)
+		{
+		}
+
+	protected:
+		int_type overflow(int_type c)
+		{
+			if (c != traits_type::eof())
+				_target += traits_type::to_char_type(c);
+			return c;
+		}
+
+		std::streamsize xsputn(const char* s, std::streamsize count)
+		{
+			_target.append(s, static_cast<std::size_t>(count));
+			return count;
+		}
+
+	private:
+		std::string& _target;
+	};
+}
+
+
+void Template::render(const Var& data, std::string& out) const
+{
+	out.clear();
+	StringSinkBuf buf(out);
+	std::ostream ostr(&buf);
+	_parts->render(data, ostr);
+}
+
+
 } } // namespace Poco::JSON
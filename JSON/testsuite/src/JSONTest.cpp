@@ -1527,6 +1527,46 @@ void JSONTest::testStringify()
 }
 
 
+void JSONTest::testStringifyCached()
+{
+	Object obj;
+	obj.set("key", 1);
+	assertTrue (obj.stringifyCached() == "{\"key\":1}");
+	// the cached form is reused while the object is unchanged
+	assertTrue (obj.stringifyCached() == "{\"key\":1}");
+
+	// any mutation invalidates the cache
+	obj.set("key", 2);
+	assertTrue (obj.stringifyCached() == "{\"key\":2}");
+	obj.remove("key");
+	assertTrue (obj.stringifyCached() == "{}");
+
+	// a different indent is not served from the cache
+	obj.set("key", 3);
+	std::string compact = obj.stringifyCached();
+	assertTrue (compact == "{\"key\":3}");
+	std::string indented = obj.stringifyCached(1);
+	assertTrue (indented != compact);
+
+	// assignment replaces the cached form along with the contents
+	Object obj2;
+	obj2.set("key", 4);
+	obj.stringifyCached();
+	obj = obj2;
+	assertTrue (obj.stringifyCached() == "{\"key\":4}");
+	Object obj3;
+	obj3.set("key", 5);
+	obj = std::move(obj3);
+	assertTrue (obj.stringifyCached() == "{\"key\":5}");
+
+	// copies do not share the source's cache
+	obj.stringifyCached();
+	Object obj4(obj);
+	obj4.set("key", 6);
+	assertTrue (obj4.stringifyCached() == "{\"key\":6}");
+}
+
+
 void JSONTest::testStringifyPreserveOrder()
 {
 	Object presObj(Poco::JSON_PRESERVE_KEY_ORDER);
@@ -2206,6 +2246,7 @@ CppUnit::Test* JSONTest::suite()
 	CppUnit_addTest(pSuite, JSONTest, testComment);
 	CppUnit_addTest(pSuite, JSONTest, testPrintHandler);
 	CppUnit_addTest(pSuite, JSONTest, testStringify);
+	CppUnit_addTest(pSuite, JSONTest, testStringifyCached);
 	CppUnit_addTest(pSuite, JSONTest, testStringifyPreserveOrder);
 	CppUnit_addTest(pSuite, JSONTest, testValidJanssonFiles);
 	CppUnit_addTest(pSuite, JSONTest, testInvalidJanssonFiles);
@@ -135,6 +135,14 @@ public:
 		/// Used for one-way requests without a response.
 
 	void sendRequest(RequestMessage& request, ResponseMessage& response);
+		/// Sends a request to the MongoDB server and receives the response.
+		/// Use this when a response is expected: only a "query" or "getmore"
+		/// request will return a response.
+
+	void readResponse(ResponseMessage& response);
+		/// Reads a response from the MongoDB server for a request
+		/// previously sent with sendRequest(RequestMessage&), allowing
+		/// requests to be pipelined (see Cursor::setPrefetch()).
 		/// Sends a request to the MongoDB server and receives the response.
 		///
 		/// Use this when a response is expected: only a "query" or "getmore"
@@ -50,12 +50,25 @@ public:
 	QueryRequest& query();
 		/// Returns the associated query.
 
+	void setPrefetch(bool enable);
+		/// Enables or disables batch prefetching. With prefetching
+		/// enabled, the request for the next batch is pipelined to
+		/// the server as soon as a batch arrives, so the server
+		/// prepares (and the network carries) the next batch while
+		/// the current one is being processed, instead of next()
+		/// paying a full round trip after each batch is exhausted.
+
+	bool getPrefetch() const;
+		/// Returns true if batch prefetching is enabled.
+
 	void kill(Connection& connection);
 		/// Kills the cursor and reset it so that it can be reused.
 
 private:
 	QueryRequest    _query;
 	ResponseMessage _response;
+	bool            _prefetch = false;
+	bool            _requestInFlight = false;
 };
 
 
@@ -0,0 +1,130 @@
+//
+// DocumentView.h
+//
+// Library: MongoDB
+// Package: MongoDB
+// Module:  DocumentView
+//
+// Definition of the DocumentView class.
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef MongoDB_DocumentView_INCLUDED
+#define MongoDB_DocumentView_INCLUDED
+
+
+#include "Poco/MongoDB/MongoDB.h"
+#include "Poco/MongoDB/Document.h"
+#include <map>
+#include <string>
+
+
+namespace Poco {
+namespace MongoDB {
+
+
+class MongoDB_API DocumentView
+	/// A lazy, read-only view over a raw BSON document.
+	///
+	/// In contrast to Document::read(), which deserializes every
+	/// BSON element into a heap-allocated ConcreteElement up front,
+	/// a DocumentView keeps the raw BSON bytes and resolves elements
+	/// by scanning them on demand. Elements that are never accessed
+	/// are never decoded and the element offset index is only built
+	/// as far as lookups require, which makes the view suitable for
+	/// consumers that extract a few fields from large documents
+	/// (e.g. filtering a change stream).
+	///
+	/// The view does not own the buffer; the raw BSON bytes must
+	/// stay valid and unmodified for the lifetime of the view and
+	/// of any subviews obtained from it.
+{
+public:
+	DocumentView(const char* bson, std::size_t size);
+		/// Creates a DocumentView for the given raw BSON bytes
+		/// (starting with the document's int32 size field).
+		/// Throws a Poco::DataFormatException if the buffer is
+		/// shorter than the document's declared size.
+
+	~DocumentView();
+		/// Destroys the DocumentView.
+
+	bool has(const std::string& name) const;
+		/// Returns true if the document contains an element with
+		/// the given name.
+
+	double getDouble(const std::string& name) const;
+		/// Returns the value of the double element with the given
+		/// name. Throws a Poco::NotFoundException if there is no
+		/// such element, or a Poco::BadCastException if it has a
+		/// different type.
+
+	Int32 getInt32(const std::string& name) const;
+		/// Returns the value of the int32 element with the given name.
+
+	Int64 getInt64(const std::string& name) const;
+		/// Returns the value of the int64 element with the given name.
+
+	std::string getString(const std::string& name) const;
+		/// Returns the value of the string element with the given name.
+
+	bool getBool(const std::string& name) const;
+		/// Returns the value of the boolean element with the given name.
+
+	DocumentView getView(const std::string& name) const;
+		/// Returns a DocumentView for the embedded document or array
+		/// element with the given name. The returned view shares
+		/// this view's buffer.
+
+	void toDocument(Document& document) const;
+		/// Fully deserializes the viewed BSON bytes into the given
+		/// Document, for code that needs the eager representation
+		/// after all.
+
+	std::size_t size() const;
+		/// Returns the size of the viewed BSON document in bytes.
+
+private:
+	struct ElementRef
+	{
+		unsigned char type;
+		std::size_t offset; // of the element payload
+	};
+
+	bool find(const std::string& name, ElementRef& ref) const;
+		/// Looks the element up in the offset index, scanning
+		/// further into the document as needed.
+
+	std::size_t skipValue(unsigned char type, std::size_t offset) const;
+		/// Returns the offset of the first byte after the value of
+		/// the given type starting at offset.
+
+	Int32 readInt32(std::size_t offset) const;
+	Int64 readInt64(std::size_t offset) const;
+	const ElementRef& refFor(const std::string& name, unsigned char type) const;
+
+	const char* _bson;
+	std::size_t _size;
+	mutable std::size_t _scanPos;
+	mutable std::map<std::string, ElementRef> _index;
+};
+
+
+//
+// inlines
+//
+inline std::size_t DocumentView::size() const
+{
+	return _size;
+}
+
+
+} } // namespace Poco::MongoDB
+
+
+#endif // MongoDB_DocumentView_INCLUDED
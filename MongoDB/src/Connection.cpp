@@ -226,7 +226,12 @@ void Connection::sendRequest(RequestMessage& request)
 void Connection::sendRequest(RequestMessage& request, ResponseMessage& response)
 {
 	sendRequest(request);
+	readResponse(response);
+}
+
 
+void Connection::readResponse(ResponseMessage& response)
+{
 	Poco::Net::SocketInputStream sis(_socket);
 	response.read(sis);
 }
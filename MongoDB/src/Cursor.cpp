@@ -47,7 +47,15 @@ Cursor::~Cursor()
 
 ResponseMessage& Cursor::next(Connection& connection)
 {
-	if (_response.cursorID() == 0)
+	if (_requestInFlight)
+	{
+		// the next batch was pipelined when the previous one
+		// arrived; just collect it
+		_response.clear();
+		connection.readResponse(_response);
+		_requestInFlight = false;
+	}
+	else if (_response.cursorID() == 0)
 	{
 		connection.sendRequest(_query, _response);
 	}
@@ -58,12 +66,46 @@ ResponseMessage& Cursor::next(Connection& connection)
 		_response.clear();
 		connection.sendRequest(getMore, _response);
 	}
+	if (_prefetch && _response.cursorID() != 0)
+	{
+		Poco::MongoDB::GetMoreRequest getMore(_query.fullCollectionName(), _response.cursorID());
+		getMore.setNumberToReturn(_query.getNumberToReturn());
+		connection.sendRequest(getMore);
+		_requestInFlight = true;
+	}
 	return _response;
 }
 
 
+void Cursor::setPrefetch(bool enable)
+{
+	_prefetch = enable;
+}
+
+
+bool Cursor::getPrefetch() const
+{
+	return _prefetch;
+}
+
+
 void Cursor::kill(Connection& connection)
 {
+	if (_requestInFlight)
+	{
+		// drain the pipelined batch so the connection stays usable
+		ResponseMessage pending;
+		connection.readResponse(pending);
+		_requestInFlight = false;
+		if (pending.cursorID() != 0)
+		{
+			KillCursorsRequest killRequest;
+			killRequest.cursors().push_back(pending.cursorID());
+			connection.sendRequest(killRequest);
+		}
+		_response.clear();
+		return;
+	}
 	if (_response.cursorID() != 0)
 	{
 		KillCursorsRequest killRequest;
@@ -0,0 +1,224 @@
+//
+// DocumentView.cpp
+//
+// Library: MongoDB
+// Package: MongoDB
+// Module:  DocumentView
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/MongoDB/DocumentView.h"
+#include "Poco/MemoryStream.h"
+#include "Poco/BinaryReader.h"
+#include "Poco/Exception.h"
+#include <cstring>
+
+
+namespace Poco {
+namespace MongoDB {
+
+
+DocumentView::DocumentView(const char* bson, std::size_t size):
+	_bson(bson),
+	_size(0),
+	_scanPos(4)
+{
+	poco_check_ptr (bson);
+
+	if (size < 5)
+		throw DataFormatException("BSON document too short");
+	Int32 declared = readInt32(0);
+	if (declared < 5 || static_cast<std::size_t>(declared) > size)
+		throw DataFormatException("BSON document size field out of range");
+	_size = static_cast<std::size_t>(declared);
+}
+
+
+DocumentView::~DocumentView()
+{
+}
+
+
+Int32 DocumentView::readInt32(std::size_t offset) const
+{
+	Int32 value;
+	std::memcpy(&value, _bson + offset, sizeof(value));
+	return value;
+}
+
+
+Int64 DocumentView::readInt64(std::size_t offset) const
+{
+	Int64 value;
+	std::memcpy(&value, _bson + offset, sizeof(value));
+	return value;
+}
+
+
+std::size_t DocumentView::skipValue(unsigned char type, std::size_t offset) const
+{
+	switch (type)
+	{
+	case 0x01: // double
+	case 0x09: // UTC datetime
+	case 0x11: // timestamp
+	case 0x12: // int64
+		return offset + 8;
+	case 0x02: // string
+	case 0x0D: // JavaScript code
+	case 0x0E: // symbol
+		return offset + 4 + static_cast<std::size_t>(readInt32(offset));
+	case 0x03: // embedded document
+	case 0x04: // array
+	case 0x0F: // code with scope
+		return offset + static_cast<std::size_t>(readInt32(offset));
+	case 0x05: // binary
+		return offset + 4 + 1 + static_cast<std::size_t>(readInt32(offset));
+	case 0x06: // undefined
+	case 0x0A: // null
+	case 0x7F: // max key
+	case 0xFF: // min key
+		return offset;
+	case 0x07: // ObjectId
+		return offset + 12;
+	case 0x08: // boolean
+		return offset + 1;
+	case 0x0B: // regular expression: two cstrings
+	{
+		std::size_t end = offset;
+		while (end < _size && _bson[end] != '\0') ++end;
+		++end;
+		while (end < _size && _bson[end] != '\0') ++end;
+		return end + 1;
+	}
+	case 0x0C: // DBPointer: string + ObjectId
+		return offset + 4 + static_cast<std::size_t>(readInt32(offset)) + 12;
+	case 0x10: // int32
+		return offset + 4;
+	case 0x13: // decimal128
+		return offset + 16;
+	default:
+		throw DataFormatException("Unknown BSON element type");
+	}
+}
+
+
+bool DocumentView::find(const std::string& name, ElementRef& ref) const
+{
+	std::map<std::string, ElementRef>::const_iterator it = _index.find(name);
+	if (it != _index.end())
+	{
+		ref = it->second;
+		return true;
+	}
+
+	// continue scanning where the last lookup stopped
+	while (_scanPos + 1 < _size && _bson[_scanPos] != '\0')
+	{
+		unsigned char type = static_cast<unsigned char>(_bson[_scanPos]);
+		std::size_t nameBegin = _scanPos + 1;
+		std::size_t nameEnd = nameBegin;
+		while (nameEnd < _size && _bson[nameEnd] != '\0') ++nameEnd;
+		if (nameEnd >= _size)
+			throw DataFormatException("Unterminated BSON element name");
+
+		ElementRef entry;
+		entry.type = type;
+		entry.offset = nameEnd + 1;
+		_scanPos = skipValue(type, entry.offset);
+		if (_scanPos > _size)
+			throw DataFormatException("BSON element exceeds document size");
+
+		std::string elementName(_bson + nameBegin, nameEnd - nameBegin);
+		_index[elementName] = entry;
+		if (elementName == name)
+		{
+			ref = entry;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+const DocumentView::ElementRef& DocumentView::refFor(const std::string& name, unsigned char type) const
+{
+	std::map<std::string, ElementRef>::const_iterator it = _index.find(name);
+	if (it == _index.end())
+	{
+		ElementRef ref;
+		if (!find(name, ref)) throw NotFoundException(name);
+		it = _index.find(name);
+	}
+	if (it->second.type != type) throw BadCastException(name);
+	return it->second;
+}
+
+
+bool DocumentView::has(const std::string& name) const
+{
+	ElementRef ref;
+	return find(name, ref);
+}
+
+
+double DocumentView::getDouble(const std::string& name) const
+{
+	const ElementRef& ref = refFor(name, 0x01);
+	double value;
+	std::memcpy(&value, _bson + ref.offset, sizeof(value));
+	return value;
+}
+
+
+Int32 DocumentView::getInt32(const std::string& name) const
+{
+	return readInt32(refFor(name, 0x10).offset);
+}
+
+
+Int64 DocumentView::getInt64(const std::string& name) const
+{
+	return readInt64(refFor(name, 0x12).offset);
+}
+
+
+std::string DocumentView::getString(const std::string& name) const
+{
+	const ElementRef& ref = refFor(name, 0x02);
+	Int32 length = readInt32(ref.offset); // includes the terminating null
+	if (length < 1 || ref.offset + 4 + length > _size)
+		throw DataFormatException("BSON string length out of range");
+	return std::string(_bson + ref.offset + 4, static_cast<std::size_t>(length - 1));
+}
+
+
+bool DocumentView::getBool(const std::string& name) const
+{
+	return _bson[refFor(name, 0x08).offset] != '\0';
+}
+
+
+DocumentView DocumentView::getView(const std::string& name) const
+{
+	ElementRef ref;
+	if (!find(name, ref)) throw NotFoundException(name);
+	if (ref.type != 0x03 && ref.type != 0x04) throw BadCastException(name);
+	return DocumentView(_bson + ref.offset, _size - ref.offset);
+}
+
+
+void DocumentView::toDocument(Document& document) const
+{
+	Poco::MemoryInputStream istr(_bson, _size);
+	Poco::BinaryReader reader(istr, BinaryReader::LITTLE_ENDIAN_BYTE_ORDER);
+	document.read(reader);
+}
+
+
+} } // namespace Poco::MongoDB
@@ -22,6 +22,7 @@
 #include "Poco/Net/SocketDefs.h"
 #include "Poco/Net/IPAddress.h"
 #include "Poco/Net/HostEntry.h"
+#include "Poco/ActiveMethod.h"
 
 
 namespace Poco {
@@ -83,6 +84,30 @@ public:
 		///
 		/// Throws an IOException in case of any other error.
 		
+	static HostEntry hostByNameCached(const std::string& hostname);
+		/// Like hostByName(), but consults an in-process cache
+		/// first, so hot paths (e.g. client reconnects) do not
+		/// stall on resolver latency for recently used names.
+		///
+		/// Cache entries expire after the timeout set with
+		/// setCacheTimeout() (default 60 seconds). Failed lookups
+		/// are cached as well (negative caching) for the timeout
+		/// set with setNegativeCacheTimeout() (default 10 seconds)
+		/// and re-throw a HostNotFoundException until they expire,
+		/// protecting the resolver from lookup storms during
+		/// dependency failovers.
+
+	static void setCacheTimeout(long seconds);
+		/// Sets the time-to-live for positive entries in the
+		/// hostByNameCached() cache.
+
+	static void setNegativeCacheTimeout(long seconds);
+		/// Sets the time-to-live for negative entries in the
+		/// hostByNameCached() cache.
+
+	static void flushNameCache();
+		/// Removes all entries from the hostByNameCached() cache.
+
 	static HostEntry hostByAddress(const IPAddress& address, unsigned hintFlags =
 #ifdef POCO_HAVE_ADDRINFO
 		DNS_HINT_AI_CANONNAME | DNS_HINT_AI_ADDRCONFIG
@@ -193,6 +218,39 @@ protected:
 };
 
 
+class Net_API DNSResolver
+	/// Asynchronous, cache-backed name resolution.
+	///
+	/// resolve() is an ActiveMethod: it returns immediately with an
+	/// ActiveResult future while a pooled thread performs the
+	/// (cached) lookup, so callers can overlap resolution with other
+	/// work or enforce their own timeouts:
+	///
+	///     DNSResolver resolver;
+	///     Poco::ActiveResult<HostEntry> result = resolver.resolve("poco.example.com");
+	///     ...
+	///     result.wait();
+	///     HostEntry entry = result.data();
+{
+public:
+	DNSResolver();
+		/// Creates the DNSResolver.
+
+	~DNSResolver();
+		/// Destroys the DNSResolver.
+
+	Poco::ActiveMethod<HostEntry, std::string, DNSResolver> resolve;
+		/// Resolves the given host name asynchronously through
+		/// DNS::hostByNameCached().
+
+private:
+	DNSResolver(const DNSResolver&);
+	DNSResolver& operator = (const DNSResolver&);
+
+	HostEntry resolveImpl(const std::string& hostname);
+};
+
+
 } } // namespace Poco::Net
 
 
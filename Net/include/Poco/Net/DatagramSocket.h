@@ -177,6 +177,23 @@ public:
 		///
 		/// Returns the number of bytes received.
 
+	int sendMultiple(DatagramVec& datagrams, int flags = 0);
+		/// Sends one datagram per entry to the entry's address,
+		/// using a single sendmmsg() system call where available
+		/// (Linux) and a sendTo() loop elsewhere. Each entry's
+		/// length field receives the number of bytes sent.
+		///
+		/// Returns the number of datagrams sent.
+
+	int receiveMultiple(DatagramVec& datagrams, int flags = 0);
+		/// Receives up to one datagram per entry into the entry's
+		/// buffers, using a single recvmmsg() system call where
+		/// available (Linux); elsewhere a single datagram is
+		/// received. Each filled entry holds the sender address
+		/// and the number of bytes received.
+		///
+		/// Returns the number of datagrams received.
+
 	void setBroadcast(bool flag);
 		/// Sets the value of the SO_BROADCAST socket option.
 		///
@@ -41,6 +41,8 @@ public:
 
 private:
 	static Poco::MemoryPool _pool;
+
+	friend class HTTPBufferMagazine;
 };
 
 
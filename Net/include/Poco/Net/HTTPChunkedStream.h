@@ -53,6 +53,8 @@ private:
 	openmode        _mode;
 	std::streamsize _chunk;
 	std::string     _chunkBuffer;
+	bool            _closing = false;
+	bool            _terminated = false;
 };
 
 
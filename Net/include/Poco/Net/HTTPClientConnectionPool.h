@@ -0,0 +1,125 @@
+//
+// HTTPClientConnectionPool.h
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPClientConnectionPool
+//
+// Definition of the HTTPClientConnectionPool class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPClientConnectionPool_INCLUDED
+#define Net_HTTPClientConnectionPool_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/URI.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Timespan.h"
+#include "Poco/Mutex.h"
+#include <map>
+#include <vector>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API HTTPClientConnectionPool
+	/// A pool of keep-alive HTTPClientSession objects, keyed by
+	/// scheme, host and port.
+	///
+	/// Instead of creating a new HTTPClientSession (and paying the
+	/// TCP, and for HTTPS the TLS, handshake) for every outbound
+	/// request, borrow a session from the pool, send the request,
+	/// and return the session with release(). Released keep-alive
+	/// sessions are kept warm and handed out again for the same
+	/// scheme/host/port; before reuse, the socket is validated with
+	/// a zero-timeout poll so connections closed by the peer are
+	/// detected and discarded cheaply.
+	///
+	/// Sessions are created through the default HTTPSessionFactory,
+	/// so HTTPS pooling works if an HTTPS session instantiator has
+	/// been registered.
+	///
+	/// The pool bounds both the number of idle sessions kept per
+	/// host and the total number of idle sessions; beyond those,
+	/// released sessions are simply closed. Idle sessions older
+	/// than the idle timeout are closed on the next borrow() or
+	/// release() for their host.
+{
+public:
+	typedef Poco::SharedPtr<HTTPClientSession> SessionPtr;
+
+	HTTPClientConnectionPool(int maxIdlePerHost = 8, int maxIdleTotal = 64, const Poco::Timespan& idleTimeout = Poco::Timespan(30, 0));
+		/// Creates the HTTPClientConnectionPool with the given
+		/// per-host and total idle-session bounds and idle timeout.
+
+	~HTTPClientConnectionPool();
+		/// Destroys the HTTPClientConnectionPool and closes all
+		/// idle sessions.
+
+	SessionPtr borrow(const Poco::URI& uri);
+		/// Returns a session for the given URI's scheme, host and
+		/// port, reusing a pooled keep-alive session if a healthy
+		/// one is available, otherwise creating a new one through
+		/// the default HTTPSessionFactory.
+
+	void release(SessionPtr pSession);
+		/// Returns a borrowed session to the pool.
+		///
+		/// Sessions that are no longer connected, have seen a
+		/// network exception, or do not fit within the pool's
+		/// bounds are closed instead of being pooled.
+
+	int idleSessions() const;
+		/// Returns the total number of idle sessions in the pool.
+
+	void closeIdle();
+		/// Closes and removes all idle sessions.
+
+	static HTTPClientConnectionPool& defaultPool();
+		/// Returns the default HTTPClientConnectionPool.
+
+private:
+	struct IdleSession
+	{
+		SessionPtr pSession;
+		Poco::Timestamp idleSince;
+	};
+
+	typedef std::vector<IdleSession> SessionVec;
+	typedef std::map<std::string, SessionVec> SessionMap;
+
+	HTTPClientConnectionPool(const HTTPClientConnectionPool&);
+	HTTPClientConnectionPool& operator = (const HTTPClientConnectionPool&);
+
+	static std::string key(const Poco::URI& uri);
+	void evictExpired(SessionVec& sessions);
+	static bool validate(SessionPtr& pSession);
+		/// Returns true if the pooled session's socket is still
+		/// usable: connected, and not readable (a readable idle
+		/// keep-alive socket means the peer has closed the
+		/// connection or sent stray data).
+
+	int _maxIdlePerHost;
+	int _maxIdleTotal;
+	Poco::Timespan _idleTimeout;
+	int _idleCount;
+	SessionMap _sessions;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPClientConnectionPool_INCLUDED
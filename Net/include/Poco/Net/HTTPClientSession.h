@@ -22,6 +22,8 @@
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/SharedPtr.h"
+#include "Poco/InflatingStream.h"
+#include <deque>
 #include <istream>
 #include <ostream>
 
@@ -205,8 +207,26 @@ public:
 	static const ProxyConfig& getGlobalProxyConfig();
 		/// Returns the global proxy configuration.
 
+	void setResponseDecompression(bool enable);
+		/// Enables or disables transparent response body
+		/// decompression (disabled by default).
+		///
+		/// With decompression enabled, sendRequest() adds an
+		/// "Accept-Encoding: gzip, deflate" header to requests that
+		/// do not carry one, and receiveResponse() returns an
+		/// already-decoded stream for responses with a matching
+		/// Content-Encoding (the response object's headers are left
+		/// untouched; its Content-Length, if any, refers to the
+		/// compressed body). The inflate state is allocated once
+		/// per session and reused across requests.
+
+	bool getResponseDecompression() const;
+		/// Returns true if transparent response decompression
+		/// is enabled.
+
 	void setKeepAliveTimeout(const Poco::Timespan& timeout);
 		/// Sets the connection timeout for HTTP connections.
+
 		
 	const Poco::Timespan& getKeepAliveTimeout() const;
 		/// Returns the connection timeout for HTTP connections.
@@ -255,6 +275,41 @@ public:
 		/// to ensure a new connection will be set up
 		/// for the next request.
 		
+	virtual std::size_t pipelineRequest(HTTPRequest& request);
+		/// Sends the given HTTP request to the server without
+		/// waiting for the response, so that several requests can
+		/// be in flight on the same keep-alive connection.
+		/// Returns the number of pipelined requests whose
+		/// responses are still outstanding.
+		///
+		/// The HTTPClientSession will set the request's
+		/// Host and Keep-Alive headers accordingly.
+		///
+		/// Only requests without a message body can be pipelined;
+		/// a request with a content length or chunked transfer
+		/// encoding causes a NetException to be thrown, as does
+		/// pipelining on a session with keep-alive disabled.
+		///
+		/// Responses must be collected in request order with
+		/// receivePipelinedResponse(). The regular sendRequest()
+		/// must not be called while pipelined responses are
+		/// outstanding.
+
+	virtual std::istream& receivePipelinedResponse(HTTPResponse& response);
+		/// Receives the response for the oldest request sent with
+		/// pipelineRequest() whose response has not been received
+		/// yet. Throws a NetException if no pipelined request is
+		/// outstanding.
+		///
+		/// The returned input stream is valid until the next
+		/// receivePipelinedResponse(), sendRequest() or until the
+		/// session is destroyed, and must be fully consumed before
+		/// the next response is received.
+
+	std::size_t pipelinedRequests() const;
+		/// Returns the number of pipelined requests whose
+		/// responses have not yet been received.
+
 	virtual bool peekResponse(HTTPResponse& response);
 		/// If the request contains a "Expect: 100-continue" header,
 		/// (see HTTPRequest::setExpectContinue()) this method can be
@@ -343,6 +398,10 @@ private:
 	bool            _responseReceived;
 	Poco::SharedPtr<std::ostream> _pRequestStream;
 	Poco::SharedPtr<std::istream> _pResponseStream;
+	bool _responseDecompression;
+	int  _inflateType;
+	Poco::SharedPtr<Poco::InflatingInputStream> _pInflateStream;
+	std::deque<bool> _pipeline; // response-body expectations, in request order
 
 	static ProxyConfig _globalProxyConfig;
 	
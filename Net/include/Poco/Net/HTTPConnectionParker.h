@@ -0,0 +1,108 @@
+//
+// HTTPConnectionParker.h
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPConnectionParker
+//
+// Definition of the HTTPConnectionParker class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPConnectionParker_INCLUDED
+#define Net_HTTPConnectionParker_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/PollSet.h"
+#include "Poco/Net/TCPServerConnectionFactory.h"
+#include "Poco/Net/TCPServerConnection.h"
+#include "Poco/Thread.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Timespan.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Mutex.h"
+#include <atomic>
+#include <map>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API HTTPConnectionParker: public Poco::Runnable
+	/// Parks idle HTTP keep-alive connections so they do not occupy
+	/// a server thread while waiting for the client's next request.
+	///
+	/// With keep-alive parking enabled (see
+	/// HTTPServerParams::setKeepAliveParking()), an
+	/// HTTPServerConnection that has served a request and finds no
+	/// further data pending hands its socket to the parker and
+	/// returns its pooled thread. The parker watches all parked
+	/// sockets with a single PollSet; when a socket becomes readable,
+	/// a fresh server connection is created for it and run on the
+	/// parker's thread pool, and sockets idle beyond the keep-alive
+	/// timeout are closed. The number of concurrent keep-alive
+	/// clients is then bounded by sockets, not threads.
+{
+public:
+	HTTPConnectionParker(TCPServerConnectionFactory* pFactory, const Poco::Timespan& idleTimeout, int maxThreads = 16);
+		/// Creates the HTTPConnectionParker and starts its watcher
+		/// thread. Resumed connections are served by an internal
+		/// thread pool with the given maximum size.
+		///
+		/// The factory must outlive the parker (the factory owns
+		/// the parker in the intended setup).
+
+	~HTTPConnectionParker();
+		/// Stops the watcher thread and closes all parked
+		/// connections.
+
+	void park(const StreamSocket& socket);
+		/// Parks the given connection until it becomes readable
+		/// or its idle timeout expires.
+
+	int parkedConnections() const;
+		/// Returns the number of currently parked connections.
+
+	void run();
+		/// The watcher loop; called by the internal thread.
+
+	void startConnection(TCPServerConnection* pConnection);
+		/// Runs the given connection; for internal use by the
+		/// parker's resume machinery.
+
+	void closeAll();
+		/// Closes all currently parked connections; called when the
+		/// server is stopped with abortCurrent semantics.
+
+private:
+	HTTPConnectionParker(const HTTPConnectionParker&);
+	HTTPConnectionParker& operator = (const HTTPConnectionParker&);
+
+	void resume(const StreamSocket& socket);
+
+	typedef std::map<poco_socket_t, std::pair<StreamSocket, Poco::Timestamp> > ParkedMap;
+
+	TCPServerConnectionFactory* _pFactory;
+	Poco::Timespan _idleTimeout;
+	PollSet _pollSet;
+	ParkedMap _parked;
+	mutable Poco::FastMutex _mutex;
+	Poco::ThreadPool _pool;
+	Poco::Thread _thread;
+	std::atomic<bool> _stopped;
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPConnectionParker_INCLUDED
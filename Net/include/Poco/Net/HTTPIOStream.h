@@ -19,6 +19,7 @@
 
 
 #include "Poco/Net/Net.h"
+#include "Poco/SharedPtr.h"
 #include "Poco/Net/HTTPResponse.h"
 #include "Poco/UnbufferedStreamBuf.h"
 
@@ -75,10 +76,18 @@ class Net_API HTTPResponseStream: public HTTPResponseIOS, public std::istream
 public:
 	HTTPResponseStream(std::istream& istr, HTTPClientSession* pSession);
 		
+	HTTPResponseStream(std::istream& istr, const Poco::SharedPtr<HTTPClientSession>& pPooledSession);
+		/// Creates a response stream over a session borrowed from
+		/// the default HTTPClientConnectionPool. When the stream is
+		/// destroyed after the response has been fully read, the
+		/// session is returned to the pool for keep-alive reuse;
+		/// partially consumed responses close the connection.
+
 	~HTTPResponseStream();
 	
 private:
 	HTTPClientSession* _pSession;
+	Poco::SharedPtr<HTTPClientSession> _pPooledSession;
 };
 
 
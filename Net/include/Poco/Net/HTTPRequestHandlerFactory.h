@@ -62,6 +62,7 @@ public:
 
 protected:
 	Poco::BasicEvent<const bool> serverStopped;
+	Poco::BasicEvent<const bool> serverDraining;
 
 private:
 	HTTPRequestHandlerFactory(const HTTPRequestHandlerFactory&);
@@ -69,6 +70,7 @@ private:
 	
 	friend class HTTPServer;
 	friend class HTTPServerConnection;
+	friend class HTTPServerConnectionFactory;
 };
 
 
@@ -82,6 +82,20 @@ public:
 	~HTTPServer();
 		/// Destroys the HTTPServer and its HTTPRequestHandlerFactory.
 
+	int drain(const Poco::Timespan& timeout);
+		/// Gracefully drains the server for a rolling restart:
+		/// stops accepting new connections, closes parked idle
+		/// keep-alive connections, and makes every response sent
+		/// from now on carry "Connection: close", so well-behaved
+		/// clients reconnect elsewhere after their in-flight
+		/// request completes. Then waits, up to the given timeout,
+		/// for current connections to finish.
+		///
+		/// Returns the number of connections still open when the
+		/// timeout expired (0 for a clean drain). Stragglers --
+		/// typically connections idle inside their keep-alive
+		/// timeout -- can then be cut with stopAll(true).
+
 	void stopAll(bool abortCurrent = false);
 		/// Stops the server. In contrast to TCPServer::stop(), which also
 		/// stops the server, but allows all client connections to finish at
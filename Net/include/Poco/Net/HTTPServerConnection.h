@@ -31,6 +31,7 @@ namespace Net {
 
 
 class HTTPServerSession;
+class HTTPConnectionParker;
 
 
 class Net_API HTTPServerConnection: public TCPServerConnection
@@ -38,8 +39,11 @@ class Net_API HTTPServerConnection: public TCPServerConnection
 	/// connections.
 {
 public:
-	HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory);
-		/// Creates the HTTPServerConnection.
+	HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, HTTPConnectionParker* pParker = 0);
+		/// Creates the HTTPServerConnection. If a parker is given
+		/// and keep-alive parking is enabled, idle keep-alive
+		/// connections are handed to it instead of blocking this
+		/// connection's thread.
 
 	virtual ~HTTPServerConnection();
 		/// Destroys the HTTPServerConnection.
@@ -50,11 +54,14 @@ public:
 protected:
 	void sendErrorResponse(HTTPServerSession& session, HTTPResponse::HTTPStatus status);
 	void onServerStopped(const bool& abortCurrent);
+	void onServerDraining(const bool& graceful);
 
 private:
 	HTTPServerParams::Ptr          _pParams;
 	HTTPRequestHandlerFactory::Ptr _pFactory;
+	HTTPConnectionParker*          _pParker;
 	bool _stopped;
+	bool _draining;
 	Poco::FastMutex _mutex;
 };
 
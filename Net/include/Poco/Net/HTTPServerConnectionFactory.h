@@ -22,6 +22,8 @@
 #include "Poco/Net/TCPServerConnectionFactory.h"
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
 #include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPConnectionParker.h"
+#include "Poco/SharedPtr.h"
 
 
 namespace Poco {
@@ -42,10 +44,16 @@ public:
 	TCPServerConnection* createConnection(const StreamSocket& socket);
 		/// Creates an instance of HTTPServerConnection
 		/// using the given StreamSocket.
+
+	void onServerStopped(const bool& abortCurrent);
+	void onServerDraining(const bool& graceful);
+		/// Closes parked connections when the server is stopped
+		/// with abortCurrent semantics.
 	
 private:
 	HTTPServerParams::Ptr          _pParams;
 	HTTPRequestHandlerFactory::Ptr _pFactory;
+	Poco::SharedPtr<HTTPConnectionParker> _pParker;
 };
 
 
@@ -0,0 +1,60 @@
+//
+// HTTPServerMetricsHandler.h
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPServerMetricsHandler
+//
+// Definition of the HTTPServerMetricsHandler class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPServerMetricsHandler_INCLUDED
+#define Net_HTTPServerMetricsHandler_INCLUDED
+
+
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/TCPServer.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API HTTPServerMetricsHandler: public HTTPRequestHandler
+	/// A request handler exposing a TCPServer's (and therefore an
+	/// HTTPServer's) operational counters -- current/total
+	/// connections, queued and refused connections, thread usage --
+	/// as a plain-text metrics document in the widely understood
+	/// "name value" exposition format.
+	///
+	/// Mount it for an admin path in the application's request
+	/// handler factory:
+	///
+	///     if (request.getURI() == "/metrics")
+	///         return new HTTPServerMetricsHandler(myServer);
+	///
+	/// The server reference must outlive the handler factory.
+{
+public:
+	explicit HTTPServerMetricsHandler(TCPServer& server);
+		/// Creates the HTTPServerMetricsHandler for the
+		/// given server.
+
+	void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response);
+		/// Sends the metrics document.
+
+private:
+	TCPServer& _server;
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPServerMetricsHandler_INCLUDED
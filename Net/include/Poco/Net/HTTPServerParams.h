@@ -85,6 +85,39 @@ public:
 	const Poco::Timespan& getKeepAliveTimeout() const;
 		/// Returns the connection timeout for HTTP connections.
 	
+	void setTcpNoDelay(bool noDelay);
+		/// Enables or disables TCP_NODELAY on accepted server
+		/// connections (enabled by default).
+		///
+		/// Responses are assembled in user-space buffers before
+		/// hitting the socket, so disabling Nagle's algorithm does
+		/// not create excessive small packets but removes the
+		/// 40 ms delayed-ACK stalls that Nagle interaction causes
+		/// on request/response traffic.
+
+	bool getTcpNoDelay() const;
+		/// Returns true if TCP_NODELAY is set on accepted
+		/// connections.
+
+	void setKeepAliveParking(bool parking);
+		/// Enables or disables keep-alive connection parking.
+		///
+		/// When enabled, a server connection that has served a
+		/// request and finds no further data pending hands its
+		/// socket to a shared HTTPConnectionParker and releases its
+		/// pooled thread; the connection resumes on a fresh thread
+		/// when the client sends the next request. Idle keep-alive
+		/// clients then hold sockets instead of threads, lifting
+		/// the concurrent-client ceiling of the thread-per-
+		/// connection model.
+		///
+		/// Must be set before the HTTPServer is created.
+		/// Default is disabled.
+
+	bool getKeepAliveParking() const;
+		/// Returns true if keep-alive connection parking is
+		/// enabled.
+
 	void setMaxKeepAliveRequests(int maxKeepAliveRequests);
 		/// Specifies the maximum number of requests allowed
 		/// during a persistent connection. 0 means unlimited
@@ -105,6 +138,8 @@ private:
 	Poco::Timespan _timeout;
 	bool           _keepAlive;
 	int            _maxKeepAliveRequests;
+	bool           _keepAliveParking;
+	bool           _tcpNoDelay;
 	Poco::Timespan _keepAliveTimeout;
 };
 
@@ -142,6 +177,18 @@ inline int HTTPServerParams::getMaxKeepAliveRequests() const
 }
 
 
+inline bool HTTPServerParams::getKeepAliveParking() const
+{
+	return _keepAliveParking;
+}
+
+
+inline bool HTTPServerParams::getTcpNoDelay() const
+{
+	return _tcpNoDelay;
+}
+
+
 inline const Poco::Timespan& HTTPServerParams::getKeepAliveTimeout() const
 {
 	return _keepAliveTimeout;
@@ -47,6 +47,10 @@ public:
 	
 	bool canKeepAlive() const;
 		/// Returns true if the session can be kept alive.
+
+	bool hasBufferedData() const;
+		/// Returns true if unconsumed input (e.g. a pipelined
+		/// request) is buffered in the session.
 	
 	SocketAddress clientAddress();
 		/// Returns the client's address.
@@ -70,6 +74,12 @@ inline bool HTTPServerSession::canKeepAlive() const
 }
 
 
+inline bool HTTPServerSession::hasBufferedData() const
+{
+	return buffered() > 0;
+}
+
+
 } } // namespace Poco::Net
 
 
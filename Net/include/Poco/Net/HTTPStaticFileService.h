@@ -0,0 +1,146 @@
+//
+// HTTPStaticFileService.h
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPStaticFileService
+//
+// Definition of the HTTPStaticFileService and HTTPStaticFileHandler classes.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPStaticFileService_INCLUDED
+#define Net_HTTPStaticFileService_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Timespan.h"
+#include "Poco/Mutex.h"
+#include <map>
+#include <string>
+
+
+namespace Poco {
+namespace Net {
+
+
+class HTTPServerRequest;
+class HTTPServerResponse;
+
+
+class Net_API HTTPStaticFileService
+	/// A production static-file service: everything every
+	/// hand-rolled file handler reimplements, in one place.
+	///
+	/// Supported out of the box:
+	///   - ETag (from file size and modification time) and
+	///     Last-Modified, with If-None-Match and If-Modified-Since
+	///     conditional handling (304);
+	///   - single-range requests (206/Content-Range, 416 on
+	///     unsatisfiable ranges);
+	///   - HEAD requests;
+	///   - content types by extension (common built-ins,
+	///     extensible via addContentType());
+	///   - directory index files (default index.html);
+	///   - a TTL-bounded stat/ETag cache, so hot files do not stat
+	///     per request;
+	///   - path traversal protection;
+	///   - full responses go out through
+	///     HTTPServerResponse::sendFile(), i.e. the zero-copy
+	///     sendfile path on Linux.
+	///
+	/// One service instance (holding config and caches) is shared
+	/// by all requests; wire it into a server by returning
+	/// createHandler() from a HTTPRequestHandlerFactory:
+	///
+	///     HTTPRequestHandler* MyFactory::createRequestHandler(const HTTPServerRequest& request)
+	///     {
+	///         return _fileService.createHandler();
+	///     }
+{
+public:
+	HTTPStaticFileService(const std::string& rootPath);
+		/// Creates the service, serving files from rootPath.
+
+	~HTTPStaticFileService();
+		/// Destroys the HTTPStaticFileService.
+
+	void setIndexFile(const std::string& indexFile);
+		/// Sets the file served for directory requests
+		/// (default "index.html"; empty disables).
+
+	void setCacheTimeout(const Poco::Timespan& timeout);
+		/// Sets the stat/ETag cache TTL (default 1 second, which
+		/// bounds how long a changed file can be served stale;
+		/// zero disables caching).
+
+	void addContentType(const std::string& extension, const std::string& contentType);
+		/// Maps a (lower-case, dot-less) file extension to a
+		/// content type, overriding or extending the built-ins.
+
+	HTTPRequestHandler* createHandler();
+		/// Returns a new request handler serving through this
+		/// service. The service must outlive the server.
+
+	void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response);
+		/// Serves the given request; usable directly from an
+		/// existing handler as well.
+
+	void flushCache();
+		/// Drops all cached file metadata.
+
+private:
+	struct FileInfo
+	{
+		bool exists;
+		bool isDirectory;
+		Poco::UInt64 size;
+		Poco::Timestamp lastModified;
+		std::string etag;
+		Poco::Timestamp cachedAt;
+	};
+
+	HTTPStaticFileService(const HTTPStaticFileService&);
+	HTTPStaticFileService& operator = (const HTTPStaticFileService&);
+
+	bool resolve(const std::string& uriPath, std::string& fsPath) const;
+	bool statFile(const std::string& fsPath, FileInfo& info);
+	const std::string& contentTypeFor(const std::string& fsPath) const;
+	void sendRange(HTTPServerRequest& request, HTTPServerResponse& response, const std::string& fsPath, const FileInfo& info, const std::string& rangeHeader);
+
+	std::string _rootPath;
+	std::string _indexFile;
+	Poco::Timespan _cacheTimeout;
+	std::map<std::string, std::string> _contentTypes;
+	std::map<std::string, FileInfo> _statCache;
+	Poco::FastMutex _cacheMutex;
+};
+
+
+class Net_API HTTPStaticFileHandler: public HTTPRequestHandler
+	/// The per-request handler handed out by
+	/// HTTPStaticFileService::createHandler().
+{
+public:
+	HTTPStaticFileHandler(HTTPStaticFileService& service);
+		/// Creates the handler.
+
+	void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response);
+		/// Delegates to the service.
+
+private:
+	HTTPStaticFileService& _service;
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPStaticFileService_INCLUDED
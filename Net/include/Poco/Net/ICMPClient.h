@@ -20,6 +20,7 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/ICMPSocket.h"
+#include "Poco/SharedPtr.h"
 #include "Poco/Net/ICMPEventArgs.h"
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/BasicEvent.h"
@@ -45,6 +46,10 @@ public:
 	mutable Poco::BasicEvent<ICMPEventArgs> pingEnd;
 
 	explicit ICMPClient(SocketAddress::Family family, int dataSize = 48, int ttl = 128, int timeout = 50000);
+		/// Creates an ICMP client. The client's raw socket is
+		/// created on first use and reused across ping() calls, so
+		/// probing many endpoints does not create and tear down a
+		/// raw socket per sequence.
 		/// Creates an ICMP client.
 
 	~ICMPClient();
@@ -88,6 +93,7 @@ private:
 	int _dataSize;
 	int _ttl;
 	int _timeout;
+	mutable Poco::SharedPtr<ICMPSocket> _pSocket; /// reused across ping() calls
 };
 
 
@@ -34,9 +34,10 @@ class MultiSocketPoller
 	/// state, the reading/error handling actions are delegated to the reader.
 {
 public:
-	MultiSocketPoller(typename UDPHandlerImpl<S>::List& handlers, const Poco::Net::SocketAddress& sa, int nSockets = 10, Poco::Timespan timeout = 250000):
+	MultiSocketPoller(typename UDPHandlerImpl<S>::List& handlers, const Poco::Net::SocketAddress& sa, int nSockets = 10, Poco::Timespan timeout = 250000, int batchSize = 1):
 		_address(sa),
 		_timeout(timeout),
+		_batchSize(batchSize),
 		_reader(handlers)
 		/// Creates the MutiSocketPoller.
 	{
@@ -47,6 +48,7 @@ public:
 	MultiSocketPoller(typename UDPHandlerImpl<S>::List& handlers, const UDPServerParams& serverParams):
 		_address(serverParams.address()),
 		_timeout(serverParams.timeout()),
+		_batchSize(serverParams.batchSize()),
 		_reader(handlers)
 		/// Creates the MutiSocketPoller.
 	{
@@ -86,7 +88,10 @@ public:
 			if (it->second & PollSet::POLL_READ)
 			{
 				DatagramSocket ds(it->first);
-				_reader.read(ds);
+				if (_batchSize > 1)
+					_reader.readMany(ds, _batchSize);
+				else
+					_reader.read(ds);
 			}
 			else if (it->second & PollSet::POLL_ERROR)
 			{
@@ -118,6 +123,7 @@ private:
 	PollSet            _pollSet;
 	SocketAddress      _address;
 	Poco::Timespan     _timeout;
+	int                _batchSize;
 	UDPSocketReader<S> _reader;
 };
 
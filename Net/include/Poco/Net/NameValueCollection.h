@@ -21,6 +21,7 @@
 #include "Poco/Net/Net.h"
 #include "Poco/String.h"
 #include "Poco/ListMap.h"
+#include <map>
 #include <cstddef>
 
 
@@ -67,7 +68,14 @@ public:
 		
 	void add(const std::string& name, const std::string& value);
 		/// Adds a new name-value pair with the given name and value.
-		
+
+	void add(const std::string& name, std::string&& value);
+		/// Adds a new name-value pair with the given name, moving
+		/// the given value into the collection.
+		///
+		/// This overload avoids copying the value string and is
+		/// used on the header parsing hot path.
+
 	const std::string& get(const std::string& name) const;
 		/// Returns the value of the first name-value pair with the given name.
 		///
@@ -107,7 +115,22 @@ public:
 		/// Removes all name-value pairs and their values.
 
 private:
+	typedef std::map<std::string, HeaderMap::ConstIterator> NameIndex;
+
+	ConstIterator lookup(const std::string& name) const;
+		/// Finds the first entry with the given name, using the
+		/// lazily built case-folded index for large collections.
+
+	void invalidateIndex();
+
+	enum
+	{
+		INDEX_THRESHOLD = 12 /// build the index above this size
+	};
+
 	HeaderMap _map;
+	mutable NameIndex _index;
+	mutable bool _indexValid = false;
 };
 
 
@@ -250,6 +250,14 @@ public:
 		/// with the given index does not exist.
 
 	static List list(bool ipOnly = true, bool upOnly = true);
+		/// Returns a list of all network interfaces.
+
+	static List cachedList(long maxAgeMilliseconds = 1000, bool ipOnly = true, bool upOnly = true);
+		/// Like list(), but serves results from a cache refreshed at
+		/// most every maxAgeMilliseconds, so per-connection callers
+		/// (e.g. source-address selection) do not re-enumerate the
+		/// system's interfaces on every call. Pass 0 to force a
+		/// refresh.
 		/// Returns a list with all network interfaces
 		/// on the system.
 		///
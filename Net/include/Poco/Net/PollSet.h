@@ -44,10 +44,24 @@ public:
 		POLL_ERROR = 0x04
 	};
 
+	enum TriggerMode
+	{
+		TRIGGER_LEVEL = 0, /// report readiness as long as it persists (default)
+		TRIGGER_EDGE  = 1  /// report readiness only on state transitions
+	};
+
 	typedef std::map<Poco::Net::Socket, int> SocketModeMap;
 
-	PollSet();
+	explicit PollSet(TriggerMode triggerMode = TRIGGER_LEVEL);
 		/// Creates an empty PollSet.
+		///
+		/// If triggerMode is TRIGGER_EDGE and the epoll backend is
+		/// used, sockets are registered edge-triggered (EPOLLET) and
+		/// poll() only reports state transitions, so its cost scales
+		/// with the number of ready sockets rather than the number of
+		/// watched sockets. The poll() and select() backends do not
+		/// support edge-triggered operation and silently fall back to
+		/// level-triggered mode.
 
 	~PollSet();
 		/// Destroys the PollSet.
@@ -69,6 +83,11 @@ public:
 	bool empty() const;
 		/// Returns true if no socket is registered for polling.
 
+	TriggerMode triggerMode() const;
+		/// Returns the effective trigger mode. For backends without
+		/// edge-triggered support this is always TRIGGER_LEVEL,
+		/// regardless of the mode given to the constructor.
+
 	void clear();
 		/// Removes all sockets from the PollSet.
 
@@ -19,6 +19,11 @@
 
 
 #include "Poco/Net/Net.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Thread.h"
+#include "Poco/RunnableAdapter.h"
+#include "Poco/Event.h"
+#include <deque>
 #include "Poco/Channel.h"
 #include "Poco/Mutex.h"
 #include "Poco/Net/DatagramSocket.h"
@@ -108,6 +113,12 @@ public:
 		
 	void log(const Message& msg);
 		/// Sends the message's text to the syslog service.
+		///
+		/// With the default UDP transport, the message is sent as
+		/// one datagram immediately. With the TCP transport, the
+		/// message is queued and a background thread sends batches
+		/// with RFC 6587 octet-counted framing, reconnecting with
+		/// exponential backoff when the collector goes away.
 		
 	void setProperty(const std::string& name, const std::string& value);
 		/// Sets the property with the given value.
@@ -121,6 +132,13 @@ public:
 		///                  by a colon) can also be specified.
 		///     * host:      (optional) Host name included in syslog messages. If not specified, the host's real domain name or
 		///                  IP address will be used.
+		///     * transport: "udp" (default; one datagram per message) or "tcp" (RFC 6587 octet-counted
+		///                  framing with batching, a bounded send queue and reconnect backoff).
+		///     * batchSize: Maximum number of messages per TCP batch (default 100).
+		///     * flushInterval: Maximum time in milliseconds a queued message waits for its batch (default 1000).
+		///     * queueSize: Bound of the TCP send queue in messages (default 10000); when the collector
+		///                  is unreachable long enough for the queue to fill, the newest messages are dropped
+		///                  (see droppedCount()).
 		
 	std::string getProperty(const std::string& name) const;
 		/// Returns the value of the property with the given name.
@@ -128,16 +146,30 @@ public:
 	static void registerChannel();
 		/// Registers the channel with the global LoggingFactory.
 
+	Poco::UInt64 droppedCount() const;
+		/// Returns the number of messages dropped because the
+		/// bounded TCP send queue was full.
+
 	static const std::string PROP_NAME;
 	static const std::string PROP_FACILITY;
 	static const std::string PROP_FORMAT;
 	static const std::string PROP_LOGHOST;
 	static const std::string PROP_HOST;
+	static const std::string PROP_TRANSPORT;
+	static const std::string PROP_BATCH_SIZE;
+	static const std::string PROP_FLUSH_INTERVAL;
+	static const std::string PROP_QUEUE_SIZE;
 	static const std::string STRUCTURED_DATA;
 
 protected:
 	~RemoteSyslogChannel();
 	static int getPrio(const Message& msg);
+	void formatMessage(const Message& msg, std::string& m);
+	void runSender();
+		/// The TCP sender thread: drains the queue in batches,
+		/// framing each message per RFC 6587, and reconnects with
+		/// exponential backoff on failure.
+	bool sendBatch(const std::string& batch);
 
 private:
 	std::string _logHost;
@@ -145,10 +177,23 @@ private:
 	std::string _host;
 	int  _facility;
 	bool _bsdFormat;
+	bool _tcp;
+	int  _batchSize;
+	int  _flushInterval;
+	std::size_t _queueLimit;
 	DatagramSocket _socket;
+	StreamSocket _tcpSocket;
+	bool _tcpConnected;
 	SocketAddress _socketAddress;
 	bool _open;
+	std::deque<std::string> _queue;
+	Poco::UInt64 _dropped;
+	Poco::Event _queueEvent;
+	Poco::Thread _senderThread;
+	Poco::RunnableAdapter<RemoteSyslogChannel> _senderAdapter;
+	bool _stopSender;
 	mutable Poco::FastMutex _mutex;
+	mutable Poco::FastMutex _queueMutex;
 };
 
 
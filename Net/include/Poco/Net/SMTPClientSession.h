@@ -186,18 +186,33 @@ protected:
 	void loginUsingXOAUTH2(const std::string& username, const std::string& password);
 	DialogSocket& socket();
 
+public:
+	bool supportsPipelining() const;
+		/// Returns true if the server advertised the PIPELINING
+		/// extension (RFC 2920) in its EHLO response; the envelope
+		/// commands of sendMessage() are then sent in one batch
+		/// and their responses collected together, saving one
+		/// round trip per recipient.
+
 private:
 	void sendCommands(const MailMessage& message, const Recipients* pRecipients = 0);
 	void transportMessage(const MailMessage& message);
 
 	DialogSocket _socket;
 	bool         _isOpen;
+	bool         _pipelining = false;
 };
 
 
 //
 // inlines
 //
+inline bool SMTPClientSession::supportsPipelining() const
+{
+	return _pipelining;
+}
+
+
 inline bool SMTPClientSession::isPositiveCompletion(int status)
 {
 	return status/100 == SMTP_POSITIVE_COMPLETION;
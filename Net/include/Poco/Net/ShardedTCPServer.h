@@ -0,0 +1,159 @@
+//
+// ShardedTCPServer.h
+//
+// Library: Net
+// Package: TCPServer
+// Module:  ShardedTCPServer
+//
+// Definition of the ShardedTCPServer class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_ShardedTCPServer_INCLUDED
+#define Net_ShardedTCPServer_INCLUDED
+
+
+#include "Poco/Net/TCPServer.h"
+#include <vector>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API ShardedTCPServer
+	/// This class implements a sharded multithreaded TCP server.
+	///
+	/// A plain TCPServer funnels every accepted connection through a
+	/// single accept thread and a single dispatcher queue, which
+	/// becomes a bottleneck at very high connection rates. A
+	/// ShardedTCPServer instead runs N independent TCPServer shards,
+	/// each with its own acceptor thread, connection queue and thread
+	/// pool, so the accept path has no shared lock and load is spread
+	/// across cores by the kernel.
+	///
+	/// On platforms supporting the SO_REUSEPORT socket option, every
+	/// shard binds its own listening socket to the same port and the
+	/// kernel distributes incoming connections between the shards.
+	/// Where SO_REUSEPORT is not available, all shards accept from a
+	/// single shared listening socket; this still removes the
+	/// dispatcher bottleneck, at the cost of some accept contention
+	/// in the kernel.
+	///
+	/// The number of shards is configured with
+	/// TCPServerParams::setShardCount(). All shards share the given
+	/// TCPServerParams object, but each shard creates its own
+	/// TCPServerConnection objects through the shared
+	/// TCPServerConnectionFactory, which must therefore be
+	/// thread-safe (factories normally are, as TCPServer already
+	/// calls them from multiple dispatcher threads).
+{
+public:
+	ShardedTCPServer(TCPServerConnectionFactory::Ptr pFactory, Poco::UInt16 portNumber, TCPServerParams::Ptr pParams = 0);
+		/// Creates the ShardedTCPServer, with shard listening sockets
+		/// bound to the given port.
+		///
+		/// The number of shards is taken from the given
+		/// TCPServerParams object (see TCPServerParams::setShardCount());
+		/// if no TCPServerParams object is given, a single shard is
+		/// created, making the server behave like a plain TCPServer.
+		///
+		/// Each shard is given its own thread pool, sized according
+		/// to TCPServerParams::getMaxThreads().
+
+	~ShardedTCPServer();
+		/// Destroys the ShardedTCPServer and its shards.
+
+	const TCPServerParams& params() const;
+		/// Returns a const reference to the TCPServerParam object
+		/// shared by all shards.
+
+	void start();
+		/// Starts all shards.
+		///
+		/// Before start() is called, the listening sockets are
+		/// already bound and in listening state.
+
+	void stop();
+		/// Stops all shards.
+		///
+		/// No new connections will be accepted.
+		/// Already handled connections will continue to be served.
+		///
+		/// Once the server has been stopped, it cannot be restarted.
+
+	int shardCount() const;
+		/// Returns the number of shards.
+
+	TCPServer& shard(int index);
+		/// Returns the TCPServer for the shard with the given index.
+
+	int currentThreads() const;
+		/// Returns the number of currently used connection threads,
+		/// summed over all shards.
+
+	int totalConnections() const;
+		/// Returns the total number of handled connections,
+		/// summed over all shards.
+
+	int currentConnections() const;
+		/// Returns the number of currently handled connections,
+		/// summed over all shards.
+
+	int queuedConnections() const;
+		/// Returns the number of queued connections,
+		/// summed over all shards.
+
+	int refusedConnections() const;
+		/// Returns the number of refused connections,
+		/// summed over all shards.
+
+	Poco::UInt16 port() const;
+		/// Returns the port the shard sockets listen on.
+
+	void setConnectionFilter(const TCPServerConnectionFilter::Ptr& pFilter);
+		/// Sets a TCPServerConnectionFilter on all shards. Can also be
+		/// used to remove a filter by passing a null pointer.
+		///
+		/// To avoid a potential race condition, the filter must
+		/// be set before the ShardedTCPServer is started. Trying to
+		/// set the filter after start() has been called will trigger
+		/// an assertion.
+
+private:
+	ShardedTCPServer();
+	ShardedTCPServer(const ShardedTCPServer&);
+	ShardedTCPServer& operator = (const ShardedTCPServer&);
+
+	typedef std::vector<TCPServer*> ShardVec;
+	typedef std::vector<Poco::ThreadPool*> PoolVec;
+
+	ShardVec _shards;
+	PoolVec  _pools;
+};
+
+
+//
+// inlines
+//
+inline int ShardedTCPServer::shardCount() const
+{
+	return static_cast<int>(_shards.size());
+}
+
+
+inline TCPServer& ShardedTCPServer::shard(int index)
+{
+	return *_shards.at(index);
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_ShardedTCPServer_INCLUDED
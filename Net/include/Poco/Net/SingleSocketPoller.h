@@ -47,7 +47,7 @@ public:
 		/// Creates the SingleSocketPoller and binds it to
 		/// the given address.
 	{
-		_socket.bind(serverParams.address(), false, false);
+		_socket.bind(serverParams.address(), serverParams.reusePort(), serverParams.reusePort());
 		_socket.setBlocking(false);
 	}
 
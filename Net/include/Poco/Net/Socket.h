@@ -223,6 +223,29 @@ public:
 	void getLinger(bool& on, int& seconds) const;
 		/// Returns the value of the SO_LINGER socket option.
 	
+	void setReceiveTimestamping(bool flag);
+		/// Enables or disables kernel receive timestamping
+		/// (SO_TIMESTAMPNS where available); see
+		/// SocketImpl::setReceiveTimestamping().
+
+	bool getReceiveTimestamping();
+		/// Returns true if kernel receive timestamping is enabled.
+
+	void setBusyPoll(int microseconds);
+		/// Sets the kernel busy-poll duration for blocking receives
+		/// (SO_BUSY_POLL where available); see
+		/// SocketImpl::setBusyPoll().
+
+	int getBusyPoll();
+		/// Returns the configured busy-poll duration.
+
+	void setZeroCopy(bool flag);
+		/// Enables zero-copy sends (SO_ZEROCOPY where available);
+		/// see SocketImpl::setZeroCopy().
+
+	bool getZeroCopy();
+		/// Returns true if zero-copy sends are enabled.
+
 	void setNoDelay(bool flag);
 		/// Sets the value of the TCP_NODELAY socket option.
 		
@@ -421,6 +444,42 @@ inline int Socket::available() const
 }
 
 
+inline void Socket::setReceiveTimestamping(bool flag)
+{
+	impl()->setReceiveTimestamping(flag);
+}
+
+
+inline bool Socket::getReceiveTimestamping()
+{
+	return impl()->getReceiveTimestamping();
+}
+
+
+inline void Socket::setBusyPoll(int microseconds)
+{
+	impl()->setBusyPoll(microseconds);
+}
+
+
+inline void Socket::setZeroCopy(bool flag)
+{
+	impl()->setZeroCopy(flag);
+}
+
+
+inline bool Socket::getZeroCopy()
+{
+	return impl()->getZeroCopy();
+}
+
+
+inline int Socket::getBusyPoll()
+{
+	return impl()->getBusyPoll();
+}
+
+
 inline void Socket::setSendBufferSize(int size)
 {
 	_pImpl->setSendBufferSize(size);
@@ -39,6 +39,15 @@ class Net_API SocketAddress
 	/// address. The address can belong either to the
 	/// IPv4 or the IPv6 address family and consists of a
 	/// host address and a port number.
+	///
+	/// SocketAddress is a small-value type: the address
+	/// implementation lives in inline storage inside the object
+	/// (no heap allocation and no reference counting), so creating
+	/// and copying addresses in high-rate receive paths costs a
+	/// constructor call on local memory. Note that the inline
+	/// implementations are polymorphic, so the type is not
+	/// trivially copyable; copy it with its copy constructor, not
+	/// memcpy.
 {
 public:
 	// The following declarations keep the Family type
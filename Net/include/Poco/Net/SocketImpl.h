@@ -21,6 +21,7 @@
 #include "Poco/Net/Net.h"
 #include "Poco/Net/SocketDefs.h"
 #include "Poco/Net/SocketAddress.h"
+#include <atomic>
 #include "Poco/RefCountedObject.h"
 #include "Poco/Timespan.h"
 #include "Poco/Buffer.h"
@@ -30,6 +31,48 @@ namespace Poco {
 namespace Net {
 
 
+struct Datagram
+	/// A single datagram in a batched send or receive
+	/// (see SocketImpl::sendMultiple() and receiveMultiple()).
+{
+	SocketBufVec  buffers; /// scatter/gather buffers holding the payload
+	SocketAddress address; /// destination (send) or sender (receive) address
+	int           length;  /// number of payload bytes sent or received
+};
+
+typedef std::vector<Datagram> DatagramVec;
+
+
+struct SocketHooks
+	/// Process-wide socket lifecycle callbacks for
+	/// instrumentation; see SocketImpl::setSocketHooks().
+	///
+	/// Each member may be a null pointer; only non-null hooks are
+	/// invoked. Hooks run on the thread performing the socket
+	/// operation and must be fast and non-throwing. Durations are
+	/// measured with Poco::Clock (monotonic, microsecond
+	/// resolution).
+{
+	void (*connectStart)(poco_socket_t sockfd, const SocketAddress& address);
+		/// Invoked before a connect attempt begins.
+
+	void (*connectComplete)(poco_socket_t sockfd, const SocketAddress& address, Poco::Int64 durationMicroseconds, int errorCode);
+		/// Invoked when a blocking connect attempt finishes,
+		/// successfully (errorCode 0) or not.
+
+	void (*accept)(poco_socket_t sockfd);
+		/// Invoked for every accepted connection.
+
+	void (*close)(poco_socket_t sockfd);
+		/// Invoked when a socket is closed.
+
+	void (*error)(poco_socket_t sockfd, int errorCode);
+		/// Invoked when a socket operation is about to throw.
+		/// The descriptor is POCO_INVALID_SOCKET when the error is
+		/// reported from a context without one.
+};
+
+
 class Net_API SocketImpl: public Poco::RefCountedObject
 	/// This class encapsulates the Berkeley sockets API.
 	///
@@ -240,6 +283,26 @@ public:
 		///
 		/// Always returns zero for platforms where not implemented.
 
+	virtual int sendMultiple(DatagramVec& datagrams, int flags = 0);
+		/// Sends one datagram per Datagram entry to the respective
+		/// destination address, using a single sendmmsg() system
+		/// call where available (Linux) and a sendTo() loop
+		/// elsewhere. On return, each entry's length field holds
+		/// the number of bytes sent for that datagram.
+		///
+		/// Returns the number of datagrams sent, which may be less
+		/// than the number of entries.
+
+	virtual int receiveMultiple(DatagramVec& datagrams, int flags = 0);
+		/// Receives up to one datagram per Datagram entry into the
+		/// entry's buffers, using a single recvmmsg() system call
+		/// where available (Linux) and a receiveFrom() loop
+		/// elsewhere (which receives a single datagram). On return,
+		/// each filled entry holds the sender address and the
+		/// number of bytes received.
+		///
+		/// Returns the number of datagrams received.
+
 	int receiveFrom(SocketBufVec& buffers, struct sockaddr** ppSA, poco_socklen_t** ppSALen, int flags);
 		/// Receives data from the socket and stores it
 		/// in buffers.
@@ -424,7 +487,79 @@ public:
 		/// This method will only work if the blocking modes of
 		/// the socket are changed via the setBlocking method!
 
+	void setReceiveTimestamping(bool flag);
+		/// Enables or disables kernel receive timestamping
+		/// (SO_TIMESTAMPNS on Linux): with it enabled, packet
+		/// arrival times are recorded by the kernel and can be
+		/// retrieved from the ancillary data of recvmsg-based
+		/// receives. A no-op on platforms without support.
+
+	bool getReceiveTimestamping();
+		/// Returns true if kernel receive timestamping is enabled.
+		/// Always returns false on platforms without support.
+
+	void setBusyPoll(int microseconds);
+		/// Sets the busy-poll duration (SO_BUSY_POLL on Linux):
+		/// blocking receives spin in the kernel for up to the given
+		/// number of microseconds before sleeping, trading CPU for
+		/// wakeup latency. A no-op on platforms without support
+		/// (or without the required privilege).
+
+	int getBusyPoll();
+		/// Returns the configured busy-poll duration in
+		/// microseconds, or 0 on platforms without support.
+
+	void setZeroCopy(bool flag);
+		/// Enables or disables zero-copy sends on the socket
+		/// (SO_ZEROCOPY on Linux 4.14+): sendBytesZeroCopy() then
+		/// pins the caller's pages instead of copying them into
+		/// kernel buffers. A no-op on platforms without support.
+
+	bool getZeroCopy();
+		/// Returns true if zero-copy sends are enabled.
+		/// Always returns false on platforms without support.
+
+	int sendBytesZeroCopy(const void* buffer, int length);
+		/// Sends the contents of the given buffer with MSG_ZEROCOPY
+		/// (after setZeroCopy(true)), avoiding the copy into kernel
+		/// space for large payloads. The caller must keep the buffer
+		/// unmodified and alive until the kernel reports the send
+		/// complete via nextZeroCopyCompletion(); modifying it
+		/// earlier sends corrupted data.
+		///
+		/// Falls back to an ordinary sendBytes() when zero-copy
+		/// is unavailable (in which case no completion notification
+		/// is generated and the buffer may be reused immediately;
+		/// check getZeroCopy() to know which contract applies).
+		///
+		/// Returns the number of bytes sent.
+
+	bool nextZeroCopyCompletion(Poco::UInt32& first, Poco::UInt32& last);
+		/// Drains one zero-copy completion notification from the
+		/// socket's error queue. On success, first and last are the
+		/// inclusive range of completed send operations (zero-copy
+		/// sends are numbered from 0 in issue order per socket) and
+		/// the corresponding buffers may be reused or freed.
+		///
+		/// Returns false when no notification is pending. The error
+		/// queue is readable without consuming payload data; poll
+		/// for POLLERR (or call this after a batch of sends) to
+		/// avoid busy-waiting.
+
+	static void setSocketHooks(const SocketHooks* pHooks);
+		/// Installs (or, with a null pointer, removes) the
+		/// process-wide socket lifecycle hooks. The structure must
+		/// outlive its installation; hooks should be installed
+		/// once, at startup, before sockets are in use.
+		///
+		/// When no hooks are installed, the per-operation cost is
+		/// a single relaxed atomic load.
+
+	static const SocketHooks* socketHooks();
+		/// Returns the installed socket hooks, or a null pointer.
+
 	virtual bool secure() const;
+
 		/// Returns true iff the socket's connection is secure
 		/// (using SSL or TLS).
 
@@ -516,6 +651,8 @@ private:
 	SocketImpl(const SocketImpl&);
 	SocketImpl& operator = (const SocketImpl&);
 
+	static std::atomic<const SocketHooks*> _pHooks;
+
 	poco_socket_t  _sockfd;
 	Poco::Timespan _recvTimeout;
 	Poco::Timespan _sndTimeout;
@@ -20,9 +20,14 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/Socket.h"
+#include "Poco/BufferRef.h"
+#include "Poco/CancellationToken.h"
 #include "Poco/FIFOBuffer.h"
 
 
+#include <vector>
+
+
 namespace Poco {
 namespace Net {
 
@@ -83,6 +88,20 @@ public:
 		/// establishes a connection to the TCP server at the given address.
 
 	void connectNB(const SocketAddress& address);
+		/// Initiates a non-blocking connect to the given address.
+
+	static StreamSocket connectAny(const std::vector<SocketAddress>& addresses, const Poco::Timespan& timeout, const Poco::Timespan& stagger = Poco::Timespan(0, 250000));
+		/// Connects to the first of the given addresses to respond,
+		/// in the style of Happy Eyeballs (RFC 8305): non-blocking
+		/// connect attempts are started in order, a new one every
+		/// stagger interval, and the first to complete wins while
+		/// the others are abandoned. A dual-stack target with a
+		/// broken address family then costs one stagger interval
+		/// instead of a full connect timeout.
+		///
+		/// Throws a NetException (with the last per-address error)
+		/// or TimeoutException if no address could be connected
+		/// within the timeout.
 		/// Initializes the socket and establishes a connection to
 		/// the TCP server at the given address. Prior to opening the
 		/// connection the socket is set to nonblocking mode.
@@ -150,6 +169,33 @@ public:
 		/// Certain socket implementations may also return a negative
 		/// value denoting a certain condition.
 
+	int sendBytes(const Poco::ConstBufferRef& buffer);
+		/// Sends the bytes referenced by the given span; see
+		/// sendBytes(const void*, int).
+
+	int receiveBytes(const Poco::BufferRef& buffer);
+		/// Receives data into the storage referenced by the given
+		/// span; see receiveBytes(void*, int).
+
+	int receiveBytes(void* buffer, int length, const Poco::CancellationToken& token);
+		/// Receives data, waiting interruptibly: cancelling the
+		/// token wakes the wait immediately (instead of letting the
+		/// receive run into its timeout) and an InterruptedException
+		/// is thrown. The socket's receive timeout still applies and
+		/// raises a TimeoutException as usual.
+
+	int sendBytesZeroCopy(const void* buffer, int length);
+
+		/// Sends the contents of the given buffer with MSG_ZEROCOPY
+		/// where enabled and available; the buffer must stay alive
+		/// and unmodified until the completion for this send has
+		/// been drained with nextZeroCopyCompletion(). See
+		/// SocketImpl::sendBytesZeroCopy().
+
+	bool nextZeroCopyCompletion(Poco::UInt32& first, Poco::UInt32& last);
+		/// Drains one zero-copy completion notification; see
+		/// SocketImpl::nextZeroCopyCompletion().
+
 	int receiveBytes(void* buffer, int length, int flags = 0);
 		/// Receives data from the socket and stores it
 		/// in buffer. Up to length bytes are received.
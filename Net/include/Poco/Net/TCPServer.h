@@ -198,6 +198,17 @@ public:
 	void setConnectionFilter(const TCPServerConnectionFilter::Ptr& pFilter);
 		/// Sets a TCPServerConnectionFilter. Can also be used to remove
 		/// a filter by passing a null pointer.
+
+	void enqueueConnection(const StreamSocket& socket);
+		/// Hands the given socket to the server's dispatcher, as if
+		/// it had just been accepted.
+		///
+		/// Intended for TCPServerConnectionFilter implementations
+		/// that admit connections asynchronously: the filter keeps a
+		/// copy of the socket, returns false from accept(), performs
+		/// its staging work (e.g. a TLS handshake) elsewhere, and
+		/// re-injects the socket here when the connection is ready
+		/// to be served.
 		///
 		/// To avoid a potential race condition, the filter must
 		/// be set before the TCPServer is started. Trying to set
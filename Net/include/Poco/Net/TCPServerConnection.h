@@ -68,6 +68,7 @@ private:
 	StreamSocket _socket;
 	
 	friend class TCPServerDispatcher;
+	friend class HTTPConnectionParker;
 };
 
 
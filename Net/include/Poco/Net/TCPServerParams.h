@@ -45,6 +45,7 @@ public:
 		///   - threadIdleTime:       10 seconds
 		///   - maxThreads:           0
 		///   - maxQueued:            64
+		///   - shardCount:           1
 
 	void setThreadIdleTime(const Poco::Timespan& idleTime);
 		/// Sets the maximum idle time for a thread before
@@ -92,6 +93,22 @@ public:
 		/// Returns the priority of TCP server threads
 		/// created by TCPServer.
 
+	void setShardCount(int count);
+		/// Sets the number of acceptor shards used by
+		/// ShardedTCPServer. Must be greater than 0.
+		///
+		/// Each shard runs its own acceptor thread,
+		/// connection queue and thread pool, so accept
+		/// load is spread across cores without a shared
+		/// dispatcher lock.
+		///
+		/// The default number of shards is 1. This
+		/// parameter is ignored by plain TCPServer.
+
+	int getShardCount() const;
+		/// Returns the number of acceptor shards used by
+		/// ShardedTCPServer.
+
 protected:
 	virtual ~TCPServerParams();
 		/// Destroys the TCPServerParams.
@@ -101,6 +118,7 @@ private:
 	int _maxThreads;
 	int _maxQueued;
 	Poco::Thread::Priority _threadPriority;
+	int _shardCount;
 };
 
 
@@ -131,6 +149,12 @@ inline Poco::Thread::Priority TCPServerParams::getThreadPriority() const
 }
 
 
+inline int TCPServerParams::getShardCount() const
+{
+	return _shardCount;
+}
+
+
 } } // namespace Poco::Net
 
 
@@ -29,6 +29,9 @@
 #include <map>
 
 
+#include <vector>
+
+
 namespace Poco {
 namespace Net {
 
@@ -96,6 +99,70 @@ private:
 };
 
 
+template <std::size_t S = POCO_UDP_BUF_SIZE>
+class ShardedUDPServer
+	/// Receive-side-scaling UDP server: runs a number of
+	/// single-socket UDP servers, each with its own reader thread,
+	/// all bound to the same address with SO_REUSEPORT, so the
+	/// kernel hashes flows across the reader sockets. This removes
+	/// the single reader thread as the per-port packet-rate ceiling.
+	///
+	/// All shards share the given handler list; handlers run in
+	/// their own threads as usual. Requires a platform with
+	/// SO_REUSEPORT support (the port is otherwise only bound by
+	/// the first shard).
+{
+public:
+	ShardedUDPServer(typename UDPHandlerImpl<S>::List& handlers, const UDPServerParams& params, int shards):
+		_servers()
+		/// Creates a ShardedUDPServer with the given number of
+		/// shards, all bound to params.address() with SO_REUSEPORT.
+	{
+		poco_assert (shards > 0);
+		UDPServerParams shardParams(params.address(), params.numberOfSockets(),
+			params.timeout(), params.handlerBufListSize(), params.notifySender(),
+			params.backlogThreshold(), true);
+		for (int i = 0; i < shards; i++)
+		{
+			_servers.push_back(new UDPServerImpl<S, SingleSocketPoller<S> >(handlers, shardParams));
+		}
+	}
+
+	~ShardedUDPServer()
+		/// Destroys the ShardedUDPServer.
+	{
+		for (typename ServerVec::iterator it = _servers.begin(); it != _servers.end(); ++it)
+			delete *it;
+	}
+
+	Poco::UInt16 port() const
+		/// Returns the port the shards are listening on.
+	{
+		return _servers.front()->port();
+	}
+
+	Poco::Net::SocketAddress address() const
+		/// Returns the address of the server.
+	{
+		return _servers.front()->address();
+	}
+
+	int shardCount() const
+		/// Returns the number of shards.
+	{
+		return static_cast<int>(_servers.size());
+	}
+
+private:
+	typedef std::vector<UDPServerImpl<S, SingleSocketPoller<S> >*> ServerVec;
+
+	ShardedUDPServer(const ShardedUDPServer&);
+	ShardedUDPServer& operator = (const ShardedUDPServer&);
+
+	ServerVec _servers;
+};
+
+
 typedef UDPServerImpl<POCO_UDP_BUF_SIZE, SingleSocketPoller<POCO_UDP_BUF_SIZE> > UDPServer;
 typedef UDPServerImpl<POCO_UDP_BUF_SIZE, MultiSocketPoller<POCO_UDP_BUF_SIZE> > UDPMultiServer;
 
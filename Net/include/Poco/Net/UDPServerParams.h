@@ -36,7 +36,9 @@ public:
 		Poco::Timespan timeout = 250000,
 		std::size_t handlerBufListSize = 1000,
 		bool notifySender = false,
-		int  backlogThreshold = 10);
+		int  backlogThreshold = 10,
+		bool reusePort = false,
+		int batchSize = 1);
 		/// Creates UDPServerParams.
 
 	~UDPServerParams();
@@ -64,6 +66,18 @@ public:
 		/// reports backlogs back to the client. Only meaningful
 		/// if notifySender() is true.
 
+	bool reusePort() const;
+		/// Returns true if the server socket should be bound with
+		/// the SO_REUSEPORT option, so that several servers can
+		/// share one port and the kernel distributes (hashes) flows
+		/// between their sockets (see ShardedUDPServer).
+
+	int batchSize() const;
+		/// Returns the number of datagrams drained from a readable
+		/// socket per poll cycle (the fairness cap). The default of
+		/// 1 preserves the classic one-datagram-per-poll dispatch;
+		/// larger values amortize one poll syscall over a burst.
+
 private:
 	UDPServerParams();
 
@@ -73,6 +87,8 @@ private:
 	std::size_t              _handlerBufListSize;
 	bool                     _notifySender;
 	int                      _backlogThreshold;
+	bool                     _reusePort;
+	int                      _batchSize;
 };
 
 
@@ -92,6 +108,18 @@ inline int UDPServerParams::numberOfSockets() const
 }
 
 
+inline bool UDPServerParams::reusePort() const
+{
+	return _reusePort;
+}
+
+
+inline int UDPServerParams::batchSize() const
+{
+	return _batchSize;
+}
+
+
 inline Poco::Timespan UDPServerParams::timeout() const
 {
 	return _timeout;
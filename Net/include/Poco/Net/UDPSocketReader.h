@@ -114,6 +114,18 @@ public:
 		handler().notify();
 	}
 
+	void readMany(DatagramSocket& sock, int limit)
+		/// Drains the socket: reads datagrams back to back, without
+		/// returning to the poller, while data is immediately
+		/// available, up to the given limit (the fairness cap that
+		/// keeps one busy socket from starving the rest of the poll
+		/// set). With limit <= 1 this is a plain read().
+	{
+		read(sock);
+		while (--limit > 0 && sock.available() > 0)
+			read(sock);
+	}
+
 	bool handlerStopped() const
 		/// Returns true if all handlers are stopped.
 	{
@@ -247,6 +247,11 @@ protected:
 	static WebSocketImpl* connect(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials);
 	static WebSocketImpl* completeHandshake(HTTPClientSession& cs, HTTPResponse& response, const std::string& key);
 	static std::string computeAccept(const std::string& key);
+	static bool offersPerMessageDeflate(const std::string& extensions);
+		/// Returns true if the given Sec-WebSocket-Extensions header
+		/// value offers the permessage-deflate extension in a form
+		/// this implementation supports.
+
 	static std::string createKey();
 	
 private:
@@ -48,6 +48,14 @@ public:
 	virtual int receiveBytes(Poco::Buffer<char>& buffer, int flags = 0, const Poco::Timespan& span = 0);
 		/// Receives a WebSocket protocol frame.
 
+	void enableCompression();
+		/// Enables the permessage-deflate extension (RFC 7692) on
+		/// this connection. Called by WebSocket after the extension
+		/// has been negotiated during the upgrade handshake.
+
+	bool compressionEnabled() const;
+		/// Returns true if permessage-deflate has been negotiated.
+
 	virtual SocketImpl* acceptConnection(SocketAddress& clientAddr);
 	virtual void connect(const SocketAddress& address);
 	virtual void connect(const SocketAddress& address, const Poco::Timespan& timeout);
@@ -98,6 +106,9 @@ private:
 	Poco::Buffer<char> _buffer;
 	int _bufferOffset;
 	int _frameFlags;
+	class PerMessageDeflateContext;
+	PerMessageDeflateContext* _pCompression;
+	bool _inflating;
 	bool _mustMaskPayload;
 	Poco::Random _rnd;
 };
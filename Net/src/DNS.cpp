@@ -13,6 +13,9 @@
 
 
 #include "Poco/Net/DNS.h"
+#include "Poco/Mutex.h"
+#include "Poco/Timespan.h"
+#include <map>
 #include "Poco/Net/NetException.h"
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/Environment.h"
@@ -61,6 +64,85 @@ static Poco::RWLock resolverLock;
 #endif
 
 
+namespace
+{
+	//
+	// in-process resolver cache for hostByNameCached()
+	//
+	struct CachedHostEntry
+	{
+		HostEntry entry;
+		bool negative;
+		Poco::Timestamp expires;
+	};
+
+	std::map<std::string, CachedHostEntry> dnsCache;
+	Poco::FastMutex dnsCacheMutex;
+	long dnsCacheTimeout = 60;
+	long dnsNegativeCacheTimeout = 10;
+}
+
+
+HostEntry DNS::hostByNameCached(const std::string& hostname)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(dnsCacheMutex);
+		std::map<std::string, CachedHostEntry>::iterator it = dnsCache.find(hostname);
+		if (it != dnsCache.end())
+		{
+			if (!it->second.expires.isElapsed(0))
+			{
+				if (it->second.negative)
+					throw HostNotFoundException(hostname);
+				return it->second.entry;
+			}
+			dnsCache.erase(it);
+		}
+	}
+	CachedHostEntry cached;
+	cached.negative = false;
+	try
+	{
+		cached.entry = hostByName(hostname);
+	}
+	catch (HostNotFoundException&)
+	{
+		cached.negative = true;
+		cached.expires = Poco::Timestamp() + Poco::Timespan(dnsNegativeCacheTimeout, 0).totalMicroseconds();
+		Poco::FastMutex::ScopedLock lock(dnsCacheMutex);
+		dnsCache[hostname] = cached;
+		throw;
+	}
+	cached.expires = Poco::Timestamp() + Poco::Timespan(dnsCacheTimeout, 0).totalMicroseconds();
+	Poco::FastMutex::ScopedLock lock(dnsCacheMutex);
+	dnsCache[hostname] = cached;
+	return cached.entry;
+}
+
+
+void DNS::setCacheTimeout(long seconds)
+{
+	poco_assert (seconds > 0);
+	Poco::FastMutex::ScopedLock lock(dnsCacheMutex);
+	dnsCacheTimeout = seconds;
+}
+
+
+void DNS::setNegativeCacheTimeout(long seconds)
+{
+	poco_assert (seconds > 0);
+	Poco::FastMutex::ScopedLock lock(dnsCacheMutex);
+	dnsNegativeCacheTimeout = seconds;
+}
+
+
+void DNS::flushNameCache()
+{
+	Poco::FastMutex::ScopedLock lock(dnsCacheMutex);
+	dnsCache.clear();
+}
+
+
 HostEntry DNS::hostByName(const std::string& hostname, unsigned
 #ifdef POCO_HAVE_ADDRINFO
 						  hintFlags
@@ -684,4 +766,21 @@ int punycode_decode(size_t input_length, const char input[], size_t *output_leng
 }
 
 
+DNSResolver::DNSResolver():
+	resolve(this, &DNSResolver::resolveImpl)
+{
+}
+
+
+DNSResolver::~DNSResolver()
+{
+}
+
+
+HostEntry DNSResolver::resolveImpl(const std::string& hostname)
+{
+	return DNS::hostByNameCached(hostname);
+}
+
+
 } } // namespace Poco::Net
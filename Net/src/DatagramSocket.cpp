@@ -153,4 +153,16 @@ int DatagramSocket::receiveFrom(SocketBufVec& buffers, struct sockaddr** ppSA, p
 }
 
 
+int DatagramSocket::sendMultiple(DatagramVec& datagrams, int flags)
+{
+	return impl()->sendMultiple(datagrams, flags);
+}
+
+
+int DatagramSocket::receiveMultiple(DatagramVec& datagrams, int flags)
+{
+	return impl()->receiveMultiple(datagrams, flags);
+}
+
+
 } } // namespace Poco::Net
@@ -239,20 +239,30 @@ bool DialogSocket::receiveLine(std::string& line, std::size_t lineLengthLimit)
 {
 	// An old wisdom goes: be strict in what you emit
 	// and generous in what you accept.
-	int ch = get();
-	while (ch != EOF_CHAR && ch != '\r' && ch != '\n')
+	for (;;)
 	{
-		if (lineLengthLimit == 0 || line.size() < lineLengthLimit)
-			line += (char) ch;
-		else
+		refill();
+		if (_pNext == _pEnd) return false; // EOF
+
+		// scan the buffered data for the line terminator and append
+		// the whole run at once instead of one character at a time
+		std::size_t available = static_cast<std::size_t>(_pEnd - _pNext);
+		const char* pCR = static_cast<const char*>(std::memchr(_pNext, '\r', available));
+		std::size_t scanLength = pCR ? static_cast<std::size_t>(pCR - _pNext) : available;
+		const char* pLF = static_cast<const char*>(std::memchr(_pNext, '\n', scanLength));
+		const char* pTerm = pLF ? pLF : pCR;
+		std::size_t n = (pTerm ? static_cast<std::size_t>(pTerm - _pNext) : available);
+		if (lineLengthLimit != 0 && line.size() + n > lineLengthLimit)
 			throw Poco::IOException("Line too long");
-		ch = get();
+		line.append(_pNext, n);
+		_pNext += n;
+		if (!pTerm) continue; // terminator not buffered yet
+
+		int ch = std::char_traits<char>::to_int_type(*_pNext++);
+		if (ch == '\r' && peek() == '\n')
+			get();
+		return true;
 	}
-	if (ch == '\r' && peek() == '\n')
-		get();
-	else if (ch == EOF_CHAR)
-		return false;
-	return true;
 }
 
 
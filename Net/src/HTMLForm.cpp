@@ -300,15 +300,21 @@ void HTMLForm::readUrl(std::istream& istr)
 {
 	static const int eof = std::char_traits<char>::eof();
 
+	// read through the stream buffer directly; one virtual call per
+	// character through the istream adds up on large bodies
+	std::streambuf& buf = *istr.rdbuf();
+
 	int fields = 0;
-	int ch = istr.get();
+	int ch = buf.sbumpc();
 	bool isFirst = true;
+	std::string name;
+	std::string value;
 	while (ch != eof)
 	{
 		if (_fieldLimit > 0 && fields == _fieldLimit)
 			throw HTMLFormException("Too many form fields");
-		std::string name;
-		std::string value;
+		name.clear();
+		value.clear();
 		while (ch != eof && ch != '=' && ch != '&')
 		{
 			if (ch == '+') ch = ' ';
@@ -316,11 +322,11 @@ void HTMLForm::readUrl(std::istream& istr)
 				name += (char) ch;
 			else
 				throw HTMLFormException("Field name too long");
-			ch = istr.get();
+			ch = buf.sbumpc();
 		}
 		if (ch == '=')
 		{
-			ch = istr.get();
+			ch = buf.sbumpc();
 			while (ch != eof && ch != '&')
 			{
 				if (ch == '+') ch = ' ';
@@ -328,7 +334,7 @@ void HTMLForm::readUrl(std::istream& istr)
 					value += (char) ch;
 				else
 					throw HTMLFormException("Field value too long");
-				ch = istr.get();
+				ch = buf.sbumpc();
 			}
 		}
 		// remove UTF-8 byte order mark from first name, if present
@@ -340,9 +346,9 @@ void HTMLForm::readUrl(std::istream& istr)
 		std::string decodedValue;
 		URI::decode(name, decodedName);
 		URI::decode(value, decodedValue);
-		add(decodedName, decodedValue);
+		add(decodedName, std::move(decodedValue));
 		++fields;
-		if (ch == '&') ch = istr.get();
+		if (ch == '&') ch = buf.sbumpc();
 		isFirst = false;
 	}
 }
@@ -13,6 +13,9 @@
 
 
 #include "Poco/Net/HTTPBufferAllocator.h"
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
 
 
 using Poco::MemoryPool;
@@ -25,10 +28,70 @@ namespace Net {
 MemoryPool HTTPBufferAllocator::_pool(HTTPBufferAllocator::BUFFER_SIZE, 16);
 
 
+//
+// Per-thread buffer magazine over the shared pool: session
+// buffer churn on a busy server otherwise serializes on the
+// pool's mutex. A thread's magazine is drained back into the
+// pool when the thread exits.
+//
+class HTTPBufferMagazine
+{
+public:
+	enum
+	{
+		CAPACITY = 4
+	};
+
+	~HTTPBufferMagazine()
+	{
+		// this destructor can run during process shutdown after the
+		// shared pool (a static in this library) has already been
+		// destroyed -- worker threads of Foundation's default thread
+		// pool exit that late -- so the buffers are returned to the
+		// heap directly; the pool only ever frees blocks on its own
+		// free list, so nothing is freed twice
+		while (_count > 0)
+			delete [] _buffers[--_count];
+		// deallocations can still arrive on this thread after TLS
+		// destruction; they must bypass the dead magazine
+		_destroyed = true;
+	}
+
+	char* pop()
+	{
+		if (_destroyed) return 0;
+		return _count > 0 ? _buffers[--_count] : 0;
+	}
+
+	bool push(char* pBuffer)
+	{
+		if (!_destroyed && _count < CAPACITY)
+		{
+			_buffers[_count++] = pBuffer;
+			return true;
+		}
+		return false;
+	}
+
+private:
+	char* _buffers[CAPACITY];
+	int _count = 0;
+	bool _destroyed = false;
+};
+
+
+namespace
+{
+	thread_local HTTPBufferMagazine bufferMagazine;
+}
+
+
 char* HTTPBufferAllocator::allocate(std::streamsize size)
 {
 	poco_assert_dbg (size == BUFFER_SIZE);
 
+	char* pBuffer = bufferMagazine.pop();
+	if (pBuffer) return pBuffer;
 	return reinterpret_cast<char*>(_pool.get());
 }
 
@@ -37,7 +100,8 @@ void HTTPBufferAllocator::deallocate(char* ptr, std::streamsize size)
 {
 	poco_assert_dbg (size == BUFFER_SIZE);
 
-	_pool.release(ptr);
+	if (!bufferMagazine.push(ptr))
+		_pool.release(ptr);
 }
 
 
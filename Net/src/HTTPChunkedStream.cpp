@@ -50,8 +50,13 @@ void HTTPChunkedStreamBuf::close()
 {
 	if (_mode & std::ios::out)
 	{
+		_closing = true;
 		sync();
-		_session.write("0\r\n\r\n", 5);
+		if (!_terminated)
+		{
+			_session.write("0\r\n\r\n", 5);
+			_terminated = true;
+		}
 	}
 }
 
@@ -97,6 +102,13 @@ int HTTPChunkedStreamBuf::writeToDevice(const char* buffer, std::streamsize leng
 	_chunkBuffer.append("\r\n", 2);
 	_chunkBuffer.append(buffer, static_cast<std::string::size_type>(length));
 	_chunkBuffer.append("\r\n", 2);
+	if (_closing)
+	{
+		// piggyback the terminating chunk onto the final data chunk,
+		// saving a separate small TCP segment per response
+		_chunkBuffer.append("0\r\n\r\n", 5);
+		_terminated = true;
+	}
 	_session.write(_chunkBuffer.data(), static_cast<std::streamsize>(_chunkBuffer.size()));
 	return static_cast<int>(length);
 }
@@ -0,0 +1,187 @@
+//
+// HTTPClientConnectionPool.cpp
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPClientConnectionPool
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPClientConnectionPool.h"
+#include "Poco/Net/HTTPSessionFactory.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/SingletonHolder.h"
+#include "Poco/Exception.h"
+#include "Poco/String.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+HTTPClientConnectionPool::HTTPClientConnectionPool(int maxIdlePerHost, int maxIdleTotal, const Poco::Timespan& idleTimeout):
+	_maxIdlePerHost(maxIdlePerHost),
+	_maxIdleTotal(maxIdleTotal),
+	_idleTimeout(idleTimeout),
+	_idleCount(0)
+{
+	poco_assert (maxIdlePerHost > 0);
+	poco_assert (maxIdleTotal >= maxIdlePerHost);
+}
+
+
+HTTPClientConnectionPool::~HTTPClientConnectionPool()
+{
+	try
+	{
+		closeIdle();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+std::string HTTPClientConnectionPool::key(const Poco::URI& uri)
+{
+	std::string result(uri.getScheme());
+	result += "://";
+	result += uri.getHost();
+	result += ':';
+	NumberFormatter::append(result, uri.getPort());
+	return result;
+}
+
+
+bool HTTPClientConnectionPool::validate(SessionPtr& pSession)
+{
+	if (!pSession->connected() || pSession->networkException()) return false;
+	try
+	{
+		// a readable idle keep-alive socket means the peer has closed
+		// the connection (EOF) or sent data we did not ask for
+		return !pSession->socket().poll(Poco::Timespan(0), Socket::SELECT_READ | Socket::SELECT_ERROR);
+	}
+	catch (Poco::Exception&)
+	{
+		return false;
+	}
+}
+
+
+void HTTPClientConnectionPool::evictExpired(SessionVec& sessions)
+{
+	for (SessionVec::iterator it = sessions.begin(); it != sessions.end();)
+	{
+		if (it->idleSince.isElapsed(_idleTimeout.totalMicroseconds()))
+		{
+			it = sessions.erase(it);
+			--_idleCount;
+		}
+		else ++it;
+	}
+}
+
+
+HTTPClientConnectionPool::SessionPtr HTTPClientConnectionPool::borrow(const Poco::URI& uri)
+{
+	std::string uriKey = key(uri);
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		SessionMap::iterator it = _sessions.find(uriKey);
+		if (it != _sessions.end())
+		{
+			evictExpired(it->second);
+			while (!it->second.empty())
+			{
+				// most recently used first: its keep-alive window is
+				// the least likely to have expired on the server side
+				SessionPtr pSession = it->second.back().pSession;
+				it->second.pop_back();
+				--_idleCount;
+				if (validate(pSession)) return pSession;
+			}
+		}
+	}
+	SessionPtr pSession;
+	try
+	{
+		pSession = HTTPSessionFactory::defaultFactory().createClientSession(uri);
+	}
+	catch (UnknownURISchemeException&)
+	{
+		// no instantiator registered (HTTPSessionInstantiator::
+		// registerInstantiator() not called); plain HTTP needs none
+		if (icompare(uri.getScheme(), "http") == 0)
+			pSession = new HTTPClientSession(uri.getHost(), uri.getPort());
+		else
+			throw;
+	}
+	// pooling only makes sense with persistent connections
+	pSession->setKeepAlive(true);
+	return pSession;
+}
+
+
+void HTTPClientConnectionPool::release(SessionPtr pSession)
+{
+	if (!pSession) return;
+	if (!pSession->connected() || pSession->networkException()) return;
+	if (!pSession->getKeepAlive()) return;
+
+	Poco::URI uri;
+	uri.setScheme(pSession->secure() ? "https" : "http");
+	uri.setHost(pSession->getHost());
+	uri.setPort(pSession->getPort());
+	std::string uriKey = key(uri);
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	SessionVec& sessions = _sessions[uriKey];
+	evictExpired(sessions);
+	if (static_cast<int>(sessions.size()) >= _maxIdlePerHost) return;
+	if (_idleCount >= _maxIdleTotal) return;
+
+	IdleSession idle;
+	idle.pSession = pSession;
+	sessions.push_back(idle);
+	++_idleCount;
+}
+
+
+int HTTPClientConnectionPool::idleSessions() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _idleCount;
+}
+
+
+void HTTPClientConnectionPool::closeIdle()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	_sessions.clear();
+	_idleCount = 0;
+}
+
+
+namespace
+{
+	static SingletonHolder<HTTPClientConnectionPool> sh;
+}
+
+
+HTTPClientConnectionPool& HTTPClientConnectionPool::defaultPool()
+{
+	return *sh.get();
+}
+
+
+} } // namespace Poco::Net
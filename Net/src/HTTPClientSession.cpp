@@ -23,6 +23,7 @@
 #include "Poco/Net/NetException.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/CountingStream.h"
+#include "Poco/String.h"
 #include "Poco/RegularExpression.h"
 #include <sstream>
 
@@ -47,7 +48,9 @@ HTTPClientSession::HTTPClientSession():
 	_reconnect(false),
 	_mustReconnect(false),
 	_expectResponseBody(false),
-	_responseReceived(false)
+	_responseReceived(false),
+	_responseDecompression(false),
+	_inflateType(-1)
 {
 }
 
@@ -62,7 +65,9 @@ HTTPClientSession::HTTPClientSession(const StreamSocket& socket):
 	_reconnect(false),
 	_mustReconnect(false),
 	_expectResponseBody(false),
-	_responseReceived(false)
+	_responseReceived(false),
+	_responseDecompression(false),
+	_inflateType(-1)
 {
 	setKeepAlive(true);
 }
@@ -78,7 +83,9 @@ HTTPClientSession::HTTPClientSession(const SocketAddress& address):
 	_reconnect(false),
 	_mustReconnect(false),
 	_expectResponseBody(false),
-	_responseReceived(false)
+	_responseReceived(false),
+	_responseDecompression(false),
+	_inflateType(-1)
 {
 }
 
@@ -93,7 +100,9 @@ HTTPClientSession::HTTPClientSession(const std::string& host, Poco::UInt16 port)
 	_reconnect(false),
 	_mustReconnect(false),
 	_expectResponseBody(false),
-	_responseReceived(false)
+	_responseReceived(false),
+	_responseDecompression(false),
+	_inflateType(-1)
 {
 }
 
@@ -108,7 +117,9 @@ HTTPClientSession::HTTPClientSession(const std::string& host, Poco::UInt16 port,
 	_reconnect(false),
 	_mustReconnect(false),
 	_expectResponseBody(false),
-	_responseReceived(false)
+	_responseReceived(false),
+	_responseDecompression(false),
+	_inflateType(-1)
 {
 }
 
@@ -123,7 +134,9 @@ HTTPClientSession::HTTPClientSession(const StreamSocket& socket, const ProxyConf
 	_reconnect(false),
 	_mustReconnect(false),
 	_expectResponseBody(false),
-	_responseReceived(false)
+	_responseReceived(false),
+	_responseDecompression(false),
+	_inflateType(-1)
 {
 	setKeepAlive(true);
 }
@@ -271,6 +284,8 @@ std::ostream& HTTPClientSession::sendRequest(HTTPRequest& request)
 			request.setKeepAlive(false);
 		if (!request.has(HTTPRequest::HOST) && !_host.empty())
 			request.setHost(_host, _port);
+		if (_responseDecompression && !request.has("Accept-Encoding"))
+			request.set("Accept-Encoding", "gzip, deflate");
 		if (!_proxyConfig.host.empty() && !bypassProxy())
 		{
 			request.setURI(proxyRequestPrefix() + request.getURI());
@@ -362,10 +377,112 @@ std::istream& HTTPClientSession::receiveResponse(HTTPResponse& response)
 	else
 		_pResponseStream = new HTTPInputStream(*this);
 
+	if (_responseDecompression)
+	{
+		const std::string& encoding = response.get("Content-Encoding", HTTPMessage::EMPTY);
+		int type = -1;
+		if (Poco::icompare(encoding, "gzip") == 0)
+			type = Poco::InflatingStreamBuf::STREAM_GZIP;
+		else if (Poco::icompare(encoding, "deflate") == 0)
+			type = Poco::InflatingStreamBuf::STREAM_ZLIB;
+		if (type != -1)
+		{
+			if (_pInflateStream && _inflateType == type)
+			{
+				// reuse the session's inflate state across requests
+				_pInflateStream->reset(*_pResponseStream);
+			}
+			else
+			{
+				_pInflateStream = new Poco::InflatingInputStream(*_pResponseStream, static_cast<Poco::InflatingStreamBuf::StreamType>(type));
+				_inflateType = type;
+			}
+			return *_pInflateStream;
+		}
+	}
+
 	return *_pResponseStream;
 }
 
 
+void HTTPClientSession::setResponseDecompression(bool enable)
+{
+	_responseDecompression = enable;
+}
+
+
+bool HTTPClientSession::getResponseDecompression() const
+{
+	return _responseDecompression;
+}
+
+
+std::size_t HTTPClientSession::pipelineRequest(HTTPRequest& request)
+{
+	if (!getKeepAlive())
+		throw NetException("Pipelining requires a keep-alive session");
+	if (request.getChunkedTransferEncoding() || (request.hasContentLength() && request.getContentLength() > 0))
+		throw NetException("Requests with a message body cannot be pipelined");
+
+	clearException();
+	_pRequestStream = 0;
+	_pResponseStream = 0;
+	_responseReceived = false;
+
+	if (mustReconnect() && !_host.empty())
+	{
+		// only safe when no responses are outstanding
+		if (_pipeline.empty())
+		{
+			close();
+			_mustReconnect = false;
+		}
+		else throw NetException("Cannot pipeline: connection must be re-established");
+	}
+	try
+	{
+		if (!connected())
+			reconnect();
+		if (!request.has(HTTPRequest::HOST) && !_host.empty())
+			request.setHost(_host, _port);
+		if (!_proxyConfig.host.empty() && !bypassProxy())
+		{
+			request.setURI(proxyRequestPrefix() + request.getURI());
+			proxyAuthenticate(request);
+		}
+		_reconnect = true;
+		HTTPHeaderOutputStream hos(*this);
+		request.write(hos);
+		hos.flush();
+	}
+	catch (Exception&)
+	{
+		close();
+		throw;
+	}
+	_pipeline.push_back(request.getMethod() != HTTPRequest::HTTP_HEAD);
+	_lastRequest.update();
+	return _pipeline.size();
+}
+
+
+std::istream& HTTPClientSession::receivePipelinedResponse(HTTPResponse& response)
+{
+	if (_pipeline.empty())
+		throw NetException("No pipelined request outstanding");
+	_expectResponseBody = _pipeline.front();
+	_pipeline.pop_front();
+	_responseReceived = false;
+	return receiveResponse(response);
+}
+
+
+std::size_t HTTPClientSession::pipelinedRequests() const
+{
+	return _pipeline.size();
+}
+
+
 bool HTTPClientSession::peekResponse(HTTPResponse& response)
 {
 	poco_assert (!_responseReceived);
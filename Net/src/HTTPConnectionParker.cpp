@@ -0,0 +1,230 @@
+//
+// HTTPConnectionParker.cpp
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPConnectionParker
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPConnectionParker.h"
+#include "Poco/Net/TCPServerConnection.h"
+#include "Poco/ErrorHandler.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	class ResumedConnection: public Poco::Runnable
+		/// Runs a server connection created for a resumed socket
+		/// on the parker's thread pool and cleans up afterwards.
+	{
+	public:
+		ResumedConnection(HTTPConnectionParker& parker, TCPServerConnection* pConnection):
+			_parker(parker),
+			_pConnection(pConnection)
+		{
+		}
+
+		void run()
+		{
+			try
+			{
+				_parker.startConnection(_pConnection);
+			}
+			catch (...)
+			{
+			}
+			delete _pConnection;
+			delete this;
+		}
+
+	private:
+		HTTPConnectionParker& _parker;
+		TCPServerConnection* _pConnection;
+	};
+}
+
+
+HTTPConnectionParker::HTTPConnectionParker(TCPServerConnectionFactory* pFactory, const Poco::Timespan& idleTimeout, int maxThreads):
+	_pFactory(pFactory),
+	_idleTimeout(idleTimeout),
+	_pool(2, maxThreads),
+	_thread("HTTPConnectionParker"),
+	_stopped(false)
+{
+	poco_check_ptr (pFactory);
+
+	_thread.start(*this);
+}
+
+
+HTTPConnectionParker::~HTTPConnectionParker()
+{
+	try
+	{
+		_stopped = true;
+		_thread.join();
+		_pool.joinAll();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void HTTPConnectionParker::park(const StreamSocket& socket)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		_parked[socket.impl()->sockfd()] = std::make_pair(socket, Poco::Timestamp());
+	}
+	_pollSet.add(socket, PollSet::POLL_READ | PollSet::POLL_ERROR);
+}
+
+
+void HTTPConnectionParker::closeAll()
+{
+	std::vector<StreamSocket> parked;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		for (ParkedMap::iterator it = _parked.begin(); it != _parked.end(); ++it)
+			parked.push_back(it->second.first);
+		_parked.clear();
+	}
+	for (std::vector<StreamSocket>::iterator it = parked.begin(); it != parked.end(); ++it)
+	{
+		_pollSet.remove(*it);
+		try
+		{
+			it->close();
+		}
+		catch (...)
+		{
+		}
+	}
+}
+
+
+int HTTPConnectionParker::parkedConnections() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return static_cast<int>(_parked.size());
+}
+
+
+void HTTPConnectionParker::resume(const StreamSocket& socket)
+{
+	TCPServerConnection* pConnection = 0;
+	ResumedConnection* pRunnable = 0;
+	try
+	{
+		pConnection = _pFactory->createConnection(socket);
+		pRunnable = new ResumedConnection(*this, pConnection);
+	}
+	catch (Poco::Exception& exc)
+	{
+		delete pConnection;
+		ErrorHandler::handle(exc);
+		return;
+	}
+	for (int attempt = 0; ; ++attempt)
+	{
+		try
+		{
+			_pool.start(*pRunnable);
+			return;
+		}
+		catch (NoThreadAvailableException&)
+		{
+			if (attempt >= 100)
+			{
+				// sustained overload: run inline, applying
+				// back-pressure to further resumes
+				pRunnable->run();
+				return;
+			}
+			Poco::Thread::sleep(10);
+		}
+	}
+}
+
+
+void HTTPConnectionParker::startConnection(TCPServerConnection* pConnection)
+{
+	pConnection->start();
+}
+
+
+void HTTPConnectionParker::run()
+{
+	while (!_stopped)
+	{
+		try
+		{
+			if (_pollSet.empty())
+			{
+				// poll() returns immediately on an empty set
+				Poco::Thread::sleep(100);
+				continue;
+			}
+			PollSet::SocketModeMap sm = _pollSet.poll(Poco::Timespan(0, 250000));
+			for (PollSet::SocketModeMap::const_iterator it = sm.begin(); it != sm.end(); ++it)
+			{
+				StreamSocket socket;
+				{
+					Poco::FastMutex::ScopedLock lock(_mutex);
+					ParkedMap::iterator itp = _parked.find(it->first.impl()->sockfd());
+					if (itp == _parked.end()) continue;
+					socket = itp->second.first;
+					_parked.erase(itp);
+				}
+				_pollSet.remove(socket);
+				if (it->second & PollSet::POLL_READ)
+					resume(socket);
+				else
+					socket.close();
+			}
+
+			// close connections idle beyond the keep-alive timeout
+			std::vector<StreamSocket> expired;
+			{
+				Poco::FastMutex::ScopedLock lock(_mutex);
+				for (ParkedMap::iterator it = _parked.begin(); it != _parked.end();)
+				{
+					if (it->second.second.isElapsed(_idleTimeout.totalMicroseconds()))
+					{
+						expired.push_back(it->second.first);
+						it = _parked.erase(it);
+					}
+					else ++it;
+				}
+			}
+			for (std::vector<StreamSocket>::iterator it = expired.begin(); it != expired.end(); ++it)
+			{
+				_pollSet.remove(*it);
+				it->close();
+			}
+		}
+		catch (Poco::Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+	}
+}
+
+
+} } // namespace Poco::Net
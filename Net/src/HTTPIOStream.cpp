@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/HTTPIOStream.h"
+#include "Poco/Net/HTTPClientConnectionPool.h"
 #include "Poco/Net/HTTPClientSession.h"
 
 
@@ -56,8 +57,30 @@ HTTPResponseStream::HTTPResponseStream(std::istream& istr, HTTPClientSession* pS
 }
 
 
+HTTPResponseStream::HTTPResponseStream(std::istream& istr, const Poco::SharedPtr<HTTPClientSession>& pPooledSession):
+	HTTPResponseIOS(istr),
+	std::istream(&_buf),
+	_pSession(0),
+	_pPooledSession(pPooledSession)
+{
+}
+
+
 HTTPResponseStream::~HTTPResponseStream()
 {
+	if (_pPooledSession)
+	{
+		try
+		{
+			// only a fully consumed response leaves the connection
+			// in a reusable state
+			if (eof())
+				HTTPClientConnectionPool::defaultPool().release(_pPooledSession);
+		}
+		catch (...)
+		{
+		}
+	}
 	delete _pSession;
 }
 
@@ -14,6 +14,8 @@
 
 #include "Poco/Net/HTTPServer.h"
 #include "Poco/Net/HTTPServerConnectionFactory.h"
+#include "Poco/Thread.h"
+#include "Poco/Timestamp.h"
 
 
 namespace Poco {
@@ -53,4 +55,15 @@ void HTTPServer::stopAll(bool abortCurrent)
 }
 
 
+int HTTPServer::drain(const Poco::Timespan& timeout)
+{
+	stop();
+	_pFactory->serverDraining(this, true);
+	Poco::Timestamp start;
+	while (currentConnections() > 0 && start.elapsed() < timeout.totalMicroseconds())
+		Poco::Thread::sleep(10);
+	return currentConnections();
+}
+
+
 } } // namespace Poco::Net
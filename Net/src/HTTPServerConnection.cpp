@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/HTTPServerConnection.h"
+#include "Poco/Net/HTTPConnectionParker.h"
 #include "Poco/Net/HTTPServerSession.h"
 #include "Poco/Net/HTTPServerRequestImpl.h"
 #include "Poco/Net/HTTPServerResponseImpl.h"
@@ -29,15 +30,30 @@ namespace Poco {
 namespace Net {
 
 
-HTTPServerConnection::HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory):
+HTTPServerConnection::HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, HTTPConnectionParker* pParker):
 	TCPServerConnection(socket),
 	_pParams(pParams),
 	_pFactory(pFactory),
-	_stopped(false)
+	_pParker(pParker),
+	_stopped(false),
+	_draining(false)
 {
 	poco_check_ptr (pFactory);
-	
+
+	if (_pParams && _pParams->getTcpNoDelay())
+	{
+		try
+		{
+			this->socket().setNoDelay(true);
+		}
+		catch (Poco::Exception&)
+		{
+			// not fatal; some socket types do not support it
+		}
+	}
+
 	_pFactory->serverStopped += Poco::delegate(this, &HTTPServerConnection::onServerStopped);
+	_pFactory->serverDraining += Poco::delegate(this, &HTTPServerConnection::onServerDraining);
 }
 
 
@@ -46,6 +62,7 @@ HTTPServerConnection::~HTTPServerConnection()
 	try
 	{
 		_pFactory->serverStopped -= Poco::delegate(this, &HTTPServerConnection::onServerStopped);
+		_pFactory->serverDraining -= Poco::delegate(this, &HTTPServerConnection::onServerDraining);
 	}
 	catch (...)
 	{
@@ -71,7 +88,7 @@ void HTTPServerConnection::run()
 				Poco::Timestamp now;
 				response.setDate(now);
 				response.setVersion(request.getVersion());
-				response.setKeepAlive(_pParams->getKeepAlive() && request.getKeepAlive() && session.canKeepAlive());
+				response.setKeepAlive(_pParams->getKeepAlive() && request.getKeepAlive() && session.canKeepAlive() && !_draining);
 				if (!server.empty())
 					response.set("Server", server);
 				try
@@ -83,7 +100,7 @@ void HTTPServerConnection::run()
 							response.sendContinue();
 					
 						pHandler->handleRequest(request, response);
-						session.setKeepAlive(_pParams->getKeepAlive() && response.getKeepAlive() && session.canKeepAlive());
+						session.setKeepAlive(_pParams->getKeepAlive() && response.getKeepAlive() && session.canKeepAlive() && !_draining);
 					}
 					else sendErrorResponse(session, HTTPResponse::HTTP_NOT_IMPLEMENTED);
 				}
@@ -119,6 +136,18 @@ void HTTPServerConnection::run()
 			}
 			else throw;
 		}
+		if (_pParker && !_stopped && !_draining && session.getKeepAlive() && session.canKeepAlive() &&
+			!session.hasBufferedData() && !session.socket().poll(0, Socket::SELECT_READ))
+		{
+			// the response has been flushed (the response object's
+			// destructor ran when the inner scope closed) and no
+			// further request is pending: park the socket and
+			// release this thread instead of blocking on the
+			// keep-alive timeout. The socket is detached so the
+			// session's destructor does not close it.
+			_pParker->park(session.detachSocket());
+			return;
+		}
 	}
 }
 
@@ -173,4 +202,12 @@ void HTTPServerConnection::onServerStopped(const bool& abortCurrent)
 }
 
 
+void HTTPServerConnection::onServerDraining(const bool&)
+{
+	// in-flight responses pick this up before they are sent and
+	// answer with Connection: close; the request itself completes
+	_draining = true;
+}
+
+
 } } // namespace Poco::Net
@@ -15,6 +15,7 @@
 #include "Poco/Net/HTTPServerConnectionFactory.h"
 #include "Poco/Net/HTTPServerConnection.h"
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Delegate.h"
 
 
 namespace Poco {
@@ -26,17 +27,57 @@ HTTPServerConnectionFactory::HTTPServerConnectionFactory(HTTPServerParams::Ptr p
 	_pFactory(pFactory)
 {
 	poco_check_ptr (pFactory);
+
+	if (_pParams && _pParams->getKeepAliveParking())
+	{
+		_pParker = new HTTPConnectionParker(this, _pParams->getKeepAliveTimeout(), _pParams->getMaxThreads() > 0 ? _pParams->getMaxThreads() : 16);
+		_pFactory->serverStopped += Poco::delegate(this, &HTTPServerConnectionFactory::onServerStopped);
+		_pFactory->serverDraining += Poco::delegate(this, &HTTPServerConnectionFactory::onServerDraining);
+	}
+}
+
+
+void HTTPServerConnectionFactory::onServerStopped(const bool& abortCurrent)
+{
+	if (abortCurrent && _pParker)
+	{
+		// parked connections count as "currently being served" for
+		// abort purposes: close them instead of resuming
+		_pParker->closeAll();
+	}
+}
+
+
+void HTTPServerConnectionFactory::onServerDraining(const bool&)
+{
+	if (_pParker)
+	{
+		// parked connections are idle between requests: close them
+		// now instead of waiting out their keep-alive timeout
+		_pParker->closeAll();
+	}
 }
 
 
 HTTPServerConnectionFactory::~HTTPServerConnectionFactory()
 {
+	if (_pParker)
+	{
+		try
+		{
+			_pFactory->serverStopped -= Poco::delegate(this, &HTTPServerConnectionFactory::onServerStopped);
+			_pFactory->serverDraining -= Poco::delegate(this, &HTTPServerConnectionFactory::onServerDraining);
+		}
+		catch (...)
+		{
+		}
+	}
 }
 
 
 TCPServerConnection* HTTPServerConnectionFactory::createConnection(const StreamSocket& socket)
 {
-	return new HTTPServerConnection(socket, _pParams, _pFactory);
+	return new HTTPServerConnection(socket, _pParams, _pFactory, _pParker.get());
 }
 
 
@@ -0,0 +1,55 @@
+//
+// HTTPServerMetricsHandler.cpp
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPServerMetricsHandler
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPServerMetricsHandler.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/NumberFormatter.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+HTTPServerMetricsHandler::HTTPServerMetricsHandler(TCPServer& server):
+	_server(server)
+{
+}
+
+
+void HTTPServerMetricsHandler::handleRequest(HTTPServerRequest& /*request*/, HTTPServerResponse& response)
+{
+	std::string body;
+	body.reserve(256);
+	body += "tcpserver_connections_current ";
+	Poco::NumberFormatter::append(body, _server.currentConnections());
+	body += "\ntcpserver_connections_total ";
+	Poco::NumberFormatter::append(body, _server.totalConnections());
+	body += "\ntcpserver_connections_queued ";
+	Poco::NumberFormatter::append(body, _server.queuedConnections());
+	body += "\ntcpserver_connections_refused ";
+	Poco::NumberFormatter::append(body, _server.refusedConnections());
+	body += "\ntcpserver_connections_max_concurrent ";
+	Poco::NumberFormatter::append(body, _server.maxConcurrentConnections());
+	body += "\ntcpserver_threads_current ";
+	Poco::NumberFormatter::append(body, _server.currentThreads());
+	body += "\ntcpserver_threads_max ";
+	Poco::NumberFormatter::append(body, _server.maxThreads());
+	body += "\n";
+
+	response.setContentType("text/plain; version=0.0.4");
+	response.sendBuffer(body.data(), body.size());
+}
+
+
+} } // namespace Poco::Net
@@ -23,7 +23,9 @@ HTTPServerParams::HTTPServerParams():
 	_timeout(60000000),
 	_keepAlive(true),
 	_maxKeepAliveRequests(0),
-	_keepAliveTimeout(15000000)
+	_keepAliveTimeout(15000000),
+	_keepAliveParking(false),
+	_tcpNoDelay(true)
 {
 }
 
@@ -63,6 +65,18 @@ void HTTPServerParams::setKeepAliveTimeout(const Poco::Timespan& timeout)
 }
 
 	
+void HTTPServerParams::setTcpNoDelay(bool noDelay)
+{
+	_tcpNoDelay = noDelay;
+}
+
+
+void HTTPServerParams::setKeepAliveParking(bool parking)
+{
+	_keepAliveParking = parking;
+}
+
+
 void HTTPServerParams::setMaxKeepAliveRequests(int maxKeepAliveRequests)
 {
 	poco_assert (maxKeepAliveRequests >= 0);
@@ -30,6 +30,16 @@
 #include "Poco/DateTimeFormat.h"
 
 
+#include "Poco/Net/NetException.h"
+#if POCO_OS == POCO_OS_LINUX
+#include <sys/sendfile.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+#include <sstream>
+
+
 using Poco::File;
 using Poco::Timestamp;
 using Poco::NumberFormatter;
@@ -43,6 +53,48 @@ namespace Poco {
 namespace Net {
 
 
+#if POCO_OS == POCO_OS_LINUX
+namespace
+{
+	bool sendFileZeroCopy(StreamSocket& socket, const std::string& path, File::FileSize length)
+		/// Copies the file to the socket in kernel space using sendfile(),
+		/// avoiding the round trip through a userspace buffer.
+		///
+		/// Returns false if nothing has been sent yet and the caller
+		/// should fall back to a userspace stream copy. Once data has
+		/// been sent, errors are reported by throwing a NetException,
+		/// since the response headers are already on the wire.
+	{
+		int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0) return false;
+		off_t offset = 0;
+		while (offset < static_cast<off_t>(length))
+		{
+			ssize_t n = ::sendfile(socket.impl()->sockfd(), fd, &offset, static_cast<size_t>(length - offset));
+			if (n == 0)
+			{
+				// file shrunk while sending; the announced Content-Length
+				// can no longer be honored
+				::close(fd);
+				throw NetException("sendfile() failed: file truncated", path);
+			}
+			if (n < 0)
+			{
+				int err = errno;
+				if (err == EINTR) continue;
+				::close(fd);
+				if (offset == 0 && (err == EINVAL || err == ENOSYS))
+					return false;
+				throw NetException("sendfile() failed", path, err);
+			}
+		}
+		::close(fd);
+		return true;
+	}
+}
+#endif
+
+
 HTTPServerResponseImpl::HTTPServerResponseImpl(HTTPServerSession& session):
 	_session(session),
 	_pRequest(0),
@@ -128,6 +180,14 @@ void HTTPServerResponseImpl::sendFile(const std::string& path, const std::string
 		write(*_pStream);
 		if (_pRequest && _pRequest->getMethod() != HTTPRequest::HTTP_HEAD)
 		{
+#if POCO_OS == POCO_OS_LINUX
+			if (!_session.socket().secure())
+			{
+				_pStream->flush();
+				if (sendFileZeroCopy(_session.socket(), path, length))
+					return;
+			}
+#endif
 			StreamCopier::copyStream(istr, *_pStream);
 		}
 	}
@@ -141,10 +201,48 @@ void HTTPServerResponseImpl::sendBuffer(const void* pBuffer, std::size_t length)
 
 	setContentLength(static_cast<int>(length));
 	setChunkedTransferEncoding(false);
-	
+
+	bool sendBody = _pRequest && _pRequest->getMethod() != HTTPRequest::HTTP_HEAD;
+	if (sendBody && length > 0 && !_session.socket().secure())
+	{
+		// gather status line, headers and body into a single
+		// writev() on the socket instead of copying them through
+		// the buffered header stream
+		std::ostringstream hstr;
+		write(hstr);
+		std::string headers = hstr.str();
+		const char* pBody = static_cast<const char*>(pBuffer);
+		std::size_t headerSent = 0;
+		std::size_t bodySent = 0;
+		while (headerSent < headers.size() || bodySent < length)
+		{
+			SocketBufVec vec;
+			if (headerSent < headers.size())
+			{
+				vec.push_back(Socket::makeBuffer(const_cast<char*>(headers.data()) + headerSent, headers.size() - headerSent));
+			}
+			vec.push_back(Socket::makeBuffer(const_cast<char*>(pBody) + bodySent, length - bodySent));
+			int n = _session.socket().sendBytes(vec);
+			if (n <= 0) throw NetException("Failed to send response buffer");
+			std::size_t sent = static_cast<std::size_t>(n);
+			std::size_t headerPart = headers.size() - headerSent;
+			if (sent < headerPart)
+			{
+				headerSent += sent;
+			}
+			else
+			{
+				headerSent = headers.size();
+				bodySent += sent - headerPart;
+			}
+		}
+		_pStream = new HTTPHeaderOutputStream(_session);
+		return;
+	}
+
 	_pStream = new HTTPHeaderOutputStream(_session);
 	write(*_pStream);
-	if (_pRequest && _pRequest->getMethod() != HTTPRequest::HTTP_HEAD)
+	if (sendBody)
 	{
 		_pStream->write(static_cast<const char*>(pBuffer), static_cast<std::streamsize>(length));
 	}
@@ -0,0 +1,359 @@
+//
+// HTTPStaticFileService.cpp
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPStaticFileService
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPStaticFileService.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPMessage.h"
+#include "Poco/Path.h"
+#include "Poco/File.h"
+#include "Poco/FileStream.h"
+#include "Poco/URI.h"
+#include "Poco/String.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
+#include "Poco/DateTime.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/DateTimeParser.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/StreamCopier.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+HTTPStaticFileService::HTTPStaticFileService(const std::string& rootPath):
+	_rootPath(Poco::Path(rootPath).makeAbsolute().makeDirectory().toString()),
+	_indexFile("index.html"),
+	_cacheTimeout(1, 0)
+{
+	_contentTypes["html"] = "text/html";
+	_contentTypes["htm"]  = "text/html";
+	_contentTypes["css"]  = "text/css";
+	_contentTypes["js"]   = "application/javascript";
+	_contentTypes["json"] = "application/json";
+	_contentTypes["xml"]  = "application/xml";
+	_contentTypes["txt"]  = "text/plain";
+	_contentTypes["png"]  = "image/png";
+	_contentTypes["jpg"]  = "image/jpeg";
+	_contentTypes["jpeg"] = "image/jpeg";
+	_contentTypes["gif"]  = "image/gif";
+	_contentTypes["svg"]  = "image/svg+xml";
+	_contentTypes["ico"]  = "image/x-icon";
+	_contentTypes["woff"] = "font/woff";
+	_contentTypes["woff2"] = "font/woff2";
+	_contentTypes["pdf"]  = "application/pdf";
+	_contentTypes["zip"]  = "application/zip";
+	_contentTypes["gz"]   = "application/gzip";
+	_contentTypes["wasm"] = "application/wasm";
+}
+
+
+HTTPStaticFileService::~HTTPStaticFileService()
+{
+}
+
+
+void HTTPStaticFileService::setIndexFile(const std::string& indexFile)
+{
+	_indexFile = indexFile;
+}
+
+
+void HTTPStaticFileService::setCacheTimeout(const Poco::Timespan& timeout)
+{
+	Poco::FastMutex::ScopedLock lock(_cacheMutex);
+	_cacheTimeout = timeout;
+}
+
+
+void HTTPStaticFileService::addContentType(const std::string& extension, const std::string& contentType)
+{
+	_contentTypes[Poco::toLower(extension)] = contentType;
+}
+
+
+HTTPRequestHandler* HTTPStaticFileService::createHandler()
+{
+	return new HTTPStaticFileHandler(*this);
+}
+
+
+void HTTPStaticFileService::flushCache()
+{
+	Poco::FastMutex::ScopedLock lock(_cacheMutex);
+	_statCache.clear();
+}
+
+
+bool HTTPStaticFileService::resolve(const std::string& uriPath, std::string& fsPath) const
+{
+	// only origin-form targets can be mapped into the root; a relative
+	// request-target would keep leading ".." components after parsing
+	if (uriPath.empty() || uriPath[0] != '/') return false;
+
+	Poco::Path relative(uriPath, Poco::Path::PATH_UNIX);
+	relative.makeFile();
+	// reject anything a filesystem would walk out of the root with:
+	// parent references that survived parsing, and backslashes, which
+	// Windows treats as separators
+	for (int i = 0; i < relative.depth(); i++)
+	{
+		const std::string& dir = relative.directory(i);
+		if (dir == ".." || dir.find('\\') != std::string::npos) return false;
+	}
+	if (relative.getFileName() == ".." || relative.getFileName().find('\\') != std::string::npos) return false;
+
+	Poco::Path requested(_rootPath);
+	requested.append(relative);
+	requested.makeAbsolute();
+	fsPath = requested.toString();
+	// by construction fsPath is now below the (absolute, canonical)
+	// root; keep the prefix check as a backstop
+	return fsPath.compare(0, _rootPath.size(), _rootPath) == 0;
+}
+
+
+bool HTTPStaticFileService::statFile(const std::string& fsPath, FileInfo& info)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_cacheMutex);
+		if (_cacheTimeout.totalMicroseconds() > 0)
+		{
+			std::map<std::string, FileInfo>::iterator it = _statCache.find(fsPath);
+			if (it != _statCache.end() && !it->second.cachedAt.isElapsed(_cacheTimeout.totalMicroseconds()))
+			{
+				info = it->second;
+				return info.exists;
+			}
+		}
+	}
+
+	Poco::File file(fsPath);
+	info.exists = file.exists();
+	info.isDirectory = info.exists && file.isDirectory();
+	if (info.exists && !info.isDirectory)
+	{
+		info.size = file.getSize();
+		info.lastModified = file.getLastModified();
+		// weak by construction (size + mtime); enough to catch any
+		// file replacement that changes either
+		info.etag = "\"";
+		Poco::NumberFormatter::appendHex(info.etag, info.size);
+		info.etag += '-';
+		Poco::NumberFormatter::appendHex(info.etag, static_cast<Poco::UInt64>(info.lastModified.epochMicroseconds()));
+		info.etag += '"';
+	}
+	else
+	{
+		info.size = 0;
+		info.etag.clear();
+	}
+	info.cachedAt = Poco::Timestamp();
+
+	if (_cacheTimeout.totalMicroseconds() > 0)
+	{
+		Poco::FastMutex::ScopedLock lock(_cacheMutex);
+		_statCache[fsPath] = info;
+	}
+	return info.exists;
+}
+
+
+const std::string& HTTPStaticFileService::contentTypeFor(const std::string& fsPath) const
+{
+	static const std::string defaultType("application/octet-stream");
+	std::string extension = Poco::toLower(Poco::Path(fsPath).getExtension());
+	std::map<std::string, std::string>::const_iterator it = _contentTypes.find(extension);
+	return it != _contentTypes.end() ? it->second : defaultType;
+}
+
+
+void HTTPStaticFileService::handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+{
+	const std::string& method = request.getMethod();
+	if (method != HTTPRequest::HTTP_GET && method != HTTPRequest::HTTP_HEAD)
+	{
+		response.setStatusAndReason(HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+		response.set("Allow", "GET, HEAD");
+		response.send();
+		return;
+	}
+
+	std::string uriPath = Poco::URI(request.getURI()).getPath();
+	std::string fsPath;
+	if (!resolve(uriPath, fsPath))
+	{
+		response.setStatusAndReason(HTTPResponse::HTTP_FORBIDDEN);
+		response.send();
+		return;
+	}
+
+	FileInfo info;
+	bool exists = statFile(fsPath, info);
+	if (exists && info.isDirectory && !_indexFile.empty())
+	{
+		Poco::Path indexPath(fsPath);
+		indexPath.makeDirectory().setFileName(_indexFile);
+		fsPath = indexPath.toString();
+		exists = statFile(fsPath, info);
+	}
+	if (!exists || info.isDirectory)
+	{
+		response.setStatusAndReason(HTTPResponse::HTTP_NOT_FOUND);
+		response.send();
+		return;
+	}
+
+	// conditional requests
+	const std::string& ifNoneMatch = request.get("If-None-Match", HTTPMessage::EMPTY);
+	if (!ifNoneMatch.empty() && ifNoneMatch == info.etag)
+	{
+		response.setStatusAndReason(HTTPResponse::HTTP_NOT_MODIFIED);
+		response.set("ETag", info.etag);
+		response.send();
+		return;
+	}
+	const std::string& ifModifiedSince = request.get("If-Modified-Since", HTTPMessage::EMPTY);
+	if (ifNoneMatch.empty() && !ifModifiedSince.empty())
+	{
+		try
+		{
+			int tzd;
+			Poco::DateTime since = Poco::DateTimeParser::parse(ifModifiedSince, tzd);
+			since.makeUTC(tzd);
+			// HTTP dates have one-second resolution
+			if (info.lastModified.epochTime() <= since.timestamp().epochTime())
+			{
+				response.setStatusAndReason(HTTPResponse::HTTP_NOT_MODIFIED);
+				response.set("ETag", info.etag);
+				response.send();
+				return;
+			}
+		}
+		catch (Poco::Exception&)
+		{
+			// unparsable date: ignore the condition
+		}
+	}
+
+	response.set("ETag", info.etag);
+	response.set("Last-Modified", Poco::DateTimeFormatter::format(info.lastModified, Poco::DateTimeFormat::HTTP_FORMAT));
+	response.set("Accept-Ranges", "bytes");
+
+	const std::string& range = request.get("Range", HTTPMessage::EMPTY);
+	if (!range.empty() && method == HTTPRequest::HTTP_GET)
+	{
+		sendRange(request, response, fsPath, info, range);
+		return;
+	}
+
+	if (method == HTTPRequest::HTTP_HEAD)
+	{
+		response.setContentType(contentTypeFor(fsPath));
+		response.setContentLength64(info.size);
+		response.send();
+		return;
+	}
+
+	// the full-file path uses sendfile on Linux
+	response.sendFile(fsPath, contentTypeFor(fsPath));
+}
+
+
+void HTTPStaticFileService::sendRange(HTTPServerRequest& request, HTTPServerResponse& response, const std::string& fsPath, const FileInfo& info, const std::string& rangeHeader)
+{
+	// single ranges only: "bytes=first-last", "bytes=first-", "bytes=-suffix"
+	Poco::UInt64 first = 0;
+	Poco::UInt64 last = info.size > 0 ? info.size - 1 : 0;
+	bool valid = false;
+	if (rangeHeader.compare(0, 6, "bytes=") == 0 && rangeHeader.find(',') == std::string::npos)
+	{
+		std::string spec = rangeHeader.substr(6);
+		std::string::size_type dash = spec.find('-');
+		if (dash != std::string::npos)
+		{
+			std::string fromStr = spec.substr(0, dash);
+			std::string toStr = spec.substr(dash + 1);
+			try
+			{
+				if (fromStr.empty() && !toStr.empty())
+				{
+					// suffix range: last N bytes
+					Poco::UInt64 suffix = Poco::NumberParser::parseUnsigned64(toStr);
+					if (suffix > 0 && info.size > 0)
+					{
+						first = suffix >= info.size ? 0 : info.size - suffix;
+						valid = true;
+					}
+				}
+				else if (!fromStr.empty())
+				{
+					first = Poco::NumberParser::parseUnsigned64(fromStr);
+					if (!toStr.empty()) last = Poco::NumberParser::parseUnsigned64(toStr);
+					if (last > info.size - 1) last = info.size - 1;
+					valid = info.size > 0 && first <= last && first < info.size;
+				}
+			}
+			catch (Poco::Exception&)
+			{
+			}
+		}
+	}
+	if (!valid)
+	{
+		response.setStatusAndReason(HTTPResponse::HTTP_REQUESTED_RANGE_NOT_SATISFIABLE);
+		response.set("Content-Range", "bytes */" + Poco::NumberFormatter::format(info.size));
+		response.send();
+		return;
+	}
+
+	Poco::UInt64 length = last - first + 1;
+	response.setStatusAndReason(HTTPResponse::HTTP_PARTIAL_CONTENT);
+	response.setContentType(contentTypeFor(fsPath));
+	response.set("Content-Range", "bytes " + Poco::NumberFormatter::format(first) + "-" + Poco::NumberFormatter::format(last) + "/" + Poco::NumberFormatter::format(info.size));
+	response.setContentLength64(length);
+
+	Poco::FileInputStream istr(fsPath);
+	istr.seekg(static_cast<std::streamoff>(first), std::ios::beg);
+	std::ostream& ostr = response.send();
+	Poco::UInt64 remaining = length;
+	Poco::Buffer<char> buffer(65536);
+	while (remaining > 0 && istr.good())
+	{
+		std::streamsize chunk = remaining > buffer.size() ? static_cast<std::streamsize>(buffer.size()) : static_cast<std::streamsize>(remaining);
+		istr.read(buffer.begin(), chunk);
+		std::streamsize n = istr.gcount();
+		if (n <= 0) break;
+		ostr.write(buffer.begin(), n);
+		remaining -= static_cast<Poco::UInt64>(n);
+	}
+}
+
+
+HTTPStaticFileHandler::HTTPStaticFileHandler(HTTPStaticFileService& service):
+	_service(service)
+{
+}
+
+
+void HTTPStaticFileHandler::handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+{
+	_service.handleRequest(request, response);
+}
+
+
+} } // namespace Poco::Net
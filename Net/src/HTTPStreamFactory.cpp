@@ -14,6 +14,7 @@
 
 #include "Poco/Net/HTTPStreamFactory.h"
 #include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPClientConnectionPool.h"
 #include "Poco/Net/HTTPIOStream.h"
 #include "Poco/Net/HTTPRequest.h"
 #include "Poco/Net/HTTPResponse.h"
@@ -71,6 +72,7 @@ std::istream* HTTPStreamFactory::open(const URI& uri)
 	URI resolvedURI(uri);
 	URI proxyUri;
 	HTTPClientSession* pSession = 0;
+	Poco::SharedPtr<HTTPClientSession> pPooledSession;
 	HTTPResponse res;
 	bool retry = false;
 	bool authorize = false;
@@ -83,7 +85,15 @@ std::istream* HTTPStreamFactory::open(const URI& uri)
 		{
 			if (!pSession)
 			{
-				pSession = new HTTPClientSession(resolvedURI.getHost(), resolvedURI.getPort());
+				if (proxyUri.empty() && _proxyHost.empty())
+				{
+					// reuse a warm keep-alive connection if the
+					// pool has one for this host
+					pPooledSession = HTTPClientConnectionPool::defaultPool().borrow(resolvedURI);
+					pSession = pPooledSession.get();
+				}
+				else
+					pSession = new HTTPClientSession(resolvedURI.getHost(), resolvedURI.getPort());
 			
 				if (proxyUri.empty())
 				{
@@ -137,6 +147,8 @@ std::istream* HTTPStreamFactory::open(const URI& uri)
 			}
 			else if (res.getStatus() == HTTPResponse::HTTP_OK)
 			{
+				if (pPooledSession)
+					return new HTTPResponseStream(rs, pPooledSession);
 				return new HTTPResponseStream(rs, pSession);
 			}
 			else if (res.getStatus() == HTTPResponse::HTTP_USE_PROXY && !retry)
@@ -147,7 +159,8 @@ std::istream* HTTPStreamFactory::open(const URI& uri)
 				// single request via the proxy. 305 responses MUST only be generated by origin servers.
 				// only use for one single request!
 				proxyUri.resolve(res.get("Location"));
-				delete pSession;
+				if (pPooledSession) pPooledSession = 0;
+				else delete pSession;
 				pSession = 0;
 				retry = true; // only allow useproxy once
 			}
@@ -165,7 +178,8 @@ std::istream* HTTPStreamFactory::open(const URI& uri)
 	}
 	catch (...)
 	{
-		delete pSession;
+		if (pPooledSession) pPooledSession = 0;
+		else delete pSession;
 		throw;
 	}
 }
@@ -60,7 +60,12 @@ int ICMPClient::ping(const SocketAddress& address, int repeat) const
 {
 	if (repeat <= 0) return 0;
 
-	ICMPSocket icmpSocket(_family, _dataSize, _ttl, _timeout);
+	// create the raw socket once and reuse it for subsequent
+	// sequences; probing fleets of endpoints no longer pays a
+	// socket setup/teardown per target
+	if (!_pSocket)
+		_pSocket = new ICMPSocket(_family, _dataSize, _ttl, _timeout);
+	ICMPSocket& icmpSocket = *_pSocket;
 
 	ICMPEventArgs eventArgs(address, repeat, icmpSocket.dataSize(), icmpSocket.ttl());
 	pingBegin.notify(this, eventArgs);
@@ -59,6 +59,12 @@ namespace Poco {
 namespace Net {
 
 
+namespace
+{
+	const std::size_t LARGE_COPY_BUFFER_SIZE = 65536;
+}
+
+
 namespace
 {
 	class MultiPartHandler: public PartHandler
@@ -493,19 +499,21 @@ void MailMessage::writeEncoded(std::istream& istr, std::ostream& ostr, ContentTr
 	{
 	case ENCODING_7BIT:
 	case ENCODING_8BIT:
-		StreamCopier::copyStream(istr, ostr);
+		StreamCopier::copyStream(istr, ostr, LARGE_COPY_BUFFER_SIZE);
 		break;
 	case ENCODING_QUOTED_PRINTABLE:
 		{
 			QuotedPrintableEncoder encoder(ostr);
-			StreamCopier::copyStream(istr, encoder);
+			StreamCopier::copyStream(istr, encoder, LARGE_COPY_BUFFER_SIZE);
 			encoder.close();
 		}
 		break;
 	case ENCODING_BASE64:
 		{
+			// large chunks feed the encoder's block-wise bulk path,
+			// so big attachments stream without per-byte overhead
 			Base64Encoder encoder(ostr);
-			StreamCopier::copyStream(istr, encoder);
+			StreamCopier::copyStream(istr, encoder, LARGE_COPY_BUFFER_SIZE);
 			encoder.close();
 		}
 		break;
@@ -108,8 +108,13 @@ void MessageHeader::read(std::istream& istr, RecipientList* pRecipients)
 				throw MessageException("Folded field value too long/no CRLF found");
 		}
 		Poco::trimRightInPlace(value);
-		add(name, decodeWord(value));
 		if (pRecipients) getRecipients(name, value, pRecipients);
+		// moving the value avoids a copy per header; HTTP headers
+		// practically never contain RFC 2047 encoded words
+		if (value.find("=?") != std::string::npos)
+			add(name, decodeWord(value));
+		else
+			add(name, std::move(value));
 		++fields;
 
 	}
@@ -44,6 +44,7 @@ NameValueCollection& NameValueCollection::operator = (const NameValueCollection&
 {
 	if (&nvc != this)
 	{
+		invalidateIndex();
 		_map = nvc._map;
 	}
 	return *this;
@@ -52,13 +53,15 @@ NameValueCollection& NameValueCollection::operator = (const NameValueCollection&
 
 void NameValueCollection::swap(NameValueCollection& nvc)
 {
+	invalidateIndex();
+	nvc.invalidateIndex();
 	std::swap(_map, nvc._map);
 }
 
 	
 const std::string& NameValueCollection::operator [] (const std::string& name) const
 {
-	ConstIterator it = _map.find(name);
+	ConstIterator it = lookup(name);
 	if (it != _map.end())
 		return it->second;
 	else
@@ -68,6 +71,7 @@ const std::string& NameValueCollection::operator [] (const std::string& name) co
 
 void NameValueCollection::set(const std::string& name, const std::string& value)	
 {
+	invalidateIndex();
 	Iterator it = _map.find(name);
 	if (it != _map.end())
 		it->second = value;
@@ -78,13 +82,21 @@ void NameValueCollection::set(const std::string& name, const std::string& value)
 	
 void NameValueCollection::add(const std::string& name, const std::string& value)
 {
+	invalidateIndex();
 	_map.insert(HeaderMap::ValueType(name, value));
 }
 
 
+void NameValueCollection::add(const std::string& name, std::string&& value)
+{
+	invalidateIndex();
+	_map.insert(HeaderMap::ValueType(name, std::move(value)));
+}
+
+
 const std::string& NameValueCollection::get(const std::string& name) const
 {
-	ConstIterator it = _map.find(name);
+	ConstIterator it = lookup(name);
 	if (it != _map.end())
 		return it->second;
 	else
@@ -94,7 +106,7 @@ const std::string& NameValueCollection::get(const std::string& name) const
 
 const std::string& NameValueCollection::get(const std::string& name, const std::string& defaultValue) const
 {
-	ConstIterator it = _map.find(name);
+	ConstIterator it = lookup(name);
 	if (it != _map.end())
 		return it->second;
 	else
@@ -104,13 +116,43 @@ const std::string& NameValueCollection::get(const std::string& name, const std::
 
 bool NameValueCollection::has(const std::string& name) const
 {
-	return _map.find(name) != _map.end();
+	return lookup(name) != _map.end();
 }
 
 
 NameValueCollection::ConstIterator NameValueCollection::find(const std::string& name) const
 {
-	return _map.find(name);
+	return lookup(name);
+}
+
+
+NameValueCollection::ConstIterator NameValueCollection::lookup(const std::string& name) const
+{
+	if (_map.size() <= INDEX_THRESHOLD)
+		return _map.find(name);
+
+	if (!_indexValid)
+	{
+		// lazily build a case-folded index over the entries; it is
+		// discarded on any mutation
+		_index.clear();
+		for (ConstIterator it = _map.begin(); it != _map.end(); ++it)
+		{
+			std::string folded = Poco::toLower(it->first);
+			if (_index.find(folded) == _index.end())
+				_index[folded] = it;
+		}
+		_indexValid = true;
+	}
+	NameIndex::const_iterator it = _index.find(Poco::toLower(name));
+	if (it != _index.end()) return it->second;
+	return _map.end();
+}
+
+
+void NameValueCollection::invalidateIndex()
+{
+	_indexValid = false;
 }
 
 	
@@ -140,12 +182,14 @@ std::size_t NameValueCollection::size() const
 
 void NameValueCollection::erase(const std::string& name)
 {
+	invalidateIndex();
 	_map.erase(name);
 }
 
 
 void NameValueCollection::clear()
 {
+	invalidateIndex();
 	_map.clear();
 }
 
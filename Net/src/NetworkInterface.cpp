@@ -882,6 +882,44 @@ std::string NetworkInterface::toString(const MACAddress& addr)
 }
 
 
+namespace
+{
+	//
+	// cache for cachedList(); keyed by the (ipOnly, upOnly) flags
+	//
+	struct InterfaceListCache
+	{
+		Poco::FastMutex mutex;
+		NetworkInterface::List lists[4];
+		Poco::Timestamp refreshed[4];
+		bool valid[4] = { false, false, false, false };
+	};
+
+	InterfaceListCache& interfaceListCache()
+	{
+		static InterfaceListCache cache;
+		return cache;
+	}
+}
+
+
+NetworkInterface::List NetworkInterface::cachedList(long maxAgeMilliseconds, bool ipOnly, bool upOnly)
+{
+	InterfaceListCache& cache = interfaceListCache();
+	int slot = (ipOnly ? 1 : 0) | (upOnly ? 2 : 0);
+
+	Poco::FastMutex::ScopedLock lock(cache.mutex);
+	if (!cache.valid[slot] || maxAgeMilliseconds <= 0 ||
+		cache.refreshed[slot].isElapsed(Poco::Timestamp::TimeDiff(maxAgeMilliseconds)*1000))
+	{
+		cache.lists[slot] = list(ipOnly, upOnly);
+		cache.refreshed[slot].update();
+		cache.valid[slot] = true;
+	}
+	return cache.lists[slot];
+}
+
+
 NetworkInterface::List NetworkInterface::list(bool ipOnly, bool upOnly)
 {
 	List list;
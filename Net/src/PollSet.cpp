@@ -54,9 +54,10 @@ namespace Net {
 class PollSetImpl
 {
 public:
-	PollSetImpl():
+	explicit PollSetImpl(PollSet::TriggerMode triggerMode):
 		_epollfd(-1),
-		_events(1024)
+		_events(1024),
+		_eventFlags(triggerMode == PollSet::TRIGGER_EDGE ? EPOLLET : 0)
 	{
 		_epollfd = epoll_create(1);
 		if (_epollfd < 0)
@@ -78,7 +79,7 @@ public:
 		SocketImpl* sockImpl = socket.impl();
 		poco_socket_t fd = sockImpl->sockfd();
 		struct epoll_event ev;
-		ev.events = 0;
+		ev.events = _eventFlags;
 		if (mode & PollSet::POLL_READ)
 			ev.events |= EPOLLIN;
 		if (mode & PollSet::POLL_WRITE)
@@ -126,11 +127,16 @@ public:
 		return _socketMap.empty();
 	}
 
+	PollSet::TriggerMode triggerMode() const
+	{
+		return _eventFlags ? PollSet::TRIGGER_EDGE : PollSet::TRIGGER_LEVEL;
+	}
+
 	void update(const Socket& socket, int mode)
 	{
 		poco_socket_t fd = socket.impl()->sockfd();
 		struct epoll_event ev;
-		ev.events = 0;
+		ev.events = _eventFlags;
 		if (mode & PollSet::POLL_READ)
 			ev.events |= EPOLLIN;
 		if (mode & PollSet::POLL_WRITE)
@@ -210,6 +216,7 @@ private:
 	int                             _epollfd;
 	std::map<void*, Socket>         _socketMap;
 	std::vector<struct epoll_event> _events;
+	Poco::UInt32                    _eventFlags;
 };
 
 
@@ -222,6 +229,17 @@ private:
 class PollSetImpl
 {
 public:
+	explicit PollSetImpl(PollSet::TriggerMode)
+		// poll()/WSAPoll() only support level-triggered operation;
+		// TRIGGER_EDGE silently falls back to TRIGGER_LEVEL.
+	{
+	}
+
+	PollSet::TriggerMode triggerMode() const
+	{
+		return PollSet::TRIGGER_LEVEL;
+	}
+
 	void add(const Socket& socket, int mode)
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
@@ -392,6 +410,17 @@ private:
 class PollSetImpl
 {
 public:
+	explicit PollSetImpl(PollSet::TriggerMode)
+		// select() only supports level-triggered operation;
+		// TRIGGER_EDGE silently falls back to TRIGGER_LEVEL.
+	{
+	}
+
+	PollSet::TriggerMode triggerMode() const
+	{
+		return PollSet::TRIGGER_LEVEL;
+	}
+
 	void add(const Socket& socket, int mode)
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
@@ -526,8 +555,8 @@ private:
 #endif
 
 
-PollSet::PollSet():
-	_pImpl(new PollSetImpl)
+PollSet::PollSet(TriggerMode triggerMode):
+	_pImpl(new PollSetImpl(triggerMode))
 {
 }
 
@@ -568,6 +597,12 @@ bool PollSet::empty() const
 }
 
 
+PollSet::TriggerMode PollSet::triggerMode() const
+{
+	return _pImpl->triggerMode();
+}
+
+
 void PollSet::clear()
 {
 	_pImpl->clear();
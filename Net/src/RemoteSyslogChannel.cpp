@@ -21,6 +21,7 @@
 #include "Poco/LoggingFactory.h"
 #include "Poco/Instantiator.h"
 #include "Poco/String.h"
+#include "Poco/NumberParser.h"
 
 
 namespace Poco {
@@ -34,6 +35,10 @@ const std::string RemoteSyslogChannel::PROP_FACILITY("facility");
 const std::string RemoteSyslogChannel::PROP_FORMAT("format");
 const std::string RemoteSyslogChannel::PROP_LOGHOST("loghost");
 const std::string RemoteSyslogChannel::PROP_HOST("host");
+const std::string RemoteSyslogChannel::PROP_TRANSPORT("transport");
+const std::string RemoteSyslogChannel::PROP_BATCH_SIZE("batchSize");
+const std::string RemoteSyslogChannel::PROP_FLUSH_INTERVAL("flushInterval");
+const std::string RemoteSyslogChannel::PROP_QUEUE_SIZE("queueSize");
 const std::string RemoteSyslogChannel::STRUCTURED_DATA("structured-data");
 
 
@@ -42,7 +47,15 @@ RemoteSyslogChannel::RemoteSyslogChannel():
 	_name("-"),
 	_facility(SYSLOG_USER),
 	_bsdFormat(false),
-	_open(false)
+	_tcp(false),
+	_batchSize(100),
+	_flushInterval(1000),
+	_queueLimit(10000),
+	_tcpConnected(false),
+	_open(false),
+	_dropped(0),
+	_senderAdapter(*this, &RemoteSyslogChannel::runSender),
+	_stopSender(false)
 {
 }
 
@@ -52,7 +65,15 @@ RemoteSyslogChannel::RemoteSyslogChannel(const std::string& address, const std::
 	_name(name),
 	_facility(facility),
 	_bsdFormat(bsdFormat),
-	_open(false)
+	_tcp(false),
+	_batchSize(100),
+	_flushInterval(1000),
+	_queueLimit(10000),
+	_tcpConnected(false),
+	_open(false),
+	_dropped(0),
+	_senderAdapter(*this, &RemoteSyslogChannel::runSender),
+	_stopSender(false)
 {
 	if (_name.empty()) _name = "-";
 }
@@ -81,7 +102,7 @@ void RemoteSyslogChannel::open()
 		_socketAddress = SocketAddress(_logHost, SYSLOG_PORT);
 
 	// reset socket for the case that it has been previously closed
-	_socket = DatagramSocket(_socketAddress.family());
+	if (!_tcp) _socket = DatagramSocket(_socketAddress.family());
 
 	if (_host.empty())
 	{
@@ -96,14 +117,35 @@ void RemoteSyslogChannel::open()
 	}
 
 	_open = true;
+	if (_tcp)
+	{
+		_stopSender = false;
+		_senderThread.start(_senderAdapter);
+	}
 }
 
 	
 void RemoteSyslogChannel::close()
 {
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
 	if (_open)
 	{
-		_socket.close();
+		if (_tcp)
+		{
+			_stopSender = true;
+			_queueEvent.set();
+			_senderThread.join();
+			if (_tcpConnected)
+			{
+				try { _tcpSocket.close(); } catch (...) {}
+				_tcpConnected = false;
+			}
+		}
+		else
+		{
+			_socket.close();
+		}
 		_open = false;
 	}
 }
@@ -117,6 +159,31 @@ void RemoteSyslogChannel::log(const Message& msg)
 
 	std::string m;
 	m.reserve(1024);
+	formatMessage(msg, m);
+
+	if (_tcp)
+	{
+		Poco::FastMutex::ScopedLock qLock(_queueMutex);
+		if (_queue.size() >= _queueLimit)
+		{
+			// bounded queue: losing the newest message is better
+			// than blocking the logging thread on a dead collector
+			++_dropped;
+			return;
+		}
+		_queue.push_back(m);
+		if (_queue.size() >= static_cast<std::size_t>(_batchSize))
+			_queueEvent.set();
+	}
+	else
+	{
+		_socket.sendTo(m.data(), static_cast<int>(m.size()), _socketAddress);
+	}
+}
+
+
+void RemoteSyslogChannel::formatMessage(const Message& msg, std::string& m)
+{
 	m += '<';
 	Poco::NumberFormatter::append(m, getPrio(msg) + _facility);
 	m += '>';
@@ -150,8 +217,122 @@ void RemoteSyslogChannel::log(const Message& msg)
 	}
 	m += ' ';
 	m += msg.getText();
+}
+
+
+void RemoteSyslogChannel::runSender()
+{
+	Poco::UInt64 backoff = 0;
+	std::deque<std::string> pending;
+	while (!_stopSender)
+	{
+		_queueEvent.tryWait(_flushInterval);
+		if (pending.empty())
+		{
+			Poco::FastMutex::ScopedLock qLock(_queueMutex);
+			std::size_t n = _queue.size();
+			if (n > static_cast<std::size_t>(_batchSize)) n = static_cast<std::size_t>(_batchSize);
+			for (std::size_t i = 0; i < n; i++)
+			{
+				pending.push_back(std::string());
+				pending.back().swap(_queue.front());
+				_queue.pop_front();
+			}
+		}
+		if (pending.empty()) continue;
 
-	_socket.sendTo(m.data(), static_cast<int>(m.size()), _socketAddress);
+		// RFC 6587 octet-counted framing: "MSG-LEN SP MSG" per message
+		std::string batch;
+		for (std::deque<std::string>::const_iterator it = pending.begin(); it != pending.end(); ++it)
+		{
+			Poco::NumberFormatter::append(batch, static_cast<Poco::UInt64>(it->size()));
+			batch += ' ';
+			batch += *it;
+		}
+		if (sendBatch(batch))
+		{
+			pending.clear();
+			backoff = 0;
+		}
+		else
+		{
+			// collector unreachable: keep the batch for retry and
+			// back off exponentially (1s doubling to 30s)
+			backoff = backoff ? backoff*2 : 1000;
+			if (backoff > 30000) backoff = 30000;
+			Poco::UInt64 slept = 0;
+			while (!_stopSender && slept < backoff)
+			{
+				Poco::Thread::sleep(100);
+				slept += 100;
+			}
+		}
+	}
+	// last chance flush on shutdown
+	if (!pending.empty())
+	{
+		std::string batch;
+		for (std::deque<std::string>::const_iterator it = pending.begin(); it != pending.end(); ++it)
+		{
+			Poco::NumberFormatter::append(batch, static_cast<Poco::UInt64>(it->size()));
+			batch += ' ';
+			batch += *it;
+		}
+		sendBatch(batch);
+	}
+}
+
+
+bool RemoteSyslogChannel::sendBatch(const std::string& batch)
+{
+	try
+	{
+		if (_tcpConnected)
+		{
+			// a collector that went away is only discovered on the
+			// next send, which TCP happily buffers; probe for EOF
+			// first so the batch is not written into a dead socket
+			if (_tcpSocket.poll(0, Socket::SELECT_READ))
+			{
+				char probe;
+				if (_tcpSocket.receiveBytes(&probe, 1, MSG_PEEK) <= 0)
+				{
+					try { _tcpSocket.close(); } catch (...) {}
+					_tcpConnected = false;
+				}
+			}
+		}
+		if (!_tcpConnected)
+		{
+			_tcpSocket = StreamSocket(_socketAddress);
+			_tcpSocket.setNoDelay(true);
+			_tcpConnected = true;
+		}
+		int sent = 0;
+		while (sent < static_cast<int>(batch.size()))
+		{
+			int n = _tcpSocket.sendBytes(batch.data() + sent, static_cast<int>(batch.size()) - sent);
+			if (n <= 0) throw Poco::IOException("syslog send failed");
+			sent += n;
+		}
+		return true;
+	}
+	catch (Poco::Exception&)
+	{
+		if (_tcpConnected)
+		{
+			try { _tcpSocket.close(); } catch (...) {}
+			_tcpConnected = false;
+		}
+		return false;
+	}
+}
+
+
+Poco::UInt64 RemoteSyslogChannel::droppedCount() const
+{
+	Poco::FastMutex::ScopedLock lock(_queueMutex);
+	return _dropped;
 }
 
 
@@ -233,6 +414,24 @@ void RemoteSyslogChannel::setProperty(const std::string& name, const std::string
 	{
 		_bsdFormat = (value == "bsd" || value == "rfc3164");
 	}
+	else if (name == PROP_TRANSPORT)
+	{
+		_tcp = (Poco::icompare(value, "tcp") == 0);
+	}
+	else if (name == PROP_BATCH_SIZE)
+	{
+		_batchSize = Poco::NumberParser::parse(value);
+		if (_batchSize < 1) _batchSize = 1;
+	}
+	else if (name == PROP_FLUSH_INTERVAL)
+	{
+		_flushInterval = Poco::NumberParser::parse(value);
+		if (_flushInterval < 1) _flushInterval = 1;
+	}
+	else if (name == PROP_QUEUE_SIZE)
+	{
+		_queueLimit = Poco::NumberParser::parseUnsigned(value);
+	}
 	else
 	{
 		Channel::setProperty(name, value);
@@ -314,6 +513,22 @@ std::string RemoteSyslogChannel::getProperty(const std::string& name) const
 	{
 		return _bsdFormat ? "rfc3164" : "rfc5424";
 	}
+	else if (name == PROP_TRANSPORT)
+	{
+		return _tcp ? "tcp" : "udp";
+	}
+	else if (name == PROP_BATCH_SIZE)
+	{
+		return Poco::NumberFormatter::format(_batchSize);
+	}
+	else if (name == PROP_FLUSH_INTERVAL)
+	{
+		return Poco::NumberFormatter::format(_flushInterval);
+	}
+	else if (name == PROP_QUEUE_SIZE)
+	{
+		return Poco::NumberFormatter::format(static_cast<Poco::UInt64>(_queueLimit));
+	}
 	else
 	{
 		return Channel::getProperty(name);
@@ -94,6 +94,7 @@ void SMTPClientSession::login(const std::string& hostname, std::string& response
 	if (isPermanentNegative(status))
 		status = sendCommand("HELO", hostname, response);
 	if (!isPositiveCompletion(status)) throw SMTPException("Login failed", response, status);
+	_pipelining = Poco::ifind(response, std::string("PIPELINING")) != std::string::npos;
 }
 
 
@@ -338,26 +339,62 @@ void SMTPClientSession::sendCommands(const MailMessage& message, const Recipient
 
 	if (!isPositiveCompletion(status)) throw SMTPException("Cannot send message", response, status);
 	
-	std::ostringstream recipient;
+	std::vector<std::string> recipients;
 	if (pRecipients)
 	{
 		for (Recipients::const_iterator it = pRecipients->begin(); it != pRecipients->end(); ++it)
-		{
-			recipient << '<' << *it << '>';
-			int status2 = sendCommand("RCPT TO:", recipient.str(), response);
-			if (!isPositiveCompletion(status2)) throw SMTPException(std::string("Recipient rejected: ") + recipient.str(), response, status2);
-			recipient.str("");
-		}
+			recipients.push_back("<" + *it + ">");
 	}
 	else
 	{
 		for (MailMessage::Recipients::const_iterator it = message.recipients().begin(); it != message.recipients().end(); ++it)
+			recipients.push_back("<" + it->getAddress() + ">");
+	}
+
+	if (_pipelining)
+	{
+		// RFC 2920: send all RCPT TO commands (and DATA) in one
+		// batch, then collect the responses in order -- one round
+		// trip instead of one per recipient
+		for (std::vector<std::string>::const_iterator it = recipients.begin(); it != recipients.end(); ++it)
+			_socket.sendMessage("RCPT TO:", *it);
+		_socket.sendMessage("DATA");
+		// all replies must be read, even after a rejection: DATA is
+		// already on the wire and its reply is still outstanding
+		std::string failedRecipient;
+		std::string failedResponse;
+		int failedStatus = 0;
+		for (std::vector<std::string>::const_iterator it = recipients.begin(); it != recipients.end(); ++it)
 		{
-			recipient << '<' << it->getAddress() << '>';
-			int status2 = sendCommand("RCPT TO:", recipient.str(), response);
-			if (!isPositiveCompletion(status2)) throw SMTPException(std::string("Recipient rejected: ") + recipient.str(), response, status2);
-			recipient.str("");
+			int status2 = _socket.receiveStatusMessage(response);
+			if (!isPositiveCompletion(status2) && failedStatus == 0)
+			{
+				failedRecipient = *it;
+				failedResponse = response;
+				failedStatus = status2;
+			}
 		}
+		status = _socket.receiveStatusMessage(response);
+		if (failedStatus != 0)
+		{
+			// leave the session in command state before throwing: if
+			// the server accepted DATA, the data phase must be
+			// terminated, or the next command would be read as mail text
+			if (isPositiveIntermediate(status))
+			{
+				_socket.sendMessage(".");
+				_socket.receiveStatusMessage(response);
+			}
+			throw SMTPException(std::string("Recipient rejected: ") + failedRecipient, failedResponse, failedStatus);
+		}
+		if (!isPositiveIntermediate(status)) throw SMTPException("Cannot send message data", response, status);
+		return;
+	}
+
+	for (std::vector<std::string>::const_iterator it = recipients.begin(); it != recipients.end(); ++it)
+	{
+		int status2 = sendCommand("RCPT TO:", *it, response);
+		if (!isPositiveCompletion(status2)) throw SMTPException(std::string("Recipient rejected: ") + *it, response, status2);
 	}
 
 	status = sendCommand("DATA", response);
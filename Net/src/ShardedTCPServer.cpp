@@ -0,0 +1,170 @@
+//
+// ShardedTCPServer.cpp
+//
+// Library: Net
+// Package: TCPServer
+// Module:  ShardedTCPServer
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/ShardedTCPServer.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Exception.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+ShardedTCPServer::ShardedTCPServer(TCPServerConnectionFactory::Ptr pFactory, Poco::UInt16 portNumber, TCPServerParams::Ptr pParams)
+{
+	int shardCount = pParams ? pParams->getShardCount() : 1;
+	int maxThreads = pParams ? pParams->getMaxThreads() : 0;
+	if (maxThreads <= 0) maxThreads = 16;
+
+	ServerSocket firstSocket;
+	firstSocket.bind(SocketAddress(portNumber), true, true);
+	firstSocket.listen(64);
+	Poco::UInt16 boundPort = firstSocket.address().port();
+
+	try
+	{
+		for (int i = 0; i < shardCount; i++)
+		{
+			ServerSocket shardSocket(firstSocket);
+			if (i > 0)
+			{
+				try
+				{
+					// Give every shard its own listening socket; with
+					// SO_REUSEPORT the kernel spreads incoming connections
+					// across the shard sockets.
+					ServerSocket ownSocket;
+					ownSocket.bind(SocketAddress(boundPort), true, true);
+					ownSocket.listen(64);
+					shardSocket = ownSocket;
+				}
+				catch (NetException&)
+				{
+					// SO_REUSEPORT not supported; all shards accept
+					// from the first shard's listening socket.
+				}
+			}
+			Poco::ThreadPool* pPool = new Poco::ThreadPool(2, maxThreads);
+			_pools.push_back(pPool);
+			_shards.push_back(new TCPServer(pFactory, *pPool, shardSocket, pParams));
+		}
+	}
+	catch (...)
+	{
+		for (ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+			delete *it;
+		for (PoolVec::iterator it = _pools.begin(); it != _pools.end(); ++it)
+			delete *it;
+		throw;
+	}
+}
+
+
+ShardedTCPServer::~ShardedTCPServer()
+{
+	try
+	{
+		stop();
+		for (ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+			delete *it;
+		for (PoolVec::iterator it = _pools.begin(); it != _pools.end(); ++it)
+			delete *it;
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+const TCPServerParams& ShardedTCPServer::params() const
+{
+	return _shards.front()->params();
+}
+
+
+void ShardedTCPServer::start()
+{
+	for (ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+		(*it)->start();
+}
+
+
+void ShardedTCPServer::stop()
+{
+	for (ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+		(*it)->stop();
+}
+
+
+int ShardedTCPServer::currentThreads() const
+{
+	int n = 0;
+	for (ShardVec::const_iterator it = _shards.begin(); it != _shards.end(); ++it)
+		n += (*it)->currentThreads();
+	return n;
+}
+
+
+int ShardedTCPServer::totalConnections() const
+{
+	int n = 0;
+	for (ShardVec::const_iterator it = _shards.begin(); it != _shards.end(); ++it)
+		n += (*it)->totalConnections();
+	return n;
+}
+
+
+int ShardedTCPServer::currentConnections() const
+{
+	int n = 0;
+	for (ShardVec::const_iterator it = _shards.begin(); it != _shards.end(); ++it)
+		n += (*it)->currentConnections();
+	return n;
+}
+
+
+int ShardedTCPServer::queuedConnections() const
+{
+	int n = 0;
+	for (ShardVec::const_iterator it = _shards.begin(); it != _shards.end(); ++it)
+		n += (*it)->queuedConnections();
+	return n;
+}
+
+
+int ShardedTCPServer::refusedConnections() const
+{
+	int n = 0;
+	for (ShardVec::const_iterator it = _shards.begin(); it != _shards.end(); ++it)
+		n += (*it)->refusedConnections();
+	return n;
+}
+
+
+Poco::UInt16 ShardedTCPServer::port() const
+{
+	return _shards.front()->port();
+}
+
+
+void ShardedTCPServer::setConnectionFilter(const TCPServerConnectionFilter::Ptr& pFilter)
+{
+	for (ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+		(*it)->setConnectionFilter(pFilter);
+}
+
+
+} } // namespace Poco::Net
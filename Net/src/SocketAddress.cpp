@@ -42,6 +42,16 @@ namespace Poco {
 namespace Net {
 
 
+// every implementation placement-constructed into the inline
+// storage must fit it
+static_assert(sizeof(Poco::Net::Impl::IPv4SocketAddressImpl) <= sizeof(Poco::Net::Impl::IPv6SocketAddressImpl),
+	"IPv4 socket address implementation exceeds inline storage");
+#if defined(POCO_OS_FAMILY_UNIX)
+static_assert(sizeof(Poco::Net::Impl::LocalSocketAddressImpl) <= sizeof(Poco::Net::Impl::IPv6SocketAddressImpl),
+	"local socket address implementation exceeds inline storage");
+#endif
+
+
 struct AFLT
 {
 	bool operator () (const IPAddress& a1, const IPAddress& a2)
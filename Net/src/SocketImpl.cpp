@@ -17,6 +17,7 @@
 #include "Poco/Net/StreamSocketImpl.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/Timestamp.h"
+#include "Poco/Clock.h"
 #include <string.h> // FD_SET needs memset on some platforms, so we can't use <cstring>
 
 
@@ -40,6 +41,11 @@
 #endif
 
 
+#if POCO_OS == POCO_OS_LINUX
+#include <linux/errqueue.h>
+#endif
+
+
 #if defined(sun) || defined(__sun) || defined(__sun__)
 #include <unistd.h>
 #include <stropts.h>
@@ -79,6 +85,21 @@ bool checkIsBrokenTimeout()
 }
 
 
+std::atomic<const SocketHooks*> SocketImpl::_pHooks(nullptr);
+
+
+void SocketImpl::setSocketHooks(const SocketHooks* pHooks)
+{
+	_pHooks.store(pHooks, std::memory_order_release);
+}
+
+
+const SocketHooks* SocketImpl::socketHooks()
+{
+	return _pHooks.load(std::memory_order_relaxed);
+}
+
+
 SocketImpl::SocketImpl():
 	_sockfd(POCO_INVALID_SOCKET),
 	_blocking(true),
@@ -116,6 +137,8 @@ SocketImpl* SocketImpl::acceptConnection(SocketAddress& clientAddr)
 	while (sd == POCO_INVALID_SOCKET && lastError() == POCO_EINTR);
 	if (sd != POCO_INVALID_SOCKET)
 	{
+		const SocketHooks* pHooks = socketHooks();
+		if (pHooks && pHooks->accept) pHooks->accept(sd);
 		clientAddr = SocketAddress(pSA, saLen);
 		return new StreamSocketImpl(sd);
 	}
@@ -130,6 +153,9 @@ void SocketImpl::connect(const SocketAddress& address)
 	{
 		init(address.af());
 	}
+	const SocketHooks* pHooks = socketHooks();
+	if (pHooks && pHooks->connectStart) pHooks->connectStart(_sockfd, address);
+	Poco::Clock started;
 	int rc;
 	do
 	{
@@ -140,6 +166,7 @@ void SocketImpl::connect(const SocketAddress& address)
 #endif
 	}
 	while (rc != 0 && lastError() == POCO_EINTR);
+	if (pHooks && pHooks->connectComplete) pHooks->connectComplete(_sockfd, address, started.elapsed(), rc != 0 ? lastError() : 0);
 	if (rc != 0)
 	{
 		int err = lastError();
@@ -274,6 +301,8 @@ void SocketImpl::close()
 {
 	if (_sockfd != POCO_INVALID_SOCKET)
 	{
+		const SocketHooks* pHooks = socketHooks();
+		if (pHooks && pHooks->close) pHooks->close(_sockfd);
 		poco_closesocket(_sockfd);
 		_sockfd = POCO_INVALID_SOCKET;
 	}
@@ -555,6 +584,80 @@ int SocketImpl::receiveFrom(SocketBufVec& buffers, SocketAddress& address, int f
 }
 
 
+int SocketImpl::sendMultiple(DatagramVec& datagrams, int flags)
+{
+	if (datagrams.empty()) return 0;
+#if POCO_OS == POCO_OS_LINUX
+	std::vector<struct mmsghdr> msgs(datagrams.size());
+	for (std::size_t i = 0; i < datagrams.size(); i++)
+	{
+		poco_assert (!datagrams[i].buffers.empty());
+		std::memset(&msgs[i], 0, sizeof(struct mmsghdr));
+		msgs[i].msg_hdr.msg_name = const_cast<sockaddr*>(datagrams[i].address.addr());
+		msgs[i].msg_hdr.msg_namelen = datagrams[i].address.length();
+		msgs[i].msg_hdr.msg_iov = const_cast<iovec*>(&datagrams[i].buffers[0]);
+		msgs[i].msg_hdr.msg_iovlen = datagrams[i].buffers.size();
+	}
+	int rc;
+	do
+	{
+		rc = ::sendmmsg(_sockfd, &msgs[0], static_cast<unsigned>(msgs.size()), flags);
+	}
+	while (rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0) error();
+	for (int i = 0; i < rc; i++)
+		datagrams[i].length = static_cast<int>(msgs[i].msg_len);
+	return rc;
+#else
+	int sent = 0;
+	for (DatagramVec::iterator it = datagrams.begin(); it != datagrams.end(); ++it)
+	{
+		it->length = sendTo(it->buffers, it->address, flags);
+		++sent;
+	}
+	return sent;
+#endif
+}
+
+
+int SocketImpl::receiveMultiple(DatagramVec& datagrams, int flags)
+{
+	if (datagrams.empty()) return 0;
+#if POCO_OS == POCO_OS_LINUX
+	checkBrokenTimeout(SELECT_READ);
+	std::vector<struct mmsghdr> msgs(datagrams.size());
+	std::vector<struct sockaddr_storage> addrs(datagrams.size());
+	for (std::size_t i = 0; i < datagrams.size(); i++)
+	{
+		poco_assert (!datagrams[i].buffers.empty());
+		std::memset(&msgs[i], 0, sizeof(struct mmsghdr));
+		msgs[i].msg_hdr.msg_name = &addrs[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+		msgs[i].msg_hdr.msg_iov = &datagrams[i].buffers[0];
+		msgs[i].msg_hdr.msg_iovlen = datagrams[i].buffers.size();
+	}
+	int rc;
+	do
+	{
+		rc = ::recvmmsg(_sockfd, &msgs[0], static_cast<unsigned>(msgs.size()), flags, 0);
+	}
+	while (rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0) error();
+	for (int i = 0; i < rc; i++)
+	{
+		datagrams[i].length = static_cast<int>(msgs[i].msg_len);
+		datagrams[i].address = SocketAddress(reinterpret_cast<struct sockaddr*>(&addrs[i]), msgs[i].msg_hdr.msg_namelen);
+	}
+	return rc;
+#else
+	// without recvmmsg, receive a single datagram to avoid blocking
+	// on packets that may never arrive
+	datagrams[0].length = receiveFrom(datagrams[0].buffers, datagrams[0].address, flags);
+	return datagrams[0].length >= 0 ? 1 : 0;
+#endif
+}
+
+
 int SocketImpl::receiveFrom(SocketBufVec& buffers, struct sockaddr** pSA, poco_socklen_t** ppSALen, int flags)
 {
 	checkBrokenTimeout(SELECT_READ);
@@ -614,6 +717,149 @@ int SocketImpl::available()
 }
 
 
+void SocketImpl::setReceiveTimestamping(bool flag)
+{
+#if defined(SO_TIMESTAMPNS)
+	int value = flag ? 1 : 0;
+	setOption(SOL_SOCKET, SO_TIMESTAMPNS, value);
+#else
+	(void) flag;
+#endif
+}
+
+
+bool SocketImpl::getReceiveTimestamping()
+{
+#if defined(SO_TIMESTAMPNS)
+	int value(0);
+	getOption(SOL_SOCKET, SO_TIMESTAMPNS, value);
+	return value != 0;
+#else
+	return false;
+#endif
+}
+
+
+void SocketImpl::setBusyPoll(int microseconds)
+{
+#if defined(SO_BUSY_POLL)
+	try
+	{
+		setOption(SOL_SOCKET, SO_BUSY_POLL, microseconds);
+	}
+	catch (Poco::Exception&)
+	{
+		// requires CAP_NET_ADMIN on older kernels; treat as best effort
+	}
+#else
+	(void) microseconds;
+#endif
+}
+
+
+int SocketImpl::getBusyPoll()
+{
+#if defined(SO_BUSY_POLL)
+	int value(0);
+	getOption(SOL_SOCKET, SO_BUSY_POLL, value);
+	return value;
+#else
+	return 0;
+#endif
+}
+
+
+void SocketImpl::setZeroCopy(bool flag)
+{
+#if defined(SO_ZEROCOPY)
+	int value = flag ? 1 : 0;
+	try
+	{
+		setOption(SOL_SOCKET, SO_ZEROCOPY, value);
+	}
+	catch (Poco::Exception&)
+	{
+		// pre-4.14 kernels reject the option; treat as best effort
+	}
+#else
+	(void) flag;
+#endif
+}
+
+
+bool SocketImpl::getZeroCopy()
+{
+#if defined(SO_ZEROCOPY)
+	int value(0);
+	try
+	{
+		getOption(SOL_SOCKET, SO_ZEROCOPY, value);
+	}
+	catch (Poco::Exception&)
+	{
+	}
+	return value != 0;
+#else
+	return false;
+#endif
+}
+
+
+int SocketImpl::sendBytesZeroCopy(const void* buffer, int length)
+{
+#if defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY)
+	if (getZeroCopy())
+		return sendBytes(buffer, length, MSG_ZEROCOPY);
+#endif
+	return sendBytes(buffer, length);
+}
+
+
+bool SocketImpl::nextZeroCopyCompletion(Poco::UInt32& first, Poco::UInt32& last)
+{
+#if POCO_OS == POCO_OS_LINUX && defined(MSG_ZEROCOPY)
+	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+
+	struct msghdr msg;
+	char control[128];
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+	int rc;
+	do
+	{
+		rc = ::recvmsg(_sockfd, &msg, MSG_ERRQUEUE);
+	}
+	while (rc == -1 && lastError() == POCO_EINTR);
+	if (rc == -1)
+	{
+		int err = lastError();
+		if (err == POCO_EAGAIN || err == POCO_EWOULDBLOCK) return false;
+		error(err);
+	}
+	for (struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&msg); pCmsg; pCmsg = CMSG_NXTHDR(&msg, pCmsg))
+	{
+		if ((pCmsg->cmsg_level == SOL_IP && pCmsg->cmsg_type == IP_RECVERR) ||
+		    (pCmsg->cmsg_level == SOL_IPV6 && pCmsg->cmsg_type == IPV6_RECVERR))
+		{
+			struct sock_extended_err* pErr = reinterpret_cast<struct sock_extended_err*>(CMSG_DATA(pCmsg));
+			if (pErr->ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+			{
+				first = pErr->ee_info;
+				last  = pErr->ee_data;
+				return true;
+			}
+		}
+	}
+	return false;
+#else
+	(void) first;
+	(void) last;
+	return false;
+#endif
+}
+
+
 bool SocketImpl::secure() const
 {
 	return false;
@@ -1217,6 +1463,11 @@ void SocketImpl::error(int code)
 
 void SocketImpl::error(int code, const std::string& arg)
 {
+	if (code != POCO_ENOERR)
+	{
+		const SocketHooks* pHooks = socketHooks();
+		if (pHooks && pHooks->error) pHooks->error(POCO_INVALID_SOCKET, code);
+	}
 	switch (code)
 	{
 	case POCO_ENOERR: return;
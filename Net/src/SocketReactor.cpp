@@ -88,13 +88,17 @@ void SocketReactor::run()
 					PollSet::SocketModeMap::iterator end = sm.end();
 					for (; it != end; ++it)
 					{
+						// look the notifier up once per socket, not
+						// once per event
+						NotifierPtr pNotifier = getNotifier(it->first);
+						if (!pNotifier) continue;
 						if (it->second & PollSet::POLL_READ)
 						{
-							dispatch(it->first, _pReadableNotification);
+							dispatch(pNotifier, _pReadableNotification);
 							readable = true;
 						}
-						if (it->second & PollSet::POLL_WRITE) dispatch(it->first, _pWritableNotification);
-						if (it->second & PollSet::POLL_ERROR) dispatch(it->first, _pErrorNotification);
+						if (it->second & PollSet::POLL_WRITE) dispatch(pNotifier, _pWritableNotification);
+						if (it->second & PollSet::POLL_ERROR) dispatch(pNotifier, _pErrorNotification);
 					}
 				}
 				if (!readable) onTimeout();
@@ -119,18 +123,12 @@ void SocketReactor::run()
 
 bool SocketReactor::hasSocketHandlers()
 {
-	if (!_pollSet.empty())
-	{
-		ScopedLock lock(_mutex);
-		for (EventHandlerMap::iterator it = _handlers.begin(); it != _handlers.end(); ++it)
-		{
-			if (it->second->accepts(_pReadableNotification) ||
-				it->second->accepts(_pWritableNotification) ||
-				it->second->accepts(_pErrorNotification)) return true;
-		}
-	}
-
-	return false;
+	// sockets only enter the poll set with at least one readable,
+	// writable or error observer, so the set being non-empty is
+	// equivalent to the former per-handler scan -- without taking
+	// the reactor mutex and three notifier locks per handler on
+	// every loop iteration
+	return !_pollSet.empty();
 }
 
 
@@ -13,10 +13,20 @@
 
 
 #include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/PollSet.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Timestamp.h"
 #include "Poco/Net/StreamSocketImpl.h"
 #include "Poco/FIFOBuffer.h"
 #include "Poco/Mutex.h"
+#include "Poco/CancellationToken.h"
 #include "Poco/Exception.h"
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <poll.h>
+#include <errno.h>
+#endif
 
 
 using Poco::InvalidArgumentException;
@@ -121,6 +131,103 @@ int StreamSocket::sendBytes(const void* buffer, int length, int flags)
 }
 
 
+int StreamSocket::sendBytes(const Poco::ConstBufferRef& buffer)
+{
+	return impl()->sendBytes(buffer.data(), static_cast<int>(buffer.size()));
+}
+
+
+int StreamSocket::receiveBytes(const Poco::BufferRef& buffer)
+{
+	return impl()->receiveBytes(buffer.data(), static_cast<int>(buffer.size()));
+}
+
+
+int StreamSocket::receiveBytes(void* buffer, int length, const Poco::CancellationToken& token)
+{
+#if !defined(_WIN32)
+	token.throwIfCancelled();
+
+	// self-pipe wakeup: the cancel callback writes one byte, which
+	// makes the poll below return immediately. The pipe state is
+	// shared and mutex-guarded because a cancel() already in
+	// delivery keeps running after removeCallback(): the callback
+	// must never touch descriptors this function has closed (the
+	// numbers could already be reused by unrelated opens).
+	struct WakePipe
+	{
+		Poco::FastMutex mutex;
+		bool closed;
+		int fds[2];
+	};
+	Poco::SharedPtr<WakePipe> pWake = new WakePipe;
+	pWake->closed = false;
+	if (::pipe(pWake->fds) != 0) throw Poco::SystemException("cannot create cancellation pipe");
+	int callbackId = token.onCancel([pWake]() mutable
+	{
+		Poco::FastMutex::ScopedLock lock(pWake->mutex);
+		if (pWake->closed) return;
+		char wake = 1;
+		ssize_t rc;
+		do
+		{
+			rc = ::write(pWake->fds[1], &wake, 1);
+		}
+		while (rc < 0 && errno == EINTR);
+	});
+	int pipefd[2] = { pWake->fds[0], pWake->fds[1] };
+	try
+	{
+		Poco::Timespan timeout = impl()->getReceiveTimeout();
+		int timeoutMs = timeout.totalMicroseconds() > 0 ? static_cast<int>(timeout.totalMilliseconds()) : -1;
+		struct pollfd fds[2];
+		fds[0].fd = impl()->sockfd();
+		fds[0].events = POLLIN;
+		fds[1].fd = pipefd[0];
+		fds[1].events = POLLIN;
+		int rc;
+		do
+		{
+			fds[0].revents = 0;
+			fds[1].revents = 0;
+			rc = ::poll(fds, 2, timeoutMs);
+		}
+		while (rc < 0 && errno == EINTR);
+		int pollError = rc < 0 ? errno : 0;
+		if (token.isCancelled()) throw Poco::InterruptedException("receive cancelled");
+		if (rc < 0) throw NetException("poll failed (error " + Poco::NumberFormatter::format(pollError) + ")");
+		if (rc == 0) throw Poco::TimeoutException();
+		token.removeCallback(callbackId);
+		{
+			Poco::FastMutex::ScopedLock lock(pWake->mutex);
+			pWake->closed = true;
+			::close(pipefd[0]);
+			::close(pipefd[1]);
+		}
+		return impl()->receiveBytes(buffer, length);
+	}
+	catch (...)
+	{
+		token.removeCallback(callbackId);
+		{
+			Poco::FastMutex::ScopedLock lock(pWake->mutex);
+			pWake->closed = true;
+			::close(pipefd[0]);
+			::close(pipefd[1]);
+		}
+		throw;
+	}
+#else
+	// no self-pipe on Windows; fall back to the plain (timeout
+	// bounded) receive with a cancellation check around it
+	token.throwIfCancelled();
+	int rc = impl()->receiveBytes(buffer, length);
+	token.throwIfCancelled();
+	return rc;
+#endif
+}
+
+
 int StreamSocket::sendBytes(const SocketBufVec& buffers, int flags)
 {
 	return impl()->sendBytes(buffers, flags);
@@ -137,6 +244,18 @@ int StreamSocket::sendBytes(FIFOBuffer& fifoBuf)
 }
 
 
+int StreamSocket::sendBytesZeroCopy(const void* buffer, int length)
+{
+	return impl()->sendBytesZeroCopy(buffer, length);
+}
+
+
+bool StreamSocket::nextZeroCopyCompletion(Poco::UInt32& first, Poco::UInt32& last)
+{
+	return impl()->nextZeroCopyCompletion(first, last);
+}
+
+
 int StreamSocket::receiveBytes(void* buffer, int length, int flags)
 {
 	return impl()->receiveBytes(buffer, length, flags);
@@ -171,4 +290,72 @@ void StreamSocket::sendUrgent(unsigned char data)
 }
 
 
+StreamSocket StreamSocket::connectAny(const std::vector<SocketAddress>& addresses, const Poco::Timespan& timeout, const Poco::Timespan& stagger)
+{
+	poco_assert (!addresses.empty());
+
+	std::vector<StreamSocket> pending;
+	PollSet pollSet;
+	std::size_t next = 0;
+	std::string lastError("connection attempt failed");
+	Poco::Timestamp start;
+
+	while (start.elapsed() < timeout.totalMicroseconds())
+	{
+		if (next < addresses.size())
+		{
+			// start the next staggered attempt
+			try
+			{
+				StreamSocket candidate;
+				candidate.connectNB(addresses[next]);
+				pending.push_back(candidate);
+				pollSet.add(candidate, PollSet::POLL_WRITE | PollSet::POLL_ERROR);
+			}
+			catch (Poco::Exception& exc)
+			{
+				lastError = addresses[next].toString() + ": " + exc.displayText();
+			}
+			++next;
+		}
+		if (pending.empty())
+		{
+			if (next >= addresses.size()) break;
+			continue;
+		}
+
+		PollSet::SocketModeMap sm = pollSet.poll(next < addresses.size() ? stagger : Poco::Timespan(timeout.totalMicroseconds() - start.elapsed()));
+		for (PollSet::SocketModeMap::const_iterator it = sm.begin(); it != sm.end(); ++it)
+		{
+			std::vector<StreamSocket>::iterator itp = pending.begin();
+			while (itp != pending.end() && itp->impl() != it->first.impl()) ++itp;
+			if (itp == pending.end()) continue;
+			StreamSocket candidate = *itp;
+			pollSet.remove(candidate);
+			pending.erase(itp);
+
+			int error = 0;
+			candidate.impl()->getOption(SOL_SOCKET, SO_ERROR, error);
+			if (error == 0 && (it->second & PollSet::POLL_WRITE))
+			{
+				// winner: abandon the remaining attempts
+				for (std::vector<StreamSocket>::iterator ito = pending.begin(); ito != pending.end(); ++ito)
+				{
+					pollSet.remove(*ito);
+					try { ito->close(); } catch (...) {}
+				}
+				candidate.setBlocking(true);
+				return candidate;
+			}
+			lastError = "connect failed (error " + Poco::NumberFormatter::format(error) + ")";
+			try { candidate.close(); } catch (...) {}
+		}
+		if (pending.empty() && next >= addresses.size()) break;
+	}
+	if (start.elapsed() >= timeout.totalMicroseconds())
+		throw Poco::TimeoutException("connectAny timed out");
+	throw NetException(lastError);
+}
+
+
 } } // namespace Poco::Net
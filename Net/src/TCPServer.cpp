@@ -223,6 +223,12 @@ void TCPServer::setConnectionFilter(const TCPServerConnectionFilter::Ptr& pConne
 }
 
 
+void TCPServer::enqueueConnection(const StreamSocket& socket)
+{
+	_pDispatcher->enqueue(socket);
+}
+
+
 std::string TCPServer::threadName(const ServerSocket& socket)
 {
 #if _WIN32_WCE == 0x0800
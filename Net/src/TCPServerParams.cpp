@@ -23,7 +23,8 @@ TCPServerParams::TCPServerParams():
 	_threadIdleTime(10000000),
 	_maxThreads(0),
 	_maxQueued(64),
-	_threadPriority(Poco::Thread::PRIO_NORMAL)
+	_threadPriority(Poco::Thread::PRIO_NORMAL),
+	_shardCount(1)
 {
 }
 
@@ -61,4 +62,12 @@ void TCPServerParams::setThreadPriority(Poco::Thread::Priority prio)
 }
 
 
+void TCPServerParams::setShardCount(int count)
+{
+	poco_assert (count > 0);
+
+	_shardCount = count;
+}
+
+
 } } // namespace Poco::Net
@@ -24,12 +24,16 @@ UDPServerParams::UDPServerParams(const Poco::Net::SocketAddress& sa,
 	Poco::Timespan timeout,
 	std::size_t handlerBufListSize,
 	bool notifySender,
-	int  backlogThreshold): _sa(sa),
+	int  backlogThreshold,
+	bool reusePort,
+	int batchSize): _sa(sa),
 		_nSockets(nSockets),
 		_timeout(timeout),
 		_handlerBufListSize(handlerBufListSize),
 		_notifySender(notifySender),
-		_backlogThreshold(backlogThreshold)
+		_backlogThreshold(backlogThreshold),
+		_reusePort(reusePort),
+		_batchSize(batchSize)
 {
 }
 
@@ -141,11 +141,18 @@ WebSocketImpl* WebSocket::accept(HTTPServerRequest& request, HTTPServerResponse&
 		response.set("Upgrade", "websocket");
 		response.set("Connection", "Upgrade");
 		response.set("Sec-WebSocket-Accept", computeAccept(key));
+		bool compress = offersPerMessageDeflate(request.get("Sec-WebSocket-Extensions", ""));
+		if (compress)
+		{
+			response.set("Sec-WebSocket-Extensions", "permessage-deflate; server_no_context_takeover; client_no_context_takeover");
+		}
 		response.setContentLength(0);
 		response.send().flush();
 		
 		HTTPServerRequestImpl& requestImpl = static_cast<HTTPServerRequestImpl&>(request);
-		return new WebSocketImpl(static_cast<StreamSocketImpl*>(requestImpl.detachSocket().impl()), requestImpl.session(), false);
+		WebSocketImpl* pImpl = new WebSocketImpl(static_cast<StreamSocketImpl*>(requestImpl.detachSocket().impl()), requestImpl.session(), false);
+		if (compress) pImpl->enableCompression();
+		return pImpl;
 	}
 	else throw WebSocketException("No WebSocket handshake", WS_ERR_NO_HANDSHAKE);
 }
@@ -162,6 +169,11 @@ WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, H
 	request.set("Upgrade", "websocket");
 	request.set("Sec-WebSocket-Version", WEBSOCKET_VERSION);
 	request.set("Sec-WebSocket-Key", key);
+	if (!request.has("Sec-WebSocket-Extensions"))
+	{
+		// offer permessage-deflate (RFC 7692) without context takeover
+		request.set("Sec-WebSocket-Extensions", "permessage-deflate; client_no_context_takeover; server_no_context_takeover");
+	}
 	request.setChunkedTransferEncoding(false);
 	cs.setKeepAlive(true);
 	cs.sendRequest(request);
@@ -213,7 +225,24 @@ WebSocketImpl* WebSocket::completeHandshake(HTTPClientSession& cs, HTTPResponse&
 	std::string accept = response.get("Sec-WebSocket-Accept", "");
 	if (accept != computeAccept(key))
 		throw WebSocketException("Invalid or missing Sec-WebSocket-Accept header in handshake response", WS_ERR_HANDSHAKE_ACCEPT);
-	return new WebSocketImpl(static_cast<StreamSocketImpl*>(cs.detachSocket().impl()), cs, true);
+	WebSocketImpl* pImpl = new WebSocketImpl(static_cast<StreamSocketImpl*>(cs.detachSocket().impl()), cs, true);
+	if (offersPerMessageDeflate(response.get("Sec-WebSocket-Extensions", "")))
+	{
+		pImpl->enableCompression();
+	}
+	return pImpl;
+}
+
+
+bool WebSocket::offersPerMessageDeflate(const std::string& extensions)
+{
+	// accept the extension only in the parameterizations the
+	// implementation handles: plain permessage-deflate, optionally
+	// with no-context-takeover parameters, but without custom
+	// window bits
+	if (extensions.find("permessage-deflate") == std::string::npos) return false;
+	if (extensions.find("max_window_bits") != std::string::npos) return false;
+	return true;
 }
 
 
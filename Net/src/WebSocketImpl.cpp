@@ -22,18 +22,159 @@
 #include "Poco/MemoryStream.h"
 #include "Poco/Format.h"
 #include <cstring>
+#if defined(POCO_UNBUNDLED)
+#include <zlib.h>
+#else
+#include "Poco/zlib.h"
+#endif
 
 
 namespace Poco {
 namespace Net {
 
 
+namespace
+{
+	void applyMask(char* dest, const char* src, int length, const char mask[4])
+		/// XORs src with the repeating four-byte mask into dest
+		/// (dest may equal src for in-place unmasking), processing
+		/// eight bytes per iteration instead of one.
+	{
+		Poco::UInt64 mask64;
+		std::memcpy(&mask64, mask, 4);
+		std::memcpy(reinterpret_cast<char*>(&mask64) + 4, mask, 4);
+		int i = 0;
+		for (; i + 8 <= length; i += 8)
+		{
+			Poco::UInt64 chunk;
+			std::memcpy(&chunk, src + i, 8);
+			chunk ^= mask64;
+			std::memcpy(dest + i, &chunk, 8);
+		}
+		for (; i < length; i++)
+		{
+			dest[i] = src[i] ^ mask[i & 3];
+		}
+	}
+}
+
+
+
+class WebSocketImpl::PerMessageDeflateContext
+	/// Pooled zlib state for the permessage-deflate extension
+	/// (RFC 7692), negotiated without context takeover: the deflater
+	/// is reset per message, while the inflater processes the peer's
+	/// messages as one continuous raw deflate stream, which decodes
+	/// both takeover and no-takeover senders correctly.
+{
+public:
+	PerMessageDeflateContext()
+	{
+		std::memset(&_deflate, 0, sizeof(_deflate));
+		int rc = deflateInit2(&_deflate, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+		if (rc != Z_OK) throw WebSocketException(zError(rc), WebSocket::WS_ERR_UNAUTHORIZED);
+		std::memset(&_inflate, 0, sizeof(_inflate));
+		rc = inflateInit2(&_inflate, -15);
+		if (rc != Z_OK)
+		{
+			deflateEnd(&_deflate);
+			throw WebSocketException(zError(rc), WebSocket::WS_ERR_UNAUTHORIZED);
+		}
+	}
+
+	~PerMessageDeflateContext()
+	{
+		deflateEnd(&_deflate);
+		inflateEnd(&_inflate);
+	}
+
+	int compress(const char* data, int length, Poco::Buffer<char>& out)
+		/// Deflates one message; returns the compressed size with
+		/// the trailing empty block (00 00 FF FF) stripped.
+	{
+		deflateReset(&_deflate); // no context takeover
+		out.resize(static_cast<std::size_t>(deflateBound(&_deflate, length)) + 8, false);
+		_deflate.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+		_deflate.avail_in  = static_cast<uInt>(length);
+		_deflate.next_out  = reinterpret_cast<Bytef*>(out.begin());
+		_deflate.avail_out = static_cast<uInt>(out.size());
+		int rc = deflate(&_deflate, Z_SYNC_FLUSH);
+		if (rc != Z_OK) throw WebSocketException(zError(rc), WebSocket::WS_ERR_INCOMPLETE_FRAME);
+		int compressedLength = static_cast<int>(out.size() - _deflate.avail_out);
+		poco_assert (compressedLength >= 4);
+		return compressedLength - 4;
+	}
+
+	int decompress(const char* data, int length, bool final, char* out, int capacity)
+		/// Inflates one frame into the given buffer; returns the
+		/// number of decompressed bytes. The terminating empty
+		/// block is re-appended on the final frame of a message.
+	{
+		int produced = inflateChunk(data, length, out, capacity);
+		if (final)
+		{
+			static const char tail[] = {0x00, 0x00, '\xff', '\xff'};
+			produced += inflateChunk(tail, 4, out + produced, capacity - produced);
+		}
+		return produced;
+	}
+
+	void decompressAppend(const char* data, int length, bool final, Poco::Buffer<char>& out)
+		/// Like decompress(), but appends to a growable buffer.
+	{
+		appendChunk(data, length, out);
+		if (final)
+		{
+			static const char tail[] = {0x00, 0x00, '\xff', '\xff'};
+			appendChunk(tail, 4, out);
+		}
+	}
+
+private:
+	int inflateChunk(const char* data, int length, char* out, int capacity)
+	{
+		_inflate.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+		_inflate.avail_in  = static_cast<uInt>(length);
+		_inflate.next_out  = reinterpret_cast<Bytef*>(out);
+		_inflate.avail_out = static_cast<uInt>(capacity);
+		int rc = inflate(&_inflate, Z_SYNC_FLUSH);
+		if (rc != Z_OK && rc != Z_BUF_ERROR)
+			throw WebSocketException(zError(rc), WebSocket::WS_ERR_INCOMPLETE_FRAME);
+		if (_inflate.avail_in > 0)
+			throw WebSocketException("Insufficient buffer for decompressed payload", WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+		return capacity - static_cast<int>(_inflate.avail_out);
+	}
+
+	void appendChunk(const char* data, int length, Poco::Buffer<char>& out)
+	{
+		_inflate.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+		_inflate.avail_in = static_cast<uInt>(length);
+		do
+		{
+			char chunk[16384];
+			_inflate.next_out  = reinterpret_cast<Bytef*>(chunk);
+			_inflate.avail_out = sizeof(chunk);
+			int rc = inflate(&_inflate, Z_SYNC_FLUSH);
+			if (rc != Z_OK && rc != Z_BUF_ERROR)
+				throw WebSocketException(zError(rc), WebSocket::WS_ERR_INCOMPLETE_FRAME);
+			out.append(chunk, sizeof(chunk) - _inflate.avail_out);
+		}
+		while (_inflate.avail_in > 0 || _inflate.avail_out == 0);
+	}
+
+	z_stream _deflate;
+	z_stream _inflate;
+};
+
+
 WebSocketImpl::WebSocketImpl(StreamSocketImpl* pStreamSocketImpl, HTTPSession& session, bool mustMaskPayload):
 	StreamSocketImpl(pStreamSocketImpl->sockfd()),
 	_pStreamSocketImpl(pStreamSocketImpl),
 	_buffer(0),
 	_bufferOffset(0),
 	_frameFlags(0),
+	_pCompression(0),
+	_inflating(false),
 	_mustMaskPayload(mustMaskPayload)
 {
 	poco_check_ptr(pStreamSocketImpl);
@@ -44,6 +185,7 @@ WebSocketImpl::WebSocketImpl(StreamSocketImpl* pStreamSocketImpl, HTTPSession& s
 
 WebSocketImpl::~WebSocketImpl()
 {
+	delete _pCompression;
 	try
 	{
 		_pStreamSocketImpl->release();
@@ -56,8 +198,37 @@ WebSocketImpl::~WebSocketImpl()
 }
 
 
+void WebSocketImpl::enableCompression()
+{
+	if (!_pCompression) _pCompression = new PerMessageDeflateContext;
+}
+
+
+bool WebSocketImpl::compressionEnabled() const
+{
+	return _pCompression != 0;
+}
+
+
 int WebSocketImpl::sendBytes(const void* buffer, int length, int flags)
 {
+	if (flags == 0) flags = WebSocket::FRAME_BINARY;
+	if (_pCompression && length > 0
+		&& (flags & WebSocket::FRAME_FLAG_FIN) != 0
+		&& (flags & WebSocket::FRAME_FLAG_RSV1) == 0
+		&& (flags & WebSocket::FRAME_OP_SETRAW) == 0
+		&& ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_TEXT ||
+			(flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_BINARY))
+	{
+		Poco::Buffer<char> compressed(0);
+		int compressedLength = _pCompression->compress(reinterpret_cast<const char*>(buffer), length, compressed);
+		if (compressedLength < length)
+		{
+			sendBytes(compressed.begin(), compressedLength, flags | WebSocket::FRAME_FLAG_RSV1);
+			return length;
+		}
+	}
+
 	Poco::Buffer<char> frame(length + MAX_HEADER_LENGTH);
 	Poco::MemoryOutputStream ostr(frame.begin(), frame.size());
 	Poco::BinaryWriter writer(ostr, Poco::BinaryWriter::NETWORK_BYTE_ORDER);
@@ -92,10 +263,7 @@ int WebSocketImpl::sendBytes(const void* buffer, int length, int flags)
 		const char* b = reinterpret_cast<const char*>(buffer);
 		writer.writeRaw(m, 4);
 		char* p = frame.begin() + ostr.charsWritten();
-		for (int i = 0; i < length; i++)
-		{
-			p[i] = b[i] ^ m[i % 4];
-		}
+		applyMask(p, b, length, m);
 	}
 	else
 	{
@@ -176,10 +344,7 @@ int WebSocketImpl::receivePayload(char *buffer, int payloadLength, char mask[4],
 
 	if (useMask)
 	{
-		for (int i = 0; i < received; i++)
-		{
-			buffer[i] ^= mask[i % 4];
-		}
+		applyMask(buffer, buffer, received, mask);
 	}
 	return received;
 }
@@ -192,6 +357,18 @@ int WebSocketImpl::receiveBytes(void* buffer, int length, int)
 	int payloadLength = receiveHeader(mask, useMask);
 	if (payloadLength <= 0)
 		return payloadLength;
+	// control frames may be interleaved in a fragmented message
+	// and are never compressed
+	bool controlFrame = (_frameFlags & WebSocket::FRAME_OP_BITMASK) >= WebSocket::FRAME_OP_CLOSE;
+	if (_pCompression && !controlFrame && ((_frameFlags & WebSocket::FRAME_FLAG_RSV1) != 0 || _inflating))
+	{
+		Poco::Buffer<char> raw(payloadLength);
+		receivePayload(raw.begin(), payloadLength, mask, useMask);
+		bool final = (_frameFlags & WebSocket::FRAME_FLAG_FIN) != 0;
+		_inflating = !final;
+		_frameFlags &= ~WebSocket::FRAME_FLAG_RSV1;
+		return _pCompression->decompress(raw.begin(), payloadLength, final, reinterpret_cast<char*>(buffer), length);
+	}
 	if (payloadLength > length)
 		throw WebSocketException(Poco::format("Insufficient buffer for payload size %d", payloadLength), WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
 	return receivePayload(reinterpret_cast<char*>(buffer), payloadLength, mask, useMask);
@@ -205,6 +382,18 @@ int WebSocketImpl::receiveBytes(Poco::Buffer<char>& buffer, int, const Poco::Tim
 	int payloadLength = receiveHeader(mask, useMask);
 	if (payloadLength <= 0)
 		return payloadLength;
+	bool controlFrame = (_frameFlags & WebSocket::FRAME_OP_BITMASK) >= WebSocket::FRAME_OP_CLOSE;
+	if (_pCompression && !controlFrame && ((_frameFlags & WebSocket::FRAME_FLAG_RSV1) != 0 || _inflating))
+	{
+		Poco::Buffer<char> raw(payloadLength);
+		receivePayload(raw.begin(), payloadLength, mask, useMask);
+		bool final = (_frameFlags & WebSocket::FRAME_FLAG_FIN) != 0;
+		_inflating = !final;
+		_frameFlags &= ~WebSocket::FRAME_FLAG_RSV1;
+		int oldSize = static_cast<int>(buffer.size());
+		_pCompression->decompressAppend(raw.begin(), payloadLength, final, buffer);
+		return static_cast<int>(buffer.size()) - oldSize;
+	}
 	int oldSize = static_cast<int>(buffer.size());
 	buffer.resize(oldSize + payloadLength);
 	return receivePayload(buffer.begin() + oldSize, payloadLength, mask, useMask);
@@ -12,8 +12,16 @@
 #include "Poco/CppUnit/TestCaller.h"
 #include "Poco/CppUnit/TestSuite.h"
 #include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/ServerSocket.h"
 #include "Poco/Net/HTTPRequest.h"
 #include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/NetException.h"
 #include "Poco/StreamCopier.h"
 #include "HTTPTestServer.h"
 #include <istream>
@@ -25,6 +33,7 @@ using Poco::Net::HTTPClientSession;
 using Poco::Net::HTTPRequest;
 using Poco::Net::HTTPResponse;
 using Poco::Net::HTTPMessage;
+using Poco::Net::NetException;
 using Poco::StreamCopier;
 
 
@@ -240,6 +249,100 @@ void HTTPClientSessionTest::testKeepAlive()
 }
 
 
+namespace
+{
+	class PipelineRequestHandler: public Poco::Net::HTTPRequestHandler
+	{
+	public:
+		void handleRequest(Poco::Net::HTTPServerRequest& request, Poco::Net::HTTPServerResponse& response)
+		{
+			response.setContentType("text/plain");
+			if (request.getMethod() == HTTPRequest::HTTP_HEAD)
+			{
+				response.setContentLength(HTTPTestServer::SMALL_BODY.length());
+				response.send();
+			}
+			else
+			{
+				response.sendBuffer(HTTPTestServer::SMALL_BODY.data(), HTTPTestServer::SMALL_BODY.length());
+			}
+		}
+	};
+
+	class PipelineRequestHandlerFactory: public Poco::Net::HTTPRequestHandlerFactory
+	{
+	public:
+		Poco::Net::HTTPRequestHandler* createRequestHandler(const Poco::Net::HTTPServerRequest& request)
+		{
+			return new PipelineRequestHandler;
+		}
+	};
+}
+
+
+void HTTPClientSessionTest::testPipeline()
+{
+	// HTTPTestServer answers one request per connection, so a real
+	// HTTPServer (which keeps the connection open between requests)
+	// serves the pipelined requests here
+	Poco::Net::ServerSocket ss(0);
+	Poco::Net::HTTPServer srv(new PipelineRequestHandlerFactory, ss, new Poco::Net::HTTPServerParams);
+	srv.start();
+	HTTPClientSession s("127.0.0.1", ss.address().port());
+	s.setKeepAlive(true);
+
+	HTTPRequest request1(HTTPRequest::HTTP_GET, "/small", HTTPMessage::HTTP_1_1);
+	HTTPRequest request2(HTTPRequest::HTTP_GET, "/small", HTTPMessage::HTTP_1_1);
+	HTTPRequest request3(HTTPRequest::HTTP_HEAD, "/small", HTTPMessage::HTTP_1_1);
+	assertTrue (s.pipelineRequest(request1) == 1);
+	assertTrue (s.pipelineRequest(request2) == 2);
+	assertTrue (s.pipelineRequest(request3) == 3);
+	assertTrue (s.pipelinedRequests() == 3);
+
+	// responses arrive in request order
+	HTTPResponse response;
+	std::istream& rs1 = s.receivePipelinedResponse(response);
+	assertTrue (response.getContentLength() == HTTPTestServer::SMALL_BODY.length());
+	std::ostringstream ostr1;
+	StreamCopier::copyStream(rs1, ostr1);
+	assertTrue (ostr1.str() == HTTPTestServer::SMALL_BODY);
+
+	std::istream& rs2 = s.receivePipelinedResponse(response);
+	std::ostringstream ostr2;
+	StreamCopier::copyStream(rs2, ostr2);
+	assertTrue (ostr2.str() == HTTPTestServer::SMALL_BODY);
+
+	std::istream& rs3 = s.receivePipelinedResponse(response);
+	assertTrue (response.getContentLength() == HTTPTestServer::SMALL_BODY.length());
+	std::ostringstream ostr3;
+	assertTrue (StreamCopier::copyStream(rs3, ostr3) == 0);
+	assertTrue (s.pipelinedRequests() == 0);
+
+	try
+	{
+		s.receivePipelinedResponse(response);
+		fail("no pipelined request outstanding - must throw");
+	}
+	catch (NetException&)
+	{
+	}
+
+	// requests with a message body cannot be pipelined
+	HTTPRequest post(HTTPRequest::HTTP_POST, "/echo", HTTPMessage::HTTP_1_1);
+	post.setContentLength(4);
+	try
+	{
+		s.pipelineRequest(post);
+		fail("request has a body - must throw");
+	}
+	catch (NetException&)
+	{
+	}
+
+	srv.stop();
+}
+
+
 void HTTPClientSessionTest::testProxy()
 {
 	HTTPTestServer srv;
@@ -363,6 +466,7 @@ CppUnit::Test* HTTPClientSessionTest::suite()
 	CppUnit_addTest(pSuite, HTTPClientSessionTest, testPostSmallClose);
 	CppUnit_addTest(pSuite, HTTPClientSessionTest, testPostLargeClose);
 	CppUnit_addTest(pSuite, HTTPClientSessionTest, testKeepAlive);
+	CppUnit_addTest(pSuite, HTTPClientSessionTest, testPipeline);
 	CppUnit_addTest(pSuite, HTTPClientSessionTest, testProxy);
 	CppUnit_addTest(pSuite, HTTPClientSessionTest, testProxyAuth);
 	CppUnit_addTest(pSuite, HTTPClientSessionTest, testBypassProxy);
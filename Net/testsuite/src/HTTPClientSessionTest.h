@@ -34,6 +34,7 @@ public:
 	void testPostSmallClose();
 	void testPostLargeClose();
 	void testKeepAlive();
+	void testPipeline();
 	void testProxy();
 	void testProxyAuth();
 	void testBypassProxy();
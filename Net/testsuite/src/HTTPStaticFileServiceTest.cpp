@@ -0,0 +1,224 @@
+//
+// HTTPStaticFileServiceTest.cpp
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTPStaticFileServiceTest.h"
+#include "Poco/CppUnit/TestCaller.h"
+#include "Poco/CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPStaticFileService.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/Path.h"
+#include "Poco/File.h"
+#include "Poco/FileStream.h"
+#include "Poco/TemporaryFile.h"
+#include <sstream>
+
+
+using Poco::Net::HTTPStaticFileService;
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPClientSession;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTPMessage;
+using Poco::Net::ServerSocket;
+using Poco::StreamCopier;
+
+
+namespace
+{
+	const std::string SECRET_CONTENT("TOP SECRET");
+
+
+	class StaticFileFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		StaticFileFactory(HTTPStaticFileService& service):
+			_service(service)
+		{
+		}
+
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			return _service.createHandler();
+		}
+
+	private:
+		HTTPStaticFileService& _service;
+	};
+
+
+	class StaticFileServer
+	{
+	public:
+		StaticFileServer(HTTPStaticFileService& service):
+			_socket(0),
+			_server(new StaticFileFactory(service), _socket, new HTTPServerParams)
+		{
+			_server.start();
+		}
+
+		~StaticFileServer()
+		{
+			_server.stop();
+		}
+
+		Poco::UInt16 port() const
+		{
+			return _socket.address().port();
+		}
+
+	private:
+		ServerSocket _socket;
+		HTTPServer _server;
+	};
+
+
+	std::string baseDir()
+	{
+		static std::string base(Poco::Path(Poco::Path::temp(), "pocostatictest").toString());
+		return base;
+	}
+
+
+	void writeFile(const Poco::Path& path, const std::string& content)
+	{
+		Poco::FileOutputStream ostr(path.toString());
+		ostr << content;
+	}
+
+
+	int requestStatus(HTTPClientSession& session, const std::string& target, std::string& body)
+	{
+		HTTPRequest request(HTTPRequest::HTTP_GET, target);
+		session.sendRequest(request);
+		HTTPResponse response;
+		std::istream& rs = session.receiveResponse(response);
+		body.clear();
+		std::ostringstream ostr;
+		StreamCopier::copyStream(rs, ostr);
+		body = ostr.str();
+		return response.getStatus();
+	}
+}
+
+
+HTTPStaticFileServiceTest::HTTPStaticFileServiceTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTPStaticFileServiceTest::~HTTPStaticFileServiceTest()
+{
+}
+
+
+void HTTPStaticFileServiceTest::testServeFile()
+{
+	HTTPStaticFileService service(Poco::Path(baseDir(), "web").toString());
+	StaticFileServer server(service);
+	HTTPClientSession session("127.0.0.1", server.port());
+
+	std::string body;
+	assertTrue (requestStatus(session, "/hello.txt", body) == HTTPResponse::HTTP_OK);
+	assertTrue (body == "Hello, world!");
+}
+
+
+void HTTPStaticFileServiceTest::testIndexFile()
+{
+	HTTPStaticFileService service(Poco::Path(baseDir(), "web").toString());
+	StaticFileServer server(service);
+	HTTPClientSession session("127.0.0.1", server.port());
+
+	std::string body;
+	assertTrue (requestStatus(session, "/", body) == HTTPResponse::HTTP_OK);
+	assertTrue (body == "<html/>");
+}
+
+
+void HTTPStaticFileServiceTest::testNotFound()
+{
+	HTTPStaticFileService service(Poco::Path(baseDir(), "web").toString());
+	StaticFileServer server(service);
+	HTTPClientSession session("127.0.0.1", server.port());
+
+	std::string body;
+	assertTrue (requestStatus(session, "/nosuchfile.txt", body) == HTTPResponse::HTTP_NOT_FOUND);
+}
+
+
+void HTTPStaticFileServiceTest::testTraversal()
+{
+	HTTPStaticFileService service(Poco::Path(baseDir(), "web").toString());
+	StaticFileServer server(service);
+	HTTPClientSession session("127.0.0.1", server.port());
+	session.setKeepAlive(true);
+
+	// secret.txt lives next to, not inside, the web root; none of
+	// these may reach it
+	const char* targets[] =
+	{
+		"a/../../secret.txt",       // relative request-target with leading ".."
+		"../secret.txt",
+		"/../secret.txt",
+		"/a/../../secret.txt",
+		"/%2e%2e/secret.txt",       // encoded dot-dot
+		"/a/%2e%2e/%2e%2e/secret.txt",
+		"/..%5csecret.txt",         // backslash, a separator on Windows
+		"/a%5c..%5c..%5csecret.txt"
+	};
+	for (std::size_t i = 0; i < sizeof(targets)/sizeof(targets[0]); i++)
+	{
+		std::string body;
+		int status = requestStatus(session, targets[i], body);
+		assertTrue (status == HTTPResponse::HTTP_FORBIDDEN || status == HTTPResponse::HTTP_NOT_FOUND);
+		assertTrue (body != SECRET_CONTENT);
+	}
+}
+
+
+void HTTPStaticFileServiceTest::setUp()
+{
+	Poco::File(Poco::Path(baseDir(), "web").toString()).createDirectories();
+	writeFile(Poco::Path(baseDir(), "secret.txt"), SECRET_CONTENT);
+	Poco::Path webRoot(baseDir(), "web");
+	writeFile(Poco::Path(webRoot, "hello.txt"), "Hello, world!");
+	writeFile(Poco::Path(webRoot, "index.html"), "<html/>");
+}
+
+
+void HTTPStaticFileServiceTest::tearDown()
+{
+	Poco::File dir(baseDir());
+	if (dir.exists()) dir.remove(true);
+}
+
+
+CppUnit::Test* HTTPStaticFileServiceTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPStaticFileServiceTest");
+
+	CppUnit_addTest(pSuite, HTTPStaticFileServiceTest, testServeFile);
+	CppUnit_addTest(pSuite, HTTPStaticFileServiceTest, testIndexFile);
+	CppUnit_addTest(pSuite, HTTPStaticFileServiceTest, testNotFound);
+	CppUnit_addTest(pSuite, HTTPStaticFileServiceTest, testTraversal);
+
+	return pSuite;
+}
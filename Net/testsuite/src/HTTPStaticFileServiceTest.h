@@ -0,0 +1,39 @@
+//
+// HTTPStaticFileServiceTest.h
+//
+// Definition of the HTTPStaticFileServiceTest class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef HTTPStaticFileServiceTest_INCLUDED
+#define HTTPStaticFileServiceTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/CppUnit/TestCase.h"
+
+
+class HTTPStaticFileServiceTest: public CppUnit::TestCase
+{
+public:
+	HTTPStaticFileServiceTest(const std::string& name);
+	~HTTPStaticFileServiceTest();
+
+	void testServeFile();
+	void testIndexFile();
+	void testNotFound();
+	void testTraversal();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // HTTPStaticFileServiceTest_INCLUDED
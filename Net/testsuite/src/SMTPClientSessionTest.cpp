@@ -305,6 +305,92 @@ void SMTPClientSessionTest::testSendFailed()
 }
 
 
+void SMTPClientSessionTest::testPipelinedSend()
+{
+	DialogServer server;
+	server.addResponse("220 localhost SMTP ready");
+	server.addResponse("250-Hello localhost\r\n250 PIPELINING");
+	server.addResponse("250 OK");
+	server.addResponse("250 OK");
+	server.addResponse("250 OK");
+	server.addResponse("354 Send data");
+	server.addResponse("250 OK");
+	server.addResponse("221 Bye");
+	SMTPClientSession session("127.0.0.1", server.port());
+	session.login("localhost");
+	assertTrue (session.supportsPipelining());
+
+	MailMessage message;
+	message.setSender("john.doe@no.where");
+	message.addRecipient(MailRecipient(MailRecipient::PRIMARY_RECIPIENT, "jane.doe@no.where", "Jane Doe"));
+	message.addRecipient(MailRecipient(MailRecipient::CC_RECIPIENT, "jack.doe@no.where", "Jack Doe"));
+	message.setSubject("Test Message");
+	message.setContent("Hello\r\nblah blah\r\n\r\nJohn\r\n");
+	server.clearCommands();
+	session.sendMessage(message);
+	std::string cmd = server.popCommandWait();
+	assertTrue (cmd == "MAIL FROM: <john.doe@no.where>");
+	cmd = server.popCommandWait();
+	assertTrue (cmd == "RCPT TO: <jane.doe@no.where>");
+	cmd = server.popCommandWait();
+	assertTrue (cmd == "RCPT TO: <jack.doe@no.where>");
+	cmd = server.popCommandWait();
+	assertTrue (cmd == "DATA");
+
+	session.close();
+}
+
+
+void SMTPClientSessionTest::testPipelinedRecipientFailed()
+{
+	DialogServer server;
+	server.addResponse("220 localhost SMTP ready");
+	server.addResponse("250-Hello localhost\r\n250 PIPELINING");
+	server.addResponse("250 OK");
+	server.addResponse("250 OK");
+	server.addResponse("550 No such user");
+	server.addResponse("354 Send data");
+	server.addResponse("250 OK");
+	server.addResponse("221 Bye");
+	SMTPClientSession session("127.0.0.1", server.port());
+	session.login("localhost");
+	assertTrue (session.supportsPipelining());
+
+	MailMessage message;
+	message.setSender("john.doe@no.where");
+	message.addRecipient(MailRecipient(MailRecipient::PRIMARY_RECIPIENT, "jane.doe@no.where", "Jane Doe"));
+	message.addRecipient(MailRecipient(MailRecipient::CC_RECIPIENT, "jack.doe@no.where", "Jack Doe"));
+	message.setSubject("Test Message");
+	message.setContent("Hello\r\nblah blah\r\n\r\nJohn\r\n");
+	server.clearCommands();
+	try
+	{
+		session.sendMessage(message);
+		fail("recipient rejected - must throw");
+	}
+	catch (SMTPException&)
+	{
+	}
+
+	// the rejected recipient must not leave the data phase open: the
+	// session terminated it, so QUIT is read as a command again
+	std::string cmd = server.popCommandWait();
+	assertTrue (cmd == "MAIL FROM: <john.doe@no.where>");
+	cmd = server.popCommandWait();
+	assertTrue (cmd == "RCPT TO: <jane.doe@no.where>");
+	cmd = server.popCommandWait();
+	assertTrue (cmd == "RCPT TO: <jack.doe@no.where>");
+	cmd = server.popCommandWait();
+	assertTrue (cmd == "DATA");
+	cmd = server.popCommandWait();
+	assertTrue (cmd == ".");
+
+	session.close();
+	cmd = server.popCommandWait();
+	assertTrue (cmd == "QUIT");
+}
+
+
 void SMTPClientSessionTest::setUp()
 {
 }
@@ -326,6 +412,8 @@ CppUnit::Test* SMTPClientSessionTest::suite()
 	CppUnit_addTest(pSuite, SMTPClientSessionTest, testSendMultiRecipient);
 	CppUnit_addTest(pSuite, SMTPClientSessionTest, testMultiSeparateRecipient);
 	CppUnit_addTest(pSuite, SMTPClientSessionTest, testSendFailed);
+	CppUnit_addTest(pSuite, SMTPClientSessionTest, testPipelinedSend);
+	CppUnit_addTest(pSuite, SMTPClientSessionTest, testPipelinedRecipientFailed);
 
 	return pSuite;
 }
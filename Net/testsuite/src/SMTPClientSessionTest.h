@@ -31,6 +31,8 @@ public:
 	void testSendMultiRecipient();
 	void testMultiSeparateRecipient();
 	void testSendFailed();
+	void testPipelinedSend();
+	void testPipelinedRecipientFailed();
 	
 	void setUp();
 	void tearDown();
@@ -193,6 +193,86 @@ void WebSocketTest::testWebSocket()
 }
 
 
+void WebSocketTest::testPerMessageDeflate()
+{
+	Poco::Net::ServerSocket ss(0);
+	Poco::Net::HTTPServer server(new WebSocketRequestHandlerFactory(16384), ss, new Poco::Net::HTTPServerParams);
+	server.start();
+
+	Poco::Thread::sleep(200);
+
+	HTTPClientSession cs("127.0.0.1", ss.address().port());
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/ws", HTTPRequest::HTTP_1_1);
+	HTTPResponse response;
+	WebSocket ws(cs, request, response);
+
+	// the client offers permessage-deflate by default and this
+	// server accepts it
+	const std::string& extensions = response.get("Sec-WebSocket-Extensions", "");
+	assertTrue (extensions.find("permessage-deflate") != std::string::npos);
+
+	// compression must be transparent to the application for both
+	// highly compressible and incompressible payloads
+	std::string payload(16000, 'x');
+	int flags;
+	Poco::Buffer<char> buffer(0);
+	ws.sendFrame(payload.data(), (int) payload.size());
+	int n = ws.receiveFrame(buffer, flags);
+	assertTrue (n == payload.size());
+	assertTrue (payload.compare(0, payload.size(), buffer.begin(), n) == 0);
+	assertTrue (flags == WebSocket::FRAME_TEXT);
+
+	payload.clear();
+	for (int i = 0; i < 16000; ++i) payload += char(rand() & 0xFF);
+	ws.sendFrame(payload.data(), (int) payload.size(), WebSocket::FRAME_BINARY);
+	buffer.resize(0);
+	n = ws.receiveFrame(buffer, flags);
+	assertTrue (n == payload.size());
+	assertTrue (payload.compare(0, payload.size(), buffer.begin(), n) == 0);
+	assertTrue (flags == WebSocket::FRAME_BINARY);
+
+	ws.shutdown();
+	char small[16];
+	n = ws.receiveFrame(small, sizeof(small), flags);
+	assertTrue ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_CLOSE);
+
+	server.stop();
+}
+
+
+void WebSocketTest::testPerMessageDeflateDeclined()
+{
+	Poco::Net::ServerSocket ss(0);
+	Poco::Net::HTTPServer server(new WebSocketRequestHandlerFactory, ss, new Poco::Net::HTTPServerParams);
+	server.start();
+
+	Poco::Thread::sleep(200);
+
+	HTTPClientSession cs("127.0.0.1", ss.address().port());
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/ws", HTTPRequest::HTTP_1_1);
+	// an application-provided extensions header suppresses the
+	// automatic permessage-deflate offer
+	request.set("Sec-WebSocket-Extensions", "x-unknown-extension");
+	HTTPResponse response;
+	WebSocket ws(cs, request, response);
+	assertTrue (response.get("Sec-WebSocket-Extensions", "").find("permessage-deflate") == std::string::npos);
+
+	std::string payload("Hello, world!");
+	int flags;
+	char buffer[1024] = {};
+	ws.sendFrame(payload.data(), (int) payload.size());
+	int n = ws.receiveFrame(buffer, sizeof(buffer), flags);
+	assertTrue (n == payload.size());
+	assertTrue (payload.compare(0, payload.size(), buffer, n) == 0);
+
+	ws.shutdown();
+	n = ws.receiveFrame(buffer, sizeof(buffer), flags);
+	assertTrue ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_CLOSE);
+
+	server.stop();
+}
+
+
 void WebSocketTest::testWebSocketLarge()
 {
 	const int msgSize = 64000;
@@ -285,6 +365,8 @@ CppUnit::Test* WebSocketTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("WebSocketTest");
 
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocket);
+	CppUnit_addTest(pSuite, WebSocketTest, testPerMessageDeflate);
+	CppUnit_addTest(pSuite, WebSocketTest, testPerMessageDeflateDeclined);
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketLarge);
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketLargeInOneFrame);
 
@@ -25,6 +25,8 @@ public:
 	~WebSocketTest();
 
 	void testWebSocket();
+	void testPerMessageDeflate();
+	void testPerMessageDeflateDeclined();
 	void testWebSocketLarge();
 	void testWebSocketLargeInOneFrame();
 
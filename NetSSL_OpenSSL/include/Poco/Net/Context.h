@@ -25,6 +25,10 @@
 #include "Poco/Crypto/RSAKey.h"
 #include "Poco/RefCountedObject.h"
 #include "Poco/AutoPtr.h"
+#include "Poco/Mutex.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Timespan.h"
+#include <map>
 #include <openssl/ssl.h>
 #include <cstdlib>
 
@@ -280,7 +284,35 @@ public:
 	Context::VerificationMode verificationMode() const;
 		/// Returns the verification mode.
 		
+	void enableCertificateVerificationCache(bool flag = true, const Poco::Timespan& timeToLive = Poco::Timespan(300, 0));
+		/// Enables or disables caching of peer certificate
+		/// verification results on this Context.
+		///
+		/// With the cache enabled, a successful chain verification
+		/// is remembered (keyed by the SHA-256 fingerprints of the
+		/// peer certificate and its presented chain) and subsequent
+		/// connections presenting the same chain skip the full
+		/// X509_verify_cert() work until the entry expires -- the
+		/// common pattern in an mTLS mesh, where the same few
+		/// hundred peers reconnect constantly.
+		///
+		/// Only successful verifications are cached: failures
+		/// re-verify every time, so InvalidCertificateHandler
+		/// prompts and VerificationError events keep firing.
+		/// The TTL bounds how long a revocation (CRL/OCSP) can go
+		/// unnoticed for an already-verified peer; call
+		/// flushCertificateVerificationCache() after updating
+		/// revocation data to drop all entries at once.
+		///
+		/// Note that on a cache hit the verified-chain accessors of
+		/// the underlying SSL connection are not populated.
+
+	void flushCertificateVerificationCache();
+		/// Drops all cached certificate verification results, e.g.
+		/// after loading an updated CRL.
+
 	void enableSessionCache(bool flag = true);
+
 		/// Enable or disable SSL/TLS session caching.
 		/// For session caching to work, it must be enabled
 		/// on the server, as well as on the client side.
@@ -367,6 +399,22 @@ public:
 		///
 		///   context.disableProtocols(PROTO_SSLV2 | PROTO_SSLV3);
 		
+	void enableKernelTLS(bool flag = true);
+		/// Enables or disables kernel TLS offload (kTLS) for
+		/// connections created from this Context, where supported by
+		/// both OpenSSL (3.0+, SSL_OP_ENABLE_KTLS) and the running
+		/// kernel (Linux with the tls module).
+		///
+		/// With kTLS, record encryption happens in the kernel after
+		/// the handshake, so sendBytes()/receiveBytes() become plain
+		/// socket system calls without a round trip through the
+		/// userspace record layer, and sendfile()-style zero-copy
+		/// transmission can be used on secure sockets.
+		///
+		/// On platforms without kTLS support this is a no-op; the
+		/// connection transparently falls back to the userspace
+		/// record layer.
+
 	void preferServerCiphers();
 		/// When choosing a cipher, use the server's preferences instead of the client
 		/// preferences. When not called, the SSL server will always follow the clients
@@ -387,10 +435,21 @@ private:
 	void createSSLContext();
 		/// Create a SSL_CTX object according to Context configuration.
 
+	static int certVerifyCacheCallback(X509_STORE_CTX* pStore, void* pArg);
+		/// Consults/fills the verification cache around
+		/// X509_verify_cert().
+
+	std::string verificationCacheKey(X509_STORE_CTX* pStore) const;
+		/// Builds the cache key from the peer chain's fingerprints.
+
 	Usage _usage;
 	VerificationMode _mode;
 	SSL_CTX* _pSSLContext;
 	bool _extendedCertificateVerification;
+	bool _certVerificationCacheEnabled;
+	Poco::Timespan _certVerificationTTL;
+	std::map<std::string, Poco::Timestamp> _certVerificationCache;
+	Poco::FastMutex _certVerificationMutex;
 };
 
 
@@ -21,6 +21,7 @@
 #include "Poco/Net/NetSSL.h"
 #include "Poco/Net/VerificationErrorArgs.h"
 #include "Poco/Net/Context.h"
+#include "Poco/Net/Session.h"
 #include "Poco/Net/PrivateKeyFactoryMgr.h"
 #include "Poco/Net/CertificateHandlerFactoryMgr.h"
 #include "Poco/Net/InvalidCertificateHandler.h"
@@ -34,6 +35,10 @@
 #endif
 
 
+#include <map>
+#include <deque>
+
+
 namespace Poco {
 namespace Net {
 
@@ -173,6 +178,31 @@ public:
 	static SSLManager& instance();
 		/// Returns the instance of the SSLManager singleton.
 
+	Session::Ptr clientSessionForHost(const std::string& host, Poco::UInt16 port);
+		/// Returns the cached TLS session (or session ticket) for
+		/// the given host and port from the process-wide client
+		/// session cache, or a null pointer if none is cached.
+		///
+		/// SecureSocketImpl consults this cache before a client
+		/// handshake, so reconnects to recently used peers resume
+		/// the TLS session (abbreviated handshake or ticket) instead
+		/// of performing a full handshake.
+
+	void cacheClientSession(const std::string& host, Poco::UInt16 port, Session::Ptr pSession);
+		/// Stores the TLS session for the given host and port in the
+		/// process-wide client session cache, evicting the oldest
+		/// entry when the cache is full. Passing a null pointer
+		/// removes the entry for the host.
+
+	void setClientSessionCacheSize(std::size_t size);
+		/// Sets the maximum number of entries in the process-wide
+		/// client session cache (default 512). Setting the size to 0
+		/// disables the cache and drops all entries.
+
+	std::size_t getClientSessionCacheSize() const;
+		/// Returns the maximum number of entries in the process-wide
+		/// client session cache.
+
 	void initializeServer(PrivateKeyPassphraseHandlerPtr ptrPassphraseHandler, InvalidCertificateHandlerPtr ptrCertificateHandler, Context::Ptr ptrContext);
 		/// Initializes the server side of the SSLManager with a default passphrase handler, a default invalid certificate handler and a default context. If this method
 		/// is never called the SSLmanager will try to initialize its members from an application configuration.
@@ -310,7 +340,10 @@ private:
 	Context::Ptr                     _ptrDefaultClientContext;
 	PrivateKeyPassphraseHandlerPtr   _ptrClientPassphraseHandler;
 	InvalidCertificateHandlerPtr     _ptrClientCertificateHandler;
-	Poco::FastMutex                  _mutex;
+	std::map<std::string, Session::Ptr> _clientSessionCache;
+	std::deque<std::string>          _clientSessionCacheOrder;
+	std::size_t                      _clientSessionCacheSize;
+	mutable Poco::FastMutex          _mutex;
 
 	static const std::string CFG_PRIV_KEY_FILE;
 	static const std::string CFG_CERTIFICATE_FILE;
@@ -0,0 +1,125 @@
+//
+// SecureHandshakeFilter.h
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLSockets
+// Module:  SecureHandshakeFilter
+//
+// Definition of the SecureHandshakeFilter class.
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef NetSSL_SecureHandshakeFilter_INCLUDED
+#define NetSSL_SecureHandshakeFilter_INCLUDED
+
+
+#include "Poco/Net/NetSSL.h"
+#include "Poco/Net/TCPServer.h"
+#include "Poco/Net/SecureStreamSocket.h"
+#include "Poco/Net/PollSet.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/Mutex.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Timespan.h"
+#include "Poco/SharedPtr.h"
+#include <vector>
+#include <map>
+
+
+namespace Poco {
+namespace Net {
+
+
+class NetSSL_API SecureHandshakeFilter: public TCPServerConnectionFilter
+	/// A TCPServerConnectionFilter that moves TLS handshakes off
+	/// the connection-serving threads onto a dedicated small pool.
+	///
+	/// By default, a connection accepted through SecureServerSocket
+	/// performs its handshake lazily, on the worker thread's first
+	/// read -- so a burst of new TLS clients spends worker time on
+	/// handshake crypto and starves established connections.
+	/// With this filter installed:
+	///
+	///     Poco::Net::SecureServerSocket socket(port);
+	///     Poco::Net::HTTPServer server(pFactory, socket, pParams);
+	///     server.setConnectionFilter(new Poco::Net::SecureHandshakeFilter(server));
+	///     server.start();
+	///
+	/// accepted sockets are switched to non-blocking mode and their
+	/// handshakes are driven to completion by handshake threads
+	/// multiplexing a PollSet; only fully established connections
+	/// enter the dispatcher (via TCPServer::enqueueConnection), so
+	/// worker latency stays independent of handshake load.
+	/// Connections whose handshake fails or exceeds the timeout are
+	/// closed without ever occupying a worker thread.
+{
+public:
+	SecureHandshakeFilter(TCPServer& server, int threads = 1, const Poco::Timespan& handshakeTimeout = Poco::Timespan(30, 0));
+		/// Creates the SecureHandshakeFilter for the given server,
+		/// with the given number of handshake threads and per
+		/// handshake timeout. The filter must be destroyed (or the
+		/// server stopped) before the server object itself.
+
+	bool accept(const StreamSocket& socket);
+		/// Takes over the freshly accepted socket: always returns
+		/// false and completes the handshake asynchronously,
+		/// re-injecting the socket into the server when done.
+
+protected:
+	~SecureHandshakeFilter();
+		/// Destroys the SecureHandshakeFilter; pending handshakes
+		/// are abandoned and their sockets closed.
+
+private:
+	class Worker: public Poco::Runnable
+		/// Drives the handshakes assigned to it with a PollSet
+		/// loop until they complete, fail or time out.
+	{
+	public:
+		Worker(TCPServer& server, const Poco::Timespan& timeout);
+		~Worker();
+
+		void add(const SecureStreamSocket& socket);
+		void stop();
+		void run();
+
+	private:
+		struct Pending
+		{
+			Pending(const SecureStreamSocket& s):
+				socket(s)
+			{
+			}
+
+			SecureStreamSocket socket;
+			Poco::Timestamp started;
+		};
+
+		void drive(SecureStreamSocket& socket, int mode);
+		void sweepTimeouts();
+
+		TCPServer&      _server;
+		Poco::Timespan  _timeout;
+		Poco::Thread    _thread;
+		PollSet         _pollSet;
+		std::map<poco_socket_t, Pending> _pending;
+		std::vector<SecureStreamSocket> _incoming;
+		Poco::FastMutex _mutex;
+		bool            _stopped;
+	};
+
+	std::vector<Poco::SharedPtr<Worker> > _workers;
+	std::size_t _next;
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // NetSSL_SecureHandshakeFilter_INCLUDED
@@ -43,7 +43,8 @@ Context::Context(Usage usage, const Params& params):
 	_usage(usage),
 	_mode(params.verificationMode),
 	_pSSLContext(0),
-	_extendedCertificateVerification(true)
+	_extendedCertificateVerification(true),
+	_certVerificationCacheEnabled(false)
 {
 	init(params);
 }
@@ -61,7 +62,8 @@ Context::Context(
 	_usage(usage),
 	_mode(verificationMode),
 	_pSSLContext(0),
-	_extendedCertificateVerification(true)
+	_extendedCertificateVerification(true),
+	_certVerificationCacheEnabled(false)
 {
 	Params params;
 	params.privateKeyFile = privateKeyFile;
@@ -85,7 +87,8 @@ Context::Context(
 	_usage(usage),
 	_mode(verificationMode),
 	_pSSLContext(0),
-	_extendedCertificateVerification(true)
+	_extendedCertificateVerification(true),
+	_certVerificationCacheEnabled(false)
 {
 	Params params;
 	params.caLocation = caLocation;
@@ -248,6 +251,84 @@ void Context::usePrivateKey(const Poco::Crypto::EVPPKey& pkey)
 }
 
 
+int Context::certVerifyCacheCallback(X509_STORE_CTX* pStore, void* pArg)
+{
+	Context* pContext = reinterpret_cast<Context*>(pArg);
+	std::string key = pContext->verificationCacheKey(pStore);
+	if (!key.empty())
+	{
+		Poco::FastMutex::ScopedLock lock(pContext->_certVerificationMutex);
+		std::map<std::string, Poco::Timestamp>::iterator it = pContext->_certVerificationCache.find(key);
+		if (it != pContext->_certVerificationCache.end())
+		{
+			if (!it->second.isElapsed(pContext->_certVerificationTTL.totalMicroseconds()))
+			{
+				X509_STORE_CTX_set_error(pStore, X509_V_OK);
+				return 1;
+			}
+			pContext->_certVerificationCache.erase(it);
+		}
+	}
+	int rc = X509_verify_cert(pStore);
+	if (rc == 1 && !key.empty())
+	{
+		// only successes are cached; failures must re-verify so
+		// the verification error events keep firing per attempt
+		Poco::FastMutex::ScopedLock lock(pContext->_certVerificationMutex);
+		pContext->_certVerificationCache[key] = Poco::Timestamp();
+	}
+	return rc;
+}
+
+
+std::string Context::verificationCacheKey(X509_STORE_CTX* pStore) const
+{
+	std::string key;
+	unsigned char digest[EVP_MAX_MD_SIZE];
+	unsigned int len;
+
+	X509* pCert = X509_STORE_CTX_get0_cert(pStore);
+	if (!pCert) return key;
+	if (!X509_digest(pCert, EVP_sha256(), digest, &len)) return std::string();
+	key.append(reinterpret_cast<char*>(digest), len);
+
+	// the presented intermediate chain is part of the verdict
+	STACK_OF(X509)* pChain = X509_STORE_CTX_get0_untrusted(pStore);
+	if (pChain)
+	{
+		for (int i = 0; i < sk_X509_num(pChain); i++)
+		{
+			if (!X509_digest(sk_X509_value(pChain, i), EVP_sha256(), digest, &len)) return std::string();
+			key.append(reinterpret_cast<char*>(digest), len);
+		}
+	}
+	return key;
+}
+
+
+void Context::enableCertificateVerificationCache(bool flag, const Poco::Timespan& timeToLive)
+{
+	_certVerificationCacheEnabled = flag;
+	_certVerificationTTL = timeToLive;
+	if (flag)
+	{
+		SSL_CTX_set_cert_verify_callback(_pSSLContext, &Context::certVerifyCacheCallback, this);
+	}
+	else
+	{
+		SSL_CTX_set_cert_verify_callback(_pSSLContext, 0, 0);
+		flushCertificateVerificationCache();
+	}
+}
+
+
+void Context::flushCertificateVerificationCache()
+{
+	Poco::FastMutex::ScopedLock lock(_certVerificationMutex);
+	_certVerificationCache.clear();
+}
+
+
 void Context::enableSessionCache(bool flag)
 {
 	if (flag)
@@ -383,6 +464,21 @@ void Context::disableProtocols(int protocols)
 }
 
 
+void Context::enableKernelTLS(bool flag)
+{
+#if defined(SSL_OP_ENABLE_KTLS)
+	if (flag)
+		SSL_CTX_set_options(_pSSLContext, SSL_OP_ENABLE_KTLS);
+	else
+		SSL_CTX_clear_options(_pSSLContext, SSL_OP_ENABLE_KTLS);
+#else
+	// kTLS requires OpenSSL 3.0 or later; silently fall back to
+	// the userspace record layer
+	(void) flag;
+#endif
+}
+
+
 void Context::preferServerCiphers()
 {
 #if defined(SSL_OP_CIPHER_SERVER_PREFERENCE)
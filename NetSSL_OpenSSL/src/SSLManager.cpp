@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/SSLManager.h"
+#include "Poco/NumberFormatter.h"
 #include "Poco/Net/Context.h"
 #include "Poco/Net/Utility.h"
 #include "Poco/Net/PrivateKeyPassphraseHandler.h"
@@ -67,7 +68,8 @@ const bool        SSLManager::VAL_FIPS_MODE(false);
 #endif
 
 
-SSLManager::SSLManager()
+SSLManager::SSLManager():
+	_clientSessionCacheSize(512)
 {
 }
 
@@ -101,6 +103,65 @@ namespace
 }
 
 
+Session::Ptr SSLManager::clientSessionForHost(const std::string& host, Poco::UInt16 port)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	std::string key(host);
+	key += ':';
+	key += Poco::NumberFormatter::format(port);
+	std::map<std::string, Session::Ptr>::const_iterator it = _clientSessionCache.find(key);
+	if (it != _clientSessionCache.end()) return it->second;
+	return 0;
+}
+
+
+void SSLManager::cacheClientSession(const std::string& host, Poco::UInt16 port, Session::Ptr pSession)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	std::string key(host);
+	key += ':';
+	key += Poco::NumberFormatter::format(port);
+	if (!pSession || _clientSessionCacheSize == 0)
+	{
+		_clientSessionCache.erase(key);
+		return;
+	}
+	if (_clientSessionCache.find(key) == _clientSessionCache.end())
+	{
+		while (_clientSessionCache.size() >= _clientSessionCacheSize && !_clientSessionCacheOrder.empty())
+		{
+			_clientSessionCache.erase(_clientSessionCacheOrder.front());
+			_clientSessionCacheOrder.pop_front();
+		}
+		_clientSessionCacheOrder.push_back(key);
+	}
+	_clientSessionCache[key] = pSession;
+}
+
+
+void SSLManager::setClientSessionCacheSize(std::size_t size)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_clientSessionCacheSize = size;
+	if (size == 0)
+	{
+		_clientSessionCache.clear();
+		_clientSessionCacheOrder.clear();
+	}
+}
+
+
+std::size_t SSLManager::getClientSessionCacheSize() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _clientSessionCacheSize;
+}
+
+
 SSLManager& SSLManager::instance()
 {
 	return *singleton.get();
@@ -0,0 +1,182 @@
+//
+// SecureHandshakeFilter.cpp
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLSockets
+// Module:  SecureHandshakeFilter
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/SecureHandshakeFilter.h"
+#include "Poco/Net/NetException.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+SecureHandshakeFilter::SecureHandshakeFilter(TCPServer& server, int threads, const Poco::Timespan& handshakeTimeout):
+	_next(0)
+{
+	poco_assert (threads > 0);
+
+	for (int i = 0; i < threads; i++)
+		_workers.push_back(new Worker(server, handshakeTimeout));
+}
+
+
+SecureHandshakeFilter::~SecureHandshakeFilter()
+{
+}
+
+
+bool SecureHandshakeFilter::accept(const StreamSocket& socket)
+{
+	try
+	{
+		SecureStreamSocket sss(socket);
+		sss.setBlocking(false);
+		_workers[_next++ % _workers.size()]->add(sss);
+	}
+	catch (Poco::Exception&)
+	{
+		// not a secure socket, or it died during setup: let it go
+	}
+	return false;
+}
+
+
+SecureHandshakeFilter::Worker::Worker(TCPServer& server, const Poco::Timespan& timeout):
+	_server(server),
+	_timeout(timeout),
+	_stopped(false)
+{
+	_thread.start(*this);
+}
+
+
+SecureHandshakeFilter::Worker::~Worker()
+{
+	stop();
+}
+
+
+void SecureHandshakeFilter::Worker::add(const SecureStreamSocket& socket)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	_incoming.push_back(socket);
+}
+
+
+void SecureHandshakeFilter::Worker::stop()
+{
+	_stopped = true;
+	try
+	{
+		_thread.join();
+	}
+	catch (...)
+	{
+	}
+}
+
+
+void SecureHandshakeFilter::Worker::run()
+{
+	while (!_stopped)
+	{
+		std::vector<SecureStreamSocket> incoming;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			incoming.swap(_incoming);
+		}
+		for (std::vector<SecureStreamSocket>::iterator it = incoming.begin(); it != incoming.end(); ++it)
+		{
+			std::map<poco_socket_t, Pending>::iterator itp =
+				_pending.insert(std::make_pair(it->impl()->sockfd(), Pending(*it))).first;
+			drive(itp->second.socket, 0);
+		}
+		if (_pending.empty())
+		{
+			// nothing in flight: a short sleep bounds reaction time
+			// to newly accepted connections
+			Poco::Thread::sleep(20);
+			continue;
+		}
+		PollSet::SocketModeMap sm = _pollSet.poll(Poco::Timespan(0, 100000));
+		for (PollSet::SocketModeMap::const_iterator it = sm.begin(); it != sm.end(); ++it)
+		{
+			std::map<poco_socket_t, Pending>::iterator itp = _pending.find(it->first.impl()->sockfd());
+			if (itp != _pending.end())
+				drive(itp->second.socket, it->second);
+		}
+		sweepTimeouts();
+	}
+	// abandon whatever is left
+	for (std::map<poco_socket_t, Pending>::iterator it = _pending.begin(); it != _pending.end(); ++it)
+	{
+		_pollSet.remove(it->second.socket);
+		try { it->second.socket.close(); } catch (...) {}
+	}
+	_pending.clear();
+}
+
+
+void SecureHandshakeFilter::Worker::drive(SecureStreamSocket& socket, int)
+{
+	poco_socket_t sockfd = socket.impl()->sockfd();
+	try
+	{
+		int rc = socket.completeHandshake();
+		if (rc == 1)
+		{
+			// established: only now does the connection enter the
+			// dispatcher and consume a worker thread
+			if (_pollSet.has(socket)) _pollSet.remove(socket);
+			SecureStreamSocket established(socket);
+			_pending.erase(sockfd);
+			established.setBlocking(true);
+			_server.enqueueConnection(established);
+			return;
+		}
+		int mode = (rc == SecureStreamSocket::ERR_SSL_WANT_WRITE) ? PollSet::POLL_WRITE : PollSet::POLL_READ;
+		if (_pollSet.has(socket))
+			_pollSet.update(socket, mode);
+		else
+			_pollSet.add(socket, mode);
+	}
+	catch (Poco::Exception&)
+	{
+		// handshake failure: drop the connection without ever
+		// having occupied a server thread
+		if (_pollSet.has(socket)) _pollSet.remove(socket);
+		try { socket.close(); } catch (...) {}
+		_pending.erase(sockfd);
+	}
+}
+
+
+void SecureHandshakeFilter::Worker::sweepTimeouts()
+{
+	std::map<poco_socket_t, Pending>::iterator it = _pending.begin();
+	while (it != _pending.end())
+	{
+		if (it->second.started.isElapsed(_timeout.totalMicroseconds()))
+		{
+			_pollSet.remove(it->second.socket);
+			try { it->second.socket.close(); } catch (...) {}
+			std::map<poco_socket_t, Pending>::iterator itDel = it;
+			++it;
+			_pending.erase(itDel);
+		}
+		else ++it;
+	}
+}
+
+
+} } // namespace Poco::Net
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/SecureSocketImpl.h"
+#include "Poco/Net/SSLManager.h"
 #include "Poco/Net/SSLException.h"
 #include "Poco/Net/Context.h"
 #include "Poco/Net/X509Certificate.h"
@@ -164,6 +165,17 @@ void SecureSocketImpl::connectSSL(bool performHandshake)
 	}
 #endif
 
+	if (!_pSession && !_peerHostName.empty())
+	{
+		// try to resume a recently negotiated session with this peer
+		try
+		{
+			_pSession = SSLManager::instance().clientSessionForHost(_peerHostName, _pSocket->peerAddress().port());
+		}
+		catch (Poco::Exception&)
+		{
+		}
+	}
 	if (_pSession)
 	{
 		SSL_set_session(_pSSL, _pSession->sslSession());
@@ -176,6 +188,12 @@ void SecureSocketImpl::connectSSL(bool performHandshake)
 			int ret = SSL_connect(_pSSL);
 			handleError(ret);
 			verifyPeerCertificate();
+			if (!_peerHostName.empty())
+			{
+				// remember the (possibly renewed) session for
+				// future connections to this peer
+				SSLManager::instance().cacheClientSession(_peerHostName, _pSocket->peerAddress().port(), currentSession());
+			}
 		}
 		else
 		{
@@ -23,6 +23,7 @@
 #include "Poco/PDF/Outline.h"
 #include "Poco/PDF/Resource.h"
 #include <deque>
+#include <ostream>
 #include <map>
 
 
@@ -162,6 +163,15 @@ public:
 		/// _fileName is used. If member variable is empty string,
 		/// document is saved to the memory stream.
 
+	void save(std::ostream& ostr);
+		/// Writes the document to the given output stream, draining
+		/// the underlying document stream in fixed-size chunks.
+		///
+		/// In contrast to data(), which materializes a second full
+		/// copy of the document in a raw buffer, this bounds the
+		/// additional memory to one chunk, which matters when large
+		/// (many-thousand page) documents are generated.
+
 	const DataPtr data(SizeType& sz);
 		/// Returns the document content as raw data and data size in
 		/// the sz argument.
@@ -85,6 +85,21 @@ void Document::save(const std::string fileName)
 }
 
 
+void Document::save(std::ostream& ostr)
+{
+	if (HPDF_Stream_Validate(_pdf->stream)) HPDF_ResetStream(_pdf);
+	HPDF_SaveToStream(_pdf);
+	HPDF_BYTE buffer[65536];
+	for (;;)
+	{
+		HPDF_UINT32 size = sizeof(buffer);
+		HPDF_STATUS status = HPDF_ReadFromStream(_pdf, buffer, &size);
+		if (size > 0) ostr.write(reinterpret_cast<const char*>(buffer), size);
+		if (status != HPDF_OK) break;
+	}
+}
+
+
 const Document::DataPtr Document::data(SizeType& sz)
 {
 	sz = size();
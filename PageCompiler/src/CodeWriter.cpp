@@ -13,6 +13,7 @@
 #include "Poco/Path.h"
 #include "Poco/StringTokenizer.h"
 #include "Poco/String.h"
+#include "Poco/NumberFormatter.h"
 
 
 using Poco::Path;
@@ -391,6 +392,70 @@ std::string CodeWriter::cleanupHandler(std::string handler)
 	{
 		Poco::replaceInPlace(handler, DOUBLE_NEWLINE_WRITE, NEWLINE_WRITE);
 	}
-	return handler;
+	return fuseStaticWrites(handler);
+}
+
+
+namespace
+{
+	void flushStaticWrite(std::string& result, std::string& literal)
+	{
+		if (literal.empty()) return;
+		// the write length is the unescaped size of the literal:
+		// every escape sequence the generator produces is one byte
+		std::size_t length = 0;
+		for (std::string::size_type i = 0; i < literal.size(); i++)
+		{
+			if (literal[i] == '\\') i++;
+			length++;
+		}
+		result += "\tresponseStream.write(\"";
+		result += literal;
+		result += "\", ";
+		result += Poco::NumberFormatter::format(static_cast<Poco::UInt64>(length));
+		result += ");\n";
+		literal.clear();
+	}
+}
+
+
+std::string CodeWriter::fuseStaticWrites(const std::string& handler)
+{
+	// fuse runs of consecutive static markup statements into a
+	// single pre-measured write() call: templated pages spend most
+	// of their time in per-chunk operator<< plumbing otherwise
+	static const std::string WRITE_PREFIX("\tresponseStream << \"");
+	static const std::string WRITE_SUFFIX("\";");
+
+	std::string result;
+	std::string literal;
+	result.reserve(handler.size());
+
+	std::string::size_type pos = 0;
+	while (pos <= handler.size())
+	{
+		std::string::size_type eol = handler.find('\n', pos);
+		if (eol == std::string::npos)
+		{
+			if (pos >= handler.size()) break;
+			eol = handler.size();
+		}
+		std::string line(handler, pos, eol - pos);
+		if (line.size() >= WRITE_PREFIX.size() + WRITE_SUFFIX.size() &&
+			line.compare(0, WRITE_PREFIX.size(), WRITE_PREFIX) == 0 &&
+			line.compare(line.size() - WRITE_SUFFIX.size(), WRITE_SUFFIX.size(), WRITE_SUFFIX) == 0)
+		{
+			literal.append(line, WRITE_PREFIX.size(), line.size() - WRITE_PREFIX.size() - WRITE_SUFFIX.size());
+		}
+		else
+		{
+			flushStaticWrite(result, literal);
+			result += line;
+			result += '\n';
+		}
+		pos = eol + 1;
+	}
+	flushStaticWrite(result, literal);
+	return result;
 }
 
@@ -66,6 +66,7 @@ protected:
 	void factoryClass(std::ostream& ostr, const std::string& base);
 	void factoryImpl(std::ostream& ostr, const std::string& arg);
 	std::string cleanupHandler(std::string handler);
+	std::string fuseStaticWrites(const std::string& handler);
 
 private:
 	CodeWriter();
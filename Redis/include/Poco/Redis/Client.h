@@ -182,6 +182,42 @@ public:
 		/// Sends all commands (pipelining) to the Redis server before
 		/// getting all replies.
 
+	std::size_t queueCommand(const Array& command);
+		/// Appends the command to the output buffer without flushing
+		/// it, as part of an incremental pipeline: queue any number
+		/// of commands, call flushCommands() once, then collect each
+		/// reply with readQueuedReply(). Unlike sendCommands(), the
+		/// commands need not be materialized in a vector and replies
+		/// can be consumed (and released) one at a time.
+		///
+		/// Returns the number of queued commands whose replies have
+		/// not been read yet.
+
+	std::size_t flushCommands();
+		/// Flushes all queued commands to the Redis server in a
+		/// single write and returns the number of outstanding
+		/// replies.
+
+	RedisType::Ptr readQueuedReply();
+		/// Reads the reply for the oldest queued command. Throws a
+		/// RedisException if no queued command is outstanding.
+
+	std::size_t queuedCommands() const;
+		/// Returns the number of queued commands whose replies have
+		/// not been read yet.
+
+	std::streamsize copyBulkReply(std::ostream& ostr);
+		/// Reads the pending reply, which must be a bulk string
+		/// (e.g. from a previously written GET), and streams its
+		/// payload directly into the given output stream in chunks
+		/// -- no std::string materialization, so multi-megabyte
+		/// values are copied once instead of several times.
+		///
+		/// Returns the number of payload bytes copied, or -1 for a
+		/// null bulk reply. Throws a RedisException if the pending
+		/// reply is not a bulk string (an error reply's message is
+		/// included).
+
 	void setReceiveTimeout(const Timespan& timeout);
 		/// Sets a receive timeout.
 
@@ -205,6 +241,7 @@ private:
 	Net::StreamSocket _socket;
 	RedisInputStream* _input;
 	RedisOutputStream* _output;
+	std::size_t _queued = 0;
     bool _authenticated;
 };
 
@@ -0,0 +1,83 @@
+//
+// ClusterClient.h
+//
+// Library: Redis
+// Package: Redis
+// Module:  ClusterClient
+//
+// Definition of the ClusterClient class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Redis_ClusterClient_INCLUDED
+#define Redis_ClusterClient_INCLUDED
+
+
+#include "Poco/Redis/Client.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Mutex.h"
+#include <map>
+#include <vector>
+
+
+namespace Poco {
+namespace Redis {
+
+
+class Redis_API ClusterClient
+	/// A Redis Cluster aware client.
+	///
+	/// Maintains the slot map obtained from CLUSTER SLOTS and routes
+	/// every command to the node owning its key's hash slot (CRC16
+	/// of the key's hash tag, modulo 16384), removing the extra hop
+	/// through an external cluster proxy. MOVED redirections refresh
+	/// the slot map and retry transparently; ASK redirections are
+	/// followed for the single command.
+	///
+	/// Commands must carry their routing key as the second array
+	/// element (the usual layout of single-key commands); multi-key
+	/// commands must keep all keys in one slot, as the cluster
+	/// itself requires.
+{
+public:
+	ClusterClient(const Net::SocketAddress& seedAddress);
+		/// Creates the ClusterClient and loads the slot map from
+		/// the given seed node.
+
+	~ClusterClient();
+		/// Destroys the ClusterClient.
+
+	RedisType::Ptr execute(const Array& command);
+		/// Routes the command to the node owning the key's slot and
+		/// returns the reply, following MOVED/ASK redirections.
+
+	void refreshSlotMap();
+		/// Reloads the slot map from one of the known nodes.
+
+	static UInt16 hashSlot(const std::string& key);
+		/// Returns the cluster hash slot (0..16383) for the given
+		/// key, honoring {hash tag} sections.
+
+private:
+	ClusterClient(const ClusterClient&);
+	ClusterClient& operator = (const ClusterClient&);
+
+	Client::Ptr route(const Array& command);
+	Client::Ptr clientFor(const std::string& address);
+
+	Net::SocketAddress _seedAddress;
+	std::vector<std::string> _slotOwners; // address per slot
+	std::map<std::string, Client::Ptr> _clients;
+	Poco::FastMutex _mutex;
+};
+
+
+} } // namespace Poco::Redis
+
+
+#endif // Redis_ClusterClient_INCLUDED
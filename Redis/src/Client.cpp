@@ -15,6 +15,7 @@
 
 
 #include "Poco/Redis/Client.h"
+#include "Poco/NumberParser.h"
 #include "Poco/Redis/Exception.h"
 
 
@@ -165,6 +166,8 @@ void Client::disconnect()
 	delete _output;
 	_output = 0;
 
+	_queued = 0;
+
 	_socket.close();
 }
 
@@ -229,4 +232,70 @@ Array Client::sendCommands(const std::vector<Array>& commands)
 }
 
 
+std::size_t Client::queueCommand(const Array& command)
+{
+	writeCommand(command, false);
+	return ++_queued;
+}
+
+
+std::size_t Client::flushCommands()
+{
+	poco_assert(_output);
+
+	_output->flush();
+	return _queued;
+}
+
+
+RedisType::Ptr Client::readQueuedReply()
+{
+	if (_queued == 0)
+		throw RedisException("No queued command outstanding");
+
+	--_queued;
+	return readReply();
+}
+
+
+std::streamsize Client::copyBulkReply(std::ostream& ostr)
+{
+	poco_assert(_input);
+
+	int c = _input->get();
+	if (c == '-')
+	{
+		std::string message = _input->getline();
+		throw RedisException(message);
+	}
+	if (c != '$')
+		throw RedisException("Pending reply is not a bulk string");
+
+	std::string lengthLine = _input->getline();
+	Int64 length = NumberParser::parse64(lengthLine);
+	if (length < 0) return -1; // null bulk reply
+
+	char buffer[8192];
+	Int64 remaining = length;
+	while (remaining > 0)
+	{
+		std::streamsize chunk = static_cast<std::streamsize>(remaining < static_cast<Int64>(sizeof(buffer)) ? remaining : sizeof(buffer));
+		_input->read(buffer, chunk);
+		std::streamsize n = _input->gcount();
+		if (n <= 0) throw RedisException("Connection lost while reading bulk string");
+		ostr.write(buffer, n);
+		remaining -= n;
+	}
+	_input->getline(); // consume the trailing CRLF
+	if (_queued > 0) --_queued;
+	return static_cast<std::streamsize>(length);
+}
+
+
+std::size_t Client::queuedCommands() const
+{
+	return _queued;
+}
+
+
 } } // namespace Poco::Redis
@@ -0,0 +1,187 @@
+//
+// ClusterClient.cpp
+//
+// Library: Redis
+// Package: Redis
+// Module:  ClusterClient
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Redis/ClusterClient.h"
+#include "Poco/Redis/Type.h"
+#include "Poco/Redis/Error.h"
+#include "Poco/Redis/Exception.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/StringTokenizer.h"
+
+
+namespace Poco {
+namespace Redis {
+
+
+namespace
+{
+	const unsigned SLOT_COUNT = 16384;
+
+	UInt16 crc16(const char* data, std::size_t length)
+		/// CCITT (XMODEM) CRC-16, as specified by the Redis
+		/// Cluster key distribution model.
+	{
+		UInt16 crc = 0;
+		for (std::size_t i = 0; i < length; i++)
+		{
+			crc ^= static_cast<UInt16>(static_cast<unsigned char>(data[i])) << 8;
+			for (int j = 0; j < 8; j++)
+			{
+				if (crc & 0x8000)
+					crc = static_cast<UInt16>((crc << 1) ^ 0x1021);
+				else
+					crc = static_cast<UInt16>(crc << 1);
+			}
+		}
+		return crc;
+	}
+}
+
+
+ClusterClient::ClusterClient(const Net::SocketAddress& seedAddress):
+	_seedAddress(seedAddress),
+	_slotOwners(SLOT_COUNT)
+{
+	refreshSlotMap();
+}
+
+
+ClusterClient::~ClusterClient()
+{
+}
+
+
+UInt16 ClusterClient::hashSlot(const std::string& key)
+{
+	// only the {hash tag} participates if present and non-empty
+	std::string::size_type open = key.find('{');
+	if (open != std::string::npos)
+	{
+		std::string::size_type close = key.find('}', open + 1);
+		if (close != std::string::npos && close > open + 1)
+			return crc16(key.data() + open + 1, close - open - 1) % SLOT_COUNT;
+	}
+	return crc16(key.data(), key.size()) % SLOT_COUNT;
+}
+
+
+Client::Ptr ClusterClient::clientFor(const std::string& address)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	std::map<std::string, Client::Ptr>::iterator it = _clients.find(address);
+	if (it != _clients.end()) return it->second;
+	Client::Ptr pClient = new Client(address);
+	_clients[address] = pClient;
+	return pClient;
+}
+
+
+void ClusterClient::refreshSlotMap()
+{
+	Client::Ptr pSeed = clientFor(_seedAddress.toString());
+
+	Array command;
+	command.add("CLUSTER").add("SLOTS");
+	RedisType::Ptr reply = pSeed->sendCommand(command);
+	Type<Array>* pRanges = dynamic_cast<Type<Array>*>(reply.get());
+	if (!pRanges) throw RedisException("CLUSTER SLOTS: unexpected reply");
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	for (Array::const_iterator it = pRanges->value().begin(); it != pRanges->value().end(); ++it)
+	{
+		RedisType::Ptr pRangeType = *it;
+		Type<Array>* pRange = dynamic_cast<Type<Array>*>(pRangeType.get());
+		if (!pRange || pRange->value().size() < 3) continue;
+		const Array& range = pRange->value();
+		Int64 start, end;
+		try
+		{
+			start = range.get<Int64>(0);
+			end = range.get<Int64>(1);
+		}
+		catch (Poco::Exception&)
+		{
+			continue;
+		}
+		RedisType::Ptr pMasterType = *(range.begin() + 2);
+		Type<Array>* pMaster = dynamic_cast<Type<Array>*>(pMasterType.get());
+		if (!pMaster || pMaster->value().size() < 2) continue;
+		std::string host = pMaster->value().get<BulkString>(0).value();
+		Int64 port = pMaster->value().get<Int64>(1);
+		std::string address(host);
+		address += ':';
+		NumberFormatter::append(address, port);
+		for (Int64 slot = start; slot <= end && slot < static_cast<Int64>(SLOT_COUNT); ++slot)
+		{
+			_slotOwners[static_cast<std::size_t>(slot)] = address;
+		}
+	}
+}
+
+
+Client::Ptr ClusterClient::route(const Array& command)
+{
+	std::string address;
+	if (command.size() > 1)
+	{
+		BulkString key = command.get<BulkString>(1);
+		if (!key.isNull())
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			address = _slotOwners[hashSlot(key.value())];
+		}
+	}
+	if (address.empty()) address = _seedAddress.toString();
+	return clientFor(address);
+}
+
+
+RedisType::Ptr ClusterClient::execute(const Array& command)
+{
+	for (int attempt = 0; attempt < 3; attempt++)
+	{
+		Client::Ptr pClient = route(command);
+		RedisType::Ptr reply = pClient->sendCommand(command);
+		Type<Error>* pError = dynamic_cast<Type<Error>*>(reply.get());
+		if (pError)
+		{
+			const std::string& message = pError->value().getMessage();
+			if (message.compare(0, 6, "MOVED ") == 0)
+			{
+				// the slot map is stale: refresh and retry
+				refreshSlotMap();
+				continue;
+			}
+			if (message.compare(0, 4, "ASK ") == 0)
+			{
+				// transient redirection during slot migration
+				Poco::StringTokenizer tok(message, " ");
+				if (tok.count() >= 3)
+				{
+					Client::Ptr pTarget = clientFor(tok[2]);
+					Array asking;
+					asking.add("ASKING");
+					pTarget->sendCommand(asking);
+					return pTarget->sendCommand(command);
+				}
+			}
+		}
+		return reply;
+	}
+	throw RedisException("Too many cluster redirections");
+}
+
+
+} } // namespace Poco::Redis
@@ -100,6 +100,12 @@ void StatementExecutor::execute()
 	if (_state < STMT_COMPILED)
 		throw StatementException("Statement is not compiled yet");
 
+	// Note: results are deliberately NOT buffered client-side with
+	// mysql_stmt_store_result(); fetch() pulls rows through
+	// mysql_stmt_fetch() on the unbuffered (use-result) cursor, so
+	// extraction overlaps network I/O and memory stays bounded for
+	// large result sets. mysql_stmt_num_rows() is therefore not
+	// meaningful before all rows have been fetched.
 	if (mysql_stmt_execute(_pHandle) != 0)
 		throw StatementException("mysql_stmt_execute error", _pHandle, _query);
 
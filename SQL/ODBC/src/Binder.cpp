@@ -673,8 +673,11 @@ void Binder::getColumnOrParameterSize(std::size_t pos, SQLINTEGER& size)
 
 void Binder::setParamSetSize(std::size_t length)
 {
-	if (0 == _paramSetSize)
+	if (static_cast<SQLINTEGER>(length) != _paramSetSize)
 	{
+		// must follow batch size changes: leaving a larger
+		// SQL_ATTR_PARAMSET_SIZE in place would make a trailing
+		// partial batch execute rows beyond the bound buffers
 		if (Utility::isError(Poco::SQL::ODBC::SQLSetStmtAttr(_rStmt, SQL_ATTR_PARAM_BIND_TYPE, SQL_PARAM_BIND_BY_COLUMN, SQL_IS_UINTEGER)) ||
 			Utility::isError(Poco::SQL::ODBC::SQLSetStmtAttr(_rStmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER) length, SQL_IS_UINTEGER)))
 				throw StatementException(_rStmt, "SQLSetStmtAttr()");
@@ -119,6 +119,15 @@ public:
 	void setAutoCommit(bool aShouldAutoCommit = true);
 		/// is the connection in auto commit mode?
 
+	bool isSingleRowMode() const;
+		/// Returns true if statements executed on this connection
+		/// stream their results in single-row mode.
+
+	void setSingleRowMode(bool enable = true);
+		/// Enables or disables single-row result streaming for
+		/// statements executed on this connection (see
+		/// StatementExecutor).
+
 	bool isAsynchronousCommit();
 		/// is the connection in Asynchronous commit mode?
 
@@ -192,6 +201,7 @@ private:
 	bool                      _inTransaction;
 	bool                      _isAutoCommit;
 	bool                      _isAsynchronousCommit;
+	bool                      _isSingleRowMode;
 	Poco::UInt32              _tranactionIsolationLevel;
 	std::vector <std::string> _preparedStatementsToBeDeallocated;
 
@@ -312,6 +322,18 @@ inline bool SessionHandle::isAutoCommit()
 }
 
 
+inline bool SessionHandle::isSingleRowMode() const
+{
+	return _isSingleRowMode;
+}
+
+
+inline void SessionHandle::setSingleRowMode(bool enable)
+{
+	_isSingleRowMode = enable;
+}
+
+
 inline bool SessionHandle::isAsynchronousCommit()
 {
 	return _isAsynchronousCommit;
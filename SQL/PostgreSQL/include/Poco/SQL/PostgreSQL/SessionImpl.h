@@ -103,6 +103,16 @@ public:
 	bool isAutoCommit(const std::string& aName = std::string()) const;
 		/// Returns autocommit property value.
 
+	void setSingleRowMode(const std::string& aName, bool aValue);
+		/// Enables or disables single-row result streaming on the
+		/// connection (feature "singleRowMode"). When enabled,
+		/// select statements stream rows from the server via
+		/// PQsendQueryPrepared()/PQsetSingleRowMode() instead of
+		/// materializing the whole result set before extraction.
+
+	bool isSingleRowMode(const std::string& aName = std::string()) const;
+		/// Returns true if single-row result streaming is enabled.
+
 	void setAsynchronousCommit(const std::string&, bool aValue);
 		/// Sets asynchronousCommit property for the session.
 
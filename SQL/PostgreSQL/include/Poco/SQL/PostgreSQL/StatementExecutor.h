@@ -63,7 +63,12 @@ public:
 		/// Executes the statement.
 
 	bool fetch();
-		/// Fetches the data for the current row
+		/// Fetches the data for the current row.
+		///
+		/// In single-row mode (see SessionHandle::setSingleRowMode()),
+		/// rows are streamed from the server one PGresult at a time,
+		/// overlapping network I/O with extraction instead of
+		/// materializing the whole result set up front.
 
 	std::size_t getAffectedRowCount() const;
 		/// get the count of rows affected by the statement
@@ -83,6 +88,7 @@ public:
 private:
 	
 	void clearResults();
+	void drainResults();
 	
 	StatementExecutor(const StatementExecutor&);
 	StatementExecutor& operator= (const StatementExecutor&);
@@ -102,6 +108,7 @@ private:
 	OutputParameterVector _outputParameterVector;
 	std::size_t           _currentRow;			// current row of the result
 	std::size_t           _affectedRowCount;
+	bool                  _singleRowMode;		// result set is streamed row by row
 };
 
 
@@ -37,6 +37,7 @@ SessionHandle::SessionHandle(): _pConnection(0),
 	_inTransaction(false),
 	_isAutoCommit(true),
 	_isAsynchronousCommit(false),
+	_isSingleRowMode(false),
 	_tranactionIsolationLevel(Session::TRANSACTION_READ_COMMITTED)
 {
 }
@@ -139,6 +139,9 @@ void SessionImpl::open(const std::string& aConnectionString)
 	addFeature("asynchronousCommit",
 		&SessionImpl::setAutoCommit,
 		&SessionImpl::isAutoCommit);
+	addFeature("singleRowMode",
+		&SessionImpl::setSingleRowMode,
+		&SessionImpl::isSingleRowMode);
 }
 
 
@@ -207,6 +210,18 @@ bool SessionImpl::isAutoCommit(const std::string&) const
 }
 
 
+void SessionImpl::setSingleRowMode(const std::string&, bool aValue)
+{
+	_sessionHandle.setSingleRowMode(aValue);
+}
+
+
+bool SessionImpl::isSingleRowMode(const std::string&) const
+{
+	return _sessionHandle.isSingleRowMode();
+}
+
+
 void SessionImpl::setAsynchronousCommit(const std::string&,  bool aValue)
 {
 	_sessionHandle.setAsynchronousCommit(aValue);
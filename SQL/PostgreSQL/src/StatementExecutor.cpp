@@ -99,7 +99,8 @@ StatementExecutor::StatementExecutor(SessionHandle& sessionHandle):_sessionHandl
 	_pResultHandle(0),
 	_countPlaceholdersInSQLStatement(0),
 	_currentRow(0),
-	_affectedRowCount(0)
+	_affectedRowCount(0),
+	_singleRowMode(false)
 {
 }
 
@@ -263,23 +264,49 @@ void StatementExecutor::execute()
 	// clear out any result data.  One way or another it is now obsolete.
 	clearResults();
 
+	_singleRowMode = _sessionHandle.isSingleRowMode();
+
 	PGresult* ptrPGResult = 0;
 	{
 		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
 
-		ptrPGResult = PQexecPrepared (_sessionHandle,
-			_preparedStatementName.c_str(), (int)_countPlaceholdersInSQLStatement,
-			_inputParameterVector.size() != 0 ? &pParameterVector[ 0 ] : 0,
-			_inputParameterVector.size() != 0 ? &parameterLengthVector[ 0 ] : 0,
-			_inputParameterVector.size() != 0 ? &parameterFormatVector[ 0 ] : 0, 0);
+		if (_singleRowMode)
+		{
+			// stream the result set one row at a time, overlapping
+			// network I/O with extraction
+			if (!PQsendQueryPrepared(_sessionHandle,
+				_preparedStatementName.c_str(), (int)_countPlaceholdersInSQLStatement,
+				_inputParameterVector.size() != 0 ? &pParameterVector[ 0 ] : 0,
+				_inputParameterVector.size() != 0 ? &parameterLengthVector[ 0 ] : 0,
+				_inputParameterVector.size() != 0 ? &parameterFormatVector[ 0 ] : 0, 0))
+			{
+				throw StatementException(std::string("postgresql_stmt_execute error: ") + PQerrorMessage(_sessionHandle));
+			}
+			if (!PQsetSingleRowMode(_sessionHandle))
+			{
+				drainResults();
+				throw StatementException("postgresql_stmt_execute error: could not enter single-row mode");
+			}
+			ptrPGResult = PQgetResult(_sessionHandle);
+		}
+		else
+		{
+			ptrPGResult = PQexecPrepared (_sessionHandle,
+				_preparedStatementName.c_str(), (int)_countPlaceholdersInSQLStatement,
+				_inputParameterVector.size() != 0 ? &pParameterVector[ 0 ] : 0,
+				_inputParameterVector.size() != 0 ? &parameterLengthVector[ 0 ] : 0,
+				_inputParameterVector.size() != 0 ? &parameterFormatVector[ 0 ] : 0, 0);
+		}
 	}
 
 	// Don't setup to auto clear the result (ptrPGResult).  It is required to retrieve the results later.
 
 	if (!ptrPGResult || (PQresultStatus(ptrPGResult) != PGRES_COMMAND_OK &&
-		PQresultStatus(ptrPGResult) != PGRES_TUPLES_OK))
+		PQresultStatus(ptrPGResult) != PGRES_TUPLES_OK &&
+		PQresultStatus(ptrPGResult) != PGRES_SINGLE_TUPLE))
 	{
 		PQResultClear resultClearer(ptrPGResult);
+		if (_singleRowMode) drainResults();
 
 		const char* pSeverity	= PQresultErrorField(ptrPGResult, PG_DIAG_SEVERITY);
 		const char* pSQLState	= PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE);
@@ -302,7 +329,13 @@ void StatementExecutor::execute()
 
 	int affectedRowCount = 0;
 
-	if (PGRES_TUPLES_OK == PQresultStatus(_pResultHandle))
+	if (PGRES_SINGLE_TUPLE == PQresultStatus(_pResultHandle))
+	{
+		// streaming: the row count only becomes known as rows
+		// are fetched
+		_affectedRowCount = 0;
+	}
+	else if (PGRES_TUPLES_OK == PQresultStatus(_pResultHandle))
 	{
 		affectedRowCount = PQntuples(_pResultHandle);
 
@@ -352,6 +385,37 @@ bool StatementExecutor::fetch()
 		_outputParameterVector.resize(countColumns);
 	}
 
+	if (_singleRowMode)
+	{
+		if (!_pResultHandle || PGRES_SINGLE_TUPLE != PQresultStatus(_pResultHandle))
+		{
+			// the final (row-less) PGRES_TUPLES_OK result, or an
+			// early end: drain the connection so it can be reused
+			drainResults();
+			return false;
+		}
+		for (int i = 0; i < countColumns; ++i)
+		{
+			int fieldLength = PQgetlength(_pResultHandle, 0, static_cast<int>(i));
+			Oid columnInternalDataType = PQftype(_pResultHandle, i);
+			_outputParameterVector.at(i).setValues(oidToColumnDataType(columnInternalDataType),
+				columnInternalDataType,
+				_currentRow,
+				PQgetvalue(_pResultHandle, 0, i),
+				(-1 == fieldLength ? 0 : fieldLength),
+				PQgetisnull(_pResultHandle, 0, i) == 1);
+		}
+		++_currentRow;
+		_affectedRowCount = _currentRow;
+		{
+			// release the consumed row and pull the next one
+			PQResultClear resultClearer(_pResultHandle);
+		}
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		_pResultHandle = PQgetResult(_sessionHandle);
+		return true;
+	}
+
 	// already retrieved last row?
 	if (_currentRow == getAffectedRowCount())
 	{
@@ -416,9 +480,30 @@ const OutputParameter& StatementExecutor::resultColumn(std::size_t aPosition) co
 }
 
 
+void StatementExecutor::drainResults()
+	/// Consumes and discards any results still pending on the
+	/// connection; required to leave single-row mode cleanly.
+{
+	{
+		PQResultClear resultClearer(_pResultHandle);
+	}
+	_pResultHandle = 0;
+	PGresult* pPending = 0;
+	while ((pPending = PQgetResult(_sessionHandle)))
+	{
+		PQclear(pPending);
+	}
+}
+
+
 void StatementExecutor::clearResults()
 {
 	// clear out any old result first
+	if (_singleRowMode)
+	{
+		drainResults();
+	}
+	else
 	{
 		PQResultClear resultClearer(_pResultHandle);
 	}
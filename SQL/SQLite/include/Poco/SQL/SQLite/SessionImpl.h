@@ -72,6 +72,30 @@ public:
 	bool isConnected() const;
 		/// Returns true if connected, false otherwise.
 
+	void setPerformanceProfile(const std::string& name, bool enable);
+		/// Enables or disables the performance profile for the
+		/// session. Enabling it executes the following pragmas:
+		///
+		///   - journal_mode = WAL (write bursts no longer fsync
+		///     per transaction commit)
+		///   - synchronous = NORMAL
+		///   - temp_store = MEMORY
+		///
+		/// Disabling restores journal_mode = DELETE and
+		/// synchronous = FULL. Exposed as the session feature
+		/// "performanceProfile".
+
+	bool getPerformanceProfile(const std::string& name) const;
+		/// Returns true if the performance profile is enabled.
+
+	void setMMapSize(const std::string& name, const Poco::Any& value);
+		/// Sets the memory-mapped I/O size (pragma mmap_size, in
+		/// bytes, Poco::Int64) for the session. Exposed as the
+		/// session property "mmapSize".
+
+	Poco::Any getMMapSize(const std::string& name) const;
+		/// Returns the configured memory-mapped I/O size.
+
 	void setConnectionTimeout(std::size_t timeout);
 		/// Sets the session connection timeout value.
 		/// Timeout value is in seconds.
@@ -128,6 +152,8 @@ private:
 	sqlite3*            _pDB;
 	bool                _connected;
 	bool                _isTransaction;
+	bool                _performanceProfile;
+	Poco::Int64         _mmapSize;
 	int                 _timeout;
 	mutable Poco::Mutex _mutex;
 
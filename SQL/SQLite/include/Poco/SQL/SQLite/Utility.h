@@ -78,6 +78,16 @@ public:
 	static MetaColumn::ColumnDataType getColumnType(sqlite3_stmt* pStmt, std::size_t pos);
 		/// Returns column data type.
 
+	static bool backup(const Session& session, const std::string& destPath, int pagesPerStep = 256, int sleepMilliseconds = 10);
+		/// Performs an online incremental backup of the session's
+		/// database into the file with the given path, using the
+		/// sqlite3_backup API: pagesPerStep pages are copied per
+		/// step with a pause between steps, so concurrent writers
+		/// keep making progress (SQLite transparently re-copies
+		/// pages they change). No quiescing is required.
+		///
+		/// Returns true if the backup completed successfully.
+
 	static bool fileToMemory(sqlite3* pInMemory, const std::string& fileName);
 		/// Loads the contents of a database file on disk into an opened
 		/// database in memory.
@@ -27,6 +27,7 @@
 #include "sqlite3.h"
 #endif
 #include <cstdlib>
+#include "Poco/NumberFormatter.h"
 #include <limits>
 
 
@@ -50,7 +51,9 @@ SessionImpl::SessionImpl(const std::string& fileName, std::size_t loginTimeout):
 	_connector(Connector::KEY),
 	_pDB(0),
 	_connected(false),
-	_isTransaction(false)
+	_isTransaction(false),
+	_performanceProfile(false),
+	_mmapSize(0)
 {
 	open();
 	setConnectionTimeout(loginTimeout);
@@ -58,7 +61,11 @@ SessionImpl::SessionImpl(const std::string& fileName, std::size_t loginTimeout):
 	addFeature("autoCommit",
 		&SessionImpl::autoCommit,
 		&SessionImpl::isAutoCommit);
+	addFeature("performanceProfile",
+		&SessionImpl::setPerformanceProfile,
+		&SessionImpl::getPerformanceProfile);
 	addProperty("connectionTimeout", &SessionImpl::setConnectionTimeout, &SessionImpl::getConnectionTimeout);
+	addProperty("mmapSize", &SessionImpl::setMMapSize, &SessionImpl::getMMapSize);
 }
 
 
@@ -75,6 +82,50 @@ SessionImpl::~SessionImpl()
 }
 
 
+void SessionImpl::setPerformanceProfile(const std::string& /*name*/, bool enable)
+{
+	poco_check_ptr (_pDB);
+
+	if (enable)
+	{
+		// WAL commits do not fsync the main database per transaction,
+		// so write bursts are no longer fsync-bound
+		sqlite3_exec(_pDB, "PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL; PRAGMA temp_store=MEMORY", 0, 0, 0);
+	}
+	else
+	{
+		sqlite3_exec(_pDB, "PRAGMA journal_mode=DELETE; PRAGMA synchronous=FULL; PRAGMA temp_store=DEFAULT", 0, 0, 0);
+	}
+	_performanceProfile = enable;
+}
+
+
+bool SessionImpl::getPerformanceProfile(const std::string& /*name*/) const
+{
+	return _performanceProfile;
+}
+
+
+void SessionImpl::setMMapSize(const std::string& /*name*/, const Poco::Any& value)
+{
+	poco_check_ptr (_pDB);
+
+	Poco::Int64 size = Poco::AnyCast<Poco::Int64>(value);
+	poco_assert (size >= 0);
+
+	std::string pragma("PRAGMA mmap_size=");
+	pragma += Poco::NumberFormatter::format(size);
+	sqlite3_exec(_pDB, pragma.c_str(), 0, 0, 0);
+	_mmapSize = size;
+}
+
+
+Poco::Any SessionImpl::getMMapSize(const std::string& /*name*/) const
+{
+	return _mmapSize;
+}
+
+
 StatementImpl::Ptr SessionImpl::createStatementImpl()
 {
 	poco_check_ptr (_pDB);
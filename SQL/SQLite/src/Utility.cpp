@@ -15,6 +15,7 @@
 
 
 #include "Poco/SQL/SQLite/Utility.h"
+#include "Poco/Thread.h"
 #include "Poco/SQL/SQLite/SQLiteException.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/String.h"
@@ -263,6 +264,47 @@ void Utility::throwException(sqlite3* pDB, int rc, const std::string& addErrMsg)
 }
 
 
+bool Utility::backup(const Session& session, const std::string& destPath, int pagesPerStep, int sleepMilliseconds)
+{
+	poco_assert (pagesPerStep > 0);
+
+	sqlite3* pSource = dbHandle(session);
+	sqlite3* pDest = 0;
+	int rc = sqlite3_open(destPath.c_str(), &pDest);
+	if (rc != SQLITE_OK)
+	{
+		if (pDest) sqlite3_close(pDest);
+		return false;
+	}
+
+	bool result = false;
+	sqlite3_backup* pBackup = sqlite3_backup_init(pDest, "main", pSource, "main");
+	if (pBackup)
+	{
+		for (;;)
+		{
+			rc = sqlite3_backup_step(pBackup, pagesPerStep);
+			if (rc == SQLITE_DONE)
+			{
+				result = true;
+				break;
+			}
+			if (rc == SQLITE_OK || rc == SQLITE_BUSY || rc == SQLITE_LOCKED)
+			{
+				// yield so concurrent writers make progress; SQLite
+				// re-copies any pages they modify
+				if (sleepMilliseconds > 0) Poco::Thread::sleep(sleepMilliseconds);
+				continue;
+			}
+			break;
+		}
+		sqlite3_backup_finish(pBackup);
+	}
+	sqlite3_close(pDest);
+	return result;
+}
+
+
 bool Utility::fileToMemory(sqlite3* pInMemory, const std::string& fileName)
 {
 	int rc;
@@ -0,0 +1,155 @@
+//
+// AsyncExecutor.h
+//
+// Library: SQL
+// Package: SQLCore
+// Module:  AsyncExecutor
+//
+// Definition of the AsyncExecutor class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef SQL_AsyncExecutor_INCLUDED
+#define SQL_AsyncExecutor_INCLUDED
+
+
+#include "Poco/SQL/SQL.h"
+#include "Poco/SQL/Statement.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Mutex.h"
+#include "Poco/CancellationToken.h"
+#include "Poco/Exception.h"
+#include <functional>
+#include <deque>
+#include <map>
+
+
+namespace Poco {
+namespace SQL {
+
+
+class Poco_SQL_API AsyncExecutor
+	/// A shared, bounded executor for asynchronous statement
+	/// execution with completion callbacks.
+	///
+	/// Statement::executeAsync() runs each call as an active method
+	/// on the process-wide default thread pool: concurrency is
+	/// bounded by whatever that pool happens to allow, slow queries
+	/// compete with every other defaultPool user, and a saturated
+	/// pool makes executeAsync() throw. An AsyncExecutor instead
+	/// owns a dedicated pool of a configured size and a bounded
+	/// overflow queue, so thousands of in-flight slow queries
+	/// occupy maxThreads threads plus queue slots, not thousands of
+	/// threads:
+	///
+	///     AsyncExecutor::instance().execute(statement,
+	///         [](std::size_t rows, const Poco::Exception* pExc)
+	///         {
+	///             ...
+	///         });
+	///
+	/// The completion callback runs on the executor thread that
+	/// performed the statement; it receives the processed row count
+	/// or, on failure, the exception. A per-session in-flight limit
+	/// (setSessionLimit()) keeps one session's backlog from
+	/// monopolizing the pool: statements over the limit wait in the
+	/// queue until one of their session's statements completes.
+	///
+	/// A CancellationToken may be supplied; cancellation is
+	/// cooperative, taking effect while the statement is still
+	/// queued (the callback then receives an InterruptedException).
+	/// A statement already inside the connector's blocking execute
+	/// call runs to completion -- interrupting that safely would
+	/// need native driver support.
+{
+public:
+	typedef std::function<void (std::size_t rowsProcessed, const Poco::Exception* pException)> CompletionHandler;
+
+	AsyncExecutor(int maxThreads = 16, std::size_t maxQueued = 1024);
+		/// Creates the AsyncExecutor with the given thread and
+		/// overflow queue bounds.
+
+	~AsyncExecutor();
+		/// Destroys the AsyncExecutor. Queued statements that have
+		/// not started are dropped (their callbacks receive an
+		/// InterruptedException); running ones are waited for.
+
+	static AsyncExecutor& instance();
+		/// Returns the process-wide default executor.
+
+	void execute(Statement& statement, const CompletionHandler& onComplete);
+		/// Schedules the statement for execution. Throws
+		/// InvalidAccessException when the overflow queue is full.
+		///
+		/// The executor keeps its own reference to the statement's
+		/// shared implementation, so the caller's Statement object
+		/// need not outlive the call; the statement must not be
+		/// used concurrently while in flight.
+
+	void execute(Statement& statement, const CompletionHandler& onComplete, const Poco::CancellationToken& token);
+		/// Schedules the statement with a cancellation token; see
+		/// class documentation for cancellation semantics.
+
+	void setSessionLimit(int maxInFlightPerSession);
+		/// Limits how many statements of one session may execute
+		/// concurrently (0 = unlimited, the default).
+
+	std::size_t queued() const;
+		/// Returns the number of statements waiting in the
+		/// overflow queue.
+
+	int active() const;
+		/// Returns the number of statements currently executing.
+
+private:
+	struct Job
+	{
+		Job(Statement& stmt, const CompletionHandler& handler, const Poco::CancellationToken& tok, SessionImpl* pSess):
+			statement(stmt),
+			onComplete(handler),
+			token(tok),
+			pSession(pSess)
+		{
+		}
+
+		Statement statement; // by value: shares the refcounted StatementImpl
+		CompletionHandler onComplete;
+		Poco::CancellationToken token;
+		SessionImpl* pSession;
+	};
+
+	class Worker;
+	friend class Worker;
+
+	AsyncExecutor(const AsyncExecutor&);
+	AsyncExecutor& operator = (const AsyncExecutor&);
+
+	void runJob(Job& job);
+	void kickQueue();
+		/// Starts a worker for the queued job when none is active
+		/// (the queued-during-wind-down race).
+	bool nextJob(Job& job, SessionImpl* pCompletedSession);
+		/// Retires the completed session slot and pops the next
+		/// runnable job (honoring the session limit); returns false
+		/// when none is eligible.
+
+	Poco::ThreadPool _pool;
+	std::size_t _maxQueued;
+	int _sessionLimit;
+	std::deque<Job> _queue;
+	std::map<SessionImpl*, int> _inFlight;
+	int _active;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+} } // namespace Poco::SQL
+
+
+#endif // SQL_AsyncExecutor_INCLUDED
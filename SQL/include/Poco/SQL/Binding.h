@@ -305,6 +305,15 @@ private:
 template <class T>
 class Binding<std::vector<T> >: public AbstractBinding
 	/// Specialization for std::vector.
+	///
+	/// Note on bulk loads: this binding feeds the statement one
+	/// element per execution round, i.e. a 100k-element vector makes
+	/// 100k passes through the binder's virtual interface. For large
+	/// homogeneous loads, bind with the bulk keyword instead --
+	/// use(values, bulk) -- which hands the whole contiguous vector
+	/// to the connector in one call and lets array-capable drivers
+	/// (e.g. ODBC's column-wise parameter arrays) carry thousands of
+	/// rows per round trip.
 {
 public:
 	typedef std::vector<T>                   ValType;
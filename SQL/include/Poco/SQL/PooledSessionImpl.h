@@ -69,6 +69,8 @@ public:
 	virtual void putBack();
 
 protected:
+	friend class SessionPool;
+
 	SessionImpl::Ptr access() const;
 		/// Updates the last access timestamp,
 		/// verifies validity of the session
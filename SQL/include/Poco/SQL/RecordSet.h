@@ -165,6 +165,39 @@ public:
 		/// Returns reference to row at position pos.
 		/// Rows are lazy-created and cached.
 
+	template <class T>
+	std::size_t columnValues(std::size_t col, std::vector<T>& values, std::vector<bool>* pNulls = 0) const
+		/// Copies all values of the column at the given position into
+		/// the contiguous values vector (replacing its contents),
+		/// honoring the row filter if one is set. If pNulls is given,
+		/// it receives one flag per copied row telling whether the
+		/// database value was null (null values are copied as whatever
+		/// the extractor stored, typically a default-constructed
+		/// value).
+		///
+		/// Scanning a column this way avoids the per-cell
+		/// Dynamic::Var boxing of row-oriented access and yields a
+		/// cache-friendly contiguous array for bulk processing.
+		///
+		/// Returns the number of copied rows.
+	{
+		std::size_t total = storageRowCount();
+		values.clear();
+		values.reserve(total);
+		if (pNulls)
+		{
+			pNulls->clear();
+			pNulls->reserve(total);
+		}
+		for (std::size_t dataRow = 0; dataRow < total; ++dataRow)
+		{
+			if (isFiltered() && !isAllowed(dataRow)) continue;
+			values.push_back(value<T>(col, dataRow, false));
+			if (pNulls) pNulls->push_back(isNull(col, dataRow));
+		}
+		return values.size();
+	}
+
 	template <class T>
 	const T& value(std::size_t col) const;
 		/// Returns the reference to data value at [col] location.
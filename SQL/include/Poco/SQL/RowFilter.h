@@ -48,6 +48,15 @@ class Poco_SQL_API RowFilter: public WeakRefCountedObject
 	/// filtering, whenever the filtering criteria is changed,
 	/// the filter automatically notifies all associated recordsets
 	/// by rewinding them to the first position.
+	///
+	/// Note on large results: filtering happens client-side, after
+	/// rows have been extracted, so filtering an N-row result always
+	/// pays the extraction cost of all N rows. To keep memory and
+	/// extraction bounded when only a small fraction of rows is
+	/// wanted, either push the predicate into the query's WHERE
+	/// clause, or extract in batches using Statement's limit()
+	/// support (execute() with a limit extracts one batch; repeat
+	/// until done()) and apply the filter per batch.
 {
 public:
 	enum Comparison
@@ -20,6 +20,7 @@
 
 #include "Poco/SQL/SQL.h"
 #include "Poco/SQL/PooledSessionHolder.h"
+#include "Poco/SQL/StatementCache.h"
 #include "Poco/SQL/PooledSessionImpl.h"
 #include "Poco/SQL/Session.h"
 #include "Poco/HashMap.h"
@@ -153,6 +154,13 @@ public:
 	Poco::Any getProperty(const std::string& name);
 		/// Returns the requested property.
 
+	StatementCache& statementCache(Session& session);
+		/// Returns the prepared-statement cache associated with the
+		/// given pooled session. The cache is keyed by the underlying
+		/// session, so statements prepared through it survive
+		/// checkout and putBack recycling and are reused until the
+		/// session itself is purged or the pool shuts down.
+
 	void shutdown();
 		/// Shuts down the session pool.
 
@@ -203,6 +211,7 @@ private:
 	std::atomic<bool>   _shutdown;
 	AddPropertyMap      _addPropertyMap;
 	AddFeatureMap       _addFeatureMap;
+	std::map<SessionImpl*, Poco::SharedPtr<StatementCache> > _statementCaches;
 	mutable Poco::Mutex _mutex;
 
 	friend class PooledSessionImpl;
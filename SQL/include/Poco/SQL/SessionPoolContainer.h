@@ -66,6 +66,20 @@ public:
 		/// Returns the requested Session.
 		/// Throws NotFoundException if session is not found.
 
+	Session getShard(const std::string& logicalName, Poco::UInt32 shardKey);
+		/// Returns a Session from one of the pools forming the
+		/// logical sharded database with the given name. Shard
+		/// pools are ordinary pools registered under names of the
+		/// form "<logicalName>#<n>" (any suffix after '#' works;
+		/// shards are ordered by name). The shard is selected by
+		/// shardKey modulo the shard count, so equal keys land on
+		/// the same shard; if the selected pool cannot currently
+		/// provide a session (exhausted or shut down), the next
+		/// shards are tried in order.
+		///
+		/// Throws NotFoundException if no shard pools are
+		/// registered for the logical name.
+
 	SessionPool& getPool(const std::string& name);
 		/// Returns a SessionPool reference.
 		/// Throws NotFoundException if session is not found.
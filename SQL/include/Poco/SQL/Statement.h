@@ -454,6 +454,8 @@ protected:
 		/// Returns the underlying session.
 
 private:
+	friend class AsyncExecutor;
+
 
 	const Result& doAsyncExec(bool reset = true);
 		/// Asynchronously executes the statement.
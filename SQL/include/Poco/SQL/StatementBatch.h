@@ -0,0 +1,86 @@
+//
+// StatementBatch.h
+//
+// Library: SQL
+// Package: SQLCore
+// Module:  StatementBatch
+//
+// Definition of the StatementBatch class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef SQL_StatementBatch_INCLUDED
+#define SQL_StatementBatch_INCLUDED
+
+
+#include "Poco/SQL/SQL.h"
+#include "Poco/SQL/Session.h"
+
+
+namespace Poco {
+namespace SQL {
+
+
+class Poco_SQL_API StatementBatch
+	/// Accumulates SQL statements and executes them as a single
+	/// multi-statement round trip:
+	///
+	///     StatementBatch batch(session);
+	///     batch.add("INSERT INTO t VALUES (1)")
+	///          .add("INSERT INTO t VALUES (2)")
+	///          .add("UPDATE c SET n = n + 2");
+	///     batch.execute();
+	///
+	/// The whole batch is compiled and executed as one statement
+	/// string, so connectors that accept multiple statements per
+	/// execution (e.g. SQLite) pay one round trip for the batch
+	/// instead of one per statement. Statements must not produce
+	/// result sets and cannot carry bindings; wrap the batch in a
+	/// Transaction for atomicity.
+{
+public:
+	explicit StatementBatch(Session& session);
+		/// Creates an empty StatementBatch for the given session.
+
+	StatementBatch& add(const std::string& sql);
+		/// Appends a statement to the batch.
+
+	std::size_t execute();
+		/// Executes the accumulated statements as one round trip
+		/// and clears the batch. Returns the number of statements
+		/// executed.
+
+	void clear();
+		/// Discards the accumulated statements.
+
+	std::size_t size() const;
+		/// Returns the number of accumulated statements.
+
+private:
+	StatementBatch(const StatementBatch&);
+	StatementBatch& operator = (const StatementBatch&);
+
+	Session& _session;
+	std::string _sql;
+	std::size_t _count;
+};
+
+
+//
+// inlines
+//
+inline std::size_t StatementBatch::size() const
+{
+	return _count;
+}
+
+
+} } // namespace Poco::SQL
+
+
+#endif // SQL_StatementBatch_INCLUDED
@@ -0,0 +1,114 @@
+//
+// StatementCache.h
+//
+// Library: SQL
+// Package: SQLCore
+// Module:  StatementCache
+//
+// Definition of the StatementCache class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef SQL_StatementCache_INCLUDED
+#define SQL_StatementCache_INCLUDED
+
+
+#include "Poco/SQL/SQL.h"
+#include "Poco/SQL/Statement.h"
+#include <map>
+
+
+namespace Poco {
+namespace SQL {
+
+
+class Poco_SQL_API StatementCache
+	/// A cache of prepared Statement objects, keyed by their SQL
+	/// text, bound to one session.
+	///
+	/// Preparing a statement is a server round trip with most
+	/// connectors, so workloads that issue the same small set of
+	/// queries at high rates should prepare each statement once and
+	/// re-execute it. A StatementCache does this bookkeeping: the
+	/// first get() for an SQL string creates (and thereby prepares)
+	/// the Statement, subsequent get() calls return the same
+	/// Statement object, whose execute() reuses the server-side
+	/// prepared statement.
+	///
+	/// SessionPool keeps one StatementCache per pooled session (see
+	/// SessionPool::statementCache()), so prepared statements
+	/// survive checkout/putBack recycling of the session.
+	///
+	/// Cached statements hold their session's resources; clear the
+	/// cache before closing the session.
+{
+public:
+	explicit StatementCache(std::size_t maxSize = 64);
+		/// Creates the StatementCache. At most maxSize statements
+		/// are cached; when the limit is reached, an entry is
+		/// evicted before the new statement is inserted.
+
+	~StatementCache();
+		/// Destroys the StatementCache.
+
+	Statement& get(Session& session, const std::string& sql);
+		/// Returns the cached Statement for the given SQL text,
+		/// creating it on first use. The session must be the same
+		/// for all calls on one StatementCache instance.
+		///
+		/// The returned reference stays valid until the statement
+		/// is evicted (when the cache is full and a new statement
+		/// is inserted) or the cache is cleared; do not retain it
+		/// across get() calls for other SQL text.
+
+	bool has(const std::string& sql) const;
+		/// Returns true if a Statement for the given SQL text
+		/// is cached.
+
+	void clear();
+		/// Removes all cached statements.
+
+	std::size_t size() const;
+		/// Returns the number of cached statements.
+
+private:
+	typedef std::map<std::string, Statement> StatementMap;
+
+	StatementCache(const StatementCache&);
+	StatementCache& operator = (const StatementCache&);
+
+	std::size_t  _maxSize;
+	StatementMap _statements;
+};
+
+
+//
+// inlines
+//
+inline bool StatementCache::has(const std::string& sql) const
+{
+	return _statements.find(sql) != _statements.end();
+}
+
+
+inline std::size_t StatementCache::size() const
+{
+	return _statements.size();
+}
+
+
+inline void StatementCache::clear()
+{
+	_statements.clear();
+}
+
+
+} } // namespace Poco::SQL
+
+
+#endif // SQL_StatementCache_INCLUDED
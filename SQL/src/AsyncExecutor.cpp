@@ -0,0 +1,254 @@
+//
+// AsyncExecutor.cpp
+//
+// Library: SQL
+// Package: SQLCore
+// Module:  AsyncExecutor
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/SQL/AsyncExecutor.h"
+#include "Poco/SQL/StatementImpl.h"
+#include "Poco/SQL/Session.h"
+#include "Poco/SingletonHolder.h"
+#include "Poco/Thread.h"
+
+
+namespace Poco {
+namespace SQL {
+
+
+class AsyncExecutor::Worker: public Poco::Runnable
+	/// Runs one job, then keeps draining eligible queued jobs on
+	/// the same thread until none is left.
+{
+public:
+	Worker(AsyncExecutor& owner, const Job& job):
+		_owner(owner),
+		_job(job)
+	{
+	}
+
+	void run()
+	{
+		Job job = _job;
+		for (;;)
+		{
+			_owner.runJob(job);
+			if (!_owner.nextJob(job, job.pSession)) break;
+		}
+		delete this;
+	}
+
+private:
+	AsyncExecutor& _owner;
+	Job _job;
+};
+
+
+AsyncExecutor::AsyncExecutor(int maxThreads, std::size_t maxQueued):
+	_pool(1, maxThreads),
+	_maxQueued(maxQueued),
+	_sessionLimit(0),
+	_active(0)
+{
+}
+
+
+AsyncExecutor::~AsyncExecutor()
+{
+	std::deque<Job> dropped;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		dropped.swap(_queue);
+	}
+	Poco::InterruptedException exc("executor shut down");
+	for (std::deque<Job>::iterator it = dropped.begin(); it != dropped.end(); ++it)
+	{
+		try
+		{
+			it->onComplete(0, &exc);
+		}
+		catch (...)
+		{
+		}
+	}
+	_pool.joinAll();
+}
+
+
+namespace
+{
+	Poco::SingletonHolder<AsyncExecutor> executorHolder;
+}
+
+
+AsyncExecutor& AsyncExecutor::instance()
+{
+	return *executorHolder.get();
+}
+
+
+void AsyncExecutor::execute(Statement& statement, const CompletionHandler& onComplete)
+{
+	execute(statement, onComplete, Poco::CancellationToken());
+}
+
+
+void AsyncExecutor::execute(Statement& statement, const CompletionHandler& onComplete, const Poco::CancellationToken& token)
+{
+	Job job(statement, onComplete, token, statement.session().impl().get());
+
+	Poco::ScopedLockWithUnlock<Poco::FastMutex> lock(_mutex);
+	bool overLimit = _sessionLimit > 0 && _inFlight[job.pSession] >= _sessionLimit;
+	if (!overLimit)
+	{
+		Worker* pWorker = new Worker(*this, job);
+		try
+		{
+			_pool.start(*pWorker);
+			++_inFlight[job.pSession];
+			++_active;
+			return;
+		}
+		catch (Poco::NoThreadAvailableException&)
+		{
+			delete pWorker;
+			// all executor threads busy: fall through to the queue
+		}
+	}
+	if (_queue.size() >= _maxQueued)
+		throw Poco::InvalidAccessException("asynchronous statement queue full");
+	_queue.push_back(job);
+	bool needKick = (_active == 0);
+	lock.unlock();
+	// a job queued while the last worker was winding down (its pool
+	// thread not yet idle again) would otherwise never be picked up
+	if (needKick) kickQueue();
+}
+
+
+void AsyncExecutor::kickQueue()
+{
+	for (;;)
+	{
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			if (_active > 0 || _queue.empty()) return;
+			Job next = _queue.front();
+			Worker* pWorker = new Worker(*this, next);
+			try
+			{
+				_pool.start(*pWorker);
+				_queue.pop_front();
+				++_inFlight[next.pSession];
+				++_active;
+				return;
+			}
+			catch (Poco::NoThreadAvailableException&)
+			{
+				delete pWorker;
+				// the exiting worker's thread is returning to the
+				// pool; yield until it is reusable
+			}
+		}
+		Poco::Thread::yield();
+	}
+}
+
+
+void AsyncExecutor::runJob(Job& job)
+{
+	if (job.token.isCancelled())
+	{
+		Poco::InterruptedException exc("statement execution cancelled");
+		try
+		{
+			job.onComplete(0, &exc);
+		}
+		catch (...)
+		{
+		}
+		return;
+	}
+	try
+	{
+		std::size_t rows = job.statement.execute();
+		try
+		{
+			job.onComplete(rows, 0);
+		}
+		catch (...)
+		{
+		}
+	}
+	catch (Poco::Exception& exc)
+	{
+		try
+		{
+			job.onComplete(0, &exc);
+		}
+		catch (...)
+		{
+		}
+	}
+	catch (std::exception& exc)
+	{
+		Poco::SystemException wrapped(exc.what());
+		try
+		{
+			job.onComplete(0, &wrapped);
+		}
+		catch (...)
+		{
+		}
+	}
+}
+
+
+bool AsyncExecutor::nextJob(Job& job, SessionImpl* pCompletedSession)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	std::map<SessionImpl*, int>::iterator it = _inFlight.find(pCompletedSession);
+	if (it != _inFlight.end() && --it->second <= 0) _inFlight.erase(it);
+
+	for (std::deque<Job>::iterator itJob = _queue.begin(); itJob != _queue.end(); ++itJob)
+	{
+		if (_sessionLimit > 0 && _inFlight[itJob->pSession] >= _sessionLimit) continue;
+		job = *itJob;
+		_queue.erase(itJob);
+		++_inFlight[job.pSession];
+		return true;
+	}
+	--_active;
+	return false;
+}
+
+
+void AsyncExecutor::setSessionLimit(int maxInFlightPerSession)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	_sessionLimit = maxInFlightPerSession;
+}
+
+
+std::size_t AsyncExecutor::queued() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _queue.size();
+}
+
+
+int AsyncExecutor::active() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _active;
+}
+
+
+} } // namespace Poco::SQL
@@ -102,6 +102,7 @@ void SessionPool::purgeDeadSessions()
 		PooledSessionHolderPtr pHolder = it->second;
 		if (!pHolder->session()->isConnected())
 		{
+			_statementCaches.erase(pHolder->session().get());
 			it = _idleSessions.erase(it);
 			--_nSessions;
 		}
@@ -293,11 +294,30 @@ void SessionPool::shutdown()
 	Poco::Mutex::ScopedLock lock(_mutex);
 	_shutdown = true;
 	_janitorTimer.stop();
+	_statementCaches.clear();
 	closeAll(_idleSessions);
 	closeAll(_activeSessions);
 }
 
 
+StatementCache& SessionPool::statementCache(Session& session)
+{
+	if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
+
+	Poco::Mutex::ScopedLock lock(_mutex);
+
+	// key by the underlying session, which is recycled through the
+	// pool, rather than by the PooledSessionImpl decorator handed
+	// out for each checkout
+	SessionImpl* pImpl = session.impl().get();
+	PooledSessionImpl* pPooled = dynamic_cast<PooledSessionImpl*>(pImpl);
+	if (pPooled) pImpl = pPooled->impl().get();
+	Poco::SharedPtr<StatementCache>& pCache = _statementCaches[pImpl];
+	if (!pCache) pCache = new StatementCache;
+	return *pCache;
+}
+
+
 void SessionPool::closeAll(SessionList& sessionList)
 {
 	SessionList::iterator it = sessionList.begin();
@@ -96,6 +96,43 @@ Session SessionPoolContainer::get(const std::string& name)
 }
 
 
+Session SessionPoolContainer::getShard(const std::string& logicalName, Poco::UInt32 shardKey)
+{
+	std::vector<SessionPool::Ptr> shards;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		std::string prefix(logicalName);
+		prefix += '#';
+		for (SessionPoolMap::iterator it = _sessionPools.begin(); it != _sessionPools.end(); ++it)
+		{
+			if (it->first.size() > prefix.size() &&
+				Poco::icompare(it->first, 0, prefix.size(), prefix) == 0)
+			{
+				shards.push_back(it->second);
+			}
+		}
+	}
+	if (shards.empty())
+		throw NotFoundException("No shard pools registered for logical database", logicalName);
+
+	std::size_t first = static_cast<std::size_t>(shardKey % shards.size());
+	for (std::size_t i = 0; i < shards.size(); i++)
+	{
+		SessionPool::Ptr pPool = shards[(first + i) % shards.size()];
+		if (!pPool->isActive()) continue;
+		try
+		{
+			return pPool->get();
+		}
+		catch (Poco::Exception&)
+		{
+			// exhausted or failing shard: fall through to the next
+		}
+	}
+	throw NotFoundException("No shard pool could provide a session", logicalName);
+}
+
+
 SessionPool& SessionPoolContainer::getPool(const std::string& name)
 {
 	URI uri(name);
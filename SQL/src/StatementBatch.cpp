@@ -0,0 +1,60 @@
+//
+// StatementBatch.cpp
+//
+// Library: SQL
+// Package: SQLCore
+// Module:  StatementBatch
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/SQL/StatementBatch.h"
+#include "Poco/SQL/Statement.h"
+
+
+namespace Poco {
+namespace SQL {
+
+
+StatementBatch::StatementBatch(Session& session):
+	_session(session),
+	_count(0)
+{
+}
+
+
+StatementBatch& StatementBatch::add(const std::string& sql)
+{
+	if (!_sql.empty()) _sql += ";\n";
+	_sql += sql;
+	++_count;
+	return *this;
+}
+
+
+std::size_t StatementBatch::execute()
+{
+	std::size_t executed = _count;
+	if (_count > 0)
+	{
+		Statement stmt(_session);
+		stmt << _sql;
+		stmt.execute();
+		clear();
+	}
+	return executed;
+}
+
+
+void StatementBatch::clear()
+{
+	_sql.clear();
+	_count = 0;
+}
+
+
+} } // namespace Poco::SQL
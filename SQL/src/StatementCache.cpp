@@ -0,0 +1,55 @@
+//
+// StatementCache.cpp
+//
+// Library: SQL
+// Package: SQLCore
+// Module:  StatementCache
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/SQL/StatementCache.h"
+#include "Poco/SQL/Session.h"
+
+
+namespace Poco {
+namespace SQL {
+
+
+StatementCache::StatementCache(std::size_t maxSize):
+	_maxSize(maxSize)
+{
+	poco_assert (maxSize > 0);
+}
+
+
+StatementCache::~StatementCache()
+{
+}
+
+
+Statement& StatementCache::get(Session& session, const std::string& sql)
+{
+	StatementMap::iterator it = _statements.find(sql);
+	if (it != _statements.end()) return it->second;
+
+	if (_statements.size() >= _maxSize)
+	{
+		// evict a single entry; clearing wholesale would dangle
+		// every reference previously handed out
+		_statements.erase(_statements.begin());
+	}
+
+	Statement stmt(session);
+	stmt << sql;
+	std::pair<StatementMap::iterator, bool> ret =
+		_statements.insert(StatementMap::value_type(sql, stmt));
+	return ret.first->second;
+}
+
+
+} } // namespace Poco::SQL
@@ -89,9 +89,19 @@ void Transaction::execute(const std::vector<std::string>& sql)
 {
 	try
 	{
-		std::vector<std::string>::const_iterator it = sql.begin();
-		std::vector<std::string>::const_iterator end = sql.end();
-		for (; it != end; ++it)	execute(*it, it + 1 == end ? true : false);
+		// execute the whole body as one multi-statement round trip
+		// instead of one execution per statement; with connectors
+		// that compile statement chains (e.g. SQLite) a small
+		// transaction then costs begin + one batch + commit
+		if (!_rSession.isTransaction()) _rSession.begin();
+		std::string batch;
+		for (std::vector<std::string>::const_iterator it = sql.begin(); it != sql.end(); ++it)
+		{
+			if (!batch.empty()) batch += ";\n";
+			batch += *it;
+		}
+		if (!batch.empty()) _rSession << batch, Keywords::now;
+		commit();
 		return;
 	}
 	catch (Exception& ex)
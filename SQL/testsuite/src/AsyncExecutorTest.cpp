@@ -0,0 +1,129 @@
+//
+// AsyncExecutorTest.cpp
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "AsyncExecutorTest.h"
+#include "Poco/CppUnit/TestCaller.h"
+#include "Poco/CppUnit/TestSuite.h"
+#include "Poco/SQL/AsyncExecutor.h"
+#include "Poco/SQL/Session.h"
+#include "Poco/SQL/SessionFactory.h"
+#include "Poco/CancellationToken.h"
+#include "Poco/Event.h"
+#include "Poco/Thread.h"
+#include "Poco/Exception.h"
+#include "Connector.h"
+
+
+using namespace Poco::SQL::Keywords;
+using Poco::Event;
+using Poco::SQL::AsyncExecutor;
+using Poco::SQL::Session;
+using Poco::SQL::SessionFactory;
+using Poco::SQL::Statement;
+
+
+AsyncExecutorTest::AsyncExecutorTest(const std::string& name): CppUnit::TestCase(name)
+{
+	Poco::SQL::Test::Connector::addToFactory();
+}
+
+
+AsyncExecutorTest::~AsyncExecutorTest()
+{
+	Poco::SQL::Test::Connector::removeFromFactory();
+}
+
+
+void AsyncExecutorTest::testExecute()
+{
+	Session sess(SessionFactory::instance().create("test", "cs"));
+	std::string str;
+	Statement stmt = (sess << "SELECT * FROM Strings", into(str), limit(50));
+
+	AsyncExecutor executor(2, 16);
+	Event done;
+	bool failed = true;
+	executor.execute(stmt, [&done, &failed](std::size_t rows, const Poco::Exception* pExc)
+	{
+		failed = (pExc != 0);
+		done.set();
+	});
+	assertTrue (done.tryWait(5000));
+	assertTrue (!failed);
+	while (executor.active() > 0) Poco::Thread::sleep(10);
+	assertTrue (executor.queued() == 0);
+}
+
+
+void AsyncExecutorTest::testStatementLifetime()
+{
+	// the executor holds its own reference to the statement's
+	// implementation: the caller's Statement may go out of scope
+	// right after execute()
+	Session sess(SessionFactory::instance().create("test", "cs"));
+	AsyncExecutor executor(1, 16);
+	Event done;
+	bool failed = true;
+	{
+		std::string str;
+		Statement stmt = (sess << "SELECT * FROM Strings", into(str), limit(50));
+		executor.execute(stmt, [&done, &failed](std::size_t rows, const Poco::Exception* pExc)
+		{
+			failed = (pExc != 0);
+			done.set();
+		});
+	}
+	assertTrue (done.tryWait(5000));
+	assertTrue (!failed);
+}
+
+
+void AsyncExecutorTest::testCancellation()
+{
+	Session sess(SessionFactory::instance().create("test", "cs"));
+	std::string str;
+	Statement stmt = (sess << "SELECT * FROM Strings", into(str), limit(50));
+
+	Poco::CancellationTokenSource source;
+	source.cancel();
+
+	AsyncExecutor executor(1, 16);
+	Event done;
+	bool interrupted = false;
+	executor.execute(stmt, [&done, &interrupted](std::size_t rows, const Poco::Exception* pExc)
+	{
+		interrupted = pExc && dynamic_cast<const Poco::InterruptedException*>(pExc) != 0;
+		done.set();
+	}, source.token());
+	assertTrue (done.tryWait(5000));
+	assertTrue (interrupted);
+}
+
+
+void AsyncExecutorTest::setUp()
+{
+}
+
+
+void AsyncExecutorTest::tearDown()
+{
+}
+
+
+CppUnit::Test* AsyncExecutorTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("AsyncExecutorTest");
+
+	CppUnit_addTest(pSuite, AsyncExecutorTest, testExecute);
+	CppUnit_addTest(pSuite, AsyncExecutorTest, testStatementLifetime);
+	CppUnit_addTest(pSuite, AsyncExecutorTest, testCancellation);
+
+	return pSuite;
+}
@@ -0,0 +1,38 @@
+//
+// AsyncExecutorTest.h
+//
+// Definition of the AsyncExecutorTest class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef AsyncExecutorTest_INCLUDED
+#define AsyncExecutorTest_INCLUDED
+
+
+#include "Poco/SQL/SQL.h"
+#include "Poco/CppUnit/TestCase.h"
+
+
+class AsyncExecutorTest: public CppUnit::TestCase
+{
+public:
+	AsyncExecutorTest(const std::string& name);
+	~AsyncExecutorTest();
+
+	void testExecute();
+	void testStatementLifetime();
+	void testCancellation();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // AsyncExecutorTest_INCLUDED
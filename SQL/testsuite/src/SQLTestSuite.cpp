@@ -11,6 +11,7 @@
 #include "SQLTestSuite.h"
 #include "SQLTest.h"
 #include "SessionPoolTest.h"
+#include "AsyncExecutorTest.h"
 
 
 CppUnit::Test* SQLTestSuite::suite()
@@ -19,6 +20,7 @@ CppUnit::Test* SQLTestSuite::suite()
 
 	pSuite->addTest(SQLTest::suite());
 	pSuite->addTest(SessionPoolTest::suite());
+	pSuite->addTest(AsyncExecutorTest::suite());
 
 	return pSuite;
 }
@@ -99,6 +99,28 @@ public:
 		///
 		/// Returns the absolute path of the extracted entry.
 
+	ConstIterator findFirst(const std::string& path) const;
+		/// Returns an iterator pointing to the first entry with the
+		/// given path (as stored in the archive, forward slashes),
+		/// or end() if there is no such entry. The entry list is
+		/// loaded once when the archive is opened, so lookups do
+		/// not rescan the archive.
+
+	void extractParallel(const std::string& destPath, int maxThreads = 0);
+		/// Extracts the entire archive to the given path, fanning
+		/// the entries out over a ThreadPool (maxThreads <= 0 uses
+		/// one thread per processor). Each worker operates on its
+		/// own archive handle, so decompression of independent
+		/// streams proceeds concurrently.
+		///
+		/// Progress and errors are reported via the extracted and
+		/// failed events, which may fire from worker threads.
+
+	void extractParallel(const EntryVec& entries, const std::string& destPath, int maxThreads = 0);
+		/// Extracts only the given entries (e.g. a subset located
+		/// with findFirst() or by iteration), fanned out over a
+		/// ThreadPool; see extractParallel(destPath, maxThreads).
+
 private:
 	Archive();
 	Archive(const Archive&);
@@ -23,6 +23,11 @@
 #include "Poco/File.h"
 #include "Poco/Path.h"
 #include "Poco/Mutex.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Environment.h"
+#include "Poco/SharedPtr.h"
+#include <vector>
 #include "7z.h"
 #include "7zAlloc.h"
 #include "7zCrc.h"
@@ -169,6 +174,11 @@ protected:
 		{
 			throw Poco::OpenFileException(_path);
 		}
+#else
+		if (InFile_Open(&_archiveStream.file, _path.c_str()) != SZ_OK)
+		{
+			throw Poco::OpenFileException(_path);
+		}
 #endif
 	
 		_lookStream.realStream = &_archiveStream.s;
@@ -367,4 +377,132 @@ std::string Archive::extract(const ArchiveEntry& entry, const std::string& destP
 }
 
 
+Archive::ConstIterator Archive::findFirst(const std::string& path) const
+{
+	ConstIterator it = begin();
+	ConstIterator itEnd = end();
+	for (; it != itEnd; ++it)
+	{
+		if (it->path() == path) return it;
+	}
+	return itEnd;
+}
+
+
+namespace
+{
+	class ExtractGroupJob: public Poco::Runnable
+		/// Extracts one partition of the entry list on its own
+		/// archive handle, so workers decompress independently.
+	{
+	public:
+		ExtractGroupJob(Archive& owner, const std::string& archivePath, const Archive::EntryVec& entries, const std::string& destPath):
+			_owner(owner),
+			_archivePath(archivePath),
+			_entries(entries),
+			_destPath(destPath)
+		{
+		}
+
+		void run()
+		{
+			try
+			{
+				ArchiveImpl impl(_archivePath);
+				for (Archive::EntryVec::const_iterator it = _entries.begin(); it != _entries.end(); ++it)
+				{
+					Archive::ExtractedEventArgs extractedArgs;
+					extractedArgs.entry = *it;
+					bool success = true;
+					try
+					{
+						extractedArgs.extractedPath = impl.extract(*it, _destPath);
+					}
+					catch (Poco::Exception& exc)
+					{
+						success = false;
+						Archive::FailedEventArgs failedArgs;
+						failedArgs.entry = *it;
+						failedArgs.pException = &exc;
+						_owner.failed(&_owner, failedArgs);
+					}
+					if (success)
+					{
+						_owner.extracted(&_owner, extractedArgs);
+					}
+				}
+			}
+			catch (Poco::Exception& exc)
+			{
+				// could not open a worker handle: report every entry
+				// of the group as failed
+				for (Archive::EntryVec::const_iterator it = _entries.begin(); it != _entries.end(); ++it)
+				{
+					Archive::FailedEventArgs failedArgs;
+					failedArgs.entry = *it;
+					failedArgs.pException = &exc;
+					_owner.failed(&_owner, failedArgs);
+				}
+			}
+		}
+
+	private:
+		Archive& _owner;
+		std::string _archivePath;
+		Archive::EntryVec _entries;
+		std::string _destPath;
+	};
+}
+
+
+void Archive::extractParallel(const std::string& destPath, int maxThreads)
+{
+	EntryVec entries(begin(), end());
+	extractParallel(entries, destPath, maxThreads);
+}
+
+
+void Archive::extractParallel(const EntryVec& entries, const std::string& destPath, int maxThreads)
+{
+	if (maxThreads <= 0) maxThreads = static_cast<int>(Poco::Environment::processorCount());
+	if (maxThreads > static_cast<int>(entries.size())) maxThreads = static_cast<int>(entries.size());
+	if (maxThreads < 1) return;
+
+	// directories first, so concurrent file extraction never races
+	// on creating the tree
+	EntryVec files;
+	for (EntryVec::const_iterator it = entries.begin(); it != entries.end(); ++it)
+	{
+		if (it->isDirectory())
+		{
+			ExtractedEventArgs extractedArgs;
+			extractedArgs.entry = *it;
+			extractedArgs.extractedPath = _pImpl->extract(*it, destPath);
+			extracted(this, extractedArgs);
+		}
+		else
+		{
+			files.push_back(*it);
+		}
+	}
+
+	// round-robin partition: consecutive entries usually share
+	// folders (solid blocks), spreading them reduces duplicate
+	// block decompression per worker
+	std::vector<EntryVec> groups(maxThreads);
+	for (std::size_t i = 0; i < files.size(); i++)
+		groups[i % maxThreads].push_back(files[i]);
+
+	Poco::ThreadPool pool(1, maxThreads);
+	std::vector<Poco::SharedPtr<ExtractGroupJob> > jobs;
+	for (std::vector<EntryVec>::const_iterator it = groups.begin(); it != groups.end(); ++it)
+	{
+		if (it->empty()) continue;
+		jobs.push_back(new ExtractGroupJob(*this, path(), *it, destPath));
+		pool.start(*jobs.back());
+	}
+	pool.joinAll();
+}
+
+
 } } // namespace Poco::SevenZip
@@ -32,6 +32,7 @@
 #include <cstdarg>
 #endif
 #include <vector>
+#include <set>
 #include <typeinfo>
 
 
@@ -215,11 +216,18 @@ public:
 
 	template <class C> C& getSubsystem() const;
 		/// Returns a reference to the subsystem of the class
-		/// given as template argument.
+		/// given as template argument. If the subsystem is lazy
+		/// (see Subsystem::lazy()) and has not been initialized
+		/// yet, it is initialized on this first access.
 		///
 		/// Throws a NotFoundException if such a subsystem has
 		/// not been registered.
 
+	void initializeSubsystem(Subsystem& subsystem);
+		/// Initializes the given subsystem if it has not been
+		/// initialized yet; used to bring up lazy subsystems on
+		/// first access.
+
 	SubsystemVec& subsystems();
 		/// Returns a reference to the subsystem list
 
@@ -381,6 +389,7 @@ private:
 
 	ConfigPtr         _pConfig;
 	SubsystemVec      _subsystems;
+	std::set<Subsystem*> _initializedSubsystems;
 	bool              _initialized;
 	std::string       _command;
 	ArgVec            _argv;
@@ -414,7 +423,13 @@ template <class C> C& Application::getSubsystem() const
 	{
 		const Subsystem* pSS(it->get());
 		const C* pC = dynamic_cast<const C*>(pSS);
-		if (pC) return *const_cast<C*>(pC);
+		if (pC)
+		{
+			// bring lazy subsystems up on first access
+			if (pSS->lazy() && _initialized)
+				const_cast<Application*>(this)->initializeSubsystem(*const_cast<C*>(pC));
+			return *const_cast<C*>(pC);
+		}
 	}
 	throw Poco::NotFoundException("The subsystem has not been registered", typeid(C).name());
 }
@@ -93,6 +93,18 @@ public:
 		/// Does nothing if the given configuration is not part of the
 		/// LayeredConfiguration.
 
+	AbstractConfiguration::Ptr snapshot() const;
+		/// Compiles the current layered view into a single flat
+		/// configuration and returns it.
+		///
+		/// Reading a property from the snapshot is a single map
+		/// lookup instead of a walk over every layer, so handlers
+		/// that consult the configuration per request should take a
+		/// snapshot and query that. The snapshot is a detached copy:
+		/// later changes to the layers (or to the snapshot) do not
+		/// affect the other side. To stay current, take a new
+		/// snapshot when a layer fires its propertyChanged event.
+
 protected:
 	struct ConfigItem
 	{
@@ -0,0 +1,81 @@
+//
+// PreforkSupervisor.h
+//
+// Library: Util
+// Package: Application
+// Module:  PreforkSupervisor
+//
+// Definition of the PreforkSupervisor class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Util_PreforkSupervisor_INCLUDED
+#define Util_PreforkSupervisor_INCLUDED
+
+
+#include "Poco/Util/Util.h"
+#include "Poco/Runnable.h"
+#include <atomic>
+
+
+namespace Poco {
+namespace Util {
+
+
+class Util_API PreforkSupervisor
+	/// Runs a fixed number of forked worker processes and restarts
+	/// them when they exit.
+	///
+	/// The intended use in a ServerApplication: bind the server
+	/// socket(s) in main() before calling supervise(); the bound
+	/// descriptors are inherited by every worker, so all workers
+	/// accept from the same socket(s) and the kernel spreads
+	/// connections across them:
+	///
+	///     ServerSocket svs(port);      // bound once, in the parent
+	///     WorkerMain worker(svs);      // Runnable serving on svs
+	///     PreforkSupervisor supervisor;
+	///     supervisor.supervise(4, worker);
+	///
+	/// In each worker process, workerMain.run() is invoked and the
+	/// process exits when it returns. The parent supervises: a
+	/// worker that exits (or crashes) is replaced, until stop() is
+	/// called from a signal handler or another thread, after which
+	/// remaining workers are terminated and supervise() returns.
+	///
+	/// Only available on POSIX platforms.
+{
+public:
+	PreforkSupervisor();
+		/// Creates the PreforkSupervisor.
+
+	int supervise(int workers, Poco::Runnable& workerMain);
+		/// Forks the given number of workers and supervises them.
+		/// Returns the number of abnormal worker exits observed
+		/// (0 for a clean shutdown).
+
+	void stop();
+		/// Initiates shutdown: no workers are restarted, running
+		/// workers receive SIGTERM, and supervise() returns once
+		/// they have exited. Async-signal-safe.
+
+	bool isStopped() const;
+		/// Returns true after stop() has been called.
+
+private:
+	PreforkSupervisor(const PreforkSupervisor&);
+	PreforkSupervisor& operator = (const PreforkSupervisor&);
+
+	std::atomic<bool> _stopped;
+};
+
+
+} } // namespace Poco::Util
+
+
+#endif // Util_PreforkSupervisor_INCLUDED
@@ -98,12 +98,12 @@ private:
 	typedef std::list<std::string> FileContent;
 	typedef std::map<std::string, FileContent::iterator> KeyFileContentItMap;
 
-	void parseLine(std::istream& istr);
-	void skipSpace(std::istream& istr) const;
+	void parseLine(std::streambuf& buf);
+	void skipSpace(std::streambuf& buf) const;
 	bool isComment(int c) const ;
-	void saveComment(std::istream& istr);
-	void skipLine(std::istream& istr) const;
-	void saveKeyValue(std::istream& istr);
+	void saveComment(std::streambuf& buf);
+	void skipLine(std::streambuf& buf) const;
+	void saveKeyValue(std::streambuf& buf);
 	bool isNewLine(int c) const;
 	bool isKeyValueSeparator(int c) const;
 	std::string composeOneLine(const std::string& key, const std::string& value) const;
@@ -112,7 +112,7 @@ private:
 	FileContent _fileContent;
 	KeyFileContentItMap _keyFileContentItMap;
 
-	static int readChar(std::istream& istr);
+	static int readChar(std::streambuf& buf);
 };
 
 
@@ -53,6 +53,18 @@ public:
 
 	virtual const char* name() const = 0;
 		/// Returns the name of the subsystem.
+
+	virtual bool lazy() const;
+		/// Returns true if the subsystem's initialization should be
+		/// deferred until it is first requested through
+		/// Application::getSubsystem() (or explicitly via
+		/// Application::initializeSubsystem()), instead of running
+		/// during application startup. The default implementation
+		/// returns false.
+		///
+		/// Marking rarely used, expensive subsystems lazy takes
+		/// their cost out of the startup path.
+		/// Returns the name of the subsystem.
 		/// Must be implemented by subclasses.
 
 protected:
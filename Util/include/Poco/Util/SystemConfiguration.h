@@ -20,6 +20,10 @@
 
 #include "Poco/Util/Util.h"
 #include "Poco/Util/AbstractConfiguration.h"
+#include "Poco/Timespan.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Mutex.h"
+#include <map>
 
 
 namespace Poco {
@@ -61,6 +65,20 @@ public:
 	SystemConfiguration();
 		/// Creates the SystemConfiguration.
 
+	void enableCaching(const Poco::Timespan& timeToLive);
+		/// Enables caching of property values: once a property has
+		/// been queried, its value is served from the cache (one
+		/// map lookup instead of an OS query) until the given TTL
+		/// expires. system.dateTime and the volatile
+		/// system.currentDir are never cached.
+		///
+		/// Useful when configuration lookups through a
+		/// LayeredConfiguration reach this configuration on a
+		/// request path.
+
+	void disableCaching();
+		/// Disables property caching and drops the cache.
+
 protected:
 	bool getRaw(const std::string& key, std::string& value) const;
 	void setRaw(const std::string& key, const std::string& value);
@@ -70,6 +88,19 @@ protected:
 
 private:
 	static bool getEnv(const std::string& name, std::string& value);
+	bool getRawImpl(const std::string& key, std::string& value) const;
+	bool getCached(const std::string& key, std::string& value) const;
+
+	struct CachedValue
+	{
+		std::string value;
+		Poco::Timestamp cachedAt;
+	};
+
+	bool _cachingEnabled;
+	Poco::Timespan _cacheTTL;
+	mutable std::map<std::string, CachedValue> _cache;
+	mutable Poco::FastMutex _cacheMutex;
 
 	static const std::string OSNAME;
 	static const std::string OSVERSION;
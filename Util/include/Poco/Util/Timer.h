@@ -21,6 +21,7 @@
 #include "Poco/Util/Util.h"
 #include "Poco/Util/TimerTask.h"
 #include "Poco/TimedNotificationQueue.h"
+#include "Poco/Histogram.h"
 #include "Poco/Thread.h"
 #include "Poco/Runnable.h"
 
@@ -154,6 +155,16 @@ public:
 		/// If task execution takes longer than the given interval,
 		/// further executions are delayed.
 
+	const Poco::Histogram& fireLatency() const;
+		/// Returns the histogram of scheduled-versus-actual task
+		/// firing latency, in microseconds: each executed task
+		/// records how late the timer thread got to it, so timer
+		/// drift under load can be quantified (e.g.
+		/// fireLatency().quantile(0.99)).
+
+	void resetFireLatency();
+		/// Resets the firing latency statistics.
+
 protected:
 	void run();
 	static void validateTask(const TimerTask::Ptr& pTask);
@@ -163,6 +174,7 @@ private:
 	Timer& operator = (const Timer&);
 	
 	Poco::TimedNotificationQueue _queue;
+	Poco::Histogram _fireLatency;
 	Poco::Thread _thread;
 };
 
@@ -181,12 +181,30 @@ void Application::initialize(Application& self)
 {
 	for (SubsystemVec::iterator it = _subsystems.begin(); it != _subsystems.end(); ++it)
 	{
+		if ((*it)->lazy())
+		{
+			// deferred until first use via getSubsystem()
+			_pLogger->debug(std::string("Deferring initialization of lazy subsystem: ") + (*it)->name());
+			continue;
+		}
 		_pLogger->debug(std::string("Initializing subsystem: ") + (*it)->name());
 		(*it)->initialize(self);
+		_initializedSubsystems.insert(it->get());
 	}
 	_initialized = true;
 }
 
+
+void Application::initializeSubsystem(Subsystem& subsystem)
+{
+	if (_initializedSubsystems.find(&subsystem) == _initializedSubsystems.end())
+	{
+		_pLogger->debug(std::string("Initializing subsystem: ") + subsystem.name());
+		subsystem.initialize(*this);
+		_initializedSubsystems.insert(&subsystem);
+	}
+}
+
 	
 void Application::uninitialize()
 {
@@ -194,9 +212,11 @@ void Application::uninitialize()
 	{
 		for (SubsystemVec::reverse_iterator it = _subsystems.rbegin(); it != _subsystems.rend(); ++it)
 		{
+			if (_initializedSubsystems.find(it->get()) == _initializedSubsystems.end()) continue;
 			_pLogger->debug(std::string("Uninitializing subsystem: ") + (*it)->name());
 			(*it)->uninitialize();
 		}
+		_initializedSubsystems.clear();
 		_initialized = false;
 	}
 }
@@ -102,10 +102,15 @@ void JSONConfiguration::getIndexes(std::string& name, std::vector<int>& indexes)
 {
 	indexes.clear();
 
+	// the overwhelmingly common case has no array index at all
+	if (name.find('[') == std::string::npos) return;
+
 	RegularExpression::MatchVec matches;
 	int firstOffset = -1;
 	int offset = 0;
-	RegularExpression regex("\\[([0-9]+)\\]");
+	// compiled once; recompiling the pattern per property access
+	// dominated lookup cost
+	static const RegularExpression regex("\\[([0-9]+)\\]");
 	while(regex.match(name, offset, matches) > 0 )
 	{
 		if ( firstOffset == -1 )
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Util/LayeredConfiguration.h"
+#include "Poco/Util/MapConfiguration.h"
 #include "Poco/Exception.h"
 #include <set>
 
@@ -163,6 +164,43 @@ void LayeredConfiguration::removeRaw(const std::string& key)
 }
 
 
+namespace
+{
+	void copyKeys(const AbstractConfiguration& source, const std::string& base, MapConfiguration& target)
+	{
+		AbstractConfiguration::Keys keys;
+		source.keys(base, keys);
+		for (AbstractConfiguration::Keys::const_iterator it = keys.begin(); it != keys.end(); ++it)
+		{
+			std::string fullKey = base.empty() ? *it : base + "." + *it;
+			if (source.has(fullKey))
+			{
+				std::string value;
+				// properties can disappear between keys() and getString()
+				// when another thread modifies a writeable layer
+				try
+				{
+					value = source.getString(fullKey);
+					target.setString(fullKey, value);
+				}
+				catch (Poco::NotFoundException&)
+				{
+				}
+			}
+			copyKeys(source, fullKey, target);
+		}
+	}
+}
+
+
+AbstractConfiguration::Ptr LayeredConfiguration::snapshot() const
+{
+	Poco::AutoPtr<MapConfiguration> pSnapshot(new MapConfiguration);
+	copyKeys(*this, std::string(), *pSnapshot);
+	return pSnapshot;
+}
+
+
 int LayeredConfiguration::lowest() const
 {
 	if (_configs.empty())
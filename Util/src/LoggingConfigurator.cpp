@@ -20,6 +20,7 @@
 #include "Poco/PatternFormatter.h"
 #include "Poco/Logger.h"
 #include "Poco/LoggingRegistry.h"
+#include <typeinfo>
 #include "Poco/LoggingFactory.h"
 #include <map>
 
@@ -83,6 +84,26 @@ void LoggingConfigurator::configureChannels(AbstractConfiguration::Ptr pConfig)
 	for (AbstractConfiguration::Keys::const_iterator it = channels.begin(); it != channels.end(); ++it)
 	{
 		AutoPtr<AbstractConfiguration> pChannelConfig(pConfig->createView(*it));
+
+		// differential reload: when a channel of the same class is
+		// already registered under this name, keep the live instance
+		// and only re-apply its properties (below). Replacing it
+		// would drop messages and, for file channels, close and
+		// re-open the log file on every reconfiguration.
+		std::string channelClass = pChannelConfig->getString("class", "");
+		if (!channelClass.empty())
+		{
+			try
+			{
+				Channel::Ptr pExisting = LoggingRegistry::defaultRegistry().channelForName(*it);
+				if (pExisting && std::string(typeid(*pExisting).name()).find(channelClass) != std::string::npos)
+					continue;
+			}
+			catch (Poco::NotFoundException&)
+			{
+			}
+		}
+
 		AutoPtr<Channel> pChannel = createChannel(pChannelConfig);
 		LoggingRegistry::defaultRegistry().registerChannel(*it, pChannel);
 	}
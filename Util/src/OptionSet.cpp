@@ -81,6 +81,17 @@ bool OptionSet::hasOption(const std::string& name, bool matchShort) const
 	
 const Option& OptionSet::getOption(const std::string& name, bool matchShort) const
 {
+	// exact full-name matches are unambiguous by construction; resolve
+	// them without the prefix scan, which otherwise runs over every
+	// registered option for every argument
+	if (!matchShort)
+	{
+		for (Iterator it = _options.begin(); it != _options.end(); ++it)
+		{
+			if (it->matchesFull(name)) return *it;
+		}
+	}
+
 	const Option* pOption = 0;
 	for (Iterator it = _options.begin(); it != _options.end(); ++it)
 	{
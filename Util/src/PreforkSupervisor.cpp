@@ -0,0 +1,136 @@
+//
+// PreforkSupervisor.cpp
+//
+// Library: Util
+// Package: Application
+// Module:  PreforkSupervisor
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Util/PreforkSupervisor.h"
+#include "Poco/Exception.h"
+#if defined(POCO_OS_FAMILY_UNIX)
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+#include <errno.h>
+#include <set>
+#endif
+
+
+namespace Poco {
+namespace Util {
+
+
+PreforkSupervisor::PreforkSupervisor():
+	_stopped(false)
+{
+}
+
+
+void PreforkSupervisor::stop()
+{
+	_stopped = true;
+}
+
+
+bool PreforkSupervisor::isStopped() const
+{
+	return _stopped;
+}
+
+
+#if defined(POCO_OS_FAMILY_UNIX)
+
+
+namespace
+{
+	pid_t forkWorker(Poco::Runnable& workerMain)
+	{
+		pid_t pid = ::fork();
+		if (pid < 0) throw Poco::SystemException("Cannot fork worker process");
+		if (pid == 0)
+		{
+			// worker: run and exit; never return into the
+			// supervisor's stack
+			int rc = 0;
+			try
+			{
+				workerMain.run();
+			}
+			catch (...)
+			{
+				rc = 1;
+			}
+			_exit(rc);
+		}
+		return pid;
+	}
+}
+
+
+int PreforkSupervisor::supervise(int workers, Poco::Runnable& workerMain)
+{
+	poco_assert (workers > 0);
+
+	std::set<pid_t> children;
+	int abnormalExits = 0;
+
+	for (int i = 0; i < workers && !_stopped; i++)
+		children.insert(forkWorker(workerMain));
+
+	while (!children.empty())
+	{
+		int status = 0;
+		pid_t pid = ::waitpid(-1, &status, _stopped ? WNOHANG : 0);
+		if (pid > 0)
+		{
+			children.erase(pid);
+			if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+				++abnormalExits;
+			if (!_stopped)
+			{
+				// replace the fallen worker
+				children.insert(forkWorker(workerMain));
+			}
+		}
+		else if (pid < 0 && errno != EINTR)
+		{
+			break;
+		}
+		if (_stopped)
+		{
+			for (std::set<pid_t>::const_iterator it = children.begin(); it != children.end(); ++it)
+				::kill(*it, SIGTERM);
+			// collect the remainder (blocking)
+			while (!children.empty())
+			{
+				pid_t done = ::waitpid(-1, &status, 0);
+				if (done > 0) children.erase(done);
+				else if (errno != EINTR) break;
+			}
+		}
+	}
+	return abnormalExits;
+}
+
+
+#else
+
+
+int PreforkSupervisor::supervise(int, Poco::Runnable&)
+{
+	throw Poco::NotImplementedException("PreforkSupervisor is only available on POSIX platforms");
+}
+
+
+#endif
+
+
+} } // namespace Poco::Util
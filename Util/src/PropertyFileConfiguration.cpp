@@ -61,7 +61,12 @@ void PropertyFileConfiguration::load(std::istream& istr, bool preserveComment)
 	_fileContent.clear();
 	_keyFileContentItMap.clear();
 
-	while (!istr.eof()) parseLine(istr);
+	// parse through the stream buffer directly; the per-character
+	// istream interface costs a sentry per get() on 80k-line files
+	std::streambuf& buf = *istr.rdbuf();
+	static const int eof = std::char_traits<char>::eof();
+	while (buf.sgetc() != eof) parseLine(buf);
+	istr.setstate(std::ios_base::eofbit);
 }
 
 	
@@ -108,36 +113,44 @@ void PropertyFileConfiguration::save(const std::string& path) const
 // If _preserveComment is true, not only save key-value into map
 // but also save the entire file into _fileContent.
 // Otherwise, only save key-value into map.
-void PropertyFileConfiguration::parseLine(std::istream& istr)
+void PropertyFileConfiguration::parseLine(std::streambuf& buf)
 {
-	skipSpace(istr);
+	static const int eof = std::char_traits<char>::eof();
 
-	if (!istr.eof())
+	skipSpace(buf);
+
+	if (buf.sgetc() != eof)
 	{
-		if (isComment(istr.peek()))
+		if (isComment(buf.sgetc()))
 		{
-			if (_preserveComment) saveComment(istr);
-			else skipLine(istr);
+			if (_preserveComment) saveComment(buf);
+			else skipLine(buf);
 		}
-		else saveKeyValue(istr);
+		else saveKeyValue(buf);
 	}
 }
 
 
-void PropertyFileConfiguration::skipSpace(std::istream& istr) const
+void PropertyFileConfiguration::skipSpace(std::streambuf& buf) const
 {
-	while (!istr.eof() && Poco::Ascii::isSpace(istr.peek())) istr.get();
+	int c = buf.sgetc();
+	while (c != std::char_traits<char>::eof() && Poco::Ascii::isSpace(c))
+	{
+		buf.sbumpc();
+		c = buf.sgetc();
+	}
 }
 
 
-int PropertyFileConfiguration::readChar(std::istream& istr)
+int PropertyFileConfiguration::readChar(std::streambuf& buf)
 {
+	static const int eof = std::char_traits<char>::eof();
 	for (;;)
 	{
-		int c = istr.get();
+		int c = buf.sbumpc();
 		if (c == '\\')
 		{
-			c = istr.get();
+			c = buf.sbumpc();
 			switch (c)
 			{
 			case 't':
@@ -149,8 +162,8 @@ int PropertyFileConfiguration::readChar(std::istream& istr)
 			case 'f':
 				return '\f';
 			case '\r':
-				if (istr.peek() == '\n')
-					istr.get();
+				if (buf.sgetc() == '\n')
+					buf.sbumpc();
 				continue;
 			case '\n':
 				continue;
@@ -160,6 +173,8 @@ int PropertyFileConfiguration::readChar(std::istream& istr)
 		}
 		else if (c == '\n' || c == '\r')
 			return 0;
+		else if (c == eof)
+			return 0;
 		else
 			return c;
 	}
@@ -204,48 +219,48 @@ bool PropertyFileConfiguration::isComment(int c) const
 }
 
 
-void PropertyFileConfiguration::saveComment(std::istream& istr)
+void PropertyFileConfiguration::saveComment(std::streambuf& buf)
 {
 	std::string comment;
 
-	int c = istr.get();
+	int c = buf.sbumpc();
 	while (!isNewLine(c))
 	{
 		comment += (char) c;
-		c = istr.get();
+		c = buf.sbumpc();
 	}
-	comment += (char) c;
+	if (c != std::char_traits<char>::eof()) comment += (char) c;
 
 	_fileContent.push_back(comment);
 }
 
 
-void PropertyFileConfiguration::skipLine(std::istream& istr) const
+void PropertyFileConfiguration::skipLine(std::streambuf& buf) const
 {
-	int c = istr.get();
-	while (!isNewLine(c)) c = istr.get();
+	int c = buf.sbumpc();
+	while (!isNewLine(c)) c = buf.sbumpc();
 }
 
 
-void PropertyFileConfiguration::saveKeyValue(std::istream& istr)
+void PropertyFileConfiguration::saveKeyValue(std::streambuf& buf)
 {
-	int c = istr.get();
+	int c = buf.sbumpc();
 
 	std::string key;
 	while (!isNewLine(c) && !isKeyValueSeparator(c))
 	{
 		key += (char) c;
-		c = istr.get();
+		c = buf.sbumpc();
 	}
 
 	std::string value;
 	if (isKeyValueSeparator(c))
 	{
-		c = readChar(istr);
-		while (!istr.eof() && c)
+		c = readChar(buf);
+		while (c)
 		{
 			value += (char) c;
-			c = readChar(istr);
+			c = readChar(buf);
 		}
 	}
 
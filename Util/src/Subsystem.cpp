@@ -29,6 +29,12 @@ Subsystem::~Subsystem()
 }
 
 
+bool Subsystem::lazy() const
+{
+	return false;
+}
+
+
 void Subsystem::reinitialize(Application& app)
 {
 	uninitialize();
@@ -53,17 +53,68 @@ const std::string SystemConfiguration::PID            = "system.pid";
 const std::string SystemConfiguration::ENV            = "system.env.";
 
 
-SystemConfiguration::SystemConfiguration()
+SystemConfiguration::SystemConfiguration():
+	_cachingEnabled(false)
 {
 }
 
 
+void SystemConfiguration::enableCaching(const Poco::Timespan& timeToLive)
+{
+	Poco::FastMutex::ScopedLock lock(_cacheMutex);
+	_cachingEnabled = true;
+	_cacheTTL = timeToLive;
+}
+
+
+void SystemConfiguration::disableCaching()
+{
+	Poco::FastMutex::ScopedLock lock(_cacheMutex);
+	_cachingEnabled = false;
+	_cache.clear();
+}
+
+
+bool SystemConfiguration::getCached(const std::string& key, std::string& value) const
+{
+	Poco::FastMutex::ScopedLock lock(_cacheMutex);
+	std::map<std::string, CachedValue>::iterator it = _cache.find(key);
+	if (it == _cache.end()) return false;
+	if (it->second.cachedAt.isElapsed(_cacheTTL.totalMicroseconds()))
+	{
+		_cache.erase(it);
+		return false;
+	}
+	value = it->second.value;
+	return true;
+}
+
+
 SystemConfiguration::~SystemConfiguration()
 {
 }
 
 
 bool SystemConfiguration::getRaw(const std::string& key, std::string& value) const
+{
+	// date/time and working directory are inherently volatile;
+	// everything else may be served from the cache when enabled
+	bool cacheable = _cachingEnabled && key != DATETIME && key != CURRENTDIR;
+	if (cacheable && getCached(key, value)) return true;
+
+	bool found = getRawImpl(key, value);
+	if (found && cacheable)
+	{
+		Poco::FastMutex::ScopedLock lock(_cacheMutex);
+		CachedValue cached;
+		cached.value = value;
+		_cache[key] = cached;
+	}
+	return found;
+}
+
+
+bool SystemConfiguration::getRawImpl(const std::string& key, std::string& value) const
 {
 	if (key == OSNAME)
 	{
@@ -114,9 +114,11 @@ private:
 class TaskNotification: public TimerNotification
 {
 public:
-	TaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask):
+	TaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask, const Poco::Clock& scheduledTime, Poco::Histogram* pFireLatency):
 		TimerNotification(queue),
-		_pTask(pTask)
+		_pTask(pTask),
+		_scheduledTime(scheduledTime),
+		_pFireLatency(pFireLatency)
 	{
 	}
 
@@ -129,10 +131,21 @@ public:
 		return _pTask;
 	}
 
+	void setScheduledTime(const Poco::Clock& scheduledTime)
+	{
+		_scheduledTime = scheduledTime;
+	}
+
 	bool execute()
 	{
 		if (!_pTask->isCancelled())
 		{
+			if (_pFireLatency)
+			{
+				// how late the timer thread got to this task,
+				// relative to its scheduled firing time
+				_pFireLatency->record(_scheduledTime.elapsed());
+			}
 			try
 			{
 				_pTask->_lastExecution.update();
@@ -156,14 +169,16 @@ public:
 
 private:
 	TimerTask::Ptr _pTask;
+	Poco::Clock _scheduledTime;
+	Poco::Histogram* _pFireLatency;
 };
 
 
 class PeriodicTaskNotification: public TaskNotification
 {
 public:
-	PeriodicTaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask, long interval):
-		TaskNotification(queue, pTask),
+	PeriodicTaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask, long interval, const Poco::Clock& scheduledTime, Poco::Histogram* pFireLatency):
+		TaskNotification(queue, pTask, scheduledTime, pFireLatency),
 		_interval(interval)
 	{
 	}
@@ -182,6 +197,7 @@ public:
 			Poco::Clock nextExecution;
 			nextExecution += static_cast<Poco::Clock::ClockDiff>(_interval)*1000;
 			if (nextExecution < now) nextExecution = now;
+			setScheduledTime(nextExecution);
 			queue().enqueueNotification(this, nextExecution);
 			duplicate();
 		}
@@ -196,8 +212,8 @@ private:
 class FixedRateTaskNotification: public TaskNotification
 {
 public:
-	FixedRateTaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask, long interval, Poco::Clock clock):
-		TaskNotification(queue, pTask),
+	FixedRateTaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask, long interval, Poco::Clock clock, Poco::Histogram* pFireLatency):
+		TaskNotification(queue, pTask, clock, pFireLatency),
 		_interval(interval),
 		_nextExecution(clock)
 	{
@@ -216,6 +232,7 @@ public:
 			Poco::Clock now;
 			_nextExecution += static_cast<Poco::Clock::ClockDiff>(_interval)*1000;
 			if (_nextExecution < now) _nextExecution = now;
+			setScheduledTime(_nextExecution);
 			queue().enqueueNotification(this, _nextExecution);
 			duplicate();
 		}
@@ -276,14 +293,17 @@ void Timer::cancel(bool wait)
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Timestamp time)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new TaskNotification(_queue, pTask), time);
+	Poco::Timestamp tsNow;
+	Poco::Clock clock;
+	clock += time - tsNow;
+	_queue.enqueueNotification(new TaskNotification(_queue, pTask, clock, &_fireLatency), time);
 }
 
 
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Clock clock)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new TaskNotification(_queue, pTask), clock);
+	_queue.enqueueNotification(new TaskNotification(_queue, pTask, clock, &_fireLatency), clock);
 }
 
 
@@ -298,14 +318,17 @@ void Timer::schedule(TimerTask::Ptr pTask, long delay, long interval)
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Timestamp time, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), time);
+	Poco::Timestamp tsNow;
+	Poco::Clock clock;
+	clock += time - tsNow;
+	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval, clock, &_fireLatency), time);
 }
 
 
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Clock clock, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), clock);
+	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval, clock, &_fireLatency), clock);
 }
 
 
@@ -324,14 +347,26 @@ void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, Poco::Timestamp time, long
 	Poco::Clock clock;
 	Poco::Timestamp::TimeDiff diff = time - tsNow;
 	clock += diff;
-	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
+	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock, &_fireLatency), clock);
 }
 
 
 void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, Poco::Clock clock, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
+	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock, &_fireLatency), clock);
+}
+
+
+const Poco::Histogram& Timer::fireLatency() const
+{
+	return _fireLatency;
+}
+
+
+void Timer::resetFireLatency()
+{
+	_fireLatency.reset();
 }
 
 
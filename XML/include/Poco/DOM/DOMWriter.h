@@ -85,6 +85,24 @@ public:
 		/// Writes the XML for the given node to the file specified in systemId,
 		/// using a standard file output stream (Poco::FileOutputStream).
 
+	void writeNodeParallel(XMLByteOutputStream& ostr, Document* pDocument, int maxThreads = 0);
+		/// Writes the XML for the given document, serializing the
+		/// root element's children concurrently on a thread pool
+		/// (maxThreads <= 0 uses one thread per processor) while
+		/// preserving document order, so exports whose root
+		/// children are independent records scale with cores.
+		///
+		/// Output is identical to writeNode() when pretty-printing
+		/// is off (child fragments are serialized at depth zero, so
+		/// PRETTY_PRINT indentation would differ) and children do
+		/// not rely on namespace prefixes declared on ancestors
+		/// without carrying the declaration themselves.
+		///
+		/// The document is briefly modified (children are detached
+		/// while the root's own tag is serialized, before any
+		/// worker runs) and restored; it must not be accessed
+		/// concurrently during the call.
+
 private:
 	std::string         _encodingName;
 	Poco::TextEncoding* _pTextEncoding;
@@ -20,6 +20,7 @@
 
 #include "Poco/XML/XML.h"
 #include "Poco/DOM/AbstractContainerNode.h"
+#include "Poco/MemoryPool.h"
 #include "Poco/XML/Name.h"
 
 
@@ -184,6 +185,15 @@ public:
 	NamedNodeMap* attributes() const;
 	unsigned short nodeType() const;
 
+	void* operator new(std::size_t size);
+		/// Allocates Element nodes from a dedicated memory pool;
+		/// large DOM trees consist mostly of Element and Text
+		/// nodes, and pooling them takes the per-node allocations
+		/// off the general-purpose heap.
+
+	void operator delete(void* ptr, std::size_t size);
+		/// Returns the node's memory to the pool.
+
 protected:
 	Element(Document* pOwnerDocument, const XMLString& namespaceURI, const XMLString& localName, const XMLString& qname);
 	Element(Document* pOwnerDocument, const Element& elem);
@@ -46,6 +46,8 @@ protected:
 	const Node* _pParent;
 	XMLString   _name;
 	mutable unsigned long _count;
+	mutable Node* _pLast = 0;          /// last node returned by item()
+	mutable unsigned long _lastIndex = 0; /// its index; enables O(1) sequential iteration
 	
 	friend class AbstractContainerNode;
 	friend class Element;
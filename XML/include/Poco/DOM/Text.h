@@ -20,6 +20,7 @@
 
 #include "Poco/XML/XML.h"
 #include "Poco/DOM/CharacterData.h"
+#include "Poco/MemoryPool.h"
 #include "Poco/XML/XMLString.h"
 
 
@@ -59,6 +60,14 @@ public:
 	// Non-standard extensions
 	XMLString innerText() const;
 
+	void* operator new(std::size_t size);
+		/// Allocates Text nodes from a dedicated memory pool
+		/// (subclasses such as CDATASection fall through to the
+		/// general-purpose heap).
+
+	void operator delete(void* ptr, std::size_t size);
+		/// Returns the node's memory to the pool.
+
 protected:
 	Text(Document* pOwnerDocument, const XMLString& data);
 	Text(Document* pOwnerDocument, const Text& text);
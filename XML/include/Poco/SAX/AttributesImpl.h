@@ -156,6 +156,7 @@ protected:
 
 private:
 	AttributeVec _attributes;
+	AttributeVec _pool; // retired attributes whose buffers are reused
 	Attribute _empty;
 };
 
@@ -177,6 +178,19 @@ inline AttributesImpl::iterator AttributesImpl::end() const
 
 inline AttributesImpl::Attribute& AttributesImpl::addAttribute()
 {
+	if (!_pool.empty())
+	{
+		_attributes.push_back(std::move(_pool.back()));
+		_pool.pop_back();
+		Attribute& attr = _attributes.back();
+		attr.localName.clear();
+		attr.namespaceURI.clear();
+		attr.qname.clear();
+		attr.value.clear();
+		attr.type.clear();
+		attr.specified = false;
+		return attr;
+	}
 	_attributes.push_back(_empty);
 	return _attributes.back();
 }
@@ -49,12 +49,20 @@ public:
 	const Name& insert(const XMLString& qname, const XMLString& namespaceURI, const XMLString& localName);	
 		/// Returns a const reference to an Name for the given names.
 		/// Creates the Name if it does not already exist.
-		/// Throws a PoolOverflowException if the name pool is full.
+		/// When the pool is full, the name is stored in an
+		/// automatically created overflow pool (references to
+		/// previously inserted names remain valid), so documents
+		/// with more distinct names than the configured capacity
+		/// degrade gracefully instead of failing.
 
 	const Name& insert(const Name& name);	
 		/// Returns a const reference to an Name for the given name.
 		/// Creates the Name if it does not already exist.
-		/// Throws a PoolOverflowException if the name pool is full.
+		/// When the pool is full, the name is stored in an
+		/// automatically created overflow pool (references to
+		/// previously inserted names remain valid), so documents
+		/// with more distinct names than the configured capacity
+		/// degrade gracefully instead of failing.
 
 	void duplicate();
 		/// Increments the reference count.
@@ -72,6 +80,7 @@ private:
 
 	NamePoolItem* _pItems;
 	unsigned long _size;
+	NamePool* _pOverflow; /// spill pool, created when this one is full
 	unsigned long _salt;
 	int           _rc;
 };
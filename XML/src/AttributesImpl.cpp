@@ -217,6 +217,11 @@ void AttributesImpl::removeAttribute(const XMLString& namespaceURI, const XMLStr
 
 void AttributesImpl::clear()
 {
+	// retire the attributes instead of destroying them, so their
+	// string buffers are reused by subsequent addAttribute() calls;
+	// this keeps per-element SAX parsing free of per-attribute
+	// allocations
+	_pool.swap(_attributes);
 	_attributes.clear();
 }
 
@@ -24,6 +24,14 @@
 #include "Poco/XML/XMLException.h"
 #include "Poco/Path.h"
 #include "Poco/FileStream.h"
+#include "Poco/DOM/Element.h"
+#include "Poco/DOM/AutoPtr.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Environment.h"
+#include "Poco/SharedPtr.h"
+#include <sstream>
+#include <vector>
 
 
 namespace Poco {
@@ -98,5 +106,139 @@ void DOMWriter::writeNode(const std::string& systemId, const Node* pNode)
 }
 
 
+namespace
+{
+	class SubtreeJob: public Poco::Runnable
+		/// Serializes one range of root children into its own
+		/// buffer; ranges are stitched back in document order.
+	{
+	public:
+		SubtreeJob(const DOMWriter& writer, const std::vector<Node*>& nodes, std::size_t begin, std::size_t step):
+			_writer(writer),
+			_nodes(nodes),
+			_begin(begin),
+			_step(step),
+			_results(nodes.size())
+		{
+		}
+
+		void run()
+		{
+			for (std::size_t i = _begin; i < _nodes.size(); i += _step)
+			{
+				std::ostringstream ostr;
+				DOMWriter writer;
+				writer.setOptions(_writer.getOptions());
+				writer.setNewLine(_writer.getNewLine());
+				writer.setIndent(_writer.getIndent());
+				writer.writeNode(ostr, _nodes[i]);
+				_results[i] = ostr.str();
+			}
+		}
+
+		const std::string& result(std::size_t i) const
+		{
+			return _results[i];
+		}
+
+	private:
+		const DOMWriter& _writer;
+		const std::vector<Node*>& _nodes;
+		std::size_t _begin;
+		std::size_t _step;
+		std::vector<std::string> _results;
+	};
+}
+
+
+void DOMWriter::writeNodeParallel(XMLByteOutputStream& ostr, Document* pDocument, int maxThreads)
+{
+	poco_check_ptr (pDocument);
+
+	Element* pRoot = pDocument->documentElement();
+	if (!pRoot)
+	{
+		writeNode(ostr, pDocument);
+		return;
+	}
+
+	// collect and temporarily detach the root's children, so the
+	// document prolog and the root's own tag can be produced by the
+	// ordinary serializer (keeping its exact byte output)
+	std::vector<AutoPtr<Node> > children;
+	for (Node* pChild = pRoot->firstChild(); pChild; pChild = pChild->nextSibling())
+		children.push_back(AutoPtr<Node>(pChild, true));
+	if (children.empty())
+	{
+		writeNode(ostr, pDocument);
+		return;
+	}
+
+	std::string prefix;
+	std::string suffix;
+	try
+	{
+		for (std::vector<AutoPtr<Node> >::iterator it = children.begin(); it != children.end(); ++it)
+			pRoot->removeChild(*it);
+		std::ostringstream shallow;
+		writeNode(shallow, pDocument);
+		std::string text = shallow.str();
+		std::string::size_type selfClose = text.rfind("/>");
+		std::string::size_type closeTag = text.rfind("</");
+		if (selfClose != std::string::npos && (closeTag == std::string::npos || selfClose > closeTag))
+		{
+			prefix = text.substr(0, selfClose) + ">";
+			suffix = "</" + std::string(pRoot->nodeName()) + ">" + text.substr(selfClose + 2);
+		}
+		else if (closeTag != std::string::npos)
+		{
+			prefix = text.substr(0, closeTag);
+			suffix = text.substr(closeTag);
+		}
+		else throw XMLException("cannot locate root element tag for parallel serialization");
+	}
+	catch (...)
+	{
+		for (std::vector<AutoPtr<Node> >::iterator it = children.begin(); it != children.end(); ++it)
+			pRoot->appendChild(*it);
+		throw;
+	}
+	for (std::vector<AutoPtr<Node> >::iterator it = children.begin(); it != children.end(); ++it)
+		pRoot->appendChild(*it);
+
+	if (maxThreads <= 0) maxThreads = static_cast<int>(Poco::Environment::processorCount());
+	if (maxThreads > static_cast<int>(children.size())) maxThreads = static_cast<int>(children.size());
+
+	std::vector<Node*> nodes;
+	nodes.reserve(children.size());
+	for (std::vector<AutoPtr<Node> >::iterator it = children.begin(); it != children.end(); ++it)
+		nodes.push_back(it->get());
+
+	std::vector<Poco::SharedPtr<SubtreeJob> > jobs;
+	if (maxThreads > 1)
+	{
+		Poco::ThreadPool pool(1, maxThreads);
+		for (int i = 0; i < maxThreads; i++)
+			jobs.push_back(new SubtreeJob(*this, nodes, i, maxThreads));
+		for (std::vector<Poco::SharedPtr<SubtreeJob> >::iterator it = jobs.begin(); it != jobs.end(); ++it)
+			pool.start(**it);
+		pool.joinAll();
+	}
+	else if (!nodes.empty())
+	{
+		jobs.push_back(new SubtreeJob(*this, nodes, 0, 1));
+		jobs.back()->run();
+	}
+
+	ostr.write(prefix.data(), static_cast<std::streamsize>(prefix.size()));
+	for (std::size_t i = 0; i < nodes.size(); i++)
+	{
+		const std::string& fragment = jobs[i % jobs.size()]->result(i);
+		ostr.write(fragment.data(), static_cast<std::streamsize>(fragment.size()));
+	}
+	ostr.write(suffix.data(), static_cast<std::streamsize>(suffix.size()));
+}
+
+
 } } // namespace Poco::XML
 
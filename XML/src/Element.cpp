@@ -25,6 +25,31 @@ namespace Poco {
 namespace XML {
 
 
+namespace
+{
+	Poco::MemoryPool nodePool(sizeof(Element), 32);
+}
+
+
+void* Element::operator new(std::size_t size)
+{
+	if (size == sizeof(Element))
+		return nodePool.get();
+	return ::operator new(size);
+}
+
+
+void Element::operator delete(void* ptr, std::size_t size)
+{
+	if (!ptr) return;
+	if (size == sizeof(Element))
+		nodePool.release(ptr);
+	else
+		::operator delete(ptr);
+}
+
+
+
 Element::Element(Document* pOwnerDocument, const XMLString& namespaceURI, const XMLString& localName, const XMLString& qname):
 	AbstractContainerNode(pOwnerDocument),
 	_name(pOwnerDocument->namePool().insert(qname, namespaceURI, localName)),
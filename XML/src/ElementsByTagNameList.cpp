@@ -39,10 +39,56 @@ ElementsByTagNameList::~ElementsByTagNameList()
 }
 
 
+namespace
+{
+	Node* nextPreorder(Node* pCurrent, const Node* pRoot)
+		/// Returns the next node in preorder within the subtree
+		/// rooted at pRoot, or a null pointer at the end.
+	{
+		if (pCurrent->firstChild()) return pCurrent->firstChild();
+		while (pCurrent && pCurrent != pRoot)
+		{
+			if (pCurrent->nextSibling()) return pCurrent->nextSibling();
+			pCurrent = pCurrent->parentNode();
+		}
+		return 0;
+	}
+}
+
+
 Node* ElementsByTagNameList::item(unsigned long index) const
 {
+	// sequential iteration (item(i) after item(i-1), the common
+	// loop) continues the preorder walk from the last hit instead
+	// of re-scanning the subtree from the root, which would make
+	// the loop quadratic. The cache assumes the subtree is not
+	// modified between sequential calls; any other access pattern
+	// falls back to a full scan.
+	if (_pLast && index == _lastIndex)
+		return _pLast;
+	if (_pLast && index == _lastIndex + 1)
+	{
+		Node* pCur = nextPreorder(_pLast, _pParent);
+		while (pCur)
+		{
+			if (pCur->nodeType() == Node::ELEMENT_NODE && (_name == toXMLString("*") || pCur->nodeName() == _name))
+			{
+				_pLast = pCur;
+				_lastIndex = index;
+				return pCur;
+			}
+			pCur = nextPreorder(pCur, _pParent);
+		}
+		return 0;
+	}
 	_count = 0;
-	return find(_pParent, index);
+	Node* pNode = find(_pParent, index);
+	if (pNode)
+	{
+		_pLast = pNode;
+		_lastIndex = index;
+	}
+	return pNode;
 }
 
 
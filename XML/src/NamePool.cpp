@@ -62,6 +62,7 @@ private:
 NamePool::NamePool(unsigned long size):
 	_size(size),
 	_salt(0),
+	_pOverflow(0),
 	_rc(1)
 {
 	poco_assert (size > 1);
@@ -76,6 +77,7 @@ NamePool::NamePool(unsigned long size):
 
 NamePool::~NamePool()
 {
+	if (_pOverflow) _pOverflow->release();
 	delete [] _pItems;
 }
 
@@ -101,7 +103,14 @@ const Name& NamePool::insert(const XMLString& qname, const XMLString& namespaceU
 	while (!_pItems[n].set(qname, namespaceURI, localName) && i++ < _size)
 		n = (n + 1) % _size;
 		
-	if (i > _size) throw Poco::PoolOverflowException("XML name pool");
+	if (i > _size)
+	{
+		// pool full: spill into an overflow pool instead of
+		// failing; existing Name references stay valid because
+		// this pool's items are never rehashed
+		if (!_pOverflow) _pOverflow = new NamePool(_size*2 + 1);
+		return _pOverflow->insert(qname, namespaceURI, localName);
+	}
 
 	return _pItems[n].get();
 }
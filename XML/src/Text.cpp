@@ -21,6 +21,31 @@ namespace Poco {
 namespace XML {
 
 
+namespace
+{
+	Poco::MemoryPool nodePool(sizeof(Text), 32);
+}
+
+
+void* Text::operator new(std::size_t size)
+{
+	if (size == sizeof(Text))
+		return nodePool.get();
+	return ::operator new(size);
+}
+
+
+void Text::operator delete(void* ptr, std::size_t size)
+{
+	if (!ptr) return;
+	if (size == sizeof(Text))
+		nodePool.release(ptr);
+	else
+		::operator delete(ptr);
+}
+
+
+
 const XMLString Text::NODE_NAME = toXMLString("#text");
 
 
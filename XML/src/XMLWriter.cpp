@@ -316,13 +316,26 @@ void XMLWriter::characters(const XMLChar ch[], int start, int length)
 	_contentWritten = _contentWritten || length > 0;
 	if (_inCDATA)
 	{
-		while (length-- > 0) writeXML(ch[start++]);
+		_pTextConverter->write((const char*) (ch + start), length*int(sizeof(XMLChar)));
 	}
 	else
 	{
-		while (length-- > 0)
+		// emit clean runs in bulk; only characters needing an escape
+		// (or validity checking) break the run
+		int runStart = start;
+		int pos = start;
+		int end = start + length;
+		while (pos < end)
 		{
-			XMLChar c = ch[start++];
+			XMLChar c = ch[pos];
+			bool needsSpecial = (c == '"' || c == '&' || c == '<' || c == '>' || (c >= 0 && c < 32));
+			if (!needsSpecial)
+			{
+				++pos;
+				continue;
+			}
+			if (pos > runStart)
+				_pTextConverter->write((const char*) (ch + runStart), (pos - runStart)*int(sizeof(XMLChar)));
 			switch (c)
 			{
 			case '"':  writeMarkup(MARKUP_QUOTENC); break;
@@ -330,16 +343,16 @@ void XMLWriter::characters(const XMLChar ch[], int start, int length)
 			case '<':  writeMarkup(MARKUP_LTENC); break;
 			case '>':  writeMarkup(MARKUP_GTENC); break;
 			default:
-				if (c >= 0 && c < 32)
-				{
-					if (c == '\t' || c == '\r' || c == '\n')
-						writeXML(c);
-					else
-						throw XMLException("Invalid character token.");
-				}
-				else writeXML(c);
+				if (c == '\t' || c == '\r' || c == '\n')
+					writeXML(c);
+				else
+					throw XMLException("Invalid character token.");
 			}
+			++pos;
+			runStart = pos;
 		}
+		if (end > runStart)
+			_pTextConverter->write((const char*) (ch + runStart), (end - runStart)*int(sizeof(XMLChar)));
 	}
 }
 
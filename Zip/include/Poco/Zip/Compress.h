@@ -103,6 +103,8 @@ private:
 		/// for directories.
 
 	void addFileRaw(std::istream& in, const ZipLocalFileHeader& hdr, const Poco::Path& fileName);
+
+	friend class ParallelCompress;
 		/// copys an already compressed ZipEntry from in
 
 private:
@@ -0,0 +1,87 @@
+//
+// ParallelCompress.h
+//
+// Library: Zip
+// Package: Zip
+// Module:  ParallelCompress
+//
+// Definition of the ParallelCompress class.
+//
+// Copyright (c) 2007, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Zip_ParallelCompress_INCLUDED
+#define Zip_ParallelCompress_INCLUDED
+
+
+#include "Poco/Zip/Compress.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Mutex.h"
+
+
+namespace Poco {
+namespace Zip {
+
+
+class Zip_API ParallelCompress
+	/// Compresses files into a zip archive using multiple threads.
+	///
+	/// Each added file is deflated into an in-memory buffer on a
+	/// thread pool worker; completed entries are appended to the
+	/// archive (in completion order) under a lock through the
+	/// underlying Compress object. On multi-core machines, archive
+	/// creation time approaches the time needed to deflate the
+	/// largest entry instead of the sum over all entries.
+	///
+	/// Entries are always deflated (CM_DEFLATE); use Compress
+	/// directly for stored entries, directories or comments.
+	/// Entry order in the archive is not deterministic.
+{
+public:
+	ParallelCompress(std::ostream& out, bool seekableOut, int maxThreads = 0);
+		/// Creates the ParallelCompress, writing the archive to the
+		/// given stream. If maxThreads is 0, one worker per
+		/// processor core is used.
+
+	~ParallelCompress();
+		/// Destroys the ParallelCompress. close() should have been
+		/// called; otherwise queued work is finished and discarded.
+
+	void addFile(const Poco::Path& file, const Poco::Path& fileName, ZipCommon::CompressionLevel cl = ZipCommon::CL_MAXIMUM);
+		/// Queues the given file for compression into the archive
+		/// under the given entry name.
+
+	ZipArchive close();
+		/// Waits for all queued files to be compressed and written,
+		/// finalizes the archive and returns it.
+		///
+		/// If compression of any file failed, a ZipException with
+		/// the first failure is thrown (after all workers have
+		/// finished).
+
+private:
+	ParallelCompress(const ParallelCompress&);
+	ParallelCompress& operator = (const ParallelCompress&);
+
+	void compressOne(const Poco::Path& file, const Poco::Path& fileName, ZipCommon::CompressionLevel cl);
+
+	class CompressJob;
+	friend class CompressJob;
+
+	Compress _compress;
+	Poco::ThreadPool _pool;
+	Poco::FastMutex _outMutex;
+	Poco::FastMutex _errMutex;
+	std::string _firstError;
+	bool _closed;
+};
+
+
+} } // namespace Poco::Zip
+
+
+#endif // Zip_ParallelCompress_INCLUDED
@@ -0,0 +1,79 @@
+//
+// ParallelDecompress.h
+//
+// Library: Zip
+// Package: Zip
+// Module:  ParallelDecompress
+//
+// Definition of the ParallelDecompress class.
+//
+// Copyright (c) 2007, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Zip_ParallelDecompress_INCLUDED
+#define Zip_ParallelDecompress_INCLUDED
+
+
+#include "Poco/Zip/ZipArchive.h"
+#include "Poco/Path.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Mutex.h"
+
+
+namespace Poco {
+namespace Zip {
+
+
+class Zip_API ParallelDecompress
+	/// Extracts a zip archive using multiple threads.
+	///
+	/// The central directory is parsed first (via ZipArchive); the
+	/// directory tree is created up front, and entry inflation then
+	/// fans out over a thread pool, with every worker reading from
+	/// its own file handle positioned by the entry's local header
+	/// offset. Extraction time approaches the inflate time of the
+	/// largest entry instead of the sum over all entries.
+	///
+	/// Unlike Decompress, this requires the archive to be a seekable
+	/// file; use Decompress for non-seekable streams.
+{
+public:
+	ParallelDecompress(const std::string& zipPath, const Poco::Path& outputDir, int maxThreads = 0);
+		/// Creates the ParallelDecompress for the given archive
+		/// file and output directory. If maxThreads is 0, one
+		/// worker per processor core is used.
+
+	~ParallelDecompress();
+		/// Destroys the ParallelDecompress.
+
+	std::size_t decompressAll();
+		/// Extracts all entries and returns the number of files
+		/// written. If extraction of any entry failed, a
+		/// ZipException with the first failure is thrown after all
+		/// workers have finished.
+
+private:
+	ParallelDecompress(const ParallelDecompress&);
+	ParallelDecompress& operator = (const ParallelDecompress&);
+
+	void extractOne(const ZipLocalFileHeader& header);
+
+	class ExtractJob;
+	friend class ExtractJob;
+
+	std::string _zipPath;
+	Poco::Path _outputDir;
+	Poco::ThreadPool _pool;
+	Poco::FastMutex _errMutex;
+	std::string _firstError;
+};
+
+
+} } // namespace Poco::Zip
+
+
+#endif // Zip_ParallelDecompress_INCLUDED
@@ -0,0 +1,180 @@
+//
+// ParallelCompress.cpp
+//
+// Library: Zip
+// Package: Zip
+// Module:  ParallelCompress
+//
+// Copyright (c) 2007, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Zip/ParallelCompress.h"
+#include "Poco/Zip/ZipLocalFileHeader.h"
+#include "Poco/Zip/ZipException.h"
+#include "Poco/DeflatingStream.h"
+#include "Poco/Checksum.h"
+#include "Poco/FileStream.h"
+#include "Poco/MemoryStream.h"
+#include "Poco/File.h"
+#include "Poco/DateTime.h"
+#include "Poco/Environment.h"
+#include "Poco/Buffer.h"
+#include "Poco/zlib.h"
+#include "Poco/Runnable.h"
+#include <sstream>
+
+
+namespace Poco {
+namespace Zip {
+
+
+class ParallelCompress::CompressJob: public Poco::Runnable
+{
+public:
+	CompressJob(ParallelCompress& owner, const Poco::Path& file, const Poco::Path& fileName, ZipCommon::CompressionLevel cl):
+		_owner(owner),
+		_file(file),
+		_fileName(fileName),
+		_cl(cl)
+	{
+	}
+
+	void run()
+	{
+		try
+		{
+			_owner.compressOne(_file, _fileName, _cl);
+		}
+		catch (Poco::Exception& exc)
+		{
+			Poco::FastMutex::ScopedLock lock(_owner._errMutex);
+			if (_owner._firstError.empty())
+				_owner._firstError = _file.toString() + ": " + exc.displayText();
+		}
+		catch (std::exception& exc)
+		{
+			Poco::FastMutex::ScopedLock lock(_owner._errMutex);
+			if (_owner._firstError.empty())
+				_owner._firstError = _file.toString() + ": " + std::string(exc.what());
+		}
+		delete this;
+	}
+
+private:
+	ParallelCompress& _owner;
+	Poco::Path _file;
+	Poco::Path _fileName;
+	ZipCommon::CompressionLevel _cl;
+};
+
+
+ParallelCompress::ParallelCompress(std::ostream& out, bool seekableOut, int maxThreads):
+	_compress(out, seekableOut),
+	_pool(2, maxThreads > 0 ? maxThreads : static_cast<int>(Poco::Environment::processorCount())),
+	_closed(false)
+{
+}
+
+
+ParallelCompress::~ParallelCompress()
+{
+	try
+	{
+		_pool.joinAll();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void ParallelCompress::addFile(const Poco::Path& file, const Poco::Path& fileName, ZipCommon::CompressionLevel cl)
+{
+	poco_assert (!_closed);
+
+	CompressJob* pJob = new CompressJob(*this, file, fileName, cl);
+	try
+	{
+		_pool.start(*pJob);
+	}
+	catch (Poco::NoThreadAvailableException&)
+	{
+		// all workers busy: compress on the calling thread,
+		// applying back-pressure to the producer
+		pJob->run();
+	}
+}
+
+
+void ParallelCompress::compressOne(const Poco::Path& file, const Poco::Path& fileName, ZipCommon::CompressionLevel cl)
+{
+	Poco::File aFile(file);
+	Poco::DateTime lastModified(aFile.getLastModified());
+
+	int level = Z_DEFAULT_COMPRESSION;
+	if (cl == ZipCommon::CL_FAST || cl == ZipCommon::CL_SUPERFAST)
+		level = Z_BEST_SPEED;
+	else if (cl == ZipCommon::CL_MAXIMUM)
+		level = Z_BEST_COMPRESSION;
+
+	// deflate the file into memory, computing the CRC of the
+	// uncompressed data on the way
+	std::ostringstream compressed;
+	Poco::DeflatingOutputStream deflater(compressed, DeflatingStreamBuf::STREAM_ZLIB, level);
+	Poco::Checksum crc(Poco::Checksum::TYPE_CRC32);
+	Poco::FileInputStream istr(file.toString());
+	Poco::UInt64 uncompressedSize = 0;
+	Poco::Buffer<char> buffer(65536);
+	while (istr.good())
+	{
+		istr.read(buffer.begin(), static_cast<std::streamsize>(buffer.size()));
+		std::streamsize n = istr.gcount();
+		if (n <= 0) break;
+		crc.update(buffer.begin(), static_cast<unsigned>(n));
+		uncompressedSize += static_cast<Poco::UInt64>(n);
+		deflater.write(buffer.begin(), n);
+	}
+	deflater.close();
+
+	// strip the 2-byte zlib header and the 4-byte adler32 trailer
+	// to obtain the raw deflate stream the zip format requires
+	std::string zlibData = compressed.str();
+	if (zlibData.size() < 6) zlibData.clear();
+	else zlibData = zlibData.substr(2, zlibData.size() - 6);
+
+	ZipLocalFileHeader hdr(fileName, lastModified, ZipCommon::CM_DEFLATE, cl);
+	hdr.setStartPos(0);
+	hdr.setCRC(static_cast<Poco::UInt32>(crc.checksum()));
+	hdr.setUncompressedSize(uncompressedSize);
+	hdr.setCompressedSize(zlibData.size());
+
+	// addFileRaw() seeks past the local header to the payload, so
+	// present the entry as header bytes followed by the payload
+	std::string blob = hdr.createHeader();
+	blob += zlibData;
+	Poco::MemoryInputStream blobStream(blob.data(), blob.size());
+
+	Poco::FastMutex::ScopedLock lock(_outMutex);
+	_compress.addFileRaw(blobStream, hdr, fileName);
+}
+
+
+ZipArchive ParallelCompress::close()
+{
+	_closed = true;
+	_pool.joinAll();
+	{
+		Poco::FastMutex::ScopedLock lock(_errMutex);
+		if (!_firstError.empty())
+			throw ZipException("Parallel compression failed", _firstError);
+	}
+	return _compress.close();
+}
+
+
+} } // namespace Poco::Zip
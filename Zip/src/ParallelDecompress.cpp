@@ -0,0 +1,157 @@
+//
+// ParallelDecompress.cpp
+//
+// Library: Zip
+// Package: Zip
+// Module:  ParallelDecompress
+//
+// Copyright (c) 2007, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Zip/ParallelDecompress.h"
+#include "Poco/Zip/ZipStream.h"
+#include "Poco/Zip/ZipException.h"
+#include "Poco/Zip/ZipCommon.h"
+#include "Poco/FileStream.h"
+#include "Poco/File.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/Environment.h"
+#include "Poco/Runnable.h"
+
+
+namespace Poco {
+namespace Zip {
+
+
+class ParallelDecompress::ExtractJob: public Poco::Runnable
+{
+public:
+	ExtractJob(ParallelDecompress& owner, const ZipLocalFileHeader& header):
+		_owner(owner),
+		_header(header)
+	{
+	}
+
+	void run()
+	{
+		try
+		{
+			_owner.extractOne(_header);
+		}
+		catch (Poco::Exception& exc)
+		{
+			Poco::FastMutex::ScopedLock lock(_owner._errMutex);
+			if (_owner._firstError.empty())
+				_owner._firstError = _header.getFileName() + ": " + exc.displayText();
+		}
+		catch (std::exception& exc)
+		{
+			Poco::FastMutex::ScopedLock lock(_owner._errMutex);
+			if (_owner._firstError.empty())
+				_owner._firstError = _header.getFileName() + ": " + std::string(exc.what());
+		}
+		delete this;
+	}
+
+private:
+	ParallelDecompress& _owner;
+	ZipLocalFileHeader _header;
+};
+
+
+ParallelDecompress::ParallelDecompress(const std::string& zipPath, const Poco::Path& outputDir, int maxThreads):
+	_zipPath(zipPath),
+	_outputDir(outputDir),
+	_pool(2, maxThreads > 0 ? maxThreads : static_cast<int>(Poco::Environment::processorCount()))
+{
+	poco_assert (_outputDir.isDirectory());
+}
+
+
+ParallelDecompress::~ParallelDecompress()
+{
+	try
+	{
+		_pool.joinAll();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void ParallelDecompress::extractOne(const ZipLocalFileHeader& header)
+{
+	if (!ZipCommon::isValidPath(header.getFileName()))
+		throw ZipException("Illegal entry path (possible directory traversal)", header.getFileName());
+	Poco::Path entryPath(header.getFileName());
+	entryPath.makeFile();
+	Poco::Path target(_outputDir, entryPath);
+
+	// each worker positions its own file handle, so inflation of
+	// different entries proceeds concurrently
+	Poco::FileInputStream istr(_zipPath);
+	ZipInputStream zipIn(istr, header, true);
+	Poco::FileOutputStream ostr(target.toString());
+	Poco::StreamCopier::copyStream(zipIn, ostr);
+	if (!zipIn.crcValid())
+		throw ZipException("CRC failure", header.getFileName());
+}
+
+
+std::size_t ParallelDecompress::decompressAll()
+{
+	Poco::FileInputStream istr(_zipPath);
+	ZipArchive archive(istr);
+
+	// create the directory tree up front, then fan the files out
+	for (ZipArchive::FileHeaders::const_iterator it = archive.headerBegin(); it != archive.headerEnd(); ++it)
+	{
+		if (!ZipCommon::isValidPath(it->second.getFileName()))
+			throw ZipException("Illegal entry path (possible directory traversal)", it->second.getFileName());
+		Poco::Path entryPath(it->second.getFileName());
+		if (it->second.isDirectory())
+		{
+			entryPath.makeDirectory();
+			Poco::File(Poco::Path(_outputDir, entryPath)).createDirectories();
+		}
+		else
+		{
+			entryPath.makeFile();
+			Poco::Path parent(Poco::Path(_outputDir, entryPath).parent());
+			Poco::File(parent).createDirectories();
+		}
+	}
+
+	std::size_t count = 0;
+	for (ZipArchive::FileHeaders::const_iterator it = archive.headerBegin(); it != archive.headerEnd(); ++it)
+	{
+		if (it->second.isDirectory()) continue;
+		++count;
+		ExtractJob* pJob = new ExtractJob(*this, it->second);
+		try
+		{
+			_pool.start(*pJob);
+		}
+		catch (Poco::NoThreadAvailableException&)
+		{
+			// all workers busy: extract on the calling thread
+			pJob->run();
+		}
+	}
+	_pool.joinAll();
+	{
+		Poco::FastMutex::ScopedLock lock(_errMutex);
+		if (!_firstError.empty())
+			throw ZipException("Parallel extraction failed", _firstError);
+	}
+	return count;
+}
+
+
+} } // namespace Poco::Zip
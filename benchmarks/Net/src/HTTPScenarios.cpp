@@ -0,0 +1,335 @@
+//
+// HTTPScenarios.cpp
+//
+// HTTP load scenarios: keep-alive, churn, pipelining, slow-loris.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Scenarios.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/Timestamp.h"
+#include "Poco/NullStream.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/SharedPtr.h"
+#include <vector>
+#include <atomic>
+
+
+using namespace Poco::Net;
+
+
+namespace
+{
+	class EchoBodyHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			response.setChunkedTransferEncoding(false);
+			response.setContentType("text/plain");
+			response.sendBuffer("pong", 4);
+		}
+	};
+
+	class BenchHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest&)
+		{
+			return new EchoBodyHandler;
+		}
+	};
+
+	class BenchServer
+		/// Brings up an HTTPServer on an ephemeral port for the
+		/// duration of a scenario.
+	{
+	public:
+		BenchServer():
+			_socket(SocketAddress("127.0.0.1", 0)),
+			_server(new BenchHandlerFactory, _socket, new HTTPServerParams)
+		{
+			_server.start();
+		}
+
+		~BenchServer()
+		{
+			_server.stopAll(true);
+		}
+
+		SocketAddress address() const
+		{
+			return _socket.address();
+		}
+
+	private:
+		ServerSocket _socket;
+		HTTPServer _server;
+	};
+
+	class HTTPWorker: public Poco::Runnable
+		/// Issues GETs until told to stop; one mode reuses the
+		/// session (keep-alive), the other reconnects per request
+		/// (churn).
+	{
+	public:
+		HTTPWorker(const SocketAddress& address, LoadResult& result, std::atomic<bool>& stop, bool keepAlive):
+			_address(address),
+			_result(result),
+			_stop(stop),
+			_keepAlive(keepAlive)
+		{
+		}
+
+		void run()
+		{
+			try
+			{
+				Poco::SharedPtr<HTTPClientSession> pSession;
+				while (!_stop)
+				{
+					Poco::Stopwatch sw;
+					sw.start();
+					try
+					{
+						if (!pSession)
+						{
+							pSession = new HTTPClientSession(_address);
+							pSession->setKeepAlive(_keepAlive);
+							// a load generator should notice starvation, not
+							// sit out the default 60 second timeout
+							pSession->setTimeout(Poco::Timespan(5, 0));
+						}
+						HTTPRequest request(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+						if (!_keepAlive) request.setKeepAlive(false);
+						pSession->sendRequest(request);
+						HTTPResponse response;
+						std::istream& rs = pSession->receiveResponse(response);
+						Poco::NullOutputStream null;
+						Poco::StreamCopier::copyStream(rs, null);
+						sw.stop();
+						_result.latency.record(sw.elapsed());
+						++_result.requests;
+					}
+					catch (Poco::Exception&)
+					{
+						++_result.errors;
+						pSession = 0;
+					}
+					if (!_keepAlive) pSession = 0;
+				}
+			}
+			catch (...)
+			{
+			}
+		}
+
+	private:
+		SocketAddress _address;
+		LoadResult& _result;
+		std::atomic<bool>& _stop;
+		bool _keepAlive;
+	};
+
+	void runHTTPWorkers(const ScenarioParams& params, LoadResult& result, bool keepAlive)
+	{
+		BenchServer server;
+		std::atomic<bool> stop(false);
+		std::vector<Poco::SharedPtr<HTTPWorker> > workers;
+		std::vector<Poco::SharedPtr<Poco::Thread> > threads;
+		Poco::Stopwatch total;
+		total.start();
+		for (int i = 0; i < params.connections; i++)
+		{
+			workers.push_back(new HTTPWorker(server.address(), result, stop, keepAlive));
+			threads.push_back(new Poco::Thread);
+			threads.back()->start(*workers.back());
+		}
+		Poco::Thread::sleep(params.seconds*1000);
+		stop = true;
+		for (std::size_t i = 0; i < threads.size(); i++)
+			threads[i]->join();
+		total.stop();
+		result.connections = params.connections;
+		result.seconds = total.elapsed()/1000000.0;
+	}
+}
+
+
+void httpKeepAlive(const ScenarioParams& params, LoadResult& result)
+{
+	result.scenario = "http-keepalive";
+	runHTTPWorkers(params, result, true);
+}
+
+
+void httpChurn(const ScenarioParams& params, LoadResult& result)
+{
+	result.scenario = "http-churn";
+	runHTTPWorkers(params, result, false);
+}
+
+
+void httpPipelined(const ScenarioParams& params, LoadResult& result)
+{
+	result.scenario = "http-pipelined";
+	BenchServer server;
+	std::atomic<bool> stop(false);
+	int depth = params.extra > 0 ? params.extra : 8;
+
+	class PipelineWorker: public Poco::Runnable
+	{
+	public:
+		PipelineWorker(const SocketAddress& address, LoadResult& result, std::atomic<bool>& stop, int depth):
+			_address(address),
+			_result(result),
+			_stop(stop),
+			_depth(depth)
+		{
+		}
+
+		void run()
+		{
+			while (!_stop)
+			{
+				try
+				{
+					HTTPClientSession session(_address);
+					session.setKeepAlive(true);
+					session.setTimeout(Poco::Timespan(5, 0));
+					while (!_stop)
+					{
+						// latency is for the whole batch of _depth requests
+						Poco::Stopwatch sw;
+						sw.start();
+						for (int i = 0; i < _depth; i++)
+						{
+							HTTPRequest request(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+							session.pipelineRequest(request);
+						}
+						for (int i = 0; i < _depth; i++)
+						{
+							HTTPResponse response;
+							std::istream& rs = session.receivePipelinedResponse(response);
+							Poco::NullOutputStream null;
+							Poco::StreamCopier::copyStream(rs, null);
+							++_result.requests;
+						}
+						sw.stop();
+						_result.latency.record(sw.elapsed());
+					}
+				}
+				catch (Poco::Exception&)
+				{
+					++_result.errors;
+				}
+			}
+		}
+
+	private:
+		SocketAddress _address;
+		LoadResult& _result;
+		std::atomic<bool>& _stop;
+		int _depth;
+	};
+
+	std::vector<Poco::SharedPtr<PipelineWorker> > workers;
+	std::vector<Poco::SharedPtr<Poco::Thread> > threads;
+	Poco::Stopwatch total;
+	total.start();
+	for (int i = 0; i < params.connections; i++)
+	{
+		workers.push_back(new PipelineWorker(server.address(), result, stop, depth));
+		threads.push_back(new Poco::Thread);
+		threads.back()->start(*workers.back());
+	}
+	Poco::Thread::sleep(params.seconds*1000);
+	stop = true;
+	for (std::size_t i = 0; i < threads.size(); i++)
+		threads[i]->join();
+	total.stop();
+	result.connections = params.connections;
+	result.seconds = total.elapsed()/1000000.0;
+}
+
+
+void httpSlowLoris(const ScenarioParams& params, LoadResult& result)
+{
+	result.scenario = "http-slowloris";
+	BenchServer server;
+
+	// the attackers: connections that send an unfinished request
+	// and trickle one header byte at a time
+	int idleCount = params.extra > 0 ? params.extra : 64;
+	std::vector<Poco::SharedPtr<StreamSocket> > loris;
+	for (int i = 0; i < idleCount; i++)
+	{
+		try
+		{
+			Poco::SharedPtr<StreamSocket> pSocket = new StreamSocket(server.address());
+			std::string partial("GET / HTTP/1.1\r\nHost: bench\r\nX-Slow:");
+			pSocket->sendBytes(partial.data(), (int) partial.size());
+			loris.push_back(pSocket);
+		}
+		catch (Poco::Exception&)
+		{
+			break;
+		}
+	}
+
+	// the victims: ordinary keep-alive traffic measured while the
+	// held-open connections occupy server threads
+	std::atomic<bool> stop(false);
+	std::vector<Poco::SharedPtr<HTTPWorker> > workers;
+	std::vector<Poco::SharedPtr<Poco::Thread> > threads;
+	Poco::Stopwatch total;
+	total.start();
+	for (int i = 0; i < params.connections; i++)
+	{
+		workers.push_back(new HTTPWorker(server.address(), result, stop, true));
+		threads.push_back(new Poco::Thread);
+		threads.back()->start(*workers.back());
+	}
+	Poco::Timestamp start;
+	int trickled = 0;
+	while (start.elapsed() < Poco::Timespan(params.seconds, 0).totalMicroseconds())
+	{
+		Poco::Thread::sleep(500);
+		// keep the slow connections alive with another byte each
+		for (std::size_t i = 0; i < loris.size(); i++)
+		{
+			try
+			{
+				loris[i]->sendBytes("x", 1);
+				++trickled;
+			}
+			catch (Poco::Exception&)
+			{
+			}
+		}
+	}
+	stop = true;
+	for (std::size_t i = 0; i < threads.size(); i++)
+		threads[i]->join();
+	total.stop();
+	result.connections = params.connections;
+	result.seconds = total.elapsed()/1000000.0;
+}
@@ -0,0 +1,33 @@
+//
+// LoadResult.cpp
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "LoadResult.h"
+#include "Poco/NumberFormatter.h"
+#include <iostream>
+
+
+void LoadResult::printJSON() const
+{
+	std::string json("{");
+	json += "\"scenario\":\"" + scenario + "\"";
+	json += ",\"connections\":" + Poco::NumberFormatter::format(connections);
+	json += ",\"seconds\":" + Poco::NumberFormatter::format(seconds, 3);
+	json += ",\"requests\":" + Poco::NumberFormatter::format(requests.value());
+	json += ",\"errors\":" + Poco::NumberFormatter::format(errors.value());
+	double rps = seconds > 0 ? requests.value()/seconds : 0;
+	json += ",\"requestsPerSecond\":" + Poco::NumberFormatter::format(rps, 1);
+	json += ",\"latencyMicros\":{";
+	json += "\"p50\":" + Poco::NumberFormatter::format(latency.quantile(0.5));
+	json += ",\"p90\":" + Poco::NumberFormatter::format(latency.quantile(0.9));
+	json += ",\"p99\":" + Poco::NumberFormatter::format(latency.quantile(0.99));
+	json += ",\"max\":" + Poco::NumberFormatter::format(latency.max());
+	json += "}}";
+	std::cout << json << std::endl;
+}
@@ -0,0 +1,47 @@
+//
+// LoadResult.h
+//
+// Shared result type of the Net benchmark scenarios.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef LoadResult_INCLUDED
+#define LoadResult_INCLUDED
+
+
+#include "Poco/Histogram.h"
+#include "Poco/AtomicCounter.h"
+#include <string>
+
+
+struct LoadResult
+	/// What every scenario produces: request/error counts and a
+	/// latency histogram (microseconds per operation), plus enough
+	/// metadata to render the JSON result line.
+{
+	LoadResult():
+		connections(0),
+		requests(0),
+		errors(0),
+		seconds(0)
+	{
+	}
+
+	std::string scenario;
+	int connections;
+	Poco::AtomicCounter requests;
+	Poco::AtomicCounter errors;
+	double seconds;
+	Poco::Histogram latency; // microseconds
+
+	void printJSON() const;
+		/// Prints the result as a single JSON line on stdout.
+};
+
+
+#endif // LoadResult_INCLUDED
@@ -0,0 +1,89 @@
+//
+// NetBenchmarkDriver.cpp
+//
+// Entry point of the Net benchmark and load-generation suite:
+//
+//     Net-benchmark <scenario> [connections] [seconds] [extra]
+//
+// where <scenario> is one of http-keepalive, http-churn,
+// http-pipelined, http-slowloris, tcp-echo, udp-echo, ws-echo, or
+// "all". Results print as one JSON line per scenario.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Scenarios.h"
+#include "Poco/NumberParser.h"
+#include <iostream>
+#include <map>
+#include <string>
+
+
+namespace
+{
+	typedef void (*Scenario)(const ScenarioParams&, LoadResult&);
+
+	std::map<std::string, Scenario> scenarios()
+	{
+		std::map<std::string, Scenario> map;
+		map["http-keepalive"] = httpKeepAlive;
+		map["http-churn"]     = httpChurn;
+		map["http-pipelined"] = httpPipelined;
+		map["http-slowloris"] = httpSlowLoris;
+		map["tcp-echo"]       = tcpEcho;
+		map["udp-echo"]       = udpEcho;
+		map["ws-echo"]        = wsEcho;
+		return map;
+	}
+
+	void usage()
+	{
+		std::cerr << "usage: Net-benchmark <scenario> [connections] [seconds] [extra]" << std::endl;
+		std::cerr << "scenarios: all";
+		std::map<std::string, Scenario> map = scenarios();
+		for (std::map<std::string, Scenario>::const_iterator it = map.begin(); it != map.end(); ++it)
+			std::cerr << " " << it->first;
+		std::cerr << std::endl;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		usage();
+		return 1;
+	}
+	ScenarioParams params;
+	if (argc > 2) params.connections = Poco::NumberParser::parse(argv[2]);
+	if (argc > 3) params.seconds = Poco::NumberParser::parse(argv[3]);
+	if (argc > 4) params.extra = Poco::NumberParser::parse(argv[4]);
+
+	std::map<std::string, Scenario> map = scenarios();
+	std::string name(argv[1]);
+	if (name == "all")
+	{
+		for (std::map<std::string, Scenario>::const_iterator it = map.begin(); it != map.end(); ++it)
+		{
+			LoadResult result;
+			it->second(params, result);
+			result.printJSON();
+		}
+		return 0;
+	}
+	std::map<std::string, Scenario>::const_iterator it = map.find(name);
+	if (it == map.end())
+	{
+		usage();
+		return 1;
+	}
+	LoadResult result;
+	it->second(params, result);
+	result.printJSON();
+	return 0;
+}
@@ -0,0 +1,64 @@
+//
+// Scenarios.h
+//
+// The scripted load scenarios of the Net benchmark suite. Each
+// scenario brings up its own in-process server, drives it with
+// client worker threads, and fills in a LoadResult.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Scenarios_INCLUDED
+#define Scenarios_INCLUDED
+
+
+#include "LoadResult.h"
+
+
+struct ScenarioParams
+{
+	ScenarioParams():
+		connections(8),
+		seconds(5),
+		extra(64)
+	{
+	}
+
+	int connections; /// concurrent client connections/workers
+	int seconds;     /// measurement duration
+	int extra;       /// scenario-specific: idle sockets (slow-loris), pipeline depth, fanout size
+};
+
+
+void httpKeepAlive(const ScenarioParams& params, LoadResult& result);
+	/// Keep-alive GETs: each worker reuses one connection.
+
+void httpChurn(const ScenarioParams& params, LoadResult& result);
+	/// Connection churn: a fresh connection per request, measuring
+	/// accept/teardown cost.
+
+void httpPipelined(const ScenarioParams& params, LoadResult& result);
+	/// Pipelined GETs: params.extra requests in flight per
+	/// connection; latency is per whole batch.
+
+void httpSlowLoris(const ScenarioParams& params, LoadResult& result);
+	/// Opens params.extra connections that trickle an unfinished
+	/// request, then measures well-behaved keep-alive traffic
+	/// alongside them: shows how the server degrades under
+	/// held-open connections.
+
+void tcpEcho(const ScenarioParams& params, LoadResult& result);
+	/// TCPServer echo round trips over persistent connections.
+
+void udpEcho(const ScenarioParams& params, LoadResult& result);
+	/// UDP echo round trips against a DatagramSocket server.
+
+void wsEcho(const ScenarioParams& params, LoadResult& result);
+	/// WebSocket echo round trips over upgraded connections.
+
+
+#endif // Scenarios_INCLUDED
@@ -0,0 +1,311 @@
+//
+// SocketScenarios.cpp
+//
+// TCP, UDP and WebSocket echo round-trip scenarios.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Scenarios.h"
+#include "Poco/Net/TCPServer.h"
+#include "Poco/Net/TCPServerConnection.h"
+#include "Poco/Net/TCPServerConnectionFactory.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/DatagramSocket.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/WebSocket.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/SharedPtr.h"
+#include <vector>
+#include <atomic>
+
+
+using namespace Poco::Net;
+
+
+namespace
+{
+	class EchoConnection: public TCPServerConnection
+	{
+	public:
+		EchoConnection(const StreamSocket& socket):
+			TCPServerConnection(socket)
+		{
+		}
+
+		void run()
+		{
+			char buffer[256];
+			try
+			{
+				int n = socket().receiveBytes(buffer, sizeof(buffer));
+				while (n > 0)
+				{
+					socket().sendBytes(buffer, n);
+					n = socket().receiveBytes(buffer, sizeof(buffer));
+				}
+			}
+			catch (Poco::Exception&)
+			{
+			}
+		}
+	};
+
+	template <class Fn>
+	void runWorkers(int connections, int seconds, LoadResult& result, Fn fn)
+		/// Starts one thread per connection running fn(stop) and
+		/// fills in timing metadata.
+	{
+		class FnRunner: public Poco::Runnable
+		{
+		public:
+			FnRunner(Fn fn, std::atomic<bool>& stop):
+				_fn(fn),
+				_stop(stop)
+			{
+			}
+
+			void run()
+			{
+				_fn(_stop);
+			}
+
+		private:
+			Fn _fn;
+			std::atomic<bool>& _stop;
+		};
+
+		std::atomic<bool> stop(false);
+		std::vector<Poco::SharedPtr<FnRunner> > runners;
+		std::vector<Poco::SharedPtr<Poco::Thread> > threads;
+		Poco::Stopwatch total;
+		total.start();
+		for (int i = 0; i < connections; i++)
+		{
+			runners.push_back(new FnRunner(fn, stop));
+			threads.push_back(new Poco::Thread);
+			threads.back()->start(*runners.back());
+		}
+		Poco::Thread::sleep(seconds*1000);
+		stop = true;
+		for (std::size_t i = 0; i < threads.size(); i++)
+			threads[i]->join();
+		total.stop();
+		result.connections = connections;
+		result.seconds = total.elapsed()/1000000.0;
+	}
+}
+
+
+void tcpEcho(const ScenarioParams& params, LoadResult& result)
+{
+	result.scenario = "tcp-echo";
+	ServerSocket socket(SocketAddress("127.0.0.1", 0));
+	TCPServer server(new TCPServerConnectionFactoryImpl<EchoConnection>, socket);
+	server.start();
+	SocketAddress address = socket.address();
+
+	runWorkers(params.connections, params.seconds, result, [&result, address](std::atomic<bool>& stop)
+	{
+		try
+		{
+			StreamSocket socket(address);
+			socket.setNoDelay(true);
+			char buffer[64];
+			while (!stop)
+			{
+				Poco::Stopwatch sw;
+				sw.start();
+				socket.sendBytes("ping", 4);
+				int n = socket.receiveBytes(buffer, sizeof(buffer));
+				sw.stop();
+				if (n != 4)
+				{
+					++result.errors;
+					break;
+				}
+				result.latency.record(sw.elapsed());
+				++result.requests;
+			}
+		}
+		catch (Poco::Exception&)
+		{
+			++result.errors;
+		}
+	});
+	server.stop();
+}
+
+
+void udpEcho(const ScenarioParams& params, LoadResult& result)
+{
+	result.scenario = "udp-echo";
+	DatagramSocket serverSocket(SocketAddress("127.0.0.1", 0));
+	std::atomic<bool> serverStop(false);
+	Poco::Thread serverThread;
+
+	class UDPEchoServer: public Poco::Runnable
+	{
+	public:
+		UDPEchoServer(DatagramSocket& socket, std::atomic<bool>& stop):
+			_socket(socket),
+			_stop(stop)
+		{
+		}
+
+		void run()
+		{
+			char buffer[256];
+			SocketAddress sender;
+			while (!_stop)
+			{
+				if (_socket.poll(Poco::Timespan(0, 100000), Socket::SELECT_READ))
+				{
+					int n = _socket.receiveFrom(buffer, sizeof(buffer), sender);
+					if (n > 0) _socket.sendTo(buffer, n, sender);
+				}
+			}
+		}
+
+	private:
+		DatagramSocket& _socket;
+		std::atomic<bool>& _stop;
+	};
+
+	UDPEchoServer echoServer(serverSocket, serverStop);
+	serverThread.start(echoServer);
+	SocketAddress address = serverSocket.address();
+
+	runWorkers(params.connections, params.seconds, result, [&result, address](std::atomic<bool>& stop)
+	{
+		try
+		{
+			DatagramSocket socket(SocketAddress::IPv4);
+			socket.connect(address);
+			char buffer[64];
+			while (!stop)
+			{
+				Poco::Stopwatch sw;
+				sw.start();
+				socket.sendBytes("ping", 4);
+				if (!socket.poll(Poco::Timespan(1, 0), Socket::SELECT_READ))
+				{
+					++result.errors;
+					continue;
+				}
+				int n = socket.receiveBytes(buffer, sizeof(buffer));
+				sw.stop();
+				if (n != 4)
+				{
+					++result.errors;
+					continue;
+				}
+				result.latency.record(sw.elapsed());
+				++result.requests;
+			}
+		}
+		catch (Poco::Exception&)
+		{
+			++result.errors;
+		}
+	});
+	serverStop = true;
+	serverThread.join();
+}
+
+
+namespace
+{
+	class WSEchoHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			try
+			{
+				WebSocket ws(request, response);
+				Poco::Buffer<char> buffer(4096);
+				int flags = 0;
+				int n;
+				do
+				{
+					n = ws.receiveFrame(buffer.begin(), (int) buffer.size(), flags);
+					if (n > 0 && (flags & WebSocket::FRAME_OP_BITMASK) != WebSocket::FRAME_OP_CLOSE)
+						ws.sendFrame(buffer.begin(), n, flags);
+				}
+				while (n > 0 && (flags & WebSocket::FRAME_OP_BITMASK) != WebSocket::FRAME_OP_CLOSE);
+			}
+			catch (Poco::Exception&)
+			{
+			}
+		}
+	};
+
+	class WSHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest&)
+		{
+			return new WSEchoHandler;
+		}
+	};
+}
+
+
+void wsEcho(const ScenarioParams& params, LoadResult& result)
+{
+	result.scenario = "ws-echo";
+	ServerSocket socket(SocketAddress("127.0.0.1", 0));
+	HTTPServer server(new WSHandlerFactory, socket, new HTTPServerParams);
+	server.start();
+	SocketAddress address = socket.address();
+
+	runWorkers(params.connections, params.seconds, result, [&result, address](std::atomic<bool>& stop)
+	{
+		try
+		{
+			HTTPClientSession session(address);
+			HTTPRequest request(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+			HTTPResponse response;
+			WebSocket ws(session, request, response);
+			char buffer[256];
+			while (!stop)
+			{
+				Poco::Stopwatch sw;
+				sw.start();
+				ws.sendFrame("ping", 4, WebSocket::FRAME_TEXT);
+				int flags = 0;
+				int n = ws.receiveFrame(buffer, sizeof(buffer), flags);
+				sw.stop();
+				if (n != 4)
+				{
+					++result.errors;
+					break;
+				}
+				result.latency.record(sw.elapsed());
+				++result.requests;
+			}
+			ws.shutdown();
+		}
+		catch (Poco::Exception&)
+		{
+			++result.errors;
+		}
+	});
+	server.stopAll(true);
+}
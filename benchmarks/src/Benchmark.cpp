@@ -0,0 +1,95 @@
+//
+// Benchmark.cpp
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmark.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/NumberFormatter.h"
+#include <algorithm>
+#include <iostream>
+
+
+namespace
+{
+	const Poco::Int64 MIN_BATCH_TIME_US = 20000; // time a batch long enough to swamp timer overhead
+	const int REPETITIONS = 5;
+}
+
+
+Benchmark::Benchmark(const std::string& name, Function function)
+{
+	Entry entry;
+	entry.name = name;
+	entry.function = function;
+	registry().push_back(entry);
+}
+
+
+int Benchmark::runAll(const std::string& filter)
+{
+	int count = 0;
+	for (std::vector<Entry>::const_iterator it = registry().begin(); it != registry().end(); ++it)
+	{
+		if (filter.empty() || it->name.find(filter) != std::string::npos)
+		{
+			runOne(*it);
+			++count;
+		}
+	}
+	return count;
+}
+
+
+void Benchmark::runOne(const Entry& entry)
+{
+	// calibrate: grow the batch until it runs long enough to time reliably
+	Poco::Int64 iterations = 1;
+	Poco::Int64 elapsed = 0;
+	for (;;)
+	{
+		elapsed = timeBatch(entry.function, iterations);
+		if (elapsed >= MIN_BATCH_TIME_US) break;
+		iterations = elapsed > 0 ? iterations*MIN_BATCH_TIME_US/elapsed + 1 : iterations*10;
+	}
+	// the calibration loop doubles as warmup
+	std::vector<Poco::Int64> samples;
+	for (int i = 0; i < REPETITIONS; i++)
+		samples.push_back(timeBatch(entry.function, iterations));
+	std::sort(samples.begin(), samples.end());
+
+	double bestNs   = 1000.0*samples.front()/iterations;
+	double medianNs = 1000.0*samples[samples.size()/2]/iterations;
+	std::string line(entry.name);
+	while (line.size() < 40) line += ' ';
+	line += Poco::NumberFormatter::format(bestNs, 1);
+	line += " ns/op (median ";
+	line += Poco::NumberFormatter::format(medianNs, 1);
+	line += ", ";
+	line += Poco::NumberFormatter::format(iterations);
+	line += " iterations)";
+	std::cout << line << std::endl;
+}
+
+
+Poco::Int64 Benchmark::timeBatch(Function function, Poco::Int64 iterations)
+{
+	Poco::Stopwatch sw;
+	sw.start();
+	for (Poco::Int64 i = 0; i < iterations; i++)
+		function();
+	sw.stop();
+	return sw.elapsed();
+}
+
+
+std::vector<Benchmark::Entry>& Benchmark::registry()
+{
+	static std::vector<Entry> entries;
+	return entries;
+}
@@ -0,0 +1,72 @@
+//
+// Benchmark.h
+//
+// Definition of the benchmark harness used by the POCO
+// microbenchmark suite.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Benchmark_INCLUDED
+#define Benchmark_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <string>
+#include <vector>
+
+
+class Benchmark
+	/// The microbenchmark harness: runs a registered function in
+	/// timed batches after a warmup phase and reports per-iteration
+	/// cost. Register benchmarks with the BENCHMARK macro:
+	///
+	///     BENCHMARK(numberFormatterInt)
+	///     {
+	///         std::string s;
+	///         Poco::NumberFormatter::append(s, 12345678);
+	///         s.clear();
+	///     }
+	///
+	/// The body is the unit of work; the harness decides how often
+	/// to run it. Results (best and median nanoseconds per
+	/// iteration over several repetitions, best guards against
+	/// scheduling noise) print as one line per benchmark, so runs
+	/// can be diffed across commits.
+{
+public:
+	typedef void (*Function)();
+
+	Benchmark(const std::string& name, Function function);
+		/// Registers a benchmark under the given name.
+
+	static int runAll(const std::string& filter);
+		/// Runs all registered benchmarks whose name contains the
+		/// given filter substring (all, if the filter is empty),
+		/// printing one result line each. Returns the number of
+		/// benchmarks run.
+
+private:
+	struct Entry
+	{
+		std::string name;
+		Function function;
+	};
+
+	static void runOne(const Entry& entry);
+	static Poco::Int64 timeBatch(Function function, Poco::Int64 iterations);
+	static std::vector<Entry>& registry();
+};
+
+
+#define BENCHMARK(fn) \
+	static void fn(); \
+	static Benchmark fn##Registration(#fn, fn); \
+	static void fn()
+
+
+#endif // Benchmark_INCLUDED
@@ -0,0 +1,31 @@
+//
+// BenchmarkDriver.cpp
+//
+// Entry point of the microbenchmark suite. An optional argument
+// filters benchmarks by substring, e.g.
+//
+//     Foundation-benchmark format
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmark.h"
+#include <iostream>
+
+
+int main(int argc, char** argv)
+{
+	std::string filter;
+	if (argc > 1) filter = argv[1];
+	int count = Benchmark::runAll(filter);
+	if (count == 0)
+	{
+		std::cerr << "no benchmarks match \"" << filter << "\"" << std::endl;
+		return 1;
+	}
+	return 0;
+}
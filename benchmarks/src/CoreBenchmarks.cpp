@@ -0,0 +1,60 @@
+//
+// CoreBenchmarks.cpp
+//
+// Benchmarks for LRUCache, Base64 encoding and
+// UTF8Encoding::convert.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmark.h"
+#include "Poco/LRUCache.h"
+#include "Poco/Base64Encoder.h"
+#include "Poco/UTF8Encoding.h"
+#include <sstream>
+
+
+BENCHMARK(lruCacheHit)
+{
+	static Poco::LRUCache<int, std::string> cache(1024);
+	static bool filled = false;
+	if (!filled)
+	{
+		for (int i = 0; i < 1024; i++)
+			cache.add(i, "value");
+		filled = true;
+	}
+	Poco::SharedPtr<std::string> pValue = cache.get(511);
+}
+
+
+BENCHMARK(lruCacheAddEvict)
+{
+	static Poco::LRUCache<int, std::string> cache(256);
+	static int key = 0;
+	cache.add(key++, "value");
+}
+
+
+BENCHMARK(base64Encode4K)
+{
+	static std::string data(4096, 'x');
+	std::ostringstream ostr;
+	Poco::Base64Encoder encoder(ostr);
+	encoder.write(data.data(), (std::streamsize) data.size());
+	encoder.close();
+}
+
+
+BENCHMARK(utf8Convert)
+{
+	static Poco::UTF8Encoding encoding;
+	static const unsigned char euro[] = { 0xE2, 0x82, 0xAC, 0x00 };
+	int ch = encoding.convert(euro);
+	unsigned char buffer[4];
+	encoding.convert(ch, buffer, sizeof(buffer));
+}
@@ -0,0 +1,69 @@
+//
+// FormattingBenchmarks.cpp
+//
+// Benchmarks for Poco::format, NumberFormatter and
+// DateTimeFormatter.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmark.h"
+#include "Poco/Format.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/DateTime.h"
+
+
+using Poco::NumberFormatter;
+
+
+BENCHMARK(formatIntString)
+{
+	std::string s = Poco::format("%d: %s", 42, std::string("some value"));
+}
+
+
+BENCHMARK(formatvIntString)
+{
+	std::string s = Poco::formatv("%d: %s", 42, std::string("some value"));
+}
+
+
+BENCHMARK(numberFormatterInt)
+{
+	std::string s;
+	NumberFormatter::append(s, 1234567890);
+}
+
+
+BENCHMARK(numberFormatterFloat)
+{
+	std::string s;
+	NumberFormatter::append(s, 3.14159265358979);
+}
+
+
+BENCHMARK(numberFormatterHex)
+{
+	std::string s;
+	NumberFormatter::appendHex(s, 0xDEADBEEF);
+}
+
+
+BENCHMARK(dateTimeFormatterISO)
+{
+	static Poco::DateTime dt;
+	std::string s = Poco::DateTimeFormatter::format(dt, Poco::DateTimeFormat::ISO8601_FORMAT);
+}
+
+
+BENCHMARK(dateTimeFormatterHTTP)
+{
+	static Poco::DateTime dt;
+	std::string s = Poco::DateTimeFormatter::format(dt, Poco::DateTimeFormat::HTTP_FORMAT);
+}
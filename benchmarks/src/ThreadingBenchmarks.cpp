@@ -0,0 +1,50 @@
+//
+// ThreadingBenchmarks.cpp
+//
+// Benchmarks for NotificationQueue and ThreadPool scheduling.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmark.h"
+#include "Poco/NotificationQueue.h"
+#include "Poco/Notification.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Event.h"
+
+
+namespace
+{
+	class EmptyWork: public Poco::Runnable
+	{
+	public:
+		void run()
+		{
+			done.set();
+		}
+
+		Poco::Event done;
+	};
+}
+
+
+BENCHMARK(notificationQueueEnqueueDequeue)
+{
+	static Poco::NotificationQueue queue;
+	queue.enqueueNotification(new Poco::Notification);
+	Poco::Notification::Ptr pNf = queue.dequeueNotification();
+}
+
+
+BENCHMARK(threadPoolStartJoin)
+{
+	// round trip: schedule onto a pool thread and wait for it to run
+	static EmptyWork work;
+	Poco::ThreadPool::defaultPool().start(work);
+	work.done.wait();
+}